@@ -3,7 +3,7 @@
 #include "compiler/parser/parser.h"
 #include "util/macro.h"
 
-static ast *ast_new(const char *name_ref, char *source, lexer *lexer,
+static ast *ast_new(const char *name_ref, file_map source, lexer *lexer,
                     lexer_token_stream *token_stream, parser *parser,
                     ANTLR3_BASE_TREE *tree) {
   ast *self          = MALLOC(ast);
@@ -22,15 +22,15 @@ void ast_free(ast *self) {
     parser_free(self->parser);
     lexer_token_stream_free(self->token_stream);
     lexer_free(self->lexer);
-    free(self->source);
+    file_map_close(&self->source);
     free(self);
   }
 }
 
-// source is not const because it is consumed by (moved to) this function.
-// it is done because if source changes then ast won't be valid.
-ast *ast_build(const char *name, char *source) {
-  lexer              *lexer        = lexer_new(source, strlen(source), name);
+// source is consumed by (moved to) this function, because if source changes
+// then ast won't be valid.
+ast *ast_build(const char *name, file_map source) {
+  lexer              *lexer        = lexer_new(source.chars, source.len, name);
   lexer_token_stream *token_stream = lexer_token_stream_new(lexer);
   parser             *parser       = parser_new(token_stream);
   ANTLR3_BASE_TREE   *tree         = parser_parse(parser);
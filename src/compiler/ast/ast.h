@@ -3,18 +3,19 @@
 #include "compiler/exception/list.h"
 #include "compiler/lexer/lexer.h"
 #include "compiler/parser/parser.h"
+#include "util/file.h"
 #include <antlr3basetree.h>
 
 typedef struct ast_struct {
   const char         *name_ref;
-  char               *source;
+  file_map            source;
   lexer              *lexer;
   lexer_token_stream *token_stream;
   parser             *parser;
   ANTLR3_BASE_TREE   *tree;
 } ast;
 
-ast *ast_build(const char *name_ref, char *source);
+ast *ast_build(const char *name_ref, file_map source);
 void ast_free(ast *self);
 
 list_exception *ast_lexer_exceptions(ast *self);
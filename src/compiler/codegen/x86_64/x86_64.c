@@ -1,6 +1,7 @@
 #include "x86_64.h"
 #include "util/log.h"
 #include "util/macro.h"
+#include <string.h>
 
 static void cg_x86_64_symbol_free(cg_x86_64_symbol *self);
 static void cg_x86_64_data_free(cg_x86_64_data *self);
@@ -244,6 +245,62 @@ void cg_x86_64_op_free(cg_x86_64_op *self) {
   }
 }
 
+static int cg_x86_64_sym_cmp(const char *lsv, const char *rsv) {
+  return strcmp(lsv, rsv);
+}
+
+// returns 0 if operands are equal
+int cg_x86_64_op_cmp(const cg_x86_64_op *lsv, const cg_x86_64_op *rsv) {
+  if (lsv->kind != rsv->kind) {
+    return 1;
+  }
+
+  switch (lsv->kind) {
+    case CG_X86_64_MODE_REGISTER:
+      return lsv->reg.reg != rsv->reg.reg;
+    case CG_X86_64_MODE_DIRECT:
+      return cg_x86_64_sym_cmp(lsv->direct.sym_addr, rsv->direct.sym_addr);
+    case CG_X86_64_MODE_INDEXED:
+      return lsv->indexed.reg_index != rsv->indexed.reg_index ||
+             lsv->indexed.imm_multi != rsv->indexed.imm_multi ||
+             cg_x86_64_sym_cmp(lsv->indexed.sym_addr, rsv->indexed.sym_addr);
+    case CG_X86_64_MODE_INDIRECT:
+      return lsv->indirect.reg_base != rsv->indirect.reg_base;
+    case CG_X86_64_MODE_BASE_IMM:
+      return lsv->base_imm.reg_base != rsv->base_imm.reg_base ||
+             lsv->base_imm.imm_offset != rsv->base_imm.imm_offset;
+    case CG_X86_64_MODE_BASE_SYM:
+      return lsv->base_sym.reg_base != rsv->base_sym.reg_base ||
+             cg_x86_64_sym_cmp(lsv->base_sym.sym_addr, rsv->base_sym.sym_addr);
+    case CG_X86_64_MODE_IMMEDIATE:
+      return lsv->imm.imm_const != rsv->imm.imm_const;
+  }
+  error("unexpected op kind %d %p", lsv->kind, lsv);
+  return 1;
+}
+
+// returns 1 if register is read or written while accessing operand
+int cg_x86_64_op_has_reg(const cg_x86_64_op *self, cg_x86_64_reg reg) {
+  switch (self->kind) {
+    case CG_X86_64_MODE_REGISTER:
+      return self->reg.reg == reg;
+    case CG_X86_64_MODE_DIRECT:
+      return 0;
+    case CG_X86_64_MODE_INDEXED:
+      return self->indexed.reg_index == reg;
+    case CG_X86_64_MODE_INDIRECT:
+      return self->indirect.reg_base == reg;
+    case CG_X86_64_MODE_BASE_IMM:
+      return self->base_imm.reg_base == reg;
+    case CG_X86_64_MODE_BASE_SYM:
+      return self->base_sym.reg_base == reg;
+    case CG_X86_64_MODE_IMMEDIATE:
+      return 0;
+  }
+  error("unexpected op kind %d %p", self->kind, self);
+  return 1;
+}
+
 cg_x86_64_size cg_x86_64_mnem_size(cg_x86_64_mnem mnem) {
   switch (mnem) {
     case CG_X86_64_MNEM_PUSHQ:
@@ -272,9 +329,22 @@ cg_x86_64_size cg_x86_64_mnem_size(cg_x86_64_mnem mnem) {
       return CG_X86_64_SIZE_QUAD;
     case CG_X86_64_MNEM_TESTB:
       return CG_X86_64_SIZE_BYTE;
+    case CG_X86_64_MNEM_CMPB:
+      return CG_X86_64_SIZE_BYTE;
+    case CG_X86_64_MNEM_CMPL:
+      return CG_X86_64_SIZE_LONG;
+    case CG_X86_64_MNEM_CMPQ:
+      return CG_X86_64_SIZE_QUAD;
     case CG_X86_64_MNEM_JZ:
-      return CG_X86_64_SIZE_UNKNOWN;
     case CG_X86_64_MNEM_JNZ:
+    case CG_X86_64_MNEM_JL:
+    case CG_X86_64_MNEM_JLE:
+    case CG_X86_64_MNEM_JG:
+    case CG_X86_64_MNEM_JGE:
+    case CG_X86_64_MNEM_JB:
+    case CG_X86_64_MNEM_JBE:
+    case CG_X86_64_MNEM_JA:
+    case CG_X86_64_MNEM_JAE:
       return CG_X86_64_SIZE_UNKNOWN;
     case CG_X86_64_MNEM_JMP:
       return CG_X86_64_SIZE_UNKNOWN;
@@ -292,6 +362,24 @@ cg_x86_64_text *cg_x86_64_text_new(cg_x86_64_mnem     mnem,
   return self;
 }
 
+// returns 0 if instructions are equal
+int cg_x86_64_text_cmp(const cg_x86_64_text *lsv, const cg_x86_64_text *rsv) {
+  if (lsv->mnem != rsv->mnem) {
+    return 1;
+  }
+
+  list_cg_x86_64_op_it it_l = list_cg_x86_64_op_begin(lsv->operands);
+  list_cg_x86_64_op_it it_r = list_cg_x86_64_op_begin(rsv->operands);
+
+  for (; !END(it_l) && !END(it_r); NEXT(it_l), NEXT(it_r)) {
+    if (cg_x86_64_op_cmp(GET(it_l), GET(it_r))) {
+      return 1;
+    }
+  }
+
+  return !END(it_l) || !END(it_r);
+}
+
 static void cg_x86_64_text_free(cg_x86_64_text *self) {
   if (self) {
     list_cg_x86_64_op_free(self->operands);
@@ -302,11 +390,11 @@ static void cg_x86_64_text_free(cg_x86_64_text *self) {
 
 cg_x86_64 *cg_x86_64_new() {
   cg_x86_64 *self  = MALLOC(cg_x86_64);
-  self->data       = list_cg_x86_64_unit_new();
-  self->text       = list_cg_x86_64_unit_new();
-  self->debug_info = list_cg_x86_64_unit_new();
-  self->debug_line = list_cg_x86_64_unit_new();
-  self->debug_str  = list_cg_x86_64_unit_new();
+  self->data       = vec_cg_x86_64_unit_new();
+  self->text       = vec_cg_x86_64_unit_new();
+  self->debug_info = vec_cg_x86_64_unit_new();
+  self->debug_line = vec_cg_x86_64_unit_new();
+  self->debug_str  = vec_cg_x86_64_unit_new();
   return self;
 }
 
@@ -314,10 +402,10 @@ void cg_x86_64_free(cg_x86_64 *self) {
   if (!self) {
     return;
   }
-  list_cg_x86_64_unit_free(self->data);
-  list_cg_x86_64_unit_free(self->text);
-  list_cg_x86_64_unit_free(self->debug_info);
-  list_cg_x86_64_unit_free(self->debug_line);
-  list_cg_x86_64_unit_free(self->debug_str);
+  vec_cg_x86_64_unit_free(self->data);
+  vec_cg_x86_64_unit_free(self->text);
+  vec_cg_x86_64_unit_free(self->debug_info);
+  vec_cg_x86_64_unit_free(self->debug_line);
+  vec_cg_x86_64_unit_free(self->debug_str);
   free(self);
 }
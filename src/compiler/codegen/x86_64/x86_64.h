@@ -2,6 +2,7 @@
 
 #include "util/container_util.h"
 #include "util/list.h"
+#include "util/vec.h"
 
 typedef enum cg_x86_64_unit_kind_enum {
   CG_X86_64_UNIT_DATA,
@@ -18,9 +19,9 @@ void cg_x86_64_unit_free(cg_x86_64_unit *generic);
 static inline void container_delete_cg_x86_64_unit(void *data) {
   cg_x86_64_unit_free(data);
 }
-LIST_DECLARE_STATIC_INLINE(list_cg_x86_64_unit, cg_x86_64_unit,
-                           container_cmp_false, container_new_move,
-                           container_delete_cg_x86_64_unit);
+VEC_DECLARE_STATIC_INLINE(vec_cg_x86_64_unit, cg_x86_64_unit,
+                          container_cmp_false, container_new_move,
+                          container_delete_cg_x86_64_unit);
 
 typedef enum cg_x86_64_symbol_kind_enum {
   CG_X86_64_SYMBOL_DATA,
@@ -179,6 +180,8 @@ cg_x86_64_op *cg_x86_64_op_new_base_sym(char *sym_addr, cg_x86_64_reg reg_base);
 cg_x86_64_op *cg_x86_64_op_new_immediate(uint64_t imm_const);
 
 void cg_x86_64_op_free(cg_x86_64_op *self);
+int  cg_x86_64_op_cmp(const cg_x86_64_op *lsv, const cg_x86_64_op *rsv);
+int  cg_x86_64_op_has_reg(const cg_x86_64_op *self, cg_x86_64_reg reg);
 
 static inline void container_delete_cg_x86_64_op(void *data) {
   cg_x86_64_op_free(data);
@@ -200,8 +203,19 @@ typedef enum cg_x86_64_mnem_enum {
   CG_X86_64_MNEM_LEAQ,
   CG_X86_64_MNEM_CALL,
   CG_X86_64_MNEM_TESTB,
+  CG_X86_64_MNEM_CMPB,
+  CG_X86_64_MNEM_CMPL,
+  CG_X86_64_MNEM_CMPQ,
   CG_X86_64_MNEM_JZ,
   CG_X86_64_MNEM_JNZ,
+  CG_X86_64_MNEM_JL,  // signed
+  CG_X86_64_MNEM_JLE, // signed
+  CG_X86_64_MNEM_JG,  // signed
+  CG_X86_64_MNEM_JGE, // signed
+  CG_X86_64_MNEM_JB,  // unsigned
+  CG_X86_64_MNEM_JBE, // unsigned
+  CG_X86_64_MNEM_JA,  // unsigned
+  CG_X86_64_MNEM_JAE, // unsigned
   CG_X86_64_MNEM_JMP,
 } cg_x86_64_mnem;
 
@@ -225,13 +239,14 @@ typedef struct cg_x86_64_text_struct {
 
 cg_x86_64_text *cg_x86_64_text_new(cg_x86_64_mnem     mnem,
                                    list_cg_x86_64_op *operands);
+int cg_x86_64_text_cmp(const cg_x86_64_text *lsv, const cg_x86_64_text *rsv);
 
 typedef struct cg_x86_64_struct {
-  list_cg_x86_64_unit *data;
-  list_cg_x86_64_unit *text;
-  list_cg_x86_64_unit *debug_info;
-  list_cg_x86_64_unit *debug_line;
-  list_cg_x86_64_unit *debug_str;
+  vec_cg_x86_64_unit *data;
+  vec_cg_x86_64_unit *text;
+  vec_cg_x86_64_unit *debug_info;
+  vec_cg_x86_64_unit *debug_line;
+  vec_cg_x86_64_unit *debug_str;
 } cg_x86_64;
 
 cg_x86_64 *cg_x86_64_new();
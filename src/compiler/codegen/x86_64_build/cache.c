@@ -0,0 +1,513 @@
+#include "cache.h"
+
+#include "util/file.h"
+#include "util/hash.h"
+#include "util/macro.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// bumped when layout of entries changes
+#define CG_CACHE_FORMAT 1
+#define CG_CACHE_MAGIC "NXCG"
+#define CG_CACHE_NULL UINT64_MAX
+
+// compiler is identified by its executable, so rebuilt compiler doesn't reuse
+// code instantiated by previous one
+static uint64_t cg_cache_seed(void) {
+  uint64_t    hash = hash_uint64(HASH_SEED, CG_CACHE_FORMAT);
+  struct stat st;
+
+  if (stat("/proc/self/exe", &st) == 0) {
+    hash = hash_uint64(hash, st.st_ino);
+    hash = hash_uint64(hash, st.st_size);
+    hash = hash_uint64(hash, st.st_mtime);
+  } else {
+    hash = hash_chars(hash, __DATE__ " " __TIME__);
+  }
+  return hash;
+}
+
+cg_cache *cg_cache_new(const char *dir) {
+  if (dir_create_p(dir) != 0) {
+    return NULL;
+  }
+
+  cg_cache *self = MALLOC(cg_cache);
+  self->dir      = strdup(dir);
+  self->seed     = cg_cache_seed();
+  self->strings  = list_cg_cache_chars_new();
+  return self;
+}
+
+void cg_cache_free(cg_cache *self) {
+  if (self) {
+    list_cg_cache_chars_free(self->strings);
+    free(self->dir);
+    free(self);
+  }
+}
+
+static char *cg_cache_path(const cg_cache *self, uint64_t key,
+                           const char *suffix) {
+  char buf[64];
+  snprintf(buf, STRMAXLEN(buf), "%016lx%s", key, suffix);
+  return join_paths(self->dir, buf);
+}
+
+// WRITE
+static void cg_write_u64(FILE *file, uint64_t value) {
+  uint8_t bytes[sizeof(value)];
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    bytes[i] = (uint8_t)(value >> (i * 8));
+  }
+  fwrite(bytes, sizeof(bytes), 1, file);
+}
+
+static void cg_write_bytes(FILE *file, const void *data, size_t size) {
+  if (!data) {
+    cg_write_u64(file, CG_CACHE_NULL);
+    return;
+  }
+  cg_write_u64(file, size);
+  fwrite(data, size, 1, file);
+}
+
+static void cg_write_chars(FILE *file, const char *chars) {
+  cg_write_bytes(file, chars, chars ? strlen(chars) : 0);
+}
+
+static void cg_write_op(FILE *file, const cg_x86_64_op *op) {
+  cg_write_u64(file, op->kind);
+
+  switch (op->kind) {
+    case CG_X86_64_MODE_REGISTER:
+      cg_write_u64(file, op->reg.reg);
+      break;
+    case CG_X86_64_MODE_DIRECT:
+      cg_write_chars(file, op->direct.sym_addr);
+      break;
+    case CG_X86_64_MODE_INDEXED:
+      cg_write_chars(file, op->indexed.sym_addr);
+      cg_write_u64(file, op->indexed.reg_index);
+      cg_write_u64(file, op->indexed.imm_multi);
+      break;
+    case CG_X86_64_MODE_INDIRECT:
+      cg_write_u64(file, op->indirect.reg_base);
+      break;
+    case CG_X86_64_MODE_BASE_IMM:
+      cg_write_u64(file, op->base_imm.imm_offset);
+      cg_write_u64(file, op->base_imm.reg_base);
+      break;
+    case CG_X86_64_MODE_BASE_SYM:
+      cg_write_chars(file, op->base_sym.sym_addr);
+      cg_write_u64(file, op->base_sym.reg_base);
+      break;
+    case CG_X86_64_MODE_IMMEDIATE:
+      cg_write_u64(file, op->imm.imm_const);
+      break;
+  }
+}
+
+static void cg_write_data(FILE *file, const cg_x86_64_data *data) {
+  cg_write_u64(file, data->kind);
+
+  switch (data->kind) {
+    case CG_X86_64_DATA_BYTE:
+      cg_write_u64(file, data->data_byte);
+      break;
+    case CG_X86_64_DATA_WORD:
+      cg_write_u64(file, data->data_word);
+      break;
+    case CG_X86_64_DATA_LONG:
+      cg_write_u64(file, data->data_long);
+      break;
+    case CG_X86_64_DATA_QUAD:
+      cg_write_u64(file, data->data_quad);
+      break;
+    case CG_X86_64_DATA_ASCII:
+      cg_write_chars(file, (const char *)data->data_ascii);
+      break;
+    case CG_X86_64_DATA_BYTES:
+      cg_write_bytes(file, data->data_bytes, data->data_len);
+      break;
+    case CG_X86_64_DATA_SYMBOL:
+      cg_write_chars(file, data->data_symbol);
+      break;
+  }
+}
+
+static void cg_write_units(FILE *file, const vec_cg_x86_64_unit *units) {
+  cg_write_u64(file, vec_cg_x86_64_unit_size(units));
+
+  for (vec_cg_x86_64_unit_it it = vec_cg_x86_64_unit_begin(units); !END(it);
+       NEXT(it)) {
+    const cg_x86_64_unit *unit = GET(it);
+
+    cg_write_u64(file, unit->kind);
+    switch (unit->kind) {
+      case CG_X86_64_UNIT_DATA:
+        cg_write_data(file, (const cg_x86_64_data *)unit);
+        break;
+      case CG_X86_64_UNIT_TEXT: {
+        const cg_x86_64_text *text = (const cg_x86_64_text *)unit;
+        cg_write_u64(file, text->mnem);
+        cg_write_u64(file, list_cg_x86_64_op_size(text->operands));
+        for (list_cg_x86_64_op_it it_o =
+                 list_cg_x86_64_op_begin(text->operands);
+             !END(it_o); NEXT(it_o)) {
+          cg_write_op(file, GET(it_o));
+        }
+        break;
+      }
+      case CG_X86_64_UNIT_SYMBOL: {
+        const cg_x86_64_symbol *symbol = (const cg_x86_64_symbol *)unit;
+        cg_write_u64(file, symbol->kind);
+        cg_write_chars(file, symbol->name);
+        break;
+      }
+    }
+  }
+}
+
+static void cg_write_debug(FILE *file, const cg_debug *debug) {
+  cg_write_u64(file, list_cg_debug_sub_size(debug->subroutines));
+
+  for (list_cg_debug_sub_it it = list_cg_debug_sub_begin(debug->subroutines);
+       !END(it); NEXT(it)) {
+    const cg_debug_sub *sub = GET(it);
+
+    cg_write_chars(file, sub->sym_start_ref);
+    cg_write_chars(file, sub->sym_end_ref);
+    cg_write_chars(file, sub->name_ref);
+
+    cg_write_u64(file, list_cg_debug_param_size(sub->params));
+    for (list_cg_debug_param_it it_p = list_cg_debug_param_begin(sub->params);
+         !END(it_p); NEXT(it_p)) {
+      cg_write_u64(file, GET(it_p)->rbp_offset);
+      cg_write_chars(file, GET(it_p)->name_ref);
+    }
+
+    cg_write_u64(file, list_cg_debug_var_size(sub->vars));
+    for (list_cg_debug_var_it it_v = list_cg_debug_var_begin(sub->vars);
+         !END(it_v); NEXT(it_v)) {
+      cg_write_u64(file, GET(it_v)->rbp_offset);
+      cg_write_chars(file, GET(it_v)->name_ref);
+    }
+  }
+
+  cg_write_u64(file, list_cg_debug_line_size(debug->lines));
+
+  for (list_cg_debug_line_it it = list_cg_debug_line_begin(debug->lines);
+       !END(it); NEXT(it)) {
+    const cg_debug_line *line = GET(it);
+
+    cg_write_chars(file, line->sym_address_ref);
+    cg_write_chars(file, line->file_ref);
+    cg_write_u64(file, line->line);
+  }
+}
+
+// entry is written to temporary file and renamed, so readers never see
+// partially written entries
+void cg_cache_store(cg_cache *self, uint64_t key, const cg_x86_64 *code,
+                    const cg_debug *debug) {
+  char  suffix[32];
+  snprintf(suffix, STRMAXLEN(suffix), ".%d.tmp", getpid());
+  char *path_tmp = cg_cache_path(self, key, suffix);
+  char *path     = cg_cache_path(self, key, ".cg");
+
+  FILE *file = fopen(path_tmp, "wb");
+  if (file) {
+    fwrite(CG_CACHE_MAGIC, STRMAXLEN(CG_CACHE_MAGIC), 1, file);
+    cg_write_u64(file, key);
+    cg_write_units(file, code->data);
+    cg_write_units(file, code->text);
+    cg_write_debug(file, debug);
+
+    int failed = ferror(file);
+    if (fclose(file) != 0 || failed || rename(path_tmp, path) != 0) {
+      remove(path_tmp);
+    }
+  }
+
+  free(path);
+  free(path_tmp);
+}
+
+// READ
+typedef struct cg_reader_struct {
+  cg_cache      *cache;
+  const uint8_t *data;
+  size_t         size;
+  size_t         pos;
+  int            ok;
+} cg_reader;
+
+static uint64_t cg_read_u64(cg_reader *reader) {
+  uint64_t value = 0;
+
+  if (!reader->ok || reader->size - reader->pos < sizeof(value)) {
+    reader->ok = 0;
+    return 0;
+  }
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    value |= (uint64_t)reader->data[reader->pos++] << (i * 8);
+  }
+  return value;
+}
+
+// result is terminated, size is stored in len if present
+static uint8_t *cg_read_bytes(cg_reader *reader, size_t *len) {
+  uint64_t size = cg_read_u64(reader);
+
+  if (!reader->ok || size == CG_CACHE_NULL) {
+    return NULL;
+  }
+  if (reader->size - reader->pos < size) {
+    reader->ok = 0;
+    return NULL;
+  }
+
+  uint8_t *bytes = malloc(size + 1);
+  memcpy(bytes, reader->data + reader->pos, size);
+  bytes[size] = '\0';
+  reader->pos += size;
+
+  if (len) {
+    *len = size;
+  }
+  return bytes;
+}
+
+static char *cg_read_chars(cg_reader *reader) {
+  return (char *)cg_read_bytes(reader, NULL);
+}
+
+// string is owned by cache
+static const char *cg_read_chars_ref(cg_reader *reader) {
+  char *chars = cg_read_chars(reader);
+  if (chars) {
+    list_cg_cache_chars_push_back(reader->cache->strings, chars);
+  }
+  return chars;
+}
+
+static cg_x86_64_op *cg_read_op(cg_reader *reader) {
+  uint64_t kind = cg_read_u64(reader);
+  uint64_t value;
+  char    *sym;
+
+  switch (kind) {
+    case CG_X86_64_MODE_REGISTER:
+      return cg_x86_64_op_new_register(cg_read_u64(reader));
+    case CG_X86_64_MODE_DIRECT:
+      return cg_x86_64_op_new_direct(cg_read_chars(reader));
+    case CG_X86_64_MODE_INDEXED:
+      sym   = cg_read_chars(reader);
+      value = cg_read_u64(reader);
+      return cg_x86_64_op_new_indexed(sym, value, cg_read_u64(reader));
+    case CG_X86_64_MODE_INDIRECT:
+      return cg_x86_64_op_new_indirect(cg_read_u64(reader));
+    case CG_X86_64_MODE_BASE_IMM:
+      value = cg_read_u64(reader);
+      return cg_x86_64_op_new_base_imm(value, cg_read_u64(reader));
+    case CG_X86_64_MODE_BASE_SYM:
+      sym = cg_read_chars(reader);
+      return cg_x86_64_op_new_base_sym(sym, cg_read_u64(reader));
+    case CG_X86_64_MODE_IMMEDIATE:
+      return cg_x86_64_op_new_immediate(cg_read_u64(reader));
+  }
+  reader->ok = 0;
+  return NULL;
+}
+
+static cg_x86_64_data *cg_read_data(cg_reader *reader) {
+  uint64_t kind = cg_read_u64(reader);
+  uint8_t *bytes;
+  size_t   len = 0;
+
+  switch (kind) {
+    case CG_X86_64_DATA_BYTE:
+      return cg_x86_64_data_new_byte(cg_read_u64(reader));
+    case CG_X86_64_DATA_WORD:
+      return cg_x86_64_data_new_word(cg_read_u64(reader));
+    case CG_X86_64_DATA_LONG:
+      return cg_x86_64_data_new_long(cg_read_u64(reader));
+    case CG_X86_64_DATA_QUAD:
+      return cg_x86_64_data_new_quad(cg_read_u64(reader));
+    case CG_X86_64_DATA_ASCII:
+      return cg_x86_64_data_new_ascii(cg_read_bytes(reader, NULL));
+    case CG_X86_64_DATA_BYTES:
+      bytes = cg_read_bytes(reader, &len);
+      return cg_x86_64_data_new_bytes(len, bytes);
+    case CG_X86_64_DATA_SYMBOL:
+      return cg_x86_64_data_new_symbol(cg_read_chars(reader));
+  }
+  reader->ok = 0;
+  return NULL;
+}
+
+static cg_x86_64_unit *cg_read_unit(cg_reader *reader) {
+  uint64_t kind = cg_read_u64(reader);
+
+  switch (kind) {
+    case CG_X86_64_UNIT_DATA:
+      return (cg_x86_64_unit *)cg_read_data(reader);
+    case CG_X86_64_UNIT_TEXT: {
+      uint64_t           mnem     = cg_read_u64(reader);
+      uint64_t           cnt      = cg_read_u64(reader);
+      list_cg_x86_64_op *operands = list_cg_x86_64_op_new();
+      for (uint64_t i = 0; i < cnt && reader->ok; ++i) {
+        cg_x86_64_op *op = cg_read_op(reader);
+        if (op) {
+          list_cg_x86_64_op_push_back(operands, op);
+        }
+      }
+      return (cg_x86_64_unit *)cg_x86_64_text_new(mnem, operands);
+    }
+    case CG_X86_64_UNIT_SYMBOL: {
+      uint64_t symbol_kind = cg_read_u64(reader);
+      char    *name        = cg_read_chars(reader);
+      switch (symbol_kind) {
+        case CG_X86_64_SYMBOL_DATA:
+          return (cg_x86_64_unit *)cg_x86_64_symbol_new_data(name);
+        case CG_X86_64_SYMBOL_DATA_LN:
+          return (cg_x86_64_unit *)cg_x86_64_symbol_new_data_ln(name);
+        case CG_X86_64_SYMBOL_TEXT:
+          return (cg_x86_64_unit *)cg_x86_64_symbol_new_text(name);
+        case CG_X86_64_SYMBOL_EXTERN:
+          return (cg_x86_64_unit *)cg_x86_64_symbol_new_extern(name);
+        case CG_X86_64_SYMBOL_GLOBAL:
+          return (cg_x86_64_unit *)cg_x86_64_symbol_new_global(name);
+      }
+      free(name);
+      break;
+    }
+  }
+  reader->ok = 0;
+  return NULL;
+}
+
+static void cg_read_units(cg_reader *reader, vec_cg_x86_64_unit *units) {
+  uint64_t cnt = cg_read_u64(reader);
+
+  for (uint64_t i = 0; i < cnt && reader->ok; ++i) {
+    cg_x86_64_unit *unit = cg_read_unit(reader);
+    if (unit) {
+      vec_cg_x86_64_unit_push_back(units, unit);
+    }
+  }
+}
+
+static void cg_read_debug(cg_reader *reader, cg_debug *debug) {
+  uint64_t subs_cnt = cg_read_u64(reader);
+
+  for (uint64_t i = 0; i < subs_cnt && reader->ok; ++i) {
+    const char   *sym_start = cg_read_chars_ref(reader);
+    const char   *sym_end   = cg_read_chars_ref(reader);
+    const char   *name      = cg_read_chars_ref(reader);
+    cg_debug_sub *sub       = cg_debug_sub_new(sym_start, sym_end, name);
+    list_cg_debug_sub_push_back(debug->subroutines, sub);
+
+    uint64_t params_cnt = cg_read_u64(reader);
+    for (uint64_t j = 0; j < params_cnt && reader->ok; ++j) {
+      uint64_t offset = cg_read_u64(reader);
+      list_cg_debug_param_push_back(
+          sub->params, cg_debug_param_new(offset, cg_read_chars_ref(reader)));
+    }
+
+    uint64_t vars_cnt = cg_read_u64(reader);
+    for (uint64_t j = 0; j < vars_cnt && reader->ok; ++j) {
+      uint64_t offset = cg_read_u64(reader);
+      list_cg_debug_var_push_back(
+          sub->vars, cg_debug_var_new(offset, cg_read_chars_ref(reader)));
+    }
+  }
+
+  uint64_t lines_cnt = cg_read_u64(reader);
+
+  for (uint64_t i = 0; i < lines_cnt && reader->ok; ++i) {
+    const char *sym  = cg_read_chars_ref(reader);
+    const char *file = cg_read_chars_ref(reader);
+    list_cg_debug_line_push_back(
+        debug->lines, cg_debug_line_new(sym, file, cg_read_u64(reader)));
+  }
+}
+
+static uint8_t *cg_cache_read_file(const char *path, size_t *size) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    return NULL;
+  }
+
+  uint8_t *data = NULL;
+  if (fseek(file, 0, SEEK_END) == 0) {
+    long length = ftell(file);
+    if (length >= 0 && fseek(file, 0, SEEK_SET) == 0) {
+      data = malloc(length ? length : 1);
+      if (fread(data, 1, length, file) != (size_t)length) {
+        free(data);
+        data = NULL;
+      }
+      *size = length;
+    }
+  }
+
+  fclose(file);
+  return data;
+}
+
+int cg_cache_load(cg_cache *self, uint64_t key, cg_x86_64 *code,
+                  cg_debug *debug) {
+  char    *path = cg_cache_path(self, key, ".cg");
+  size_t   size = 0;
+  uint8_t *data = cg_cache_read_file(path, &size);
+  free(path);
+
+  cg_reader reader = {
+      .cache = self,
+      .data  = data,
+      .size  = size,
+      .pos   = 0,
+      .ok    = data != NULL,
+  };
+
+  size_t magic_len = STRMAXLEN(CG_CACHE_MAGIC);
+  if (reader.ok && (size < magic_len ||
+                    memcmp(data, CG_CACHE_MAGIC, magic_len) != 0)) {
+    reader.ok = 0;
+  }
+  reader.pos = magic_len;
+  if (reader.ok && cg_read_u64(&reader) != key) {
+    reader.ok = 0;
+  }
+
+  // read into fragment first, damaged entry is dropped as a whole
+  cg_x86_64 *fragment       = cg_x86_64_new();
+  cg_debug  *fragment_debug = cg_debug_new(debug->level);
+
+  if (reader.ok) {
+    cg_read_units(&reader, fragment->data);
+    cg_read_units(&reader, fragment->text);
+    cg_read_debug(&reader, fragment_debug);
+  }
+  if (reader.ok && reader.pos != reader.size) {
+    reader.ok = 0;
+  }
+
+  if (reader.ok) {
+    vec_cg_x86_64_unit_splice_back(code->data, fragment->data);
+    vec_cg_x86_64_unit_splice_back(code->text, fragment->text);
+    list_cg_debug_sub_splice_back(debug->subroutines,
+                                  fragment_debug->subroutines);
+    list_cg_debug_line_splice_back(debug->lines, fragment_debug->lines);
+  }
+
+  cg_x86_64_free(fragment);
+  cg_debug_free(fragment_debug);
+  free(data);
+
+  return reader.ok;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "compiler/codegen/x86_64/x86_64.h"
+#include "compiler/codegen/x86_64_build/debug.h"
+#include "util/container_util.h"
+#include "util/list.h"
+
+LIST_DECLARE_STATIC_INLINE(list_cg_cache_chars, char, container_cmp_chars,
+                           container_new_move, container_delete_chars);
+
+// instantiated code of subroutines stored in directory, entry per key
+typedef struct cg_cache_struct {
+  char                *dir;
+  uint64_t             seed;    // identifies compiler, keys start with it
+  list_cg_cache_chars *strings; // referenced by loaded debug info
+} cg_cache;
+
+// NULL if directory can't be created
+cg_cache *cg_cache_new(const char *dir);
+void      cg_cache_free(cg_cache *self);
+
+// appends data, text and debug info of entry to code and debug, returns 0 if
+// entry doesn't exist or is damaged (nothing is appended then)
+int  cg_cache_load(cg_cache *self, uint64_t key, cg_x86_64 *code,
+                   cg_debug *debug);
+// only data and text of code are stored
+void cg_cache_store(cg_cache *self, uint64_t key, const cg_x86_64 *code,
+                    const cg_debug *debug);
@@ -9,6 +9,7 @@ cg_value_meta *cg_value_meta_new(const mir_value *value_ref, int64_t offset,
   self->value_ref     = value_ref;
   self->offset        = offset;
   self->is_ptr        = is_ptr;
+  self->reads         = 0;
   return self;
 }
 
@@ -18,6 +19,20 @@ void cg_value_meta_free(cg_value_meta *self) {
   }
 }
 
+// stmt_frame
+cg_stmt_frame *cg_stmt_frame_new(const mir_stmt *stmt_ref, int64_t offset) {
+  cg_stmt_frame *self = MALLOC(cg_stmt_frame);
+  self->stmt_ref      = stmt_ref;
+  self->offset        = offset;
+  return self;
+}
+
+void cg_stmt_frame_free(cg_stmt_frame *self) {
+  if (self) {
+    free(self);
+  }
+}
+
 // mir_sym
 cg_mir_sym *cg_mir_sym_new(const void *mir_ref, const char *sym_ref) {
   cg_mir_sym *self = MALLOC(cg_mir_sym);
@@ -79,3 +94,19 @@ void cg_class_sym_free(cg_class_sym *self) {
     free(self);
   }
 }
+
+// fold_sym
+cg_fold_sym *cg_fold_sym_new(char *sym, char *sym_to) {
+  cg_fold_sym *self = MALLOC(cg_fold_sym);
+  self->sym         = sym;
+  self->sym_to      = sym_to;
+  return self;
+}
+
+void cg_fold_sym_free(cg_fold_sym *self) {
+  if (self) {
+    free(self->sym);
+    free(self->sym_to);
+    free(self);
+  }
+}
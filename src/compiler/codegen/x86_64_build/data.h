@@ -6,6 +6,7 @@ typedef struct cg_value_meta_struct {
   const mir_value *value_ref;
   int64_t          offset; // of stack relative to rbp
   int              is_ptr; // is pointer of actual value
+  size_t           reads;  // by stmts and bb conditions of subroutine
 } cg_value_meta;
 
 cg_value_meta *cg_value_meta_new(const mir_value *value_ref, int64_t offset,
@@ -30,6 +31,33 @@ HASHSET_DECLARE_STATIC_INLINE(hashset_cg_value_meta, cg_value_meta,
                               container_delete_cg_value_meta,
                               container_hash_cg_value_meta);
 
+// stmt_frame (data of make placed in frame)
+typedef struct cg_stmt_frame_struct {
+  const mir_stmt *stmt_ref;
+  int64_t         offset; // of stack relative to rbp
+} cg_stmt_frame;
+
+cg_stmt_frame *cg_stmt_frame_new(const mir_stmt *stmt_ref, int64_t offset);
+void           cg_stmt_frame_free(cg_stmt_frame *self);
+
+static inline int container_cmp_cg_stmt_frame(const void *lsv,
+                                              const void *rsv) {
+  const cg_stmt_frame *l = lsv;
+  const cg_stmt_frame *r = rsv;
+  return container_cmp_ptr(l->stmt_ref, r->stmt_ref);
+}
+static inline uint64_t container_hash_cg_stmt_frame(const void *lsv) {
+  const cg_stmt_frame *l = lsv;
+  return container_hash_ptr(l->stmt_ref);
+}
+static inline void container_delete_cg_stmt_frame(void *data) {
+  return cg_stmt_frame_free(data);
+}
+HASHSET_DECLARE_STATIC_INLINE(hashset_cg_stmt_frame, cg_stmt_frame,
+                              container_cmp_cg_stmt_frame, container_new_move,
+                              container_delete_cg_stmt_frame,
+                              container_hash_cg_stmt_frame);
+
 // mir_sym (to find symbols by mir pointer)
 typedef struct cg_mir_sym_struct {
   union {
@@ -121,3 +149,29 @@ static inline void container_delete_cg_class_sym(void *data) {
 }
 LIST_DECLARE_STATIC_INLINE(list_cg_class_sym, cg_class_sym, container_cmp_false,
                            container_new_move, container_delete_cg_class_sym);
+
+// fold_sym (folded symbol to symbol of body it is folded into)
+typedef struct cg_fold_sym_struct {
+  char *sym;
+  char *sym_to;
+} cg_fold_sym;
+
+cg_fold_sym *cg_fold_sym_new(char *sym, char *sym_to);
+void         cg_fold_sym_free(cg_fold_sym *self);
+
+static inline int container_cmp_cg_fold_sym(const void *lsv, const void *rsv) {
+  const cg_fold_sym *l = lsv;
+  const cg_fold_sym *r = rsv;
+  return container_cmp_chars(l->sym, r->sym);
+}
+static inline uint64_t container_hash_cg_fold_sym(const void *lsv) {
+  const cg_fold_sym *l = lsv;
+  return container_hash_chars(l->sym);
+}
+static inline void container_delete_cg_fold_sym(void *data) {
+  return cg_fold_sym_free(data);
+}
+HASHSET_DECLARE_STATIC_INLINE(hashset_cg_fold_sym, cg_fold_sym,
+                              container_cmp_cg_fold_sym, container_new_move,
+                              container_delete_cg_fold_sym,
+                              container_hash_cg_fold_sym);
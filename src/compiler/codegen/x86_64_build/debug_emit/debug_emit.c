@@ -97,15 +97,15 @@ static void cg_ctx_deinit(cg_ctx *ctx) {
 }
 
 static void cg_ctx_info_push(cg_ctx *ctx, void *unit) {
-  list_cg_x86_64_unit_push_back(ctx->code->debug_info, unit);
+  vec_cg_x86_64_unit_push_back(ctx->code->debug_info, unit);
 }
 
 static void cg_ctx_line_push(cg_ctx *ctx, void *unit) {
-  list_cg_x86_64_unit_push_back(ctx->code->debug_line, unit);
+  vec_cg_x86_64_unit_push_back(ctx->code->debug_line, unit);
 }
 
 static void cg_ctx_str_push(cg_ctx *ctx, void *unit) {
-  list_cg_x86_64_unit_push_back(ctx->code->debug_str, unit);
+  vec_cg_x86_64_unit_push_back(ctx->code->debug_str, unit);
 }
 
 cg_debug_emit_result cg_debug_emit(cg_x86_64 *code, const cg_debug *debug) {
@@ -1,10 +1,215 @@
 #include "inst.h"
 #include "compiler/codegen/exception.h"
 #include "compiler/codegen/x86_64/x86_64.h"
+#include "compiler/mir/hash.h"
+#include "util/hash.h"
+#include "util/log.h"
 #include "util/macro.h"
+#include "util/parallel.h"
 #include <string.h>
 
-cg_inst_result cg_inst(cg_x86_64 *code, const mir *mir) {
+typedef enum cg_inst_job_kind_enum {
+  CG_INST_JOB_SUB,
+  CG_INST_JOB_MAIN,
+  CG_INST_JOB_CLASS_INIT,
+  CG_INST_JOB_CLASS_METHOD,
+} cg_inst_job_kind;
+
+// subroutine is instantiated into its own code, jobs are merged in order
+typedef struct cg_inst_job_struct {
+  cg_inst_job_kind kind;
+  union {
+    const mir_subroutine *sub_ref;
+    const mir_class      *class_ref;
+  };
+  char           *sym;  // moved to code when job is run
+  cg_x86_64      *lits; // data of string literals, placed before code
+  cg_x86_64      *code;
+  cg_debug       *debug;
+  list_exception *exceptions;
+  uint64_t        key;    // of cache entry
+  int             cached; // code is loaded from cache and job isn't run
+} cg_inst_job;
+
+static void cg_inst_job_init(cg_inst_job *job, cg_inst_job_kind kind,
+                             const void *ref, char *sym,
+                             cg_debug_level level) {
+  job->kind       = kind;
+  job->sub_ref    = ref;
+  job->sym        = sym;
+  job->lits       = cg_x86_64_new();
+  job->code       = cg_x86_64_new();
+  job->debug      = cg_debug_new(level);
+  job->exceptions = list_exception_new();
+  job->key        = 0;
+  job->cached     = 0;
+}
+
+// job is identified by its content, symbols of other jobs and symbols of
+// declared subroutines (env), and symbols of literals it uses (added while
+// indexing them)
+static uint64_t cg_inst_job_key(const cg_inst_job *job, uint64_t env,
+                                cg_debug_level level) {
+  uint64_t hash = hash_uint64(env, job->kind);
+  hash          = hash_chars(hash, job->sym);
+  hash          = hash_uint64(hash, level);
+
+  if (job->kind == CG_INST_JOB_CLASS_INIT) {
+    return mir_class_hash(hash, job->class_ref);
+  }
+  return mir_subroutine_hash(hash, job->sub_ref);
+}
+
+static uint64_t cg_inst_env_key(uint64_t seed, const mir *mir,
+                                const cg_inst_job *jobs, size_t jobs_cnt) {
+  uint64_t hash = seed;
+
+  for (list_mir_subroutine_it it =
+           list_mir_subroutine_begin(mir->declared_subs);
+       !END(it); NEXT(it)) {
+    hash = mir_subroutine_decl_hash(hash, GET(it));
+  }
+
+  for (size_t i = 0; i < jobs_cnt; ++i) {
+    const cg_inst_job *job = &jobs[i];
+
+    hash = hash_uint64(hash, job->kind);
+    hash = hash_chars(hash, job->sym);
+    if (job->kind != CG_INST_JOB_CLASS_INIT) {
+      hash = mir_subroutine_decl_hash(hash, job->sub_ref);
+    }
+  }
+  return hash;
+}
+
+// string literals are indexed before jobs are run, so index is only read by
+// them and literal numbering is the same as in serial instantiation
+static uint64_t cg_inst_job_lits(cg_ctx *ctx, cg_inst_job *job,
+                                 uint64_t hash) {
+  if (job->kind == CG_INST_JOB_CLASS_INIT) {
+    return hash;
+  }
+
+  const mir_subroutine *sub = job->sub_ref;
+  if (sub->kind != MIR_SUBROUTINE_DEFINED ||
+      (sub->spec & MIR_SUBROUTINE_SPEC_EXTERN)) {
+    return hash;
+  }
+
+  cg_x86_64 *code = ctx->code;
+  ctx->code       = job->lits;
+  hash            = cg_inst_bbs_lits(ctx, sub->defined.bbs, hash);
+  ctx->code       = code;
+  return hash;
+}
+
+typedef struct cg_inst_jobs_struct {
+  const cg_ctx *parent;
+  cg_inst_job  *jobs;
+} cg_inst_jobs;
+
+static void cg_inst_job_run(void *arg, size_t idx) {
+  cg_inst_jobs *jobs = arg;
+  cg_inst_job  *job  = &jobs->jobs[idx];
+
+  if (job->cached) {
+    return;
+  }
+
+  cg_ctx ctx;
+  cg_ctx_init_job(&ctx, jobs->parent, job->code, job->debug, job->exceptions);
+
+  switch (job->kind) {
+    case CG_INST_JOB_SUB:
+      cg_inst_sub_def(&ctx, job->sub_ref, job->sym);
+      break;
+    case CG_INST_JOB_MAIN:
+      cg_inst_sub_main(&ctx, job->sub_ref, job->sym);
+      break;
+    case CG_INST_JOB_CLASS_INIT:
+      cg_inst_class_init(&ctx, job->class_ref, job->sym);
+      break;
+    case CG_INST_JOB_CLASS_METHOD:
+      cg_inst_class_method(&ctx, job->sub_ref, job->sym);
+      break;
+  }
+  job->sym = NULL;
+
+  cg_ctx_deinit_job(&ctx);
+}
+
+// jobs with exceptions aren't stored, so they are reported on each build
+static void cg_inst_job_store(cg_inst_job *job, cg_cache *cache) {
+  if (cache && !job->cached && list_exception_empty(job->exceptions)) {
+    cg_cache_store(cache, job->key, job->code, job->debug);
+  }
+}
+
+static void cg_inst_job_merge(cg_ctx *ctx, cg_inst_job *job) {
+  vec_cg_x86_64_unit_splice_back(ctx->code->data, job->lits->data);
+  vec_cg_x86_64_unit_splice_back(ctx->code->data, job->code->data);
+  vec_cg_x86_64_unit_splice_back(ctx->code->text, job->code->text);
+  list_cg_debug_sub_splice_back(ctx->debug->subroutines,
+                                job->debug->subroutines);
+  list_cg_debug_line_splice_back(ctx->debug->lines, job->debug->lines);
+  list_exception_extend(ctx->exceptions, job->exceptions);
+
+  cg_x86_64_free(job->lits);
+  cg_x86_64_free(job->code);
+  cg_debug_free(job->debug);
+  free(job->sym);
+}
+
+// folded job keeps only string literals indexed by it, global symbol of
+// subroutine stays defined and jumps to body it is folded into
+static void cg_inst_job_merge_folded(cg_ctx *ctx, cg_inst_job *job,
+                                     hashset_cg_fold_sym *syms) {
+  vec_cg_x86_64_unit_splice_back(ctx->code->data, job->lits->data);
+
+  if (job->kind == CG_INST_JOB_SUB) {
+    const char *sym = cg_ctx_mir_sym_find_sub(ctx, job->sub_ref);
+
+    hashset_cg_fold_sym_it it =
+        hashset_cg_fold_sym_find(syms, &(cg_fold_sym){.sym = (char *)sym});
+
+    cg_ctx_text_push_back(ctx, cg_x86_64_symbol_new_text(strdup(sym)));
+    cg_ctx_text_emplace_back_text(
+        ctx, CG_X86_64_MNEM_JMP,
+        cg_x86_64_op_new_direct(strdup(GET(it)->sym_to)), NULL);
+  }
+  list_exception_extend(ctx->exceptions, job->exceptions);
+
+  cg_x86_64_free(job->lits);
+  cg_x86_64_free(job->code);
+  cg_debug_free(job->debug);
+  free(job->sym);
+}
+
+// main isn't folded to stay entry of program, jobs with exceptions to report
+// them for each subroutine
+static size_t *cg_inst_jobs_fold(const cg_inst_job *jobs, size_t jobs_cnt,
+                                 hashset_cg_fold_sym **syms) {
+  cg_fold_body *bodies = MALLOCN(cg_fold_body, jobs_cnt);
+
+  for (size_t i = 0; i < jobs_cnt; ++i) {
+    const cg_inst_job *job = &jobs[i];
+
+    bodies[i] = (cg_fold_body){
+        .code_ref = job->code,
+        .lits_ref = job->lits,
+        .foldable = job->kind != CG_INST_JOB_MAIN &&
+                    list_exception_empty(job->exceptions),
+    };
+  }
+
+  size_t *folded = cg_fold(bodies, jobs_cnt);
+  *syms          = cg_fold_syms(bodies, folded, jobs_cnt);
+  free(bodies);
+  return folded;
+}
+
+cg_inst_result cg_inst(cg_x86_64 *code, const mir *mir, int opt_level,
+                       size_t jobs, cg_cache *cache) {
   cg_inst_result result = {
       .debug      = cg_debug_new(CG_CTX_DEBUG_LEVEL_ENABLED),
       .exceptions = list_exception_new(),
@@ -112,23 +317,104 @@ cg_inst_result cg_inst(cg_x86_64 *code, const mir *mir) {
     cg_ctx_text_push_back(&ctx, cg_x86_64_symbol_new_global(strdup(sub_sym)));
   }
 
-  // instantiate defined_subs
+  // jobs in order of output: defined_subs, class initializers and methods
+  size_t jobs_cnt = list_mir_subroutine_size(mir->defined_subs) +
+                    list_cg_class_sym_size(class_inits) +
+                    list_cg_method_sym_size(class_methods);
+
+  cg_inst_job *jobs_arr = MALLOCN(cg_inst_job, jobs_cnt);
+  size_t       job_idx  = 0;
+
   for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
        !END(it); NEXT(it)) {
     const mir_subroutine *sub     = GET(it);
     const char           *sub_sym = cg_ctx_mir_sym_find_sub(&ctx, sub);
 
     int is_main = !strcmp(sub->symbol_ref->name, "main");
-    if (is_main) {
-      cg_inst_sub_main(&ctx, sub, strdup(sub_sym));
+    cg_inst_job_init(&jobs_arr[job_idx++],
+                     is_main ? CG_INST_JOB_MAIN : CG_INST_JOB_SUB, sub,
+                     strdup(sub_sym), result.debug->level);
+  }
+
+  while (!list_cg_class_sym_empty(class_inits)) {
+    cg_class_sym *class_sym = list_cg_class_sym_pop_front(class_inits);
+    cg_inst_job_init(&jobs_arr[job_idx++], CG_INST_JOB_CLASS_INIT,
+                     class_sym->class_ref, class_sym->sym,
+                     result.debug->level);
+    class_sym->sym = NULL;
+    cg_class_sym_free(class_sym);
+  }
+  list_cg_class_sym_free(class_inits);
+
+  while (!list_cg_method_sym_empty(class_methods)) {
+    cg_method_sym *method_sym = list_cg_method_sym_pop_front(class_methods);
+    cg_inst_job_init(&jobs_arr[job_idx++], CG_INST_JOB_CLASS_METHOD,
+                     method_sym->method_ref, method_sym->sym,
+                     result.debug->level);
+    method_sym->sym = NULL;
+    cg_method_sym_free(method_sym);
+  }
+  list_cg_method_sym_free(class_methods);
+
+  uint64_t env =
+      cache ? cg_inst_env_key(cache->seed, mir, jobs_arr, jobs_cnt) : 0;
+
+  for (size_t i = 0; i < jobs_cnt; ++i) {
+    cg_inst_job *job = &jobs_arr[i];
+    uint64_t     key = cache ? cg_inst_job_key(job, env, result.debug->level)
+                             : 0;
+    job->key         = cg_inst_job_lits(&ctx, job, key);
+  }
+
+  // load jobs from cache, only changed ones are run
+  if (cache) {
+    for (size_t i = 0; i < jobs_cnt; ++i) {
+      cg_inst_job *job = &jobs_arr[i];
+
+      job->cached = cg_cache_load(cache, job->key, job->code, job->debug);
+      if (job->cached) {
+        free(job->sym);
+        job->sym = NULL;
+      }
+    }
+  }
+
+  // instantiate subroutines, class initializers and methods
+  cg_inst_jobs state = {
+      .parent = &ctx,
+      .jobs   = jobs_arr,
+  };
+  parallel_for(jobs_cnt, jobs ? jobs : parallel_jobs_default(),
+               cg_inst_job_run, &state);
+
+  // fold identical jobs, cache stores them unfolded
+  size_t              *folded     = NULL;
+  size_t               folded_cnt = 0;
+  hashset_cg_fold_sym *syms       = NULL;
+
+  if (opt_level >= 2) {
+    folded = cg_inst_jobs_fold(jobs_arr, jobs_cnt, &syms);
+  }
+
+  for (size_t i = 0; i < jobs_cnt; ++i) {
+    cg_inst_job_store(&jobs_arr[i], cache);
+    if (folded && folded[i] != i) {
+      cg_inst_job_merge_folded(&ctx, &jobs_arr[i], syms);
+      ++folded_cnt;
     } else {
-      cg_inst_sub_def(&ctx, sub, strdup(sub_sym));
+      cg_inst_job_merge(&ctx, &jobs_arr[i]);
     }
   }
+  free(jobs_arr);
 
-  // instantiate class initializers and methods
-  cg_inst_class_inits(&ctx, class_inits);
-  cg_inst_class_methods(&ctx, class_methods);
+  if (folded) {
+    cg_fold_rewrite(ctx.code->text, syms);
+    cg_fold_rewrite(ctx.code->data, syms);
+    info("folded %zu subroutines", folded_cnt);
+
+    hashset_cg_fold_sym_free(syms);
+    free(folded);
+  }
 
   cg_ctx_deinit(&ctx);
 
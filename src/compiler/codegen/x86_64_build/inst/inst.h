@@ -1,6 +1,7 @@
 #pragma once
 
 #include "compiler/codegen/x86_64/x86_64.h"
+#include "compiler/codegen/x86_64_build/cache.h"
 #include "compiler/codegen/x86_64_build/data.h"
 #include "compiler/codegen/x86_64_build/debug.h"
 #include "compiler/exception/list.h"
@@ -11,7 +12,12 @@ typedef struct cg_inst_result_struct {
   list_exception *exceptions;
 } cg_inst_result;
 
-cg_inst_result cg_inst(cg_x86_64 *code, const mir *mir);
+// subroutines are instantiated on up to jobs threads, result doesn't depend
+// on number of jobs. If cache is set, unchanged subroutines are loaded from it
+// and instantiated ones are stored. Since opt_level 2 identical subroutines
+// are folded
+cg_inst_result cg_inst(cg_x86_64 *code, const mir *mir, int opt_level,
+                       size_t jobs, cg_cache *cache);
 
 // ctx
 typedef struct cg_ctx_struct {
@@ -26,6 +32,7 @@ typedef struct cg_ctx_struct {
   cg_debug_sub          *sub_debug;
   uint64_t               line_cnt; // also for debug
   hashset_cg_value_meta *map_value_meta;
+  hashset_cg_stmt_frame *map_stmt_frame;
   uint64_t               frame_size;
 
   const mir_bb *bb;
@@ -39,6 +46,12 @@ void cg_ctx_init(cg_ctx *ctx, cg_x86_64 *code, cg_debug *debug,
                  list_exception *exceptions);
 void cg_ctx_deinit(cg_ctx *ctx);
 
+// ctx of single job, symbol indices of parent are shared and must not change
+// while jobs are running
+void cg_ctx_init_job(cg_ctx *ctx, const cg_ctx *parent, cg_x86_64 *code,
+                     cg_debug *debug, list_exception *exceptions);
+void cg_ctx_deinit_job(cg_ctx *ctx);
+
 const char *cg_ctx_mir_sym_find_lit(cg_ctx *ctx, const mir_lit *lit_ref);
 char       *cg_ctx_mir_sym_emplace_lit(cg_ctx *ctx, const mir_lit *lit_ref);
 
@@ -58,6 +71,11 @@ cg_value_meta *cg_ctx_value_meta_emplace(cg_ctx          *ctx,
                                          const mir_value *value_ref,
                                          int64_t offset, int is_ptr);
 
+const cg_stmt_frame *cg_ctx_stmt_frame_find(cg_ctx *ctx, const mir_stmt *stmt);
+cg_stmt_frame       *cg_ctx_stmt_frame_emplace(cg_ctx         *ctx,
+                                               const mir_stmt *stmt_ref,
+                                               int64_t         offset);
+
 void cg_ctx_text_push_back(cg_ctx *ctx, void *unit);
 void cg_ctx_data_push_back(cg_ctx *ctx, void *unit);
 void cg_ctx_debug_info_push_back(cg_ctx *ctx, void *unit);
@@ -84,11 +102,30 @@ char *cg_sym_local_bb(const char *base, const mir_bb *bb);
 uint64_t cg_aligned(uint64_t size);
 
 // bb
-void cg_inst_bbs(cg_ctx *ctx, const list_mir_bb *bbs);
+void cg_inst_bbs(cg_ctx *ctx, const vec_mir_bb *bbs);
+// indexes string literals of bbs in order of their instantiation, returns hash
+// combined with symbols of literals
+uint64_t cg_inst_bbs_lits(cg_ctx *ctx, const vec_mir_bb *bbs, uint64_t hash);
 
 // core
 void cg_inst_core(cg_ctx *ctx);
 
 // class
-void cg_inst_class_methods(cg_ctx *ctx, list_cg_method_sym *methods);
-void cg_inst_class_inits(cg_ctx *ctx, list_cg_class_sym *class_inits);
+void cg_inst_class_method(cg_ctx *ctx, const mir_subroutine *sub, char *sym);
+void cg_inst_class_init(cg_ctx *ctx, const mir_class *class, char *init_sym);
+
+// fold
+typedef struct cg_fold_body_struct {
+  const cg_x86_64 *code_ref; // text starts with symbol of body
+  const cg_x86_64 *lits_ref; // string literals, can be used by any body
+  int              foldable;
+} cg_fold_body;
+
+// returns index of body each body is folded into, own index if it isn't
+// folded. Bodies are identical if they differ only in local labels, symbols
+// of equal string literals and symbols of bodies folded together
+size_t              *cg_fold(const cg_fold_body *bodies, size_t cnt);
+hashset_cg_fold_sym *cg_fold_syms(const cg_fold_body *bodies,
+                                  const size_t *folded, size_t cnt);
+// references to folded bodies are replaced with bodies they are folded into
+void cg_fold_rewrite(vec_cg_x86_64_unit *units, hashset_cg_fold_sym *syms);
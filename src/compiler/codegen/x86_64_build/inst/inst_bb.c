@@ -3,8 +3,10 @@
 #include "compiler/mir/str.h"
 #include "compiler/type_table/str.h"
 #include "inst.h"
+#include "util/hash.h"
 #include "util/log.h"
 #include "util/macro.h"
+#include "x86_64_core/proxy/registry.h"
 #include "x86_64_core/value.h"
 #include <stdarg.h>
 #include <string.h>
@@ -156,11 +158,11 @@ static void cg_inst_call_op_tbl(cg_ctx *ctx, const mir_value *self,
 }
 
 // if o_null is set then adds NULL as last elements
-static uint64_t cg_inst_call_values(const mir_value    *ret,
-                                    list_mir_value_ref *args,
+static uint64_t cg_inst_call_values(const mir_value   *ret,
+                                    vec_mir_value_ref *args,
                                     const mir_value ***values_out, int o_null) {
   uint64_t values_cnt = (ret ? 1 : 0) +
-                        (args ? list_mir_value_ref_size(args) : 0) +
+                        (args ? vec_mir_value_ref_size(args) : 0) +
                         (o_null ? 1 : 0);
 
   const mir_value **values = MALLOCN(const mir_value *, values_cnt);
@@ -170,7 +172,7 @@ static uint64_t cg_inst_call_values(const mir_value    *ret,
       values[i++] = ret;
     }
     if (args) {
-      for (list_mir_value_ref_it it = list_mir_value_ref_begin(args); !END(it);
+      for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(args); !END(it);
            ++i, NEXT(it)) {
         values[i] = GET(it);
       }
@@ -190,7 +192,7 @@ static void cg_inst_stmt_op(cg_ctx *ctx, const mir_stmt *stmt) {
   const mir_value **values = NULL;
   uint64_t          values_cnt;
 
-  const mir_value *self = list_mir_value_ref_front(stmt->op.args);
+  const mir_value *self = vec_mir_value_ref_front(stmt->op.args);
   if (!self) {
     error("expected any arg to be passed by op %s(%d) %p",
           mir_stmt_op_enum_str(stmt->op.kind), stmt->op.kind, stmt);
@@ -452,7 +454,7 @@ static void cg_inst_stmt_call_extern(cg_ctx *ctx, const mir_stmt *stmt) {
   }
 
   // get argc and check if it matches extern
-  uint64_t args_cnt   = list_mir_value_ref_size(stmt->call.args);
+  uint64_t args_cnt   = vec_mir_value_ref_size(stmt->call.args);
   uint64_t params_cnt = list_type_ref_size(type.sub->params);
 
   if (args_cnt != params_cnt) {
@@ -487,7 +489,7 @@ static void cg_inst_stmt_call_extern(cg_ctx *ctx, const mir_stmt *stmt) {
     list_type_ref_it type_it = list_type_ref_begin(type.sub->params);
     uint64_t         arg_i   = 0;
 
-    for (list_mir_value_ref_it it = list_mir_value_ref_begin(stmt->call.args);
+    for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(stmt->call.args);
          !END(it); NEXT(it), ++arg_i, NEXT(type_it)) {
       const mir_value     *arg  = GET(it);
       const cg_value_meta *meta = cg_ctx_value_meta_find(ctx, arg);
@@ -802,28 +804,44 @@ static void cg_inst_stmt_call(cg_ctx *ctx, const mir_stmt *stmt) {
   }
 }
 
+// string literal is placed in data once, symbol is shared by all references
+static const char *cg_inst_lit_str_sym(cg_ctx *ctx, const mir_lit *lit) {
+  const char *sym_ref = cg_ctx_mir_sym_find_lit(ctx, lit);
+
+  // insert new lit into index and add it to data code
+  if (!sym_ref) {
+    char *sym = cg_ctx_mir_sym_emplace_lit(ctx, lit);
+
+    cg_ctx_data_push_back(ctx, cg_x86_64_symbol_new_data(sym));
+    cg_ctx_data_push_back(
+        ctx,
+        cg_x86_64_data_new_ascii((uint8_t *)strdup((char *)lit->value.v_str)));
+
+    sym_ref = sym;
+  }
+
+  return sym_ref;
+}
+
+static int cg_inst_stmt_member_ok(const mir_stmt *stmt) {
+  const type_base *member_type = stmt->member.member->type_ref->type;
+
+  return !(member_type->kind != TYPE_PRIMITIVE &&
+           ((type_primitive *)member_type)->type != TYPE_PRIMITIVE_STRING);
+}
+
 static void cg_inst_stmt_member(cg_ctx *ctx, const mir_stmt *stmt, int o_ref) {
   const mir_lit   *member      = stmt->member.member;
   const type_base *member_type = member->type_ref->type;
 
-  if (member_type->kind != TYPE_PRIMITIVE &&
-      ((type_primitive *)member_type)->type != TYPE_PRIMITIVE_STRING) {
+  if (!cg_inst_stmt_member_ok(stmt)) {
     char *type_s = type_str(member_type);
     error("expected member type TYPE_PRIMITIVE, STRING, got '%s'", type_s);
     free(type_s);
     return;
   }
 
-  const char *member_sym = cg_ctx_mir_sym_find_lit(ctx, member);
-  if (!member_sym) {
-    char *sym = cg_ctx_mir_sym_emplace_lit(ctx, stmt->member.member);
-
-    cg_ctx_data_push_back(ctx, cg_x86_64_symbol_new_data(sym));
-    cg_ctx_data_push_back(ctx, cg_x86_64_data_new_ascii((uint8_t *)strdup(
-                                   (char *)stmt->member.member->value.v_str)));
-
-    member_sym = sym;
-  }
+  const char *member_sym = cg_inst_lit_str_sym(ctx, member);
 
   const mir_value     *ret      = stmt->member.ret;
   const cg_value_meta *ret_meta = cg_ctx_value_meta_find(ctx, ret);
@@ -847,7 +865,7 @@ static void cg_inst_stmt_member(cg_ctx *ctx, const mir_stmt *stmt, int o_ref) {
 }
 
 static void cg_inst_stmt_builtin_cast(cg_ctx *ctx, const mir_stmt *stmt) {
-  if (list_mir_value_ref_size(stmt->builtin.args) != 1) {
+  if (vec_mir_value_ref_size(stmt->builtin.args) != 1) {
     span *span = mir_debug_to_span(&stmt->debug);
     cg_exception_add_error(ctx->exceptions, EXCEPTION_CG_UNEXPECTED_ARGS, span,
                            "cast expected 1 argument");
@@ -868,7 +886,7 @@ static void cg_inst_stmt_builtin_cast(cg_ctx *ctx, const mir_stmt *stmt) {
   const mir_value     *ret      = stmt->builtin.ret;
   const cg_value_meta *ret_meta = cg_ctx_value_meta_find(ctx, ret);
 
-  const mir_value     *value = list_mir_value_ref_front(stmt->builtin.args);
+  const mir_value     *value = vec_mir_value_ref_front(stmt->builtin.args);
   const cg_value_meta *value_meta = cg_ctx_value_meta_find(ctx, value);
 
   cg_inst_value_reg(ctx, ret_meta, CG_X86_64_REG_RDI);
@@ -1009,7 +1027,7 @@ static void cg_inst_stmt_builtin_make(cg_ctx *ctx, const mir_stmt *stmt) {
         }
       }
 
-      uint64_t args_cnt = list_mir_value_ref_size(stmt->builtin.args);
+      uint64_t args_cnt = vec_mir_value_ref_size(stmt->builtin.args);
       if (args_cnt != depth) {
         span *span = mir_debug_to_span(&stmt->debug);
         cg_exception_add_error(
@@ -1022,15 +1040,34 @@ static void cg_inst_stmt_builtin_make(cg_ctx *ctx, const mir_stmt *stmt) {
 
       uint64_t frame_size_old = ctx->frame_size;
 
+      const cg_stmt_frame *frame = cg_ctx_stmt_frame_find(ctx, stmt);
+
       const mir_value **values;
       const uint64_t    values_cnt = cg_inst_call_values(
-          stmt->builtin.ret, stmt->builtin.args, &values, 1);
+          stmt->builtin.ret, stmt->builtin.args, &values, !frame);
 
       cg_inst_call_pass_values(ctx, values_cnt, values);
 
-      cg_ctx_text_emplace_back_text(
-          ctx, CG_X86_64_MNEM_CALL,
-          cg_x86_64_op_new_direct(strdup("__x86_64_make_array")), NULL);
+      if (frame) {
+        cg_ctx_text_emplace_back_text(
+            ctx, CG_X86_64_MNEM_LEAQ,
+            cg_x86_64_op_new_base_imm(frame->offset, CG_X86_64_REG_RBP),
+            cg_x86_64_op_new_register(CG_X86_64_REG_RDX), NULL);
+
+        cg_ctx_text_emplace_back_text(
+            ctx, CG_X86_64_MNEM_MOVQ,
+            cg_x86_64_op_new_immediate(stmt->builtin.frame_capacity),
+            cg_x86_64_op_new_register(CG_X86_64_REG_RCX), NULL);
+
+        cg_ctx_text_emplace_back_text(
+            ctx, CG_X86_64_MNEM_CALL,
+            cg_x86_64_op_new_direct(strdup("__x86_64_make_array_frame")),
+            NULL);
+      } else {
+        cg_ctx_text_emplace_back_text(
+            ctx, CG_X86_64_MNEM_CALL,
+            cg_x86_64_op_new_direct(strdup("__x86_64_make_array")), NULL);
+      }
 
       cg_inst_frame_restore(ctx, frame_size_old);
 
@@ -1041,7 +1078,7 @@ static void cg_inst_stmt_builtin_make(cg_ctx *ctx, const mir_stmt *stmt) {
       const type_mono *mono = (typeof(mono))type;
       switch (mono->type_ref->kind) {
         case TYPE_CLASS_T:
-          if (!list_mir_value_ref_empty(stmt->builtin.args)) {
+          if (!vec_mir_value_ref_empty(stmt->builtin.args)) {
             span *span   = mir_debug_to_span(&stmt->debug);
             char *type_s = type_str(type);
             cg_exception_add_warning(ctx->exceptions,
@@ -1064,6 +1101,20 @@ static void cg_inst_stmt_builtin_make(cg_ctx *ctx, const mir_stmt *stmt) {
             break;
           }
 
+          // initializer places object in frame passed in %rsi if not null
+          const cg_stmt_frame *frame = cg_ctx_stmt_frame_find(ctx, stmt);
+          if (frame) {
+            cg_ctx_text_emplace_back_text(
+                ctx, CG_X86_64_MNEM_LEAQ,
+                cg_x86_64_op_new_base_imm(frame->offset, CG_X86_64_REG_RBP),
+                cg_x86_64_op_new_register(CG_X86_64_REG_RSI), NULL);
+          } else {
+            cg_ctx_text_emplace_back_text(
+                ctx, CG_X86_64_MNEM_XORQ,
+                cg_x86_64_op_new_register(CG_X86_64_REG_RSI),
+                cg_x86_64_op_new_register(CG_X86_64_REG_RSI), NULL);
+          }
+
           cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_CALL,
                                         cg_x86_64_op_new_direct(strdup(sym)),
                                         NULL);
@@ -1100,7 +1151,7 @@ static void cg_inst_stmt_builtin_make(cg_ctx *ctx, const mir_stmt *stmt) {
 }
 
 static void cg_inst_stmt_builtin_print(cg_ctx *ctx, const mir_stmt *stmt) {
-  for (list_mir_value_ref_it it = list_mir_value_ref_begin(stmt->builtin.args);
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(stmt->builtin.args);
        !END(it); NEXT(it)) {
     const mir_value     *value      = GET(it);
     const cg_value_meta *value_meta = cg_ctx_value_meta_find(ctx, value);
@@ -1114,7 +1165,7 @@ static void cg_inst_stmt_builtin_print(cg_ctx *ctx, const mir_stmt *stmt) {
 }
 
 static void cg_inst_stmt_builtin_type(cg_ctx *ctx, const mir_stmt *stmt) {
-  if (list_mir_value_ref_size(stmt->builtin.args) != 1) {
+  if (vec_mir_value_ref_size(stmt->builtin.args) != 1) {
     span *span = mir_debug_to_span(&stmt->debug);
     cg_exception_add_error(ctx->exceptions, EXCEPTION_CG_UNEXPECTED_ARGS, span,
                            "cast expected 1 argument");
@@ -1125,7 +1176,7 @@ static void cg_inst_stmt_builtin_type(cg_ctx *ctx, const mir_stmt *stmt) {
   const mir_value     *ret      = stmt->builtin.ret;
   const cg_value_meta *ret_meta = cg_ctx_value_meta_find(ctx, ret);
 
-  const mir_value     *value = list_mir_value_ref_front(stmt->builtin.args);
+  const mir_value     *value = vec_mir_value_ref_front(stmt->builtin.args);
   const cg_value_meta *value_meta = cg_ctx_value_meta_find(ctx, value);
 
   cg_inst_value_reg(ctx, ret_meta, CG_X86_64_REG_RDI);
@@ -1244,19 +1295,7 @@ static void cg_inst_stmt_assign_lit(cg_ctx *ctx, const mir_stmt *stmt) {
           break;
         }
         case TYPE_PRIMITIVE_STRING: {
-          const char *sym_ref = cg_ctx_mir_sym_find_lit(ctx, from_lit);
-
-          // insert new lit into index and add it to data code
-          if (!sym_ref) {
-            char *sym = cg_ctx_mir_sym_emplace_lit(ctx, from_lit);
-
-            cg_ctx_data_push_back(ctx, cg_x86_64_symbol_new_data(sym));
-            cg_ctx_data_push_back(
-                ctx, cg_x86_64_data_new_ascii(
-                         (uint8_t *)strdup((char *)from_lit->value.v_str)));
-
-            sym_ref = sym;
-          }
+          const char *sym_ref = cg_inst_lit_str_sym(ctx, from_lit);
 
           cg_ctx_text_emplace_back_text(
               ctx, CG_X86_64_MNEM_LEAQ,
@@ -1304,6 +1343,63 @@ static void cg_inst_stmt_assign_value(cg_ctx *ctx, const mir_stmt *stmt) {
   cg_inst_frame_restore(ctx, frame_size_old);
 }
 
+CASSERT(offsetof(x86_64_registry, op_tbl_arr) == 0, inst_bb);
+
+// source is dead after assignment, so its value is moved without copy
+static void cg_inst_stmt_assign_move(cg_ctx *ctx, const mir_stmt *stmt) {
+  const mir_value *to_value   = stmt->assign.to;
+  const mir_value *from_value = stmt->assign.from_value;
+
+  const cg_value_meta *to_meta   = cg_ctx_value_meta_find(ctx, to_value);
+  const cg_value_meta *from_meta = cg_ctx_value_meta_find(ctx, from_value);
+
+  uint64_t frame_size_old = ctx->frame_size;
+
+  // previous value of target is released the same way op_assign does
+  cg_inst_call_pass_values(ctx, 1, &to_value);
+  cg_inst_call_op_tbl(ctx, to_value, offsetof(x86_64_op_tbl, op_drop));
+  cg_inst_frame_restore(ctx, frame_size_old);
+
+  cg_inst_value_reg(ctx, to_meta, CG_X86_64_REG_RDI);
+  cg_inst_value_reg(ctx, from_meta, CG_X86_64_REG_RSI);
+
+  for (uint64_t offset = 0; offset < sizeof(x86_64_value);
+       offset += CG_X86_64_SIZE_QUAD) {
+    cg_ctx_text_emplace_back_text(
+        ctx, CG_X86_64_MNEM_MOVQ,
+        cg_x86_64_op_new_base_imm(offset, CG_X86_64_REG_RSI),
+        cg_x86_64_op_new_register(CG_X86_64_REG_RAX), NULL);
+    cg_ctx_text_emplace_back_text(
+        ctx, CG_X86_64_MNEM_MOVQ, cg_x86_64_op_new_register(CG_X86_64_REG_RAX),
+        cg_x86_64_op_new_base_imm(offset, CG_X86_64_REG_RDI), NULL);
+  }
+
+  // source is reset to void inplace (same as __x86_64_proxy_void_init),
+  // op_tbl_arr is the first field of registry
+  cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_MOVQ,
+      cg_x86_64_op_new_base_sym(strdup("X86_64_REGISTRY"), CG_X86_64_REG_RIP),
+      cg_x86_64_op_new_register(CG_X86_64_REG_RAX), NULL);
+
+  cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_MOVQ,
+      cg_x86_64_op_new_base_imm(X86_64_TYPE_VOID * sizeof(x86_64_op_tbl *),
+                                CG_X86_64_REG_RAX),
+      cg_x86_64_op_new_register(CG_X86_64_REG_RAX), NULL);
+
+  cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_MOVL, cg_x86_64_op_new_immediate(X86_64_TYPE_VOID),
+      cg_x86_64_op_new_base_imm(offsetof(x86_64_value, type),
+                                CG_X86_64_REG_RSI),
+      NULL);
+
+  cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_MOVQ, cg_x86_64_op_new_register(CG_X86_64_REG_RAX),
+      cg_x86_64_op_new_base_imm(offsetof(x86_64_value, op_tbl),
+                                CG_X86_64_REG_RSI),
+      NULL);
+}
+
 static void cg_inst_stmt_assign_sub(cg_ctx *ctx, const mir_stmt *stmt) {
   const mir_value      *to_value = stmt->assign.to;
   const mir_subroutine *from_sub = stmt->assign.from_sub;
@@ -1349,21 +1445,27 @@ static void cg_inst_stmt_assign(cg_ctx *ctx, const mir_stmt *stmt) {
     case MIR_STMT_ASSIGN_SUB: {
       return cg_inst_stmt_assign_sub(ctx, stmt);
     }
+    case MIR_STMT_ASSIGN_MOVE: {
+      return cg_inst_stmt_assign_move(ctx, stmt);
+    }
   }
   error("unhandled assign kind %d", stmt->assign.kind);
 }
 
-static void cg_inst_stmt(cg_ctx *ctx, const mir_stmt *stmt) {
-
-  if (cg_debug_enabled(ctx->debug)) {
+static void cg_inst_debug_line(cg_ctx *ctx, const mir_debug *debug) {
+  if (cg_debug_enabled(ctx->debug) && debug->source_ref) {
     char *sym = cg_sym_local_suf_idx(ctx->sub_sym, "L", ctx->line_cnt++);
 
     cg_ctx_text_push_back(ctx, cg_x86_64_symbol_new_text(sym));
 
     list_cg_debug_line_push_back(
         ctx->debug->lines,
-        cg_debug_line_new(sym, stmt->debug.source_ref, stmt->debug.line));
+        cg_debug_line_new(sym, debug->source_ref, debug->line));
   }
+}
+
+static void cg_inst_stmt(cg_ctx *ctx, const mir_stmt *stmt) {
+  cg_inst_debug_line(ctx, &stmt->debug);
 
   switch (stmt->kind) {
     case MIR_STMT_OP:
@@ -1382,27 +1484,265 @@ static void cg_inst_stmt(cg_ctx *ctx, const mir_stmt *stmt) {
   error("unhandled stmt kind %d %p", stmt->kind, stmt);
 }
 
-static void cg_inst_bb(cg_ctx *ctx, const mir_bb *bb) {
+// primitive that is stored in data_raw and can be compared with cmp
+typedef struct cg_inst_cmp_prim_struct {
+  x86_64_type_enum type;
+  cg_x86_64_mnem   mnem_mov;
+  cg_x86_64_mnem   mnem_cmp;
+  int              is_signed;
+} cg_inst_cmp_prim;
+
+static int cg_inst_cmp_prim_get(const mir_value *value, int *is_any,
+                                cg_inst_cmp_prim *out) {
+  *is_any = 0;
+
+  if (!value->type_ref || value->type_ref->type->kind != TYPE_PRIMITIVE) {
+    return 0;
+  }
+
+  const type_primitive *prim = (typeof(prim))value->type_ref->type;
+  switch (prim->type) {
+    case TYPE_PRIMITIVE_BYTE:
+      *out = (cg_inst_cmp_prim){X86_64_TYPE_BYTE, CG_X86_64_MNEM_MOVB,
+                                CG_X86_64_MNEM_CMPB, 0};
+      return 1;
+    case TYPE_PRIMITIVE_CHAR:
+      *out = (cg_inst_cmp_prim){X86_64_TYPE_CHAR, CG_X86_64_MNEM_MOVB,
+                                CG_X86_64_MNEM_CMPB, 0};
+      return 1;
+    case TYPE_PRIMITIVE_INT:
+      *out = (cg_inst_cmp_prim){X86_64_TYPE_INT, CG_X86_64_MNEM_MOVL,
+                                CG_X86_64_MNEM_CMPL, 1};
+      return 1;
+    case TYPE_PRIMITIVE_UINT:
+      *out = (cg_inst_cmp_prim){X86_64_TYPE_UINT, CG_X86_64_MNEM_MOVL,
+                                CG_X86_64_MNEM_CMPL, 0};
+      return 1;
+    case TYPE_PRIMITIVE_LONG:
+      *out = (cg_inst_cmp_prim){X86_64_TYPE_LONG, CG_X86_64_MNEM_MOVQ,
+                                CG_X86_64_MNEM_CMPQ, 1};
+      return 1;
+    case TYPE_PRIMITIVE_ULONG:
+      *out = (cg_inst_cmp_prim){X86_64_TYPE_ULONG, CG_X86_64_MNEM_MOVQ,
+                                CG_X86_64_MNEM_CMPQ, 0};
+      return 1;
+    case TYPE_PRIMITIVE_ANY:
+      *is_any = 1;
+      return 0;
+    default:
+      return 0;
+  }
+}
+
+// returns jcc that jumps when comparison holds (or doesn't if negate is set)
+static cg_x86_64_mnem cg_inst_cmp_jcc(mir_stmt_op_enum kind, int is_signed,
+                                      int negate) {
+  switch (kind) {
+    case MIR_STMT_OP_BINARY_EQUALS:
+      return negate ? CG_X86_64_MNEM_JNZ : CG_X86_64_MNEM_JZ;
+    case MIR_STMT_OP_BINARY_NOT_EQUALS:
+      return negate ? CG_X86_64_MNEM_JZ : CG_X86_64_MNEM_JNZ;
+    case MIR_STMT_OP_BINARY_LESS:
+      if (is_signed) {
+        return negate ? CG_X86_64_MNEM_JGE : CG_X86_64_MNEM_JL;
+      }
+      return negate ? CG_X86_64_MNEM_JAE : CG_X86_64_MNEM_JB;
+    case MIR_STMT_OP_BINARY_LESS_EQUALS:
+      if (is_signed) {
+        return negate ? CG_X86_64_MNEM_JG : CG_X86_64_MNEM_JLE;
+      }
+      return negate ? CG_X86_64_MNEM_JA : CG_X86_64_MNEM_JBE;
+    case MIR_STMT_OP_BINARY_GREATER:
+      if (is_signed) {
+        return negate ? CG_X86_64_MNEM_JLE : CG_X86_64_MNEM_JG;
+      }
+      return negate ? CG_X86_64_MNEM_JBE : CG_X86_64_MNEM_JA;
+    case MIR_STMT_OP_BINARY_GREATER_EQUALS:
+      if (is_signed) {
+        return negate ? CG_X86_64_MNEM_JL : CG_X86_64_MNEM_JGE;
+      }
+      return negate ? CG_X86_64_MNEM_JB : CG_X86_64_MNEM_JAE;
+    default:
+      break;
+  }
+  error("unexpected cmp op kind %s(%d)", mir_stmt_op_enum_str(kind), kind);
+  return CG_X86_64_MNEM_JMP;
+}
+
+// value is read only by terminator of the current bb
+static int cg_inst_value_cond_only(cg_ctx *ctx, const mir_value *value) {
+  if (value->symbol_ref || value == ctx->sub->defined.ret) {
+    return 0;
+  }
+  const cg_value_meta *meta = cg_ctx_value_meta_find(ctx, value);
+  return meta && meta->reads == 1;
+}
+
+// returns comparison stmt that produces condition of bb, if it can be fused
+// with branch, otherwise NULL
+static const mir_stmt *cg_inst_bb_cmp_stmt(cg_ctx *ctx, const mir_bb *bb,
+                                           cg_inst_cmp_prim *prim) {
+  if (vec_mir_stmt_empty(bb->stmts)) {
+    return NULL;
+  }
+
+  const mir_stmt *stmt = vec_mir_stmt_back(bb->stmts);
+
+  if (stmt->kind != MIR_STMT_OP || stmt->op.ret != bb->jmp.cond_ref) {
+    return NULL;
+  }
+
+  switch (stmt->op.kind) {
+    case MIR_STMT_OP_BINARY_EQUALS:
+    case MIR_STMT_OP_BINARY_NOT_EQUALS:
+    case MIR_STMT_OP_BINARY_LESS:
+    case MIR_STMT_OP_BINARY_LESS_EQUALS:
+    case MIR_STMT_OP_BINARY_GREATER:
+    case MIR_STMT_OP_BINARY_GREATER_EQUALS:
+      break;
+    default:
+      return NULL;
+  }
+
+  vec_mir_value_ref_it it = vec_mir_value_ref_begin(stmt->op.args);
+  if (END(it)) {
+    return NULL;
+  }
+  const mir_value *lhs = GET(it);
+  NEXT(it);
+  if (END(it)) {
+    return NULL;
+  }
+  const mir_value *rhs = GET(it);
+
+  // at least one side should be known, other can be any (checked at runtime)
+  cg_inst_cmp_prim lhs_prim, rhs_prim;
+  int              lhs_any, rhs_any;
+  int              lhs_ok = cg_inst_cmp_prim_get(lhs, &lhs_any, &lhs_prim);
+  int              rhs_ok = cg_inst_cmp_prim_get(rhs, &rhs_any, &rhs_prim);
+
+  if (lhs_ok && rhs_ok) {
+    if (lhs_prim.type != rhs_prim.type) {
+      return NULL;
+    }
+    *prim = lhs_prim;
+  } else if (lhs_ok && rhs_any) {
+    *prim = lhs_prim;
+  } else if (rhs_ok && lhs_any) {
+    *prim = rhs_prim;
+  } else {
+    return NULL;
+  }
+
+  if (!cg_inst_value_cond_only(ctx, bb->jmp.cond_ref)) {
+    return NULL;
+  }
+
+  return stmt;
+}
+
+static void cg_inst_cmp_type_guard(cg_ctx *ctx, cg_x86_64_reg reg,
+                                   x86_64_type_enum type,
+                                   const char      *sym_slow) {
+  cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_CMPL, cg_x86_64_op_new_immediate(type),
+      cg_x86_64_op_new_base_imm(offsetof(x86_64_value, type), reg), NULL);
+
+  cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_JNZ, cg_x86_64_op_new_direct(strdup(sym_slow)), NULL);
+}
+
+// jumps to je if condition holds, to jz otherwise, omits jump to next
+static void cg_inst_bb_jcc(cg_ctx *ctx, const mir_bb *bb, const mir_bb *next,
+                           cg_x86_64_mnem jcc, cg_x86_64_mnem jcc_neg) {
+  if (bb->jmp.je_ref == next) {
+    cg_ctx_text_emplace_back_text(ctx, jcc_neg,
+                                  cg_x86_64_op_new_direct(cg_sym_local_bb(
+                                      ctx->sub_sym, bb->jmp.jz_ref)),
+                                  NULL);
+    return;
+  }
+
+  cg_ctx_text_emplace_back_text(
+      ctx, jcc,
+      cg_x86_64_op_new_direct(cg_sym_local_bb(ctx->sub_sym, bb->jmp.je_ref)),
+      NULL);
+
+  if (bb->jmp.jz_ref != next) {
+    cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_JMP,
+                                  cg_x86_64_op_new_direct(cg_sym_local_bb(
+                                      ctx->sub_sym, bb->jmp.jz_ref)),
+                                  NULL);
+  }
+}
+
+// compares data of values inline if both have expected runtime type,
+// otherwise falls to slow path that calls op_tbl (and reports errors)
+static void cg_inst_bb_cmp_fast(cg_ctx *ctx, const mir_bb *bb,
+                                const mir_stmt         *stmt,
+                                const cg_inst_cmp_prim *prim,
+                                const char             *sym_slow) {
+  vec_mir_value_ref_it it  = vec_mir_value_ref_begin(stmt->op.args);
+  const mir_value     *lhs = GET(it);
+  NEXT(it);
+  const mir_value *rhs = GET(it);
+
+  cg_inst_value_reg(ctx, cg_ctx_value_meta_find(ctx, lhs), CG_X86_64_REG_RSI);
+  cg_inst_value_reg(ctx, cg_ctx_value_meta_find(ctx, rhs), CG_X86_64_REG_RDX);
+
+  cg_inst_cmp_type_guard(ctx, CG_X86_64_REG_RSI, prim->type, sym_slow);
+  cg_inst_cmp_type_guard(ctx, CG_X86_64_REG_RDX, prim->type, sym_slow);
+
+  cg_ctx_text_emplace_back_text(
+      ctx, prim->mnem_mov,
+      cg_x86_64_op_new_base_imm(offsetof(x86_64_value, data_raw),
+                                CG_X86_64_REG_RSI),
+      cg_x86_64_op_new_register(CG_X86_64_REG_RAX), NULL);
+
+  cg_ctx_text_emplace_back_text(
+      ctx, prim->mnem_cmp,
+      cg_x86_64_op_new_base_imm(offsetof(x86_64_value, data_raw),
+                                CG_X86_64_REG_RDX),
+      cg_x86_64_op_new_register(CG_X86_64_REG_RAX), NULL);
+
+  // slow path is placed right after, so both targets are jumped to
+  // explicitly, fall through to next bb would run into slow path
+  cg_inst_bb_jcc(ctx, bb, NULL,
+                 cg_inst_cmp_jcc(stmt->op.kind, prim->is_signed, 0),
+                 cg_inst_cmp_jcc(stmt->op.kind, prim->is_signed, 1));
+}
+
+// next - bb that is placed right after current one (NULL if it is last)
+static void cg_inst_bb(cg_ctx *ctx, const mir_bb *bb, const mir_bb *next) {
   ctx->bb = bb;
 
   cg_ctx_text_push_back(
       ctx, cg_x86_64_symbol_new_text(cg_sym_local_bb(ctx->sub_sym, bb)));
 
-  for (list_mir_stmt_it it = list_mir_stmt_begin(bb->stmts); !END(it);
+  mir_bb_enum kind = mir_bb_get_cond(bb);
+
+  cg_inst_cmp_prim prim;
+  const mir_stmt  *cmp_stmt =
+      kind == MIR_BB_COND ? cg_inst_bb_cmp_stmt(ctx, bb, &prim) : NULL;
+
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
        NEXT(it)) {
     const mir_stmt *stmt = GET(it);
+
+    if (stmt == cmp_stmt) {
+      char *sym_slow = cg_sym_local_suf_idx(ctx->sub_sym, "slow", bb->id);
+
+      cg_inst_debug_line(ctx, &stmt->debug);
+      cg_inst_bb_cmp_fast(ctx, bb, stmt, &prim, sym_slow);
+
+      cg_ctx_text_push_back(ctx, cg_x86_64_symbol_new_text(sym_slow));
+    }
+
     cg_inst_stmt(ctx, stmt);
   }
 
-  if (cg_debug_enabled(ctx->debug) && bb->jmp.debug.source_ref) {
-    char *sym = cg_sym_local_suf_idx(ctx->sub_sym, "L", ctx->line_cnt++);
-    cg_ctx_text_push_back(ctx, cg_x86_64_symbol_new_text(sym));
-    list_cg_debug_line_push_back(
-        ctx->debug->lines,
-        cg_debug_line_new(sym, bb->jmp.debug.source_ref, bb->jmp.debug.line));
-  }
+  cg_inst_debug_line(ctx, &bb->jmp.debug);
 
-  mir_bb_enum kind = mir_bb_get_cond(bb);
   switch (kind) {
     // unwrap as bool and jump if true, else not jump
     case MIR_BB_COND: {
@@ -1420,29 +1760,26 @@ static void cg_inst_bb(cg_ctx *ctx, const mir_bb *bb) {
           cg_x86_64_op_new_register(CG_X86_64_REG_RAX),
           cg_x86_64_op_new_register(CG_X86_64_REG_RAX), NULL);
 
-      cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_JNZ,
-                                    cg_x86_64_op_new_direct(cg_sym_local_bb(
-                                        ctx->sub_sym, bb->jmp.je_ref)),
-                                    NULL);
-
-      cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_JMP,
-                                    cg_x86_64_op_new_direct(cg_sym_local_bb(
-                                        ctx->sub_sym, bb->jmp.jz_ref)),
-                                    NULL);
+      cg_inst_bb_jcc(ctx, bb, next, CG_X86_64_MNEM_JNZ, CG_X86_64_MNEM_JZ);
       break;
     }
     case MIR_BB_NEXT: {
-      cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_JMP,
-                                    cg_x86_64_op_new_direct(cg_sym_local_bb(
-                                        ctx->sub_sym, bb->jmp.next_ref)),
-                                    NULL);
+      if (bb->jmp.next_ref != next) {
+        cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_JMP,
+                                      cg_x86_64_op_new_direct(cg_sym_local_bb(
+                                          ctx->sub_sym, bb->jmp.next_ref)),
+                                      NULL);
+      }
       break;
     }
+    // deinit is placed right after the last bb
     case MIR_BB_TERM: {
-      cg_ctx_text_emplace_back_text(
-          ctx, CG_X86_64_MNEM_JMP,
-          cg_x86_64_op_new_direct(cg_sym_local_suf(ctx->sub_sym, "deinit")),
-          NULL);
+      if (next) {
+        cg_ctx_text_emplace_back_text(
+            ctx, CG_X86_64_MNEM_JMP,
+            cg_x86_64_op_new_direct(cg_sym_local_suf(ctx->sub_sym, "deinit")),
+            NULL);
+      }
       break;
     }
     case MIR_BB_UNKNOWN:
@@ -1452,9 +1789,109 @@ static void cg_inst_bb(cg_ctx *ctx, const mir_bb *bb) {
   }
 }
 
-void cg_inst_bbs(cg_ctx *ctx, const list_mir_bb *bbs) {
-  for (list_mir_bb_it it = list_mir_bb_begin(bbs); !END(it); NEXT(it)) {
+static int cg_inst_stmt_lit_str(const mir_stmt *stmt) {
+  if (stmt->kind != MIR_STMT_ASSIGN ||
+      stmt->assign.kind != MIR_STMT_ASSIGN_LIT) {
+    return 0;
+  }
+  const type_base *type = stmt->assign.from_lit->type_ref->type;
+  return type->kind == TYPE_PRIMITIVE &&
+         ((type_primitive *)type)->type == TYPE_PRIMITIVE_STRING;
+}
+
+uint64_t cg_inst_bbs_lits(cg_ctx *ctx, const vec_mir_bb *bbs, uint64_t hash) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(bbs); !END(it); NEXT(it)) {
+    const mir_bb *bb = GET(it);
+
+    for (vec_mir_stmt_it it_s = vec_mir_stmt_begin(bb->stmts); !END(it_s);
+         NEXT(it_s)) {
+      const mir_stmt *stmt = GET(it_s);
+
+      switch (stmt->kind) {
+        case MIR_STMT_MEMBER:
+        case MIR_STMT_MEMBER_REF:
+          if (cg_inst_stmt_member_ok(stmt)) {
+            hash = hash_chars(hash,
+                              cg_inst_lit_str_sym(ctx, stmt->member.member));
+          }
+          break;
+        case MIR_STMT_ASSIGN:
+          if (cg_inst_stmt_lit_str(stmt)) {
+            hash = hash_chars(hash,
+                              cg_inst_lit_str_sym(ctx, stmt->assign.from_lit));
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }
+  return hash;
+}
+
+static void cg_inst_value_read(cg_ctx *ctx, const mir_value *value) {
+  cg_value_meta *meta = cg_ctx_value_meta_find(ctx, value);
+  if (meta) {
+    ++meta->reads;
+  }
+}
+
+static void cg_inst_value_args_read(cg_ctx                  *ctx,
+                                    const vec_mir_value_ref *args) {
+  if (!args) {
+    return;
+  }
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(args); !END(it);
+       NEXT(it)) {
+    cg_inst_value_read(ctx, GET(it));
+  }
+}
+
+// counts reads of values once per subroutine, reads are the same as of
+// mir_stmt_reads_value
+static void cg_inst_bbs_reads(cg_ctx *ctx, const vec_mir_bb *bbs) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(bbs); !END(it); NEXT(it)) {
+    const mir_bb *bb = GET(it);
+
+    if (bb->jmp.cond_ref) {
+      cg_inst_value_read(ctx, bb->jmp.cond_ref);
+    }
+
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+      switch (stmt->kind) {
+        case MIR_STMT_OP:
+          cg_inst_value_args_read(ctx, stmt->op.args);
+          break;
+        case MIR_STMT_CALL:
+          cg_inst_value_args_read(ctx, stmt->call.args);
+          break;
+        case MIR_STMT_MEMBER:
+        case MIR_STMT_MEMBER_REF:
+          cg_inst_value_read(ctx, stmt->member.obj);
+          break;
+        case MIR_STMT_BUILTIN:
+          cg_inst_value_args_read(ctx, stmt->builtin.args);
+          break;
+        case MIR_STMT_ASSIGN:
+          if (stmt->assign.kind == MIR_STMT_ASSIGN_VALUE ||
+              stmt->assign.kind == MIR_STMT_ASSIGN_MOVE) {
+            cg_inst_value_read(ctx, stmt->assign.from_value);
+            cg_inst_value_read(ctx, stmt->assign.to);
+          }
+          break;
+      }
+    }
+  }
+}
+
+void cg_inst_bbs(cg_ctx *ctx, const vec_mir_bb *bbs) {
+  cg_inst_bbs_reads(ctx, bbs);
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(bbs); !END(it);) {
     const mir_bb *bb = GET(it);
-    cg_inst_bb(ctx, bb);
+    NEXT(it);
+    cg_inst_bb(ctx, bb, END(it) ? NULL : GET(it));
   }
 }
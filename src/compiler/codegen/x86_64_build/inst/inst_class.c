@@ -6,37 +6,27 @@
 #include "x86_64_core/value.h"
 #include <string.h>
 
-void cg_inst_class_methods(cg_ctx *ctx, list_cg_method_sym *methods) {
-  UNUSED(ctx);
-  while (!list_cg_method_sym_empty(methods)) {
-    cg_method_sym        *method_sym = list_cg_method_sym_pop_front(methods);
-    const mir_subroutine *sub        = method_sym->method_ref;
-
-    switch (sub->kind) {
-      case MIR_SUBROUTINE_DEFINED:
-        cg_inst_sub_def(ctx, sub, method_sym->sym);
-        method_sym->sym = NULL;
-        break;
-      case MIR_SUBROUTINE_DECLARED:
-        cg_exception_add_error(ctx->exceptions,
-                               EXCEPTION_CG_UNSUPPORTED_CLASS_DECLARED,
-                               sub->symbol_ref->span,
-                               "TODO: subroutine '%s' can't be instantiated",
-                               sub->symbol_ref->name);
-        break;
-      case MIR_SUBROUTINE_IMPORTED:
-        cg_exception_add_error(ctx->exceptions,
-                               EXCEPTION_CG_UNSUPPORTED_CLASS_IMPORTED,
-                               sub->symbol_ref->span,
-                               "TODO: subroutine '%s' can't be instantiated",
-                               sub->symbol_ref->name);
-        break;
-    }
-
-    cg_method_sym_free(method_sym);
+void cg_inst_class_method(cg_ctx *ctx, const mir_subroutine *sub, char *sym) {
+  switch (sub->kind) {
+    case MIR_SUBROUTINE_DEFINED:
+      cg_inst_sub_def(ctx, sub, sym);
+      return;
+    case MIR_SUBROUTINE_DECLARED:
+      cg_exception_add_error(ctx->exceptions,
+                             EXCEPTION_CG_UNSUPPORTED_CLASS_DECLARED,
+                             sub->symbol_ref->span,
+                             "TODO: subroutine '%s' can't be instantiated",
+                             sub->symbol_ref->name);
+      break;
+    case MIR_SUBROUTINE_IMPORTED:
+      cg_exception_add_error(ctx->exceptions,
+                             EXCEPTION_CG_UNSUPPORTED_CLASS_IMPORTED,
+                             sub->symbol_ref->span,
+                             "TODO: subroutine '%s' can't be instantiated",
+                             sub->symbol_ref->name);
+      break;
   }
-
-  list_cg_method_sym_free(methods);
+  free(sym);
 }
 
 static const char *cg_inst_class_init_symbols(cg_ctx *ctx,
@@ -44,7 +34,7 @@ static const char *cg_inst_class_init_symbols(cg_ctx *ctx,
 
   // add member names outside of symbols (to then reference them)
   uint64_t cnt = 0;
-  for (list_mir_value_it it = list_mir_value_begin(class->fields); !END(it);
+  for (vec_mir_value_it it = vec_mir_value_begin(class->fields); !END(it);
        NEXT(it), ++cnt) {
     const mir_value *value      = GET(it);
     const char      *value_name = value->symbol_ref->name;
@@ -90,11 +80,7 @@ static const char *cg_inst_class_init_symbols(cg_ctx *ctx,
 
 static void cg_inst_class_init_defaults(cg_ctx *ctx, const mir_class *class) {
   // count entries
-  uint64_t cnt = 0;
-  for (list_mir_value_it it = list_mir_value_begin(class->fields); !END(it);
-       NEXT(it)) {
-    ++cnt;
-  }
+  uint64_t cnt = vec_mir_value_size(class->fields);
   for (list_mir_subroutine_ref_it it =
            list_mir_subroutine_ref_begin(class->methods);
        !END(it); NEXT(it)) {
@@ -116,7 +102,7 @@ static void cg_inst_class_init_defaults(cg_ctx *ctx, const mir_class *class) {
   uint64_t idx = 0;
 
   // initialize values to void
-  for (list_mir_value_it it = list_mir_value_begin(class->fields); !END(it);
+  for (vec_mir_value_it it = vec_mir_value_begin(class->fields); !END(it);
        NEXT(it), ++idx) {
 
     cg_ctx_text_emplace_back_text(
@@ -159,8 +145,7 @@ static void cg_inst_class_init_defaults(cg_ctx *ctx, const mir_class *class) {
   }
 }
 
-static void cg_inst_class_init(cg_ctx *ctx, const mir_class *class,
-                               char   *init_sym) {
+void cg_inst_class_init(cg_ctx *ctx, const mir_class *class, char *init_sym) {
   ctx->sub     = NULL;
   ctx->sub_sym = init_sym;
 
@@ -169,10 +154,14 @@ static void cg_inst_class_init(cg_ctx *ctx, const mir_class *class,
   ctx->frame_size         = CG_X86_64_SIZE_QUAD;
   uint64_t frame_size_old = ctx->frame_size;
 
-  // store %rdi, it will be overwritten by constructing defaults
+  // store %rdi and frame in %rsi, they will be overwritten by constructing
+  // defaults
   ctx->frame_size += cg_ctx_text_emplace_back_text(
       ctx, CG_X86_64_MNEM_PUSHQ, cg_x86_64_op_new_register(CG_X86_64_REG_RDI),
       NULL);
+  ctx->frame_size += cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_PUSHQ, cg_x86_64_op_new_register(CG_X86_64_REG_RSI),
+      NULL);
 
   const char *init_symbols_sym = cg_inst_class_init_symbols(ctx, class);
   cg_inst_class_init_defaults(ctx, class);
@@ -185,6 +174,13 @@ static void cg_inst_class_init(cg_ctx *ctx, const mir_class *class,
       cg_x86_64_op_new_base_imm(rsp_rdi_offset, CG_X86_64_REG_RSP),
       cg_x86_64_op_new_register(CG_X86_64_REG_RDI), NULL);
 
+  // restore frame to %rcx
+  cg_ctx_text_emplace_back_text(
+      ctx, CG_X86_64_MNEM_MOVQ,
+      cg_x86_64_op_new_base_imm(rsp_rdi_offset - CG_X86_64_SIZE_QUAD,
+                                CG_X86_64_REG_RSP),
+      cg_x86_64_op_new_register(CG_X86_64_REG_RCX), NULL);
+
   // construct symbols table and store pointer to symbol table in %rsi
   cg_ctx_text_emplace_back_text(
       ctx, CG_X86_64_MNEM_LEAQ,
@@ -198,7 +194,8 @@ static void cg_inst_class_init(cg_ctx *ctx, const mir_class *class,
 
   cg_ctx_text_emplace_back_text(
       ctx, CG_X86_64_MNEM_CALL,
-      cg_x86_64_op_new_direct(strdup("__x86_64_make_object_setup")), NULL);
+      cg_x86_64_op_new_direct(strdup("__x86_64_make_object_setup_frame")),
+      NULL);
 
   // restore stack
   if (frame_size_old != ctx->frame_size) {
@@ -210,16 +207,3 @@ static void cg_inst_class_init(cg_ctx *ctx, const mir_class *class,
 
   cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_RETQ, NULL);
 }
-
-void cg_inst_class_inits(cg_ctx *ctx, list_cg_class_sym *class_inits) {
-  UNUSED(ctx);
-
-  while (!list_cg_class_sym_empty(class_inits)) {
-    cg_class_sym *class_sym = list_cg_class_sym_pop_front(class_inits);
-    cg_inst_class_init(ctx, class_sym->class_ref, class_sym->sym);
-    class_sym->sym = NULL;
-    cg_class_sym_free(class_sym);
-  }
-
-  list_cg_class_sym_free(class_inits);
-}
@@ -28,10 +28,14 @@ static void cg_add_dir_extern_core(cg_ctx *ctx) {
       ctx, cg_x86_64_symbol_new_extern(strdup("__x86_64_make_callable")));
   cg_ctx_text_push_back(
       ctx, cg_x86_64_symbol_new_extern(strdup("__x86_64_make_array")));
+  cg_ctx_text_push_back(
+      ctx, cg_x86_64_symbol_new_extern(strdup("__x86_64_make_array_frame")));
   cg_ctx_text_push_back(
       ctx, cg_x86_64_symbol_new_extern(strdup("__x86_64_make_object")));
   cg_ctx_text_push_back(
       ctx, cg_x86_64_symbol_new_extern(strdup("__x86_64_make_object_setup")));
+  cg_ctx_text_push_back(ctx, cg_x86_64_symbol_new_extern(
+                                 strdup("__x86_64_make_object_setup_frame")));
   cg_ctx_text_push_back(
       ctx, cg_x86_64_symbol_new_extern(strdup("__x86_64_make_error")));
   // print
@@ -17,6 +17,7 @@ void cg_ctx_init(cg_ctx *ctx, cg_x86_64 *code, cg_debug *debug,
   ctx->sub_debug      = NULL;
   ctx->line_cnt       = 0;
   ctx->map_value_meta = NULL;
+  ctx->map_stmt_frame = NULL;
   ctx->frame_size     = 0;
 
   ctx->bb = NULL;
@@ -38,6 +39,7 @@ void cg_ctx_deinit(cg_ctx *ctx) {
   ctx->sub_debug      = NULL;
   ctx->line_cnt       = 0;
   ctx->map_value_meta = NULL;
+  ctx->map_stmt_frame = NULL;
   ctx->frame_size     = 0;
 
   ctx->bb = NULL;
@@ -47,6 +49,47 @@ void cg_ctx_deinit(cg_ctx *ctx) {
   ctx->exceptions = NULL;
 }
 
+void cg_ctx_init_job(cg_ctx *ctx, const cg_ctx *parent, cg_x86_64 *code,
+                     cg_debug *debug, list_exception *exceptions) {
+  ctx->map_mir_sym       = parent->map_mir_sym;
+  ctx->lit_cnt           = parent->lit_cnt;
+  ctx->method_cnt        = parent->method_cnt;
+  ctx->map_type_sym_init = parent->map_type_sym_init;
+  ctx->class_cnt         = parent->class_cnt;
+
+  ctx->sub            = NULL;
+  ctx->sub_sym        = NULL;
+  ctx->sub_debug      = NULL;
+  ctx->line_cnt       = 0;
+  ctx->map_value_meta = NULL;
+  ctx->map_stmt_frame = NULL;
+  ctx->frame_size     = 0;
+
+  ctx->bb = NULL;
+
+  ctx->code       = code;
+  ctx->debug      = debug;
+  ctx->exceptions = exceptions;
+}
+
+// shared indices are owned by parent
+void cg_ctx_deinit_job(cg_ctx *ctx) {
+  ctx->map_mir_sym       = NULL;
+  ctx->map_type_sym_init = NULL;
+
+  ctx->sub            = NULL;
+  ctx->sub_sym        = NULL;
+  ctx->sub_debug      = NULL;
+  ctx->map_value_meta = NULL;
+  ctx->map_stmt_frame = NULL;
+
+  ctx->bb = NULL;
+
+  ctx->code       = NULL;
+  ctx->debug      = NULL;
+  ctx->exceptions = NULL;
+}
+
 static inline const char *cg_ctx_mir_sym_find(cg_ctx     *ctx,
                                               const void *mir_ref) {
   hashset_cg_mir_sym_it it = hashset_cg_mir_sym_find(
@@ -134,12 +177,30 @@ cg_value_meta *cg_ctx_value_meta_emplace(cg_ctx          *ctx,
   return GET(it);
 }
 
+const cg_stmt_frame *cg_ctx_stmt_frame_find(cg_ctx         *ctx,
+                                            const mir_stmt *stmt) {
+  hashset_cg_stmt_frame_it it = hashset_cg_stmt_frame_find(
+      ctx->map_stmt_frame, &(cg_stmt_frame){.stmt_ref = stmt});
+  if (END(it)) {
+    return NULL;
+  }
+  return GET(it);
+}
+
+cg_stmt_frame *cg_ctx_stmt_frame_emplace(cg_ctx         *ctx,
+                                         const mir_stmt *stmt_ref,
+                                         int64_t         offset) {
+  hashset_cg_stmt_frame_it it = hashset_cg_stmt_frame_insert(
+      ctx->map_stmt_frame, cg_stmt_frame_new(stmt_ref, offset));
+  return GET(it);
+}
+
 void cg_ctx_text_push_back(cg_ctx *ctx, void *unit) {
-  list_cg_x86_64_unit_push_back(ctx->code->text, (cg_x86_64_unit *)unit);
+  vec_cg_x86_64_unit_push_back(ctx->code->text, (cg_x86_64_unit *)unit);
 }
 
 void cg_ctx_data_push_back(cg_ctx *ctx, void *unit) {
-  list_cg_x86_64_unit_push_back(ctx->code->data, (cg_x86_64_unit *)unit);
+  vec_cg_x86_64_unit_push_back(ctx->code->data, (cg_x86_64_unit *)unit);
 }
 
 // args of type cg_x86_64_op*, last arg is NULL
@@ -0,0 +1,539 @@
+#include "inst.h"
+
+#include "util/hash.h"
+#include "util/macro.h"
+#include <string.h>
+
+// fold_lit (symbol of string literal to its content)
+typedef struct cg_fold_lit_struct {
+  const char *sym_ref;
+  const char *value_ref;
+} cg_fold_lit;
+
+static inline int container_cmp_cg_fold_lit(const void *lsv, const void *rsv) {
+  const cg_fold_lit *l = lsv;
+  const cg_fold_lit *r = rsv;
+  return container_cmp_chars(l->sym_ref, r->sym_ref);
+}
+static inline uint64_t container_hash_cg_fold_lit(const void *lsv) {
+  const cg_fold_lit *l = lsv;
+  return container_hash_chars(l->sym_ref);
+}
+HASHSET_DECLARE_STATIC_INLINE(hashset_cg_fold_lit, cg_fold_lit,
+                              container_cmp_cg_fold_lit, container_new_move,
+                              container_delete_ptr, container_hash_cg_fold_lit);
+
+// fold_idx (symbol of body to its index)
+typedef struct cg_fold_idx_struct {
+  const char *sym_ref;
+  size_t      idx;
+} cg_fold_idx;
+
+static inline int container_cmp_cg_fold_idx(const void *lsv, const void *rsv) {
+  const cg_fold_idx *l = lsv;
+  const cg_fold_idx *r = rsv;
+  return container_cmp_chars(l->sym_ref, r->sym_ref);
+}
+static inline uint64_t container_hash_cg_fold_idx(const void *lsv) {
+  const cg_fold_idx *l = lsv;
+  return container_hash_chars(l->sym_ref);
+}
+HASHSET_DECLARE_STATIC_INLINE(hashset_cg_fold_idx, cg_fold_idx,
+                              container_cmp_cg_fold_idx, container_new_move,
+                              container_delete_ptr, container_hash_cg_fold_idx);
+
+// REF (what symbol used in body refers to)
+typedef enum cg_fold_ref_kind_enum {
+  CG_FOLD_REF_NAME,  // compared by name
+  CG_FOLD_REF_LOCAL, // label of body, compared by suffix
+  CG_FOLD_REF_LIT,   // string literal, compared by content
+  CG_FOLD_REF_BODY,  // compared by class of body
+} cg_fold_ref_kind;
+
+typedef struct cg_fold_ref_struct {
+  cg_fold_ref_kind kind;
+  const char      *str;
+  size_t           body;
+} cg_fold_ref;
+
+// CTX
+typedef struct cg_fold_ctx_struct {
+  const cg_fold_body  *bodies;
+  size_t               cnt;
+  const char         **syms;     // of bodies, NULL if body has no symbol
+  char               **prefixes; // of local labels of bodies
+  hashset_cg_fold_lit *lits;
+  hashset_cg_fold_idx *idxs;
+  size_t              *classes; // lowest index of body considered identical
+} cg_fold_ctx;
+
+static const char *cg_fold_body_sym(const cg_fold_body *body) {
+  if (vec_cg_x86_64_unit_empty(body->code_ref->text)) {
+    return NULL;
+  }
+
+  const cg_x86_64_unit *unit = vec_cg_x86_64_unit_front(body->code_ref->text);
+  if (unit->kind != CG_X86_64_UNIT_SYMBOL) {
+    return NULL;
+  }
+
+  const cg_x86_64_symbol *symbol = (const cg_x86_64_symbol *)unit;
+  return symbol->kind == CG_X86_64_SYMBOL_TEXT ? symbol->name : NULL;
+}
+
+// literal is a data symbol followed by its ascii content
+static void cg_fold_ctx_add_lits(cg_fold_ctx *ctx, const cg_x86_64 *lits) {
+  const char *sym = NULL;
+
+  for (vec_cg_x86_64_unit_it it = vec_cg_x86_64_unit_begin(lits->data);
+       !END(it); NEXT(it)) {
+    const cg_x86_64_unit *unit = GET(it);
+
+    if (unit->kind == CG_X86_64_UNIT_SYMBOL) {
+      sym = ((const cg_x86_64_symbol *)unit)->name;
+      continue;
+    }
+
+    const cg_x86_64_data *data = (const cg_x86_64_data *)unit;
+    if (sym && unit->kind == CG_X86_64_UNIT_DATA &&
+        data->kind == CG_X86_64_DATA_ASCII) {
+      cg_fold_lit *lit = MALLOC(cg_fold_lit);
+      lit->sym_ref     = sym;
+      lit->value_ref   = (const char *)data->data_ascii;
+      hashset_cg_fold_lit_insert(ctx->lits, lit);
+    }
+    sym = NULL;
+  }
+}
+
+static void cg_fold_ctx_init(cg_fold_ctx *ctx, const cg_fold_body *bodies,
+                             size_t cnt) {
+  ctx->bodies   = bodies;
+  ctx->cnt      = cnt;
+  ctx->syms     = MALLOCN(const char *, cnt);
+  ctx->prefixes = MALLOCN(char *, cnt);
+  ctx->lits     = hashset_cg_fold_lit_new();
+  ctx->idxs     = hashset_cg_fold_idx_new();
+  ctx->classes  = MALLOCN(size_t, cnt);
+
+  for (size_t i = 0; i < cnt; ++i) {
+    const char *sym = cg_fold_body_sym(&bodies[i]);
+
+    ctx->syms[i]     = sym;
+    ctx->prefixes[i] = sym ? cg_sym_local_suf(sym, "") : NULL;
+    ctx->classes[i]  = i;
+
+    if (sym) {
+      cg_fold_idx *idx = MALLOC(cg_fold_idx);
+      idx->sym_ref     = sym;
+      idx->idx         = i;
+      hashset_cg_fold_idx_insert(ctx->idxs, idx);
+    }
+    if (bodies[i].lits_ref) {
+      cg_fold_ctx_add_lits(ctx, bodies[i].lits_ref);
+    }
+  }
+}
+
+static void cg_fold_ctx_deinit(cg_fold_ctx *ctx) {
+  for (size_t i = 0; i < ctx->cnt; ++i) {
+    free(ctx->prefixes[i]);
+  }
+  free(ctx->syms);
+  free(ctx->prefixes);
+  hashset_cg_fold_lit_free(ctx->lits);
+  hashset_cg_fold_idx_free(ctx->idxs);
+}
+
+static int cg_fold_ctx_foldable(const cg_fold_ctx *ctx, size_t body) {
+  return ctx->bodies[body].foldable && ctx->syms[body];
+}
+
+static cg_fold_ref cg_fold_ctx_ref(const cg_fold_ctx *ctx, size_t body,
+                                   const char *sym) {
+  cg_fold_ref ref = {.kind = CG_FOLD_REF_NAME, .str = sym, .body = 0};
+
+  hashset_cg_fold_lit_it it_lit =
+      hashset_cg_fold_lit_find(ctx->lits, &(cg_fold_lit){.sym_ref = sym});
+  if (!END(it_lit)) {
+    ref.kind = CG_FOLD_REF_LIT;
+    ref.str  = GET(it_lit)->value_ref;
+    return ref;
+  }
+
+  // also recursive calls, so bodies calling each other can be folded
+  hashset_cg_fold_idx_it it_idx =
+      hashset_cg_fold_idx_find(ctx->idxs, &(cg_fold_idx){.sym_ref = sym});
+  if (!END(it_idx)) {
+    ref.kind = CG_FOLD_REF_BODY;
+    ref.body = GET(it_idx)->idx;
+    return ref;
+  }
+
+  const char *prefix = ctx->prefixes[body];
+  size_t      len    = strlen(prefix);
+  if (!strncmp(sym, prefix, len)) {
+    ref.kind = CG_FOLD_REF_LOCAL;
+    ref.str  = sym + len;
+  }
+  return ref;
+}
+
+// HASH
+static uint64_t cg_fold_hash_sym(const cg_fold_ctx *ctx, size_t body,
+                                 const char *sym, uint64_t hash) {
+  cg_fold_ref ref = cg_fold_ctx_ref(ctx, body, sym);
+
+  // classes of bodies change, so they aren't hashed
+  hash = hash_uint64(hash, ref.kind);
+  return ref.kind == CG_FOLD_REF_BODY ? hash : hash_chars(hash, ref.str);
+}
+
+static uint64_t cg_fold_hash_op(const cg_fold_ctx *ctx, size_t body,
+                                const cg_x86_64_op *op, uint64_t hash) {
+  hash = hash_uint64(hash, op->kind);
+
+  switch (op->kind) {
+    case CG_X86_64_MODE_REGISTER:
+      return hash_uint64(hash, op->reg.reg);
+    case CG_X86_64_MODE_DIRECT:
+      return cg_fold_hash_sym(ctx, body, op->direct.sym_addr, hash);
+    case CG_X86_64_MODE_INDEXED:
+      hash = hash_uint64(hash, op->indexed.reg_index);
+      hash = hash_uint64(hash, op->indexed.imm_multi);
+      return cg_fold_hash_sym(ctx, body, op->indexed.sym_addr, hash);
+    case CG_X86_64_MODE_INDIRECT:
+      return hash_uint64(hash, op->indirect.reg_base);
+    case CG_X86_64_MODE_BASE_IMM:
+      hash = hash_uint64(hash, op->base_imm.reg_base);
+      return hash_uint64(hash, op->base_imm.imm_offset);
+    case CG_X86_64_MODE_BASE_SYM:
+      hash = hash_uint64(hash, op->base_sym.reg_base);
+      return cg_fold_hash_sym(ctx, body, op->base_sym.sym_addr, hash);
+    case CG_X86_64_MODE_IMMEDIATE:
+      return hash_uint64(hash, op->imm.imm_const);
+  }
+  return hash;
+}
+
+static uint64_t cg_fold_hash_data(const cg_fold_ctx *ctx, size_t body,
+                                  const cg_x86_64_data *data, uint64_t hash) {
+  hash = hash_uint64(hash, data->kind);
+  hash = hash_uint64(hash, data->data_len);
+
+  switch (data->kind) {
+    case CG_X86_64_DATA_BYTE:
+      return hash_uint64(hash, data->data_byte);
+    case CG_X86_64_DATA_WORD:
+      return hash_uint64(hash, data->data_word);
+    case CG_X86_64_DATA_LONG:
+      return hash_uint64(hash, data->data_long);
+    case CG_X86_64_DATA_QUAD:
+      return hash_uint64(hash, data->data_quad);
+    case CG_X86_64_DATA_ASCII:
+      return hash_chars(hash, (const char *)data->data_ascii);
+    case CG_X86_64_DATA_BYTES:
+      return hash_bytes(hash, data->data_bytes, data->data_len);
+    case CG_X86_64_DATA_SYMBOL:
+      return cg_fold_hash_sym(ctx, body, data->data_symbol, hash);
+  }
+  return hash;
+}
+
+static uint64_t cg_fold_hash_units(const cg_fold_ctx *ctx, size_t body,
+                                   const vec_cg_x86_64_unit *units,
+                                   uint64_t hash) {
+  for (vec_cg_x86_64_unit_it it =
+           vec_cg_x86_64_unit_begin((vec_cg_x86_64_unit *)units);
+       !END(it); NEXT(it)) {
+    const cg_x86_64_unit *unit = GET(it);
+    hash                       = hash_uint64(hash, unit->kind);
+
+    switch (unit->kind) {
+      case CG_X86_64_UNIT_SYMBOL: {
+        const cg_x86_64_symbol *symbol = (const cg_x86_64_symbol *)unit;
+        hash = hash_uint64(hash, symbol->kind);
+        hash = cg_fold_hash_sym(ctx, body, symbol->name, hash);
+        break;
+      }
+      case CG_X86_64_UNIT_TEXT: {
+        const cg_x86_64_text *text = (const cg_x86_64_text *)unit;
+        hash                       = hash_uint64(hash, text->mnem);
+        for (list_cg_x86_64_op_it it_op =
+                 list_cg_x86_64_op_begin(text->operands);
+             !END(it_op); NEXT(it_op)) {
+          hash = cg_fold_hash_op(ctx, body, GET(it_op), hash);
+        }
+        break;
+      }
+      case CG_X86_64_UNIT_DATA:
+        hash = cg_fold_hash_data(ctx, body, (const cg_x86_64_data *)unit,
+                                 hash);
+        break;
+    }
+  }
+  return hash;
+}
+
+static uint64_t cg_fold_hash_body(const cg_fold_ctx *ctx, size_t body) {
+  const cg_x86_64 *code = ctx->bodies[body].code_ref;
+  uint64_t         hash = cg_fold_hash_units(ctx, body, code->text, HASH_SEED);
+  return cg_fold_hash_units(ctx, body, code->data, hash);
+}
+
+// EQUALITY (under current classes of bodies)
+static int cg_fold_eq_sym(const cg_fold_ctx *ctx, size_t l_body,
+                          const char *l_sym, size_t r_body,
+                          const char *r_sym) {
+  cg_fold_ref l = cg_fold_ctx_ref(ctx, l_body, l_sym);
+  cg_fold_ref r = cg_fold_ctx_ref(ctx, r_body, r_sym);
+
+  if (l.kind != r.kind) {
+    return 0;
+  }
+  if (l.kind == CG_FOLD_REF_BODY) {
+    return ctx->classes[l.body] == ctx->classes[r.body];
+  }
+  return !strcmp(l.str, r.str);
+}
+
+static int cg_fold_eq_op(const cg_fold_ctx *ctx, size_t l_body,
+                         const cg_x86_64_op *l, size_t r_body,
+                         const cg_x86_64_op *r) {
+  if (l->kind != r->kind) {
+    return 0;
+  }
+
+  switch (l->kind) {
+    case CG_X86_64_MODE_DIRECT:
+      return cg_fold_eq_sym(ctx, l_body, l->direct.sym_addr, r_body,
+                            r->direct.sym_addr);
+    case CG_X86_64_MODE_INDEXED:
+      return l->indexed.reg_index == r->indexed.reg_index &&
+             l->indexed.imm_multi == r->indexed.imm_multi &&
+             cg_fold_eq_sym(ctx, l_body, l->indexed.sym_addr, r_body,
+                            r->indexed.sym_addr);
+    case CG_X86_64_MODE_BASE_SYM:
+      return l->base_sym.reg_base == r->base_sym.reg_base &&
+             cg_fold_eq_sym(ctx, l_body, l->base_sym.sym_addr, r_body,
+                            r->base_sym.sym_addr);
+    case CG_X86_64_MODE_REGISTER:
+    case CG_X86_64_MODE_INDIRECT:
+    case CG_X86_64_MODE_BASE_IMM:
+    case CG_X86_64_MODE_IMMEDIATE:
+      return !cg_x86_64_op_cmp(l, r);
+  }
+  return 0;
+}
+
+static int cg_fold_eq_data(const cg_fold_ctx *ctx, size_t l_body,
+                           const cg_x86_64_data *l, size_t r_body,
+                           const cg_x86_64_data *r) {
+  if (l->kind != r->kind || l->data_len != r->data_len) {
+    return 0;
+  }
+
+  switch (l->kind) {
+    case CG_X86_64_DATA_BYTE:
+      return l->data_byte == r->data_byte;
+    case CG_X86_64_DATA_WORD:
+      return l->data_word == r->data_word;
+    case CG_X86_64_DATA_LONG:
+      return l->data_long == r->data_long;
+    case CG_X86_64_DATA_QUAD:
+      return l->data_quad == r->data_quad;
+    case CG_X86_64_DATA_ASCII:
+      return !strcmp((const char *)l->data_ascii,
+                     (const char *)r->data_ascii);
+    case CG_X86_64_DATA_BYTES:
+      return !memcmp(l->data_bytes, r->data_bytes, l->data_len);
+    case CG_X86_64_DATA_SYMBOL:
+      return cg_fold_eq_sym(ctx, l_body, l->data_symbol, r_body,
+                            r->data_symbol);
+  }
+  return 0;
+}
+
+static int cg_fold_eq_unit(const cg_fold_ctx *ctx, size_t l_body,
+                           const cg_x86_64_unit *l, size_t r_body,
+                           const cg_x86_64_unit *r) {
+  if (l->kind != r->kind) {
+    return 0;
+  }
+
+  switch (l->kind) {
+    case CG_X86_64_UNIT_SYMBOL: {
+      const cg_x86_64_symbol *l_symbol = (const cg_x86_64_symbol *)l;
+      const cg_x86_64_symbol *r_symbol = (const cg_x86_64_symbol *)r;
+      return l_symbol->kind == r_symbol->kind &&
+             cg_fold_eq_sym(ctx, l_body, l_symbol->name, r_body,
+                            r_symbol->name);
+    }
+    case CG_X86_64_UNIT_TEXT: {
+      const cg_x86_64_text *l_text = (const cg_x86_64_text *)l;
+      const cg_x86_64_text *r_text = (const cg_x86_64_text *)r;
+      if (l_text->mnem != r_text->mnem) {
+        return 0;
+      }
+
+      list_cg_x86_64_op_it it_l = list_cg_x86_64_op_begin(l_text->operands);
+      list_cg_x86_64_op_it it_r = list_cg_x86_64_op_begin(r_text->operands);
+
+      for (; !END(it_l) && !END(it_r); NEXT(it_l), NEXT(it_r)) {
+        if (!cg_fold_eq_op(ctx, l_body, GET(it_l), r_body, GET(it_r))) {
+          return 0;
+        }
+      }
+      return END(it_l) && END(it_r);
+    }
+    case CG_X86_64_UNIT_DATA:
+      return cg_fold_eq_data(ctx, l_body, (const cg_x86_64_data *)l, r_body,
+                             (const cg_x86_64_data *)r);
+  }
+  return 0;
+}
+
+static int cg_fold_eq_units(const cg_fold_ctx *ctx, size_t l_body,
+                            vec_cg_x86_64_unit *l, size_t r_body,
+                            vec_cg_x86_64_unit *r) {
+  size_t size = vec_cg_x86_64_unit_size(l);
+  if (size != vec_cg_x86_64_unit_size(r)) {
+    return 0;
+  }
+
+  for (size_t i = 0; i < size; ++i) {
+    if (!cg_fold_eq_unit(ctx, l_body, vec_cg_x86_64_unit_at(l, i), r_body,
+                         vec_cg_x86_64_unit_at(r, i))) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static int cg_fold_eq_body(const cg_fold_ctx *ctx, size_t l, size_t r) {
+  const cg_x86_64 *l_code = ctx->bodies[l].code_ref;
+  const cg_x86_64 *r_code = ctx->bodies[r].code_ref;
+
+  return cg_fold_eq_units(ctx, l, l_code->text, r, r_code->text) &&
+         cg_fold_eq_units(ctx, l, l_code->data, r, r_code->data);
+}
+
+// bodies are grouped by hash first, groups are split until bodies of each
+// group are identical assuming references to bodies of same group are equal
+size_t *cg_fold(const cg_fold_body *bodies, size_t cnt) {
+  cg_fold_ctx ctx;
+  cg_fold_ctx_init(&ctx, bodies, cnt);
+
+  uint64_t *hashes = MALLOCN(uint64_t, cnt);
+  size_t   *split  = MALLOCN(size_t, cnt);
+
+  for (size_t i = 0; i < cnt; ++i) {
+    if (!cg_fold_ctx_foldable(&ctx, i)) {
+      continue;
+    }
+    hashes[i] = cg_fold_hash_body(&ctx, i);
+
+    for (size_t j = 0; j < i; ++j) {
+      if (ctx.classes[j] == j && cg_fold_ctx_foldable(&ctx, j) &&
+          hashes[j] == hashes[i]) {
+        ctx.classes[i] = j;
+        break;
+      }
+    }
+  }
+
+  int changed;
+  do {
+    changed = 0;
+
+    for (size_t i = 0; i < cnt; ++i) {
+      size_t class = ctx.classes[i];
+      split[i]     = i;
+
+      for (size_t j = class; j < i; ++j) {
+        if (ctx.classes[j] == class && split[j] == j &&
+            cg_fold_eq_body(&ctx, i, j)) {
+          split[i] = j;
+          break;
+        }
+      }
+      changed |= split[i] != class;
+    }
+
+    size_t *classes = ctx.classes;
+    ctx.classes     = split;
+    split           = classes;
+  } while (changed);
+
+  size_t *folded = ctx.classes;
+
+  free(hashes);
+  free(split);
+  cg_fold_ctx_deinit(&ctx);
+  return folded;
+}
+
+hashset_cg_fold_sym *cg_fold_syms(const cg_fold_body *bodies,
+                                  const size_t *folded, size_t cnt) {
+  hashset_cg_fold_sym *syms = hashset_cg_fold_sym_new();
+
+  for (size_t i = 0; i < cnt; ++i) {
+    if (folded[i] != i) {
+      const char *sym    = cg_fold_body_sym(&bodies[i]);
+      const char *sym_to = cg_fold_body_sym(&bodies[folded[i]]);
+      hashset_cg_fold_sym_insert(syms,
+                                 cg_fold_sym_new(strdup(sym), strdup(sym_to)));
+    }
+  }
+  return syms;
+}
+
+static void cg_fold_rewrite_sym(hashset_cg_fold_sym *syms, char **sym) {
+  hashset_cg_fold_sym_it it =
+      hashset_cg_fold_sym_find(syms, &(cg_fold_sym){.sym = *sym});
+  if (!END(it)) {
+    free(*sym);
+    *sym = strdup(GET(it)->sym_to);
+  }
+}
+
+void cg_fold_rewrite(vec_cg_x86_64_unit *units, hashset_cg_fold_sym *syms) {
+  for (vec_cg_x86_64_unit_it it = vec_cg_x86_64_unit_begin(units); !END(it);
+       NEXT(it)) {
+    cg_x86_64_unit *unit = GET(it);
+
+    if (unit->kind == CG_X86_64_UNIT_DATA) {
+      cg_x86_64_data *data = (cg_x86_64_data *)unit;
+      if (data->kind == CG_X86_64_DATA_SYMBOL) {
+        cg_fold_rewrite_sym(syms, &data->data_symbol);
+      }
+      continue;
+    }
+    if (unit->kind != CG_X86_64_UNIT_TEXT) {
+      continue;
+    }
+
+    cg_x86_64_text *text = (cg_x86_64_text *)unit;
+    for (list_cg_x86_64_op_it it_op = list_cg_x86_64_op_begin(text->operands);
+         !END(it_op); NEXT(it_op)) {
+      cg_x86_64_op *op = GET(it_op);
+
+      switch (op->kind) {
+        case CG_X86_64_MODE_DIRECT:
+          cg_fold_rewrite_sym(syms, &op->direct.sym_addr);
+          break;
+        case CG_X86_64_MODE_INDEXED:
+          cg_fold_rewrite_sym(syms, &op->indexed.sym_addr);
+          break;
+        case CG_X86_64_MODE_BASE_SYM:
+          cg_fold_rewrite_sym(syms, &op->base_sym.sym_addr);
+          break;
+        case CG_X86_64_MODE_REGISTER:
+        case CG_X86_64_MODE_INDIRECT:
+        case CG_X86_64_MODE_BASE_IMM:
+        case CG_X86_64_MODE_IMMEDIATE:
+          break;
+      }
+    }
+  }
+}
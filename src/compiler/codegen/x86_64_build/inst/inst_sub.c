@@ -5,10 +5,12 @@
 #include "util/log.h"
 #include "util/macro.h"
 #include "x86_64_core/value.h"
+#include "x86_64_core/value/array.h"
+#include "x86_64_core/value/object.h"
 #include <string.h>
 
 static void cg_inst_sub_def_prologue_push(cg_ctx *ctx) {
-  list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.params);
+  vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.params);
 
   if (END(it)) {
     return;
@@ -84,7 +86,7 @@ static void cg_inst_sub_def_prologue(cg_ctx *ctx) {
 
 // allocate local memory for all params and copy them
 static void cg_inst_sub_def_params_copy(cg_ctx *ctx) {
-  uint64_t params           = list_mir_value_size(ctx->sub->defined.params);
+  uint64_t params           = vec_mir_value_size(ctx->sub->defined.params);
   uint64_t frame_size_old   = ctx->frame_size;
   uint64_t frame_size_start = ctx->frame_size - params * CG_X86_64_SIZE_QUAD;
 
@@ -102,19 +104,12 @@ static void cg_inst_sub_def_params_copy(cg_ctx *ctx) {
         cg_x86_64_op_new_register(CG_X86_64_REG_RSP), NULL);
   }
 
-  // reverse
-  list_mir_value_ref *params_rv = list_mir_value_ref_new();
-  for (list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.params);
-       !END(it); NEXT(it)) {
-    list_mir_value_ref_push_front(params_rv, GET(it));
-  }
-
   uint64_t offset_new = -(frame_size_start + CG_X86_64_SIZE_QUAD +
                           (sizeof(x86_64_value) * (params - 1)));
 
-  for (list_mir_value_ref_it it = list_mir_value_ref_begin(params_rv); !END(it);
-       NEXT(it), offset_new += sizeof(x86_64_value)) {
-    const mir_value *value      = GET(it);
+  // in reverse
+  for (size_t i = params; i-- > 0; offset_new += sizeof(x86_64_value)) {
+    const mir_value *value      = vec_mir_value_at(ctx->sub->defined.params, i);
     cg_value_meta   *value_meta = cg_ctx_value_meta_find(ctx, value);
 
     cg_ctx_text_emplace_back_text(
@@ -147,7 +142,6 @@ static void cg_inst_sub_def_params_copy(cg_ctx *ctx) {
     value_meta->offset = offset_new;
   }
 
-  list_mir_value_ref_free(params_rv);
 }
 
 static void cg_inst_sub_def_epilogue(cg_ctx *ctx) {
@@ -165,6 +159,50 @@ static void cg_inst_sub_def_epilogue(cg_ctx *ctx) {
   cg_ctx_text_emplace_back_text(ctx, CG_X86_64_MNEM_RETQ, NULL);
 }
 
+// data of makes that don't escape subroutine, see mir_escape
+static void cg_inst_sub_def_frame_data_reserve(cg_ctx *ctx) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(ctx->sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb = GET(it);
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+      if (stmt->kind != MIR_STMT_BUILTIN || !stmt->builtin.frame_capacity) {
+        continue;
+      }
+
+      uint64_t header = stmt->builtin.type->type->kind == TYPE_ARRAY
+                            ? sizeof(x86_64_data_array)
+                            : sizeof(x86_64_data_object);
+
+      ctx->frame_size +=
+          header + stmt->builtin.frame_capacity * sizeof(x86_64_value);
+      cg_ctx_stmt_frame_emplace(ctx, stmt, cg_ctx_rbp_offset(ctx));
+    }
+  }
+}
+
+// data is free until make places it. Walks stmts in mir order as reserve
+// does, so output doesn't depend on addresses of stmts
+static void cg_inst_sub_def_frame_data_init(cg_ctx *ctx) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(ctx->sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb = GET(it);
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+      if (stmt->kind != MIR_STMT_BUILTIN || !stmt->builtin.frame_capacity) {
+        continue;
+      }
+
+      const cg_stmt_frame *frame = cg_ctx_stmt_frame_find(ctx, stmt);
+      cg_ctx_text_emplace_back_text(
+          ctx, CG_X86_64_MNEM_MOVQ, cg_x86_64_op_new_immediate(0),
+          cg_x86_64_op_new_base_imm(frame->offset, CG_X86_64_REG_RBP), NULL);
+    }
+  }
+}
+
 static void cg_inst_sub_def_locals_init(cg_ctx *ctx, int ret) {
   cg_ctx_text_push_back(
       ctx, cg_x86_64_symbol_new_text(cg_sym_local_suf(ctx->sub_sym, "init")));
@@ -178,18 +216,19 @@ static void cg_inst_sub_def_locals_init(cg_ctx *ctx, int ret) {
                               cg_ctx_rbp_offset(ctx), 0);
   }
 
-  for (list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.vars);
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.vars);
        !END(it); NEXT(it)) {
     const mir_value *value = GET(it);
     ctx->frame_size += sizeof(x86_64_value);
     cg_ctx_value_meta_emplace(ctx, value, cg_ctx_rbp_offset(ctx), 0);
   }
-  for (list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.tmps);
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.tmps);
        !END(it); NEXT(it)) {
     const mir_value *value = GET(it);
     ctx->frame_size += sizeof(x86_64_value);
     cg_ctx_value_meta_emplace(ctx, value, cg_ctx_rbp_offset(ctx), 0);
   }
+  cg_inst_sub_def_frame_data_reserve(ctx);
 
   // allocate memory on  stack
   ctx->frame_size = cg_aligned(ctx->frame_size);
@@ -215,7 +254,7 @@ static void cg_inst_sub_def_locals_init(cg_ctx *ctx, int ret) {
         cg_x86_64_op_new_direct(strdup("__x86_64_make_void")), NULL);
   }
 
-  for (list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.vars);
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.vars);
        !END(it); NEXT(it)) {
     const mir_value     *value = GET(it);
     const cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -230,7 +269,7 @@ static void cg_inst_sub_def_locals_init(cg_ctx *ctx, int ret) {
         cg_x86_64_op_new_direct(strdup("__x86_64_make_void")), NULL);
   }
 
-  for (list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.tmps);
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.tmps);
        !END(it); NEXT(it)) {
     const mir_value     *value = GET(it);
     const cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -244,13 +283,15 @@ static void cg_inst_sub_def_locals_init(cg_ctx *ctx, int ret) {
         ctx, CG_X86_64_MNEM_CALL,
         cg_x86_64_op_new_direct(strdup("__x86_64_make_void")), NULL);
   }
+
+  cg_inst_sub_def_frame_data_init(ctx);
 }
 
 static void cg_inst_sub_def_locals_deinit(cg_ctx *ctx) {
   cg_ctx_text_push_back(
       ctx, cg_x86_64_symbol_new_text(cg_sym_local_suf(ctx->sub_sym, "deinit")));
 
-  for (list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.vars);
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.vars);
        !END(it); NEXT(it)) {
     const mir_value     *value = GET(it);
     const cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -277,7 +318,7 @@ static void cg_inst_sub_def_locals_deinit(cg_ctx *ctx) {
                                   NULL);
   }
 
-  for (list_mir_value_it it = list_mir_value_begin(ctx->sub->defined.tmps);
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.tmps);
        !END(it); NEXT(it)) {
     const mir_value     *value = GET(it);
     const cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -343,6 +384,7 @@ void cg_inst_sub_def(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
   cg_ctx_text_push_back(ctx, cg_x86_64_symbol_new_text(sub_sym));
 
   ctx->map_value_meta = hashset_cg_value_meta_new();
+  ctx->map_stmt_frame = hashset_cg_stmt_frame_new();
   ctx->frame_size     = CG_X86_64_SIZE_QUAD;
 
   if (cg_debug_enabled(ctx->debug)) {
@@ -368,7 +410,7 @@ void cg_inst_sub_def(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
   // }
 
   if (cg_debug_enabled(ctx->debug)) {
-    for (list_mir_value_it it = list_mir_value_begin(sub->defined.params);
+    for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.params);
          !END(it); NEXT(it)) {
       mir_value     *value = GET(it);
       cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -377,7 +419,7 @@ void cg_inst_sub_def(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
           cg_debug_param_new(meta->offset, value->symbol_ref->name));
     }
 
-    for (list_mir_value_it it = list_mir_value_begin(sub->defined.vars);
+    for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.vars);
          !END(it); NEXT(it)) {
       mir_value     *value = GET(it);
       cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -402,6 +444,7 @@ void cg_inst_sub_def(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
   }
 
   hashset_cg_value_meta_free(ctx->map_value_meta);
+  hashset_cg_stmt_frame_free(ctx->map_stmt_frame);
 }
 
 static void cg_inst_sub_main_prologue(cg_ctx *ctx) {
@@ -473,6 +516,7 @@ void cg_inst_sub_main(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
   cg_ctx_text_push_back(ctx, cg_x86_64_symbol_new_text(sub_sym));
 
   ctx->map_value_meta = hashset_cg_value_meta_new();
+  ctx->map_stmt_frame = hashset_cg_stmt_frame_new();
   ctx->frame_size     = CG_X86_64_SIZE_QUAD;
 
   if (cg_debug_enabled(ctx->debug)) {
@@ -496,7 +540,7 @@ void cg_inst_sub_main(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
   // }
 
   if (cg_debug_enabled(ctx->debug)) {
-    for (list_mir_value_it it = list_mir_value_begin(sub->defined.params);
+    for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.params);
          !END(it); NEXT(it)) {
       mir_value     *value = GET(it);
       cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -505,7 +549,7 @@ void cg_inst_sub_main(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
           cg_debug_param_new(meta->offset, value->symbol_ref->name));
     }
 
-    for (list_mir_value_it it = list_mir_value_begin(sub->defined.vars);
+    for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.vars);
          !END(it); NEXT(it)) {
       mir_value     *value = GET(it);
       cg_value_meta *meta  = cg_ctx_value_meta_find(ctx, value);
@@ -530,6 +574,7 @@ void cg_inst_sub_main(cg_ctx *ctx, const mir_subroutine *sub, char *sub_sym) {
   }
 
   hashset_cg_value_meta_free(ctx->map_value_meta);
+  hashset_cg_stmt_frame_free(ctx->map_stmt_frame);
 }
 
 int cg_inst_sub_extern_check_param(const type_base *param) {
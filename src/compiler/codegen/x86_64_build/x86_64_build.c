@@ -1,5 +1,6 @@
 #include "x86_64_build.h"
 
+#include "compiler/codegen/exception.h"
 #include "compiler/codegen/x86_64_build/debug_emit/debug_emit.h"
 #include "compiler/codegen/x86_64_build/inst/inst.h"
 
@@ -9,16 +10,25 @@ static inline int cg_ok(list_exception *exceptions, int ignore_errors) {
           ignore_errors);
 }
 
-cg_x86_64_build_result cg_x86_64_build(const mir *mir, int ignore_errors) {
+cg_x86_64_build_result cg_x86_64_build(const mir *mir, int opt_level,
+                                       int ignore_errors, size_t jobs,
+                                       const char *cache_dir) {
   cg_x86_64_build_result result = {
       .code       = cg_x86_64_new(),
       .exceptions = list_exception_new(),
   };
 
   cg_debug *debug = NULL;
+  cg_cache *cache = NULL;
+
+  if (cache_dir && !(cache = cg_cache_new(cache_dir))) {
+    cg_exception_add_warning(result.exceptions, EXCEPTION_CG_CACHE_UNAVAILABLE,
+                             NULL, "cache directory '%s' can't be created",
+                             cache_dir);
+  }
 
   if (cg_ok(result.exceptions, ignore_errors)) {
-    cg_inst_result r = cg_inst(result.code, mir);
+    cg_inst_result r = cg_inst(result.code, mir, opt_level, jobs, cache);
     list_exception_extend(result.exceptions, r.exceptions);
     debug = r.debug;
   }
@@ -28,7 +38,9 @@ cg_x86_64_build_result cg_x86_64_build(const mir *mir, int ignore_errors) {
     list_exception_extend(result.exceptions, r.exceptions);
   }
 
+  // cache owns strings referenced by loaded debug info
   cg_debug_free(debug);
+  cg_cache_free(cache);
 
   return result;
 }
@@ -9,4 +9,8 @@ typedef struct cg_x86_64_build_result_struct {
   list_exception *exceptions;
 } cg_x86_64_build_result;
 
-cg_x86_64_build_result cg_x86_64_build(const mir *mir, int ignore_errors);
+// jobs is number of threads used for instantiation, 0 for each processor.
+// Instantiated subroutines are cached in cache_dir if it is not NULL
+cg_x86_64_build_result cg_x86_64_build(const mir *mir, int opt_level,
+                                       int ignore_errors, size_t jobs,
+                                       const char *cache_dir);
@@ -2,9 +2,17 @@
 
 #include "compiler/codegen/x86_64/x86_64.h"
 #include "compiler/exception/list.h"
+#include <stdio.h>
 
 typedef struct cg_x86_64_emit_ctx_struct {
   list_exception *exceptions;
+  FILE           *stream;
+  FILE           *tee; // NULL if output isn't duplicated
 } cg_x86_64_emit_ctx;
 
-char *cg_x86_64_emit_gas(cg_x86_64_emit_ctx *ctx, const cg_x86_64 *code);
+// assembly is written to streams while it is emitted
+void cg_x86_64_emit_gas(cg_x86_64_emit_ctx *ctx, const cg_x86_64 *code);
+
+// relocatable ELF object, size is set to length of returned buffer
+uint8_t *cg_x86_64_emit_elf(cg_x86_64_emit_ctx *ctx, const cg_x86_64 *code,
+                            size_t *size);
@@ -0,0 +1,285 @@
+#include "emit.h"
+#include "object.h"
+#include "util/macro.h"
+#include <elf.h>
+#include <stdio.h>
+#include <string.h>
+
+typedef struct cg_section_struct {
+  const char *name;
+  uint32_t    type;
+  uint64_t    flags;
+} cg_section;
+
+static const cg_section CG_SECTIONS[CG_X86_64_OBJECT_SECTION_CNT] = {
+    [CG_X86_64_OBJECT_SECTION_DATA] = {".data", SHT_PROGBITS,
+                                       SHF_ALLOC | SHF_WRITE},
+    [CG_X86_64_OBJECT_SECTION_TEXT] = {".text", SHT_PROGBITS,
+                                       SHF_ALLOC | SHF_EXECINSTR},
+    [CG_X86_64_OBJECT_SECTION_DEBUG_INFO] = {".u_debug_info", SHT_PROGBITS, 0},
+    [CG_X86_64_OBJECT_SECTION_DEBUG_LINE] = {".u_debug_line", SHT_PROGBITS, 0},
+    [CG_X86_64_OBJECT_SECTION_DEBUG_STR]  = {".u_debug_str", SHT_PROGBITS, 0},
+};
+
+// CTX
+typedef struct cg_ctx_struct {
+  cg_x86_64_object *obj;
+  // placement of sections in file
+  uint64_t offsets[CG_X86_64_OBJECT_SECTION_CNT];
+  uint64_t rela_offsets[CG_X86_64_OBJECT_SECTION_CNT];
+  uint32_t rela_idxs[CG_X86_64_OBJECT_SECTION_CNT];
+} cg_ctx;
+
+static void cg_ctx_init(cg_ctx *ctx, cg_x86_64_object *obj) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->obj = obj;
+}
+
+static void cg_ctx_deinit(cg_ctx *ctx) { ctx->obj = NULL; }
+
+static int cg_sym_is_local_label(const cg_x86_64_object_sym *sym) {
+  return !strncmp(sym->name, ".L", 2);
+}
+
+// WRITE
+static uint32_t cg_strtab_add(cg_x86_64_bytes *strtab, const char *str) {
+  uint32_t offset = strtab->size;
+  cg_x86_64_bytes_append(strtab, str, strlen(str) + 1);
+  return offset;
+}
+
+static void cg_bytes_align(cg_x86_64_bytes *bytes, size_t align) {
+  static const uint8_t zeros[16] = {0};
+  cg_x86_64_bytes_append(bytes, zeros, (align - bytes->size % align) % align);
+}
+
+static void cg_symtab_add(cg_x86_64_bytes *symtab, uint32_t name,
+                          unsigned char info, uint16_t shndx, uint64_t value) {
+  Elf64_Sym sym = {
+      .st_name  = name,
+      .st_info  = info,
+      .st_other = STV_DEFAULT,
+      .st_shndx = shndx,
+      .st_value = value,
+      .st_size  = 0,
+  };
+  cg_x86_64_bytes_append(symtab, &sym, sizeof(sym));
+}
+
+static void cg_shdr_add(cg_x86_64_bytes *shdrs, uint32_t name, uint32_t type,
+                        uint64_t flags, uint64_t offset, uint64_t size,
+                        uint32_t link, uint32_t info, uint64_t align,
+                        uint64_t entsize) {
+  Elf64_Shdr shdr = {
+      .sh_name      = name,
+      .sh_type      = type,
+      .sh_flags     = flags,
+      .sh_addr      = 0,
+      .sh_offset    = offset,
+      .sh_size      = size,
+      .sh_link      = link,
+      .sh_info      = info,
+      .sh_addralign = align,
+      .sh_entsize   = entsize,
+  };
+  cg_x86_64_bytes_append(shdrs, &shdr, sizeof(shdr));
+}
+
+// symbol table: null, sections, locals, then globals
+static uint32_t cg_ctx_write_symtab(cg_ctx *ctx, cg_x86_64_bytes *symtab,
+                                    cg_x86_64_bytes *strtab) {
+  uint32_t idx = 0;
+
+  cg_symtab_add(symtab, 0, 0, SHN_UNDEF, 0);
+  ++idx;
+
+  for (size_t i = CG_X86_64_OBJECT_SECTION_DATA;
+       i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    cg_symtab_add(symtab, 0, ELF64_ST_INFO(STB_LOCAL, STT_SECTION), i, 0);
+    ++idx;
+  }
+
+  for (list_cg_x86_64_object_sym_ref_it it =
+           list_cg_x86_64_object_sym_ref_begin(ctx->obj->sym_refs); !END(it);
+       NEXT(it)) {
+    cg_x86_64_object_sym *sym = GET(it);
+    if (sym->global || sym->section == CG_X86_64_OBJECT_SECTION_UNDEF ||
+        cg_sym_is_local_label(sym)) {
+      continue;
+    }
+    cg_symtab_add(symtab, cg_strtab_add(strtab, sym->name),
+                  ELF64_ST_INFO(STB_LOCAL, STT_NOTYPE), sym->section,
+                  sym->value);
+    sym->idx = idx++;
+  }
+
+  uint32_t globals_idx = idx;
+
+  for (list_cg_x86_64_object_sym_ref_it it =
+           list_cg_x86_64_object_sym_ref_begin(ctx->obj->sym_refs); !END(it);
+       NEXT(it)) {
+    cg_x86_64_object_sym *sym = GET(it);
+    if (!sym->global && sym->section != CG_X86_64_OBJECT_SECTION_UNDEF) {
+      continue;
+    }
+    cg_symtab_add(symtab, cg_strtab_add(strtab, sym->name),
+                  ELF64_ST_INFO(STB_GLOBAL, STT_NOTYPE), sym->section,
+                  sym->value);
+    sym->idx = idx++;
+  }
+
+  return globals_idx;
+}
+
+static void cg_ctx_write_rela(cg_ctx *ctx, cg_x86_64_bytes *out,
+                              const cg_x86_64_object_section *section) {
+  for (list_cg_x86_64_reloc_it it = list_cg_x86_64_reloc_begin(section->relocs);
+       !END(it); NEXT(it)) {
+    const cg_x86_64_reloc      *reloc = GET(it);
+    const cg_x86_64_object_sym *sym =
+        cg_x86_64_object_sym_get(ctx->obj, reloc->sym_ref);
+
+    // local symbols may be omitted, so they are referenced through section
+    uint32_t sym_idx = sym->idx;
+    int64_t  addend  = reloc->addend;
+    if (!sym->global && sym->section != CG_X86_64_OBJECT_SECTION_UNDEF) {
+      sym_idx = sym->section;
+      addend += (int64_t)sym->value;
+    }
+
+    Elf64_Rela rela = {
+        .r_offset = reloc->offset,
+        .r_info   = ELF64_R_INFO(sym_idx, reloc->kind),
+        .r_addend = addend,
+    };
+    cg_x86_64_bytes_append(out, &rela, sizeof(rela));
+  }
+}
+
+static uint8_t *cg_ctx_write(cg_ctx *ctx, size_t *size) {
+  cg_x86_64_bytes out;
+  cg_x86_64_bytes symtab;
+  cg_x86_64_bytes strtab;
+  cg_x86_64_bytes shstrtab;
+  cg_x86_64_bytes shdrs;
+  cg_x86_64_bytes_init(&out);
+  cg_x86_64_bytes_init(&symtab);
+  cg_x86_64_bytes_init(&strtab);
+  cg_x86_64_bytes_init(&shstrtab);
+  cg_x86_64_bytes_init(&shdrs);
+
+  cg_strtab_add(&strtab, "");
+  cg_strtab_add(&shstrtab, "");
+  uint32_t globals_idx = cg_ctx_write_symtab(ctx, &symtab, &strtab);
+
+  // header is written last, when offsets are known
+  Elf64_Ehdr ehdr;
+  memset(&ehdr, 0, sizeof(ehdr));
+  cg_x86_64_bytes_append(&out, &ehdr, sizeof(ehdr));
+
+  // section contents, indices of relocation sections follow content sections
+  uint32_t shnum = CG_X86_64_OBJECT_SECTION_CNT;
+  for (size_t i = CG_X86_64_OBJECT_SECTION_DATA;
+       i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    const cg_x86_64_object_section *section = &ctx->obj->sections[i];
+    ctx->offsets[i]                         = out.size;
+    cg_x86_64_bytes_append(&out, section->bytes.data, section->bytes.size);
+  }
+  for (size_t i = CG_X86_64_OBJECT_SECTION_DATA;
+       i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    const cg_x86_64_object_section *section = &ctx->obj->sections[i];
+    if (list_cg_x86_64_reloc_size(section->relocs)) {
+      cg_bytes_align(&out, 8);
+      ctx->rela_offsets[i] = out.size;
+      ctx->rela_idxs[i]    = shnum++;
+      cg_ctx_write_rela(ctx, &out, section);
+    }
+  }
+
+  uint32_t symtab_idx   = shnum++;
+  uint32_t strtab_idx   = shnum++;
+  uint32_t shstrtab_idx = shnum++;
+
+  cg_bytes_align(&out, 8);
+  uint64_t symtab_offset = out.size;
+  cg_x86_64_bytes_append(&out, symtab.data, symtab.size);
+  uint64_t strtab_offset = out.size;
+  cg_x86_64_bytes_append(&out, strtab.data, strtab.size);
+
+  // section headers in order of indices
+  cg_shdr_add(&shdrs, 0, SHT_NULL, 0, 0, 0, 0, 0, 0, 0);
+  for (size_t i = CG_X86_64_OBJECT_SECTION_DATA;
+       i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    const cg_section *section = &CG_SECTIONS[i];
+    cg_shdr_add(&shdrs, cg_strtab_add(&shstrtab, section->name), section->type,
+                section->flags, ctx->offsets[i],
+                ctx->obj->sections[i].bytes.size, 0, 0, 1, 0);
+  }
+  for (size_t i = CG_X86_64_OBJECT_SECTION_DATA;
+       i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    if (!ctx->rela_idxs[i]) {
+      continue;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), ".rela%s", CG_SECTIONS[i].name);
+    cg_shdr_add(&shdrs, cg_strtab_add(&shstrtab, name), SHT_RELA,
+                SHF_INFO_LINK, ctx->rela_offsets[i],
+                list_cg_x86_64_reloc_size(ctx->obj->sections[i].relocs) *
+                    sizeof(Elf64_Rela),
+                symtab_idx, i, 8, sizeof(Elf64_Rela));
+  }
+  cg_shdr_add(&shdrs, cg_strtab_add(&shstrtab, ".symtab"), SHT_SYMTAB, 0,
+              symtab_offset, symtab.size, strtab_idx, globals_idx, 8,
+              sizeof(Elf64_Sym));
+  cg_shdr_add(&shdrs, cg_strtab_add(&shstrtab, ".strtab"), SHT_STRTAB, 0,
+              strtab_offset, strtab.size, 0, 0, 1, 0);
+  uint32_t shstrtab_name = cg_strtab_add(&shstrtab, ".shstrtab");
+  uint64_t shstrtab_size = shstrtab.size;
+  cg_shdr_add(&shdrs, shstrtab_name, SHT_STRTAB, 0, out.size, shstrtab_size, 0,
+              0, 1, 0);
+  cg_x86_64_bytes_append(&out, shstrtab.data, shstrtab.size);
+
+  cg_bytes_align(&out, 8);
+  uint64_t shoff = out.size;
+  cg_x86_64_bytes_append(&out, shdrs.data, shdrs.size);
+
+  memcpy(ehdr.e_ident, ELFMAG, SELFMAG);
+  ehdr.e_ident[EI_CLASS]   = ELFCLASS64;
+  ehdr.e_ident[EI_DATA]    = ELFDATA2LSB;
+  ehdr.e_ident[EI_VERSION] = EV_CURRENT;
+  ehdr.e_ident[EI_OSABI]   = ELFOSABI_NONE;
+  ehdr.e_type              = ET_REL;
+  ehdr.e_machine           = EM_X86_64;
+  ehdr.e_version           = EV_CURRENT;
+  ehdr.e_shoff             = shoff;
+  ehdr.e_ehsize            = sizeof(Elf64_Ehdr);
+  ehdr.e_shentsize         = sizeof(Elf64_Shdr);
+  ehdr.e_shnum             = shnum;
+  ehdr.e_shstrndx          = shstrtab_idx;
+  memcpy(out.data, &ehdr, sizeof(ehdr));
+
+  cg_x86_64_bytes_deinit(&shdrs);
+  cg_x86_64_bytes_deinit(&shstrtab);
+  cg_x86_64_bytes_deinit(&strtab);
+  cg_x86_64_bytes_deinit(&symtab);
+
+  *size = out.size;
+  return out.data;
+}
+
+uint8_t *cg_x86_64_emit_elf(cg_x86_64_emit_ctx *emit_ctx,
+                            const cg_x86_64 *code, size_t *size) {
+  cg_x86_64_object obj;
+  cg_x86_64_object_init(&obj, emit_ctx->exceptions);
+  cg_x86_64_object_build(&obj, code);
+
+  cg_ctx ctx;
+  cg_ctx_init(&ctx, &obj);
+
+  uint8_t *data = cg_ctx_write(&ctx, size);
+
+  cg_ctx_deinit(&ctx);
+  cg_x86_64_object_deinit(&obj);
+
+  return data;
+}
@@ -1,308 +1,240 @@
 #include "emit.h"
 #include "util/log.h"
 #include "util/macro.h"
-#include "util/strbuf.h"
+#include <stdarg.h>
 #include <string.h>
 
+// output is collected in fixed buffer and flushed to streams when it is full
+#define CG_SINK_CAPACITY (1 << 16)
+// enough for any formatted number
+#define CG_SINK_FORMAT_MAX 64
+#define CG_SINK_STREAMS 2
+
+#define CG_REG_CNT (CG_X86_64_REG_RIP + 1)
+#define CG_MNEM_CNT (CG_X86_64_MNEM_JMP + 1)
+
+// indexed by log2 of operand size
+static const char *const CG_REGS[4][CG_REG_CNT] = {
+    {
+        [CG_X86_64_REG_RAX] = "%al",   [CG_X86_64_REG_RBX] = "%bl",
+        [CG_X86_64_REG_RCX] = "%cl",   [CG_X86_64_REG_RDX] = "%dl",
+        [CG_X86_64_REG_RSP] = "%spl",  [CG_X86_64_REG_RBP] = "%bpl",
+        [CG_X86_64_REG_RSI] = "%sil",  [CG_X86_64_REG_RDI] = "%dil",
+        [CG_X86_64_REG_R8]  = "%r8b",  [CG_X86_64_REG_R9]  = "%r9b",
+        [CG_X86_64_REG_R10] = "%r10b", [CG_X86_64_REG_R11] = "%r11b",
+        [CG_X86_64_REG_R12] = "%r12b", [CG_X86_64_REG_R13] = "%r13b",
+        [CG_X86_64_REG_R14] = "%r14b", [CG_X86_64_REG_R15] = "%r15b",
+    },
+    {
+        [CG_X86_64_REG_RAX] = "%ax",   [CG_X86_64_REG_RBX] = "%bx",
+        [CG_X86_64_REG_RCX] = "%cx",   [CG_X86_64_REG_RDX] = "%dx",
+        [CG_X86_64_REG_RSP] = "%sp",   [CG_X86_64_REG_RBP] = "%bp",
+        [CG_X86_64_REG_RSI] = "%si",   [CG_X86_64_REG_RDI] = "%di",
+        [CG_X86_64_REG_R8]  = "%r8w",  [CG_X86_64_REG_R9]  = "%r9w",
+        [CG_X86_64_REG_R10] = "%r10w", [CG_X86_64_REG_R11] = "%r11w",
+        [CG_X86_64_REG_R12] = "%r12w", [CG_X86_64_REG_R13] = "%r13w",
+        [CG_X86_64_REG_R14] = "%r14w", [CG_X86_64_REG_R15] = "%r15w",
+    },
+    {
+        [CG_X86_64_REG_RAX] = "%eax",  [CG_X86_64_REG_RBX] = "%ebx",
+        [CG_X86_64_REG_RCX] = "%ecx",  [CG_X86_64_REG_RDX] = "%edx",
+        [CG_X86_64_REG_RSP] = "%esp",  [CG_X86_64_REG_RBP] = "%ebp",
+        [CG_X86_64_REG_RSI] = "%esi",  [CG_X86_64_REG_RDI] = "%edi",
+        [CG_X86_64_REG_R8]  = "%r8d",  [CG_X86_64_REG_R9]  = "%r9d",
+        [CG_X86_64_REG_R10] = "%r10d", [CG_X86_64_REG_R11] = "%r11d",
+        [CG_X86_64_REG_R12] = "%r12d", [CG_X86_64_REG_R13] = "%r13d",
+        [CG_X86_64_REG_R14] = "%r14d", [CG_X86_64_REG_R15] = "%r15d",
+    },
+    {
+        [CG_X86_64_REG_RAX] = "%rax", [CG_X86_64_REG_RBX] = "%rbx",
+        [CG_X86_64_REG_RCX] = "%rcx", [CG_X86_64_REG_RDX] = "%rdx",
+        [CG_X86_64_REG_RSP] = "%rsp", [CG_X86_64_REG_RBP] = "%rbp",
+        [CG_X86_64_REG_RSI] = "%rsi", [CG_X86_64_REG_RDI] = "%rdi",
+        [CG_X86_64_REG_R8]  = "%r8",  [CG_X86_64_REG_R9]  = "%r9",
+        [CG_X86_64_REG_R10] = "%r10", [CG_X86_64_REG_R11] = "%r11",
+        [CG_X86_64_REG_R12] = "%r12", [CG_X86_64_REG_R13] = "%r13",
+        [CG_X86_64_REG_R14] = "%r14", [CG_X86_64_REG_R15] = "%r15",
+        [CG_X86_64_REG_RIP] = "%rip",
+    },
+};
+
+static const char *const CG_MNEMS[CG_MNEM_CNT] = {
+    [CG_X86_64_MNEM_PUSHQ]   = "pushq",
+    [CG_X86_64_MNEM_POPQ]    = "popq",
+    [CG_X86_64_MNEM_MOVB]    = "movb",
+    [CG_X86_64_MNEM_MOVL]    = "movl",
+    [CG_X86_64_MNEM_MOVQ]    = "movq",
+    [CG_X86_64_MNEM_RETQ]    = "retq",
+    [CG_X86_64_MNEM_SYSCALL] = "syscall",
+    [CG_X86_64_MNEM_XORQ]    = "xorq",
+    [CG_X86_64_MNEM_SUBQ]    = "subq",
+    [CG_X86_64_MNEM_ADDQ]    = "addq",
+    [CG_X86_64_MNEM_LEAQ]    = "leaq",
+    [CG_X86_64_MNEM_CALL]    = "call",
+    [CG_X86_64_MNEM_TESTB]   = "testb",
+    [CG_X86_64_MNEM_CMPB]    = "cmpb",
+    [CG_X86_64_MNEM_CMPL]    = "cmpl",
+    [CG_X86_64_MNEM_CMPQ]    = "cmpq",
+    [CG_X86_64_MNEM_JZ]      = "jz",
+    [CG_X86_64_MNEM_JNZ]     = "jnz",
+    [CG_X86_64_MNEM_JL]      = "jl",
+    [CG_X86_64_MNEM_JLE]     = "jle",
+    [CG_X86_64_MNEM_JG]      = "jg",
+    [CG_X86_64_MNEM_JGE]     = "jge",
+    [CG_X86_64_MNEM_JB]      = "jb",
+    [CG_X86_64_MNEM_JBE]     = "jbe",
+    [CG_X86_64_MNEM_JA]      = "ja",
+    [CG_X86_64_MNEM_JAE]     = "jae",
+    [CG_X86_64_MNEM_JMP]     = "jmp",
+};
+
 typedef struct cg_ctx_struct {
-  strbuf         *buffer;
+  FILE           *streams[CG_SINK_STREAMS]; // NULL if unused
   list_exception *exceptions;
+  size_t          size;
+  char            data[CG_SINK_CAPACITY];
 } cg_ctx;
 
-static void cg_ctx_init(cg_ctx *ctx, strbuf *buffer,
+static void cg_ctx_init(cg_ctx *ctx, FILE *stream, FILE *tee,
                         list_exception *exceptions) {
-  ctx->buffer     = buffer;
+  ctx->streams[0] = stream;
+  ctx->streams[1] = tee;
   ctx->exceptions = exceptions;
+  ctx->size       = 0;
+}
+
+static void cg_ctx_write(cg_ctx *ctx, const char *data, size_t size) {
+  for (size_t i = 0; i < CG_SINK_STREAMS; ++i) {
+    if (ctx->streams[i]) {
+      fwrite(data, 1, size, ctx->streams[i]);
+    }
+  }
+}
+
+static void cg_ctx_flush(cg_ctx *ctx) {
+  cg_ctx_write(ctx, ctx->data, ctx->size);
+  ctx->size = 0;
 }
 
 static void cg_ctx_deinit(cg_ctx *ctx) {
-  ctx->buffer     = NULL;
+  cg_ctx_flush(ctx);
+  for (size_t i = 0; i < CG_SINK_STREAMS; ++i) {
+    ctx->streams[i] = NULL;
+  }
   ctx->exceptions = NULL;
 }
 
+static void cg_emit(cg_ctx *ctx, const char *str) {
+  size_t len = strlen(str);
+  if (len > CG_SINK_CAPACITY - ctx->size) {
+    cg_ctx_flush(ctx);
+  }
+  if (len >= CG_SINK_CAPACITY) {
+    cg_ctx_write(ctx, str, len);
+    return;
+  }
+  memcpy(ctx->data + ctx->size, str, len);
+  ctx->size += len;
+}
+
+__attribute__((format(printf, 2, 3))) static void
+cg_emit_f(cg_ctx *ctx, const char *format, ...) {
+  if (CG_SINK_CAPACITY - ctx->size < CG_SINK_FORMAT_MAX) {
+    cg_ctx_flush(ctx);
+  }
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(ctx->data + ctx->size, CG_SINK_FORMAT_MAX, format, args);
+  va_end(args);
+  if (len >= CG_SINK_FORMAT_MAX) {
+    len = CG_SINK_FORMAT_MAX - 1;
+  }
+  if (len > 0) {
+    ctx->size += len;
+  }
+}
+
 static void cg_emit_reg(cg_ctx *ctx, cg_x86_64_reg reg, uint64_t size) {
+  size_t idx;
   switch (size) {
-    case 1:
-      switch (reg) {
-        case CG_X86_64_REG_RAX:
-          strbuf_append(ctx->buffer, "%al");
-          break;
-        case CG_X86_64_REG_RBX:
-          strbuf_append(ctx->buffer, "%bl");
-          break;
-        case CG_X86_64_REG_RCX:
-          strbuf_append(ctx->buffer, "%cl");
-          break;
-        case CG_X86_64_REG_RDX:
-          strbuf_append(ctx->buffer, "%dl");
-          break;
-        case CG_X86_64_REG_RSP:
-          strbuf_append(ctx->buffer, "%spl");
-          break;
-        case CG_X86_64_REG_RBP:
-          strbuf_append(ctx->buffer, "%bpl");
-          break;
-        case CG_X86_64_REG_RSI:
-          strbuf_append(ctx->buffer, "%sil");
-          break;
-        case CG_X86_64_REG_RDI:
-          strbuf_append(ctx->buffer, "%dil");
-          break;
-        case CG_X86_64_REG_R8:
-          strbuf_append(ctx->buffer, "%r8b");
-          break;
-        case CG_X86_64_REG_R9:
-          strbuf_append(ctx->buffer, "%r9b");
-          break;
-        case CG_X86_64_REG_R10:
-          strbuf_append(ctx->buffer, "%r10b");
-          break;
-        case CG_X86_64_REG_R11:
-          strbuf_append(ctx->buffer, "%r11b");
-          break;
-        case CG_X86_64_REG_R12:
-          strbuf_append(ctx->buffer, "%r12b");
-          break;
-        case CG_X86_64_REG_R13:
-          strbuf_append(ctx->buffer, "%r13b");
-          break;
-        case CG_X86_64_REG_R14:
-          strbuf_append(ctx->buffer, "%r14b");
-          break;
-        case CG_X86_64_REG_R15:
-          strbuf_append(ctx->buffer, "%r15b");
-          break;
-        default:
-          error("unhandled reg size %lu with reg %d", size, reg);
-          break;
-      }
+    case CG_X86_64_SIZE_BYTE:
+      idx = 0;
       break;
-    case 2:
-      switch (reg) {
-        case CG_X86_64_REG_RAX:
-          strbuf_append(ctx->buffer, "%ax");
-          break;
-        case CG_X86_64_REG_RBX:
-          strbuf_append(ctx->buffer, "%bx");
-          break;
-        case CG_X86_64_REG_RCX:
-          strbuf_append(ctx->buffer, "%cx");
-          break;
-        case CG_X86_64_REG_RDX:
-          strbuf_append(ctx->buffer, "%dx");
-          break;
-        case CG_X86_64_REG_RSP:
-          strbuf_append(ctx->buffer, "%sp");
-          break;
-        case CG_X86_64_REG_RBP:
-          strbuf_append(ctx->buffer, "%bp");
-          break;
-        case CG_X86_64_REG_RSI:
-          strbuf_append(ctx->buffer, "%si");
-          break;
-        case CG_X86_64_REG_RDI:
-          strbuf_append(ctx->buffer, "%di");
-          break;
-        case CG_X86_64_REG_R8:
-          strbuf_append(ctx->buffer, "%r8w");
-          break;
-        case CG_X86_64_REG_R9:
-          strbuf_append(ctx->buffer, "%r9w");
-          break;
-        case CG_X86_64_REG_R10:
-          strbuf_append(ctx->buffer, "%r10w");
-          break;
-        case CG_X86_64_REG_R11:
-          strbuf_append(ctx->buffer, "%r11w");
-          break;
-        case CG_X86_64_REG_R12:
-          strbuf_append(ctx->buffer, "%r12w");
-          break;
-        case CG_X86_64_REG_R13:
-          strbuf_append(ctx->buffer, "%r13w");
-          break;
-        case CG_X86_64_REG_R14:
-          strbuf_append(ctx->buffer, "%r14w");
-          break;
-        case CG_X86_64_REG_R15:
-          strbuf_append(ctx->buffer, "%r15w");
-          break;
-        default:
-          error("unhandled reg size %lu with reg %d", size, reg);
-          break;
-      }
+    case CG_X86_64_SIZE_WORD:
+      idx = 1;
       break;
-    case 4:
-      switch (reg) {
-        case CG_X86_64_REG_RAX:
-          strbuf_append(ctx->buffer, "%eax");
-          break;
-        case CG_X86_64_REG_RBX:
-          strbuf_append(ctx->buffer, "%ebx");
-          break;
-        case CG_X86_64_REG_RCX:
-          strbuf_append(ctx->buffer, "%ecx");
-          break;
-        case CG_X86_64_REG_RDX:
-          strbuf_append(ctx->buffer, "%edx");
-          break;
-        case CG_X86_64_REG_RSP:
-          strbuf_append(ctx->buffer, "%esp");
-          break;
-        case CG_X86_64_REG_RBP:
-          strbuf_append(ctx->buffer, "%ebp");
-          break;
-        case CG_X86_64_REG_RSI:
-          strbuf_append(ctx->buffer, "%esi");
-          break;
-        case CG_X86_64_REG_RDI:
-          strbuf_append(ctx->buffer, "%edi");
-          break;
-        case CG_X86_64_REG_R8:
-          strbuf_append(ctx->buffer, "%r8d");
-          break;
-        case CG_X86_64_REG_R9:
-          strbuf_append(ctx->buffer, "%r9d");
-          break;
-        case CG_X86_64_REG_R10:
-          strbuf_append(ctx->buffer, "%r10d");
-          break;
-        case CG_X86_64_REG_R11:
-          strbuf_append(ctx->buffer, "%r11d");
-          break;
-        case CG_X86_64_REG_R12:
-          strbuf_append(ctx->buffer, "%r12d");
-          break;
-        case CG_X86_64_REG_R13:
-          strbuf_append(ctx->buffer, "%r13d");
-          break;
-        case CG_X86_64_REG_R14:
-          strbuf_append(ctx->buffer, "%r14d");
-          break;
-        case CG_X86_64_REG_R15:
-          strbuf_append(ctx->buffer, "%r15d");
-          break;
-        default:
-          error("unhandled reg size %lu with reg %d", size, reg);
-          break;
-      }
+    case CG_X86_64_SIZE_LONG:
+      idx = 2;
       break;
-    case 8:
-      switch (reg) {
-        case CG_X86_64_REG_RAX:
-          strbuf_append(ctx->buffer, "%rax");
-          break;
-        case CG_X86_64_REG_RBX:
-          strbuf_append(ctx->buffer, "%rbx");
-          break;
-        case CG_X86_64_REG_RCX:
-          strbuf_append(ctx->buffer, "%rcx");
-          break;
-        case CG_X86_64_REG_RDX:
-          strbuf_append(ctx->buffer, "%rdx");
-          break;
-        case CG_X86_64_REG_RSP:
-          strbuf_append(ctx->buffer, "%rsp");
-          break;
-        case CG_X86_64_REG_RBP:
-          strbuf_append(ctx->buffer, "%rbp");
-          break;
-        case CG_X86_64_REG_RSI:
-          strbuf_append(ctx->buffer, "%rsi");
-          break;
-        case CG_X86_64_REG_RDI:
-          strbuf_append(ctx->buffer, "%rdi");
-          break;
-        case CG_X86_64_REG_R8:
-          strbuf_append(ctx->buffer, "%r8");
-          break;
-        case CG_X86_64_REG_R9:
-          strbuf_append(ctx->buffer, "%r9");
-          break;
-        case CG_X86_64_REG_R10:
-          strbuf_append(ctx->buffer, "%r10");
-          break;
-        case CG_X86_64_REG_R11:
-          strbuf_append(ctx->buffer, "%r11");
-          break;
-        case CG_X86_64_REG_R12:
-          strbuf_append(ctx->buffer, "%r12");
-          break;
-        case CG_X86_64_REG_R13:
-          strbuf_append(ctx->buffer, "%r13");
-          break;
-        case CG_X86_64_REG_R14:
-          strbuf_append(ctx->buffer, "%r14");
-          break;
-        case CG_X86_64_REG_R15:
-          strbuf_append(ctx->buffer, "%r15");
-          break;
-        case CG_X86_64_REG_RIP:
-          strbuf_append(ctx->buffer, "%rip");
-          break;
-        default:
-          error("unhandled reg size %lu with reg %d", size, reg);
-          break;
-      }
+    case CG_X86_64_SIZE_QUAD:
+      idx = 3;
       break;
     default:
       error("unhandled reg size %lu with reg %d", size, reg);
-      break;
+      return;
   }
+  if ((size_t)reg >= CG_REG_CNT || !CG_REGS[idx][reg]) {
+    error("unhandled reg size %lu with reg %d", size, reg);
+    return;
+  }
+  cg_emit(ctx, CG_REGS[idx][reg]);
 }
 
 static void cg_emit_unit_data(cg_ctx *ctx, const cg_x86_64_data *data) {
-  char buf[64];
-
   switch (data->kind) {
     case CG_X86_64_DATA_BYTE:
-      strbuf_append_f(ctx->buffer, buf, ".byte %#x", data->data_byte);
+      cg_emit_f(ctx, ".byte %#x", data->data_byte);
       break;
     case CG_X86_64_DATA_WORD:
-      strbuf_append_f(ctx->buffer, buf, ".word %#x", data->data_word);
+      cg_emit_f(ctx, ".word %#x", data->data_word);
       break;
     case CG_X86_64_DATA_LONG:
-      strbuf_append_f(ctx->buffer, buf, ".long %#x", data->data_long);
+      cg_emit_f(ctx, ".long %#x", data->data_long);
       break;
     case CG_X86_64_DATA_QUAD:
-      strbuf_append_f(ctx->buffer, buf, ".quad %#lx", data->data_quad);
+      cg_emit_f(ctx, ".quad %#lx", data->data_quad);
       break;
     case CG_X86_64_DATA_ASCII:
-      strbuf_append(ctx->buffer, ".ascii ");
-      strbuf_append(ctx->buffer, "\"");
-      strbuf_append(ctx->buffer, (char *)data->data_ascii);
-      strbuf_append(ctx->buffer, "\\0\"");
+      cg_emit(ctx, ".ascii ");
+      cg_emit(ctx, "\"");
+      cg_emit(ctx, (char *)data->data_ascii);
+      cg_emit(ctx, "\\0\"");
       break;
     case CG_X86_64_DATA_BYTES:
-      strbuf_append(ctx->buffer, ".byte ");
-      size_t i = 0;
-      if (i++ < data->data_len) {
-        strbuf_append_f(ctx->buffer, buf, "%#x", data->data_bytes[i]);
+      cg_emit(ctx, ".byte ");
+      if (data->data_len) {
+        cg_emit_f(ctx, "%#x", data->data_bytes[0]);
       }
-      for (; i < data->data_len; ++i) {
-        strbuf_append_f(ctx->buffer, buf, ", %#x", data->data_bytes[i]);
+      for (size_t i = 1; i < data->data_len; ++i) {
+        cg_emit_f(ctx, ", %#x", data->data_bytes[i]);
       }
       break;
     case CG_X86_64_DATA_SYMBOL:
-      strbuf_append(ctx->buffer, ".quad ");
-      strbuf_append(ctx->buffer, data->data_symbol);
+      cg_emit(ctx, ".quad ");
+      cg_emit(ctx, data->data_symbol);
       break;
     default:
       error("unexpected data kind %d %p", data->kind, data);
   }
 
-  strbuf_append(ctx->buffer, "\n");
+  cg_emit(ctx, "\n");
 }
 
 static void cg_emit_unit_text_op(cg_ctx *ctx, cg_x86_64_mnem mnem,
                                  const cg_x86_64_op *op, uint64_t size) {
-  char buf[64];
-
   // add * for ca
   switch (mnem) {
     case CG_X86_64_MNEM_CALL:
     case CG_X86_64_MNEM_JZ:
     case CG_X86_64_MNEM_JNZ:
+    case CG_X86_64_MNEM_JL:
+    case CG_X86_64_MNEM_JLE:
+    case CG_X86_64_MNEM_JG:
+    case CG_X86_64_MNEM_JGE:
+    case CG_X86_64_MNEM_JB:
+    case CG_X86_64_MNEM_JBE:
+    case CG_X86_64_MNEM_JA:
+    case CG_X86_64_MNEM_JAE:
     case CG_X86_64_MNEM_JMP:
       switch (op->kind) {
         case CG_X86_64_MODE_REGISTER:
@@ -310,7 +242,7 @@ static void cg_emit_unit_text_op(cg_ctx *ctx, cg_x86_64_mnem mnem,
         case CG_X86_64_MODE_INDIRECT:
         case CG_X86_64_MODE_BASE_IMM:
         case CG_X86_64_MODE_BASE_SYM:
-          strbuf_append(ctx->buffer, "*");
+          cg_emit(ctx, "*");
           break;
         default:
           break;
@@ -324,37 +256,37 @@ static void cg_emit_unit_text_op(cg_ctx *ctx, cg_x86_64_mnem mnem,
       cg_emit_reg(ctx, op->reg.reg, size);
       break;
     case CG_X86_64_MODE_DIRECT:
-      strbuf_append(ctx->buffer, op->direct.sym_addr);
+      cg_emit(ctx, op->direct.sym_addr);
       break;
     case CG_X86_64_MODE_INDEXED:
-      strbuf_append(ctx->buffer, op->indexed.sym_addr);
-      strbuf_append(ctx->buffer, "(,");
-      cg_emit_reg(ctx, op->indexed.reg_index, size);
-      strbuf_append_f(ctx->buffer, buf, ",%#lx)", op->indexed.imm_multi);
+      cg_emit(ctx, op->indexed.sym_addr);
+      cg_emit(ctx, "(,");
+      cg_emit_reg(ctx, op->indexed.reg_index, CG_X86_64_SIZE_QUAD);
+      cg_emit_f(ctx, ",%#lx)", op->indexed.imm_multi);
       break;
     case CG_X86_64_MODE_INDIRECT:
-      strbuf_append(ctx->buffer, "(");
-      cg_emit_reg(ctx, op->indirect.reg_base, size);
-      strbuf_append(ctx->buffer, ")");
+      cg_emit(ctx, "(");
+      cg_emit_reg(ctx, op->indirect.reg_base, CG_X86_64_SIZE_QUAD);
+      cg_emit(ctx, ")");
       break;
     case CG_X86_64_MODE_BASE_IMM:
       if ((int64_t)op->base_imm.imm_offset < 0) {
-        strbuf_append_f(ctx->buffer, buf, "-%#lx", -op->base_imm.imm_offset);
+        cg_emit_f(ctx, "-%#lx", -op->base_imm.imm_offset);
       } else {
-        strbuf_append_f(ctx->buffer, buf, "%#lx", op->base_imm.imm_offset);
+        cg_emit_f(ctx, "%#lx", op->base_imm.imm_offset);
       }
-      strbuf_append(ctx->buffer, "(");
-      cg_emit_reg(ctx, op->base_imm.reg_base, size);
-      strbuf_append(ctx->buffer, ")");
+      cg_emit(ctx, "(");
+      cg_emit_reg(ctx, op->base_imm.reg_base, CG_X86_64_SIZE_QUAD);
+      cg_emit(ctx, ")");
       break;
     case CG_X86_64_MODE_BASE_SYM:
-      strbuf_append(ctx->buffer, op->base_sym.sym_addr);
-      strbuf_append(ctx->buffer, "(");
-      cg_emit_reg(ctx, op->base_sym.reg_base, size);
-      strbuf_append(ctx->buffer, ")");
+      cg_emit(ctx, op->base_sym.sym_addr);
+      cg_emit(ctx, "(");
+      cg_emit_reg(ctx, op->base_sym.reg_base, CG_X86_64_SIZE_QUAD);
+      cg_emit(ctx, ")");
       break;
     case CG_X86_64_MODE_IMMEDIATE:
-      strbuf_append_f(ctx->buffer, buf, "$%#lx", op->imm.imm_const);
+      cg_emit_f(ctx, "$%#lx", op->imm.imm_const);
       break;
     default:
       error("unhandled mode op %d %p", op->kind, op);
@@ -364,100 +296,52 @@ static void cg_emit_unit_text_op(cg_ctx *ctx, cg_x86_64_mnem mnem,
 
 static void cg_emit_unit_text(cg_ctx *ctx, const cg_x86_64_text *text) {
   // padding
-  strbuf_append(ctx->buffer, "  ");
+  cg_emit(ctx, "  ");
 
-  switch (text->mnem) {
-    case CG_X86_64_MNEM_PUSHQ:
-      strbuf_append(ctx->buffer, "pushq");
-      break;
-    case CG_X86_64_MNEM_POPQ:
-      strbuf_append(ctx->buffer, "popq");
-      break;
-    case CG_X86_64_MNEM_MOVB:
-      strbuf_append(ctx->buffer, "movb");
-      break;
-    case CG_X86_64_MNEM_MOVL:
-      strbuf_append(ctx->buffer, "movl");
-      break;
-    case CG_X86_64_MNEM_MOVQ:
-      strbuf_append(ctx->buffer, "movq");
-      break;
-    case CG_X86_64_MNEM_RETQ:
-      strbuf_append(ctx->buffer, "retq");
-      break;
-    case CG_X86_64_MNEM_SYSCALL:
-      strbuf_append(ctx->buffer, "syscall");
-      break;
-    case CG_X86_64_MNEM_XORQ:
-      strbuf_append(ctx->buffer, "xorq");
-      break;
-    case CG_X86_64_MNEM_SUBQ:
-      strbuf_append(ctx->buffer, "subq");
-      break;
-    case CG_X86_64_MNEM_ADDQ:
-      strbuf_append(ctx->buffer, "addq");
-      break;
-    case CG_X86_64_MNEM_LEAQ:
-      strbuf_append(ctx->buffer, "leaq");
-      break;
-    case CG_X86_64_MNEM_CALL:
-      strbuf_append(ctx->buffer, "call");
-      break;
-    case CG_X86_64_MNEM_TESTB:
-      strbuf_append(ctx->buffer, "testb");
-      break;
-    case CG_X86_64_MNEM_JZ:
-      strbuf_append(ctx->buffer, "jz");
-      break;
-    case CG_X86_64_MNEM_JNZ:
-      strbuf_append(ctx->buffer, "jnz");
-      break;
-    case CG_X86_64_MNEM_JMP:
-      strbuf_append(ctx->buffer, "jmp");
-      break;
-    default:
-      error("unhandled mnem %d %p", text->mnem, text);
-      break;
+  if ((size_t)text->mnem < CG_MNEM_CNT && CG_MNEMS[text->mnem]) {
+    cg_emit(ctx, CG_MNEMS[text->mnem]);
+  } else {
+    error("unhandled mnem %d %p", text->mnem, text);
   }
 
   uint64_t op_size = cg_x86_64_mnem_size(text->mnem);
 
   list_cg_x86_64_op_it it = list_cg_x86_64_op_begin(text->operands);
   if (!END(it)) {
-    strbuf_append(ctx->buffer, " ");
+    cg_emit(ctx, " ");
     cg_emit_unit_text_op(ctx, text->mnem, GET(it), op_size);
   }
   for (NEXT(it); !END(it); NEXT(it)) {
-    strbuf_append(ctx->buffer, ", ");
+    cg_emit(ctx, ", ");
     cg_emit_unit_text_op(ctx, text->mnem, GET(it), op_size);
   }
 
-  strbuf_append(ctx->buffer, "\n");
+  cg_emit(ctx, "\n");
 }
 
 static void cg_emit_unit_symbol(cg_ctx *ctx, const cg_x86_64_symbol *symbol) {
   switch (symbol->kind) {
     case CG_X86_64_SYMBOL_DATA:
     case CG_X86_64_SYMBOL_DATA_LN:
-      strbuf_append(ctx->buffer, symbol->name);
-      strbuf_append(ctx->buffer, ": ");
+      cg_emit(ctx, symbol->name);
+      cg_emit(ctx, ": ");
       if (symbol->kind == CG_X86_64_SYMBOL_DATA_LN) {
-        strbuf_append(ctx->buffer, "\n");
+        cg_emit(ctx, "\n");
       }
       break;
     case CG_X86_64_SYMBOL_TEXT:
-      strbuf_append(ctx->buffer, symbol->name);
-      strbuf_append(ctx->buffer, ":\n");
+      cg_emit(ctx, symbol->name);
+      cg_emit(ctx, ":\n");
       break;
     case CG_X86_64_SYMBOL_EXTERN:
-      strbuf_append(ctx->buffer, ".extern ");
-      strbuf_append(ctx->buffer, symbol->name);
-      strbuf_append(ctx->buffer, "\n");
+      cg_emit(ctx, ".extern ");
+      cg_emit(ctx, symbol->name);
+      cg_emit(ctx, "\n");
       break;
     case CG_X86_64_SYMBOL_GLOBAL:
-      strbuf_append(ctx->buffer, ".globl ");
-      strbuf_append(ctx->buffer, symbol->name);
-      strbuf_append(ctx->buffer, "\n");
+      cg_emit(ctx, ".globl ");
+      cg_emit(ctx, symbol->name);
+      cg_emit(ctx, "\n");
       break;
     default:
       error("unhandled symbol kind %d %p", symbol->kind, symbol);
@@ -466,12 +350,12 @@ static void cg_emit_unit_symbol(cg_ctx *ctx, const cg_x86_64_symbol *symbol) {
 }
 
 static void cg_emit_section(cg_ctx *ctx, const char *section_name,
-                            const list_cg_x86_64_unit *units) {
-  strbuf_append(ctx->buffer, ".section ");
-  strbuf_append(ctx->buffer, section_name);
-  strbuf_append(ctx->buffer, "\n");
+                            const vec_cg_x86_64_unit *units) {
+  cg_emit(ctx, ".section ");
+  cg_emit(ctx, section_name);
+  cg_emit(ctx, "\n");
 
-  for (list_cg_x86_64_unit_it it = list_cg_x86_64_unit_begin(units); !END(it);
+  for (vec_cg_x86_64_unit_it it = vec_cg_x86_64_unit_begin(units); !END(it);
        NEXT(it)) {
     const cg_x86_64_unit *unit = GET(it);
 
@@ -492,19 +376,17 @@ static void cg_emit_section(cg_ctx *ctx, const char *section_name,
   }
 }
 
-char *cg_x86_64_emit_gas(cg_x86_64_emit_ctx *emit_ctx, const cg_x86_64 *code) {
-  strbuf *buffer = strbuf_new(0, 0);
-
-  cg_ctx ctx;
-  cg_ctx_init(&ctx, buffer, emit_ctx->exceptions);
-
-  cg_emit_section(&ctx, ".data", code->data);
-  cg_emit_section(&ctx, ".text", code->text);
-  cg_emit_section(&ctx, ".u_debug_info", code->debug_info);
-  cg_emit_section(&ctx, ".u_debug_line", code->debug_line);
-  cg_emit_section(&ctx, ".u_debug_str", code->debug_str);
+void cg_x86_64_emit_gas(cg_x86_64_emit_ctx *emit_ctx, const cg_x86_64 *code) {
+  // too large for stack
+  cg_ctx *ctx = MALLOC(cg_ctx);
+  cg_ctx_init(ctx, emit_ctx->stream, emit_ctx->tee, emit_ctx->exceptions);
 
-  cg_ctx_deinit(&ctx);
+  cg_emit_section(ctx, ".data", code->data);
+  cg_emit_section(ctx, ".text", code->text);
+  cg_emit_section(ctx, ".u_debug_info", code->debug_info);
+  cg_emit_section(ctx, ".u_debug_line", code->debug_line);
+  cg_emit_section(ctx, ".u_debug_str", code->debug_str);
 
-  return strbuf_detach(buffer);
+  cg_ctx_deinit(ctx);
+  free(ctx);
 }
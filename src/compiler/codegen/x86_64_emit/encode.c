@@ -0,0 +1,832 @@
+#include "encode.h"
+
+#include "util/log.h"
+#include "util/macro.h"
+#include <string.h>
+
+#define CG_REX 0x40
+#define CG_REX_W 0x08
+#define CG_REX_R 0x04
+#define CG_REX_X 0x02
+#define CG_REX_B 0x01
+
+// hardware numbers of registers in order of cg_x86_64_reg
+static const uint8_t CG_REG_HW[] = {
+    0,  // rax
+    3,  // rbx
+    1,  // rcx
+    2,  // rdx
+    4,  // rsp
+    5,  // rbp
+    6,  // rsi
+    7,  // rdi
+    8,  // r8
+    9,  // r9
+    10, // r10
+    11, // r11
+    12, // r12
+    13, // r13
+    14, // r14
+    15, // r15
+};
+
+// reloc
+cg_x86_64_reloc *cg_x86_64_reloc_new(cg_x86_64_reloc_kind kind,
+                                     uint64_t offset, const char *sym_ref,
+                                     int64_t addend) {
+  cg_x86_64_reloc *self = MALLOC(cg_x86_64_reloc);
+  self->kind            = kind;
+  self->offset          = offset;
+  self->sym_ref         = sym_ref;
+  self->addend          = addend;
+  return self;
+}
+
+void cg_x86_64_reloc_free(cg_x86_64_reloc *self) {
+  if (self) {
+    free(self);
+  }
+}
+
+// bytes
+void cg_x86_64_bytes_init(cg_x86_64_bytes *self) {
+  self->data     = NULL;
+  self->size     = 0;
+  self->capacity = 0;
+}
+
+void cg_x86_64_bytes_deinit(cg_x86_64_bytes *self) {
+  free(self->data);
+  cg_x86_64_bytes_init(self);
+}
+
+void cg_x86_64_bytes_append(cg_x86_64_bytes *self, const void *data,
+                            size_t size) {
+  if (!size) {
+    return;
+  }
+  if (self->size + size > self->capacity) {
+    size_t capacity = self->capacity ? self->capacity : 256;
+    while (self->size + size > capacity) {
+      capacity *= 2;
+    }
+    self->data     = realloc(self->data, capacity);
+    self->capacity = capacity;
+  }
+  memcpy(self->data + self->size, data, size);
+  self->size += size;
+}
+
+static void cg_x86_64_bytes_append_le(cg_x86_64_bytes *self, uint64_t value,
+                                      size_t size) {
+  uint8_t buf[8];
+  for (size_t i = 0; i < size; ++i) {
+    buf[i] = (uint8_t)(value >> (i * 8));
+  }
+  cg_x86_64_bytes_append(self, buf, size);
+}
+
+// INST
+// parts of instruction in order they are encoded
+typedef struct cg_inst_struct {
+  uint8_t rex;
+  int     rex_force; // to access spl, bpl, sil, dil
+  uint8_t opcode[2];
+  size_t  opcode_len;
+
+  int     has_modrm;
+  uint8_t modrm;
+  int     has_sib;
+  uint8_t sib;
+
+  size_t               disp_size;
+  int64_t              disp;
+  const char          *disp_sym;
+  cg_x86_64_reloc_kind disp_reloc;
+
+  size_t               imm_size;
+  uint64_t             imm;
+  const char          *imm_sym; // relative target of branch
+  cg_x86_64_reloc_kind imm_reloc;
+} cg_inst;
+
+static int cg_fits_i8(int64_t value) { return value >= -128 && value <= 127; }
+
+static int cg_fits_i32(int64_t value) {
+  return value >= INT32_MIN && value <= INT32_MAX;
+}
+
+// immediate of operation of size, that is sign extended by cpu
+static int64_t cg_imm_signed(uint64_t imm, cg_x86_64_size size) {
+  switch (size) {
+    case CG_X86_64_SIZE_BYTE:
+      return (int8_t)imm;
+    case CG_X86_64_SIZE_LONG:
+      return (int32_t)imm;
+    default:
+      return (int64_t)imm;
+  }
+}
+
+static void cg_inst_opcode(cg_inst *inst, uint8_t opcode) {
+  inst->opcode[inst->opcode_len++] = opcode;
+}
+
+static void cg_inst_size(cg_inst *inst, cg_x86_64_size size) {
+  if (size == CG_X86_64_SIZE_QUAD) {
+    inst->rex |= CG_REX_W;
+  }
+}
+
+static void cg_inst_modrm_reg(cg_inst *inst, uint8_t reg) {
+  inst->has_modrm = 1;
+  inst->modrm |= (reg & 7) << 3;
+  if (reg & 8) {
+    inst->rex |= CG_REX_R;
+  }
+}
+
+static int cg_inst_reg_hw(cg_x86_64_reg reg, cg_x86_64_size size,
+                          cg_inst *inst, uint8_t *hw) {
+  if (reg >= sizeof(CG_REG_HW) / sizeof(*CG_REG_HW)) {
+    return 0;
+  }
+  *hw = CG_REG_HW[reg];
+  if (size == CG_X86_64_SIZE_BYTE && *hw >= 4 && *hw < 8) {
+    inst->rex_force = 1;
+  }
+  return 1;
+}
+
+static int cg_inst_rm_reg(cg_inst *inst, cg_x86_64_reg reg,
+                          cg_x86_64_size size) {
+  uint8_t hw;
+  if (!cg_inst_reg_hw(reg, size, inst, &hw)) {
+    return 0;
+  }
+  inst->has_modrm = 1;
+  inst->modrm |= 0xC0 | (hw & 7);
+  if (hw & 8) {
+    inst->rex |= CG_REX_B;
+  }
+  return 1;
+}
+
+static int cg_inst_rm_base(cg_inst *inst, cg_x86_64_reg base, int64_t disp,
+                           const char *sym) {
+  inst->has_modrm = 1;
+
+  if (base == CG_X86_64_REG_RIP) {
+    inst->modrm |= 0x05;
+    inst->disp_size  = 4;
+    inst->disp       = disp;
+    inst->disp_sym   = sym;
+    inst->disp_reloc = CG_X86_64_RELOC_PC32;
+    return 1;
+  }
+
+  uint8_t hw;
+  if (!cg_inst_reg_hw(base, CG_X86_64_SIZE_QUAD, inst, &hw)) {
+    return 0;
+  }
+  if (hw & 8) {
+    inst->rex |= CG_REX_B;
+  }
+
+  // rsp and r12 are encoded only with sib
+  if ((hw & 7) == 4) {
+    inst->modrm |= 0x04;
+    inst->has_sib = 1;
+    inst->sib     = 0x24;
+  } else {
+    inst->modrm |= hw & 7;
+  }
+
+  // rbp and r13 without displacement mean rip or no base
+  if (!sym && !disp && (hw & 7) != 5) {
+    return 1;
+  }
+  if (!sym && cg_fits_i8(disp)) {
+    inst->modrm |= 0x40;
+    inst->disp_size = 1;
+    inst->disp      = disp;
+    return 1;
+  }
+  if (!cg_fits_i32(disp)) {
+    return 0;
+  }
+  inst->modrm |= 0x80;
+  inst->disp_size  = 4;
+  inst->disp       = disp;
+  inst->disp_sym   = sym;
+  inst->disp_reloc = CG_X86_64_RELOC_32S;
+  return 1;
+}
+
+// absolute address without base
+static int cg_inst_rm_abs(cg_inst *inst, const char *sym, uint8_t sib) {
+  inst->has_modrm = 1;
+  inst->modrm |= 0x04;
+  inst->has_sib    = 1;
+  inst->sib        = sib;
+  inst->disp_size  = 4;
+  inst->disp       = 0;
+  inst->disp_sym   = sym;
+  inst->disp_reloc = CG_X86_64_RELOC_32S;
+  return 1;
+}
+
+static int cg_inst_rm_mem(cg_inst *inst, const cg_x86_64_op *op) {
+  switch (op->kind) {
+    case CG_X86_64_MODE_INDIRECT:
+      return cg_inst_rm_base(inst, op->indirect.reg_base, 0, NULL);
+    case CG_X86_64_MODE_BASE_IMM:
+      return cg_inst_rm_base(inst, op->base_imm.reg_base,
+                             (int64_t)op->base_imm.imm_offset, NULL);
+    case CG_X86_64_MODE_BASE_SYM:
+      return cg_inst_rm_base(inst, op->base_sym.reg_base, 0,
+                             op->base_sym.sym_addr);
+    case CG_X86_64_MODE_DIRECT:
+      return cg_inst_rm_abs(inst, op->direct.sym_addr, 0x25);
+    case CG_X86_64_MODE_INDEXED: {
+      uint8_t hw;
+      uint8_t scale;
+      switch (op->indexed.imm_multi) {
+        case 1:
+          scale = 0;
+          break;
+        case 2:
+          scale = 1;
+          break;
+        case 4:
+          scale = 2;
+          break;
+        case 8:
+          scale = 3;
+          break;
+        default:
+          return 0;
+      }
+      if (!cg_inst_reg_hw(op->indexed.reg_index, CG_X86_64_SIZE_QUAD, inst,
+                          &hw) ||
+          hw == 4) {
+        return 0;
+      }
+      if (hw & 8) {
+        inst->rex |= CG_REX_X;
+      }
+      return cg_inst_rm_abs(inst, op->indexed.sym_addr,
+                            (scale << 6) | ((hw & 7) << 3) | 0x05);
+    }
+    default:
+      return 0;
+  }
+}
+
+static int cg_inst_rm(cg_inst *inst, const cg_x86_64_op *op,
+                      cg_x86_64_size size) {
+  if (op->kind == CG_X86_64_MODE_REGISTER) {
+    return cg_inst_rm_reg(inst, op->reg.reg, size);
+  }
+  return cg_inst_rm_mem(inst, op);
+}
+
+static void cg_inst_imm(cg_inst *inst, uint64_t imm, size_t size) {
+  inst->imm_size = size;
+  inst->imm      = imm;
+}
+
+static void cg_inst_emit(const cg_inst *inst, cg_x86_64_bytes *out,
+                         list_cg_x86_64_reloc *relocs) {
+  if (inst->rex || inst->rex_force) {
+    uint8_t rex = CG_REX | inst->rex;
+    cg_x86_64_bytes_append(out, &rex, 1);
+  }
+  cg_x86_64_bytes_append(out, inst->opcode, inst->opcode_len);
+  if (inst->has_modrm) {
+    cg_x86_64_bytes_append(out, &inst->modrm, 1);
+  }
+  if (inst->has_sib) {
+    cg_x86_64_bytes_append(out, &inst->sib, 1);
+  }
+
+  if (inst->disp_size) {
+    if (inst->disp_sym) {
+      // pc relative displacement is counted from the end of instruction
+      int64_t addend = inst->disp;
+      if (inst->disp_reloc == CG_X86_64_RELOC_PC32) {
+        addend -= (int64_t)(inst->disp_size + inst->imm_size);
+      }
+      list_cg_x86_64_reloc_push_back(
+          relocs, cg_x86_64_reloc_new(inst->disp_reloc, out->size,
+                                      inst->disp_sym, addend));
+      cg_x86_64_bytes_append_le(out, 0, inst->disp_size);
+    } else {
+      cg_x86_64_bytes_append_le(out, (uint64_t)inst->disp, inst->disp_size);
+    }
+  }
+
+  if (inst->imm_size) {
+    if (inst->imm_sym) {
+      list_cg_x86_64_reloc_push_back(
+          relocs, cg_x86_64_reloc_new(inst->imm_reloc, out->size,
+                                      inst->imm_sym,
+                                      -(int64_t)inst->imm_size));
+      cg_x86_64_bytes_append_le(out, 0, inst->imm_size);
+    } else {
+      cg_x86_64_bytes_append_le(out, inst->imm, inst->imm_size);
+    }
+  }
+}
+
+// ENCODE
+typedef struct cg_alu_struct {
+  uint8_t mr;  // op r/m, r
+  uint8_t rm;  // op r, r/m
+  uint8_t ext; // /digit of 0x81 and 0x83
+} cg_alu;
+
+static const cg_alu CG_ALU_ADD = {0x01, 0x03, 0};
+static const cg_alu CG_ALU_SUB = {0x29, 0x2B, 5};
+static const cg_alu CG_ALU_XOR = {0x31, 0x33, 6};
+static const cg_alu CG_ALU_CMP = {0x39, 0x3B, 7};
+
+static int cg_encode_alu(cg_inst *inst, const cg_alu *alu, cg_x86_64_size size,
+                         const cg_x86_64_op *src, const cg_x86_64_op *dst) {
+  uint8_t byte = size == CG_X86_64_SIZE_BYTE;
+  cg_inst_size(inst, size);
+
+  if (src->kind == CG_X86_64_MODE_IMMEDIATE) {
+    int64_t imm = cg_imm_signed(src->imm.imm_const, size);
+    int     acc = dst->kind == CG_X86_64_MODE_REGISTER &&
+              dst->reg.reg == CG_X86_64_REG_RAX;
+    // accumulator has short form without modrm
+    if (acc && (byte || !cg_fits_i8(imm)) && cg_fits_i32(imm)) {
+      cg_inst_opcode(inst, alu->mr - byte + 4);
+      cg_inst_imm(inst, (uint64_t)imm, byte ? 1 : 4);
+      return 1;
+    }
+    if (byte) {
+      cg_inst_opcode(inst, 0x80);
+      cg_inst_imm(inst, (uint64_t)imm, 1);
+    } else if (cg_fits_i8(imm)) {
+      cg_inst_opcode(inst, 0x83);
+      cg_inst_imm(inst, (uint64_t)imm, 1);
+    } else if (cg_fits_i32(imm)) {
+      cg_inst_opcode(inst, 0x81);
+      cg_inst_imm(inst, (uint64_t)imm, 4);
+    } else {
+      return 0;
+    }
+    cg_inst_modrm_reg(inst, alu->ext);
+    return cg_inst_rm(inst, dst, size);
+  }
+
+  uint8_t hw;
+  if (src->kind == CG_X86_64_MODE_REGISTER) {
+    cg_inst_opcode(inst, alu->mr - byte);
+    if (!cg_inst_reg_hw(src->reg.reg, size, inst, &hw)) {
+      return 0;
+    }
+    cg_inst_modrm_reg(inst, hw);
+    return cg_inst_rm(inst, dst, size);
+  }
+  if (dst->kind == CG_X86_64_MODE_REGISTER) {
+    cg_inst_opcode(inst, alu->rm - byte);
+    if (!cg_inst_reg_hw(dst->reg.reg, size, inst, &hw)) {
+      return 0;
+    }
+    cg_inst_modrm_reg(inst, hw);
+    return cg_inst_rm_mem(inst, src);
+  }
+  return 0;
+}
+
+static int cg_encode_mov(cg_inst *inst, cg_x86_64_size size,
+                         const cg_x86_64_op *src, const cg_x86_64_op *dst) {
+  uint8_t byte = size == CG_X86_64_SIZE_BYTE;
+  uint8_t hw;
+
+  if (src->kind != CG_X86_64_MODE_IMMEDIATE) {
+    static const cg_alu mov = {0x89, 0x8B, 0};
+    return cg_encode_alu(inst, &mov, size, src, dst);
+  }
+
+  cg_inst_size(inst, size);
+  int64_t imm = cg_imm_signed(src->imm.imm_const, size);
+
+  // only register can be loaded with full quad
+  if (size == CG_X86_64_SIZE_QUAD && !cg_fits_i32(imm)) {
+    if (dst->kind != CG_X86_64_MODE_REGISTER ||
+        !cg_inst_reg_hw(dst->reg.reg, size, inst, &hw)) {
+      return 0;
+    }
+    if (hw & 8) {
+      inst->rex |= CG_REX_B;
+    }
+    cg_inst_opcode(inst, 0xB8 + (hw & 7));
+    cg_inst_imm(inst, (uint64_t)imm, 8);
+    return 1;
+  }
+
+  if (size != CG_X86_64_SIZE_QUAD && dst->kind == CG_X86_64_MODE_REGISTER) {
+    if (!cg_inst_reg_hw(dst->reg.reg, size, inst, &hw)) {
+      return 0;
+    }
+    if (hw & 8) {
+      inst->rex |= CG_REX_B;
+    }
+    cg_inst_opcode(inst, (byte ? 0xB0 : 0xB8) + (hw & 7));
+    cg_inst_imm(inst, (uint64_t)imm, byte ? 1 : 4);
+    return 1;
+  }
+
+  cg_inst_opcode(inst, byte ? 0xC6 : 0xC7);
+  cg_inst_imm(inst, (uint64_t)imm, byte ? 1 : 4);
+  cg_inst_modrm_reg(inst, 0);
+  return cg_inst_rm(inst, dst, size);
+}
+
+static int cg_encode_test(cg_inst *inst, cg_x86_64_size size,
+                          const cg_x86_64_op *src, const cg_x86_64_op *dst) {
+  uint8_t byte = size == CG_X86_64_SIZE_BYTE;
+  uint8_t hw;
+  cg_inst_size(inst, size);
+
+  if (src->kind == CG_X86_64_MODE_IMMEDIATE) {
+    if (dst->kind == CG_X86_64_MODE_REGISTER &&
+        dst->reg.reg == CG_X86_64_REG_RAX) {
+      cg_inst_opcode(inst, byte ? 0xA8 : 0xA9);
+      cg_inst_imm(inst, src->imm.imm_const, byte ? 1 : 4);
+      return 1;
+    }
+    cg_inst_opcode(inst, byte ? 0xF6 : 0xF7);
+    cg_inst_imm(inst, src->imm.imm_const, byte ? 1 : 4);
+    cg_inst_modrm_reg(inst, 0);
+    return cg_inst_rm(inst, dst, size);
+  }
+
+  // operation is symmetric, register goes to reg field
+  if (src->kind != CG_X86_64_MODE_REGISTER) {
+    const cg_x86_64_op *tmp = src;
+    src                     = dst;
+    dst                     = tmp;
+  }
+  if (src->kind != CG_X86_64_MODE_REGISTER ||
+      !cg_inst_reg_hw(src->reg.reg, size, inst, &hw)) {
+    return 0;
+  }
+  cg_inst_opcode(inst, byte ? 0x84 : 0x85);
+  cg_inst_modrm_reg(inst, hw);
+  return cg_inst_rm(inst, dst, size);
+}
+
+static int cg_encode_lea(cg_inst *inst, const cg_x86_64_op *src,
+                         const cg_x86_64_op *dst) {
+  uint8_t hw;
+  if (dst->kind != CG_X86_64_MODE_REGISTER ||
+      src->kind == CG_X86_64_MODE_REGISTER ||
+      src->kind == CG_X86_64_MODE_IMMEDIATE ||
+      !cg_inst_reg_hw(dst->reg.reg, CG_X86_64_SIZE_QUAD, inst, &hw)) {
+    return 0;
+  }
+  cg_inst_size(inst, CG_X86_64_SIZE_QUAD);
+  cg_inst_opcode(inst, 0x8D);
+  cg_inst_modrm_reg(inst, hw);
+  return cg_inst_rm_mem(inst, src);
+}
+
+static int cg_encode_push_pop(cg_inst *inst, int push,
+                              const cg_x86_64_op *op) {
+  uint8_t hw;
+  switch (op->kind) {
+    case CG_X86_64_MODE_REGISTER:
+      if (!cg_inst_reg_hw(op->reg.reg, CG_X86_64_SIZE_QUAD, inst, &hw)) {
+        return 0;
+      }
+      if (hw & 8) {
+        inst->rex |= CG_REX_B;
+      }
+      cg_inst_opcode(inst, (push ? 0x50 : 0x58) + (hw & 7));
+      return 1;
+    case CG_X86_64_MODE_IMMEDIATE: {
+      int64_t imm = (int64_t)op->imm.imm_const;
+      if (!push || !cg_fits_i32(imm)) {
+        return 0;
+      }
+      cg_inst_opcode(inst, cg_fits_i8(imm) ? 0x6A : 0x68);
+      cg_inst_imm(inst, (uint64_t)imm, cg_fits_i8(imm) ? 1 : 4);
+      return 1;
+    }
+    default:
+      cg_inst_opcode(inst, push ? 0xFF : 0x8F);
+      cg_inst_modrm_reg(inst, push ? 6 : 0);
+      return cg_inst_rm_mem(inst, op);
+  }
+}
+
+// direct targets are relative, other operands are read as address
+static int cg_encode_branch(cg_inst *inst, cg_x86_64_mnem mnem,
+                            const cg_x86_64_op *op, int rel8) {
+  if (op->kind == CG_X86_64_MODE_DIRECT) {
+    switch (mnem) {
+      case CG_X86_64_MNEM_CALL:
+        cg_inst_opcode(inst, 0xE8);
+        break;
+      case CG_X86_64_MNEM_JMP:
+        cg_inst_opcode(inst, 0xE9);
+        break;
+      case CG_X86_64_MNEM_JZ:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x84);
+        break;
+      case CG_X86_64_MNEM_JNZ:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x85);
+        break;
+      case CG_X86_64_MNEM_JL:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x8C);
+        break;
+      case CG_X86_64_MNEM_JLE:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x8E);
+        break;
+      case CG_X86_64_MNEM_JG:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x8F);
+        break;
+      case CG_X86_64_MNEM_JGE:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x8D);
+        break;
+      case CG_X86_64_MNEM_JB:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x82);
+        break;
+      case CG_X86_64_MNEM_JBE:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x86);
+        break;
+      case CG_X86_64_MNEM_JA:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x87);
+        break;
+      case CG_X86_64_MNEM_JAE:
+        cg_inst_opcode(inst, 0x0F);
+        cg_inst_opcode(inst, 0x83);
+        break;
+      default:
+        return 0;
+    }
+    if (rel8) {
+      // short jcc opcode is second byte of near one less 0x10
+      if (mnem == CG_X86_64_MNEM_CALL) {
+        return 0;
+      }
+      if (mnem == CG_X86_64_MNEM_JMP) {
+        inst->opcode[0] = 0xEB;
+      } else {
+        inst->opcode[0]  = inst->opcode[1] - 0x10;
+        inst->opcode_len = 1;
+      }
+      inst->imm_size = 1;
+      return 1;
+    }
+    inst->imm_size  = 4;
+    inst->imm_sym   = op->direct.sym_addr;
+    inst->imm_reloc = CG_X86_64_RELOC_PLT32;
+    return 1;
+  }
+
+  // only call and jmp have indirect forms
+  if (mnem != CG_X86_64_MNEM_CALL && mnem != CG_X86_64_MNEM_JMP) {
+    return 0;
+  }
+  cg_inst_opcode(inst, 0xFF);
+  cg_inst_modrm_reg(inst, mnem == CG_X86_64_MNEM_CALL ? 2 : 4);
+  return cg_inst_rm(inst, op, CG_X86_64_SIZE_QUAD);
+}
+
+int cg_x86_64_encode_text(cg_x86_64_bytes *out, list_cg_x86_64_reloc *relocs,
+                          const cg_x86_64_text *text) {
+  const cg_x86_64_op *ops[2]  = {NULL, NULL};
+  size_t              ops_cnt = 0;
+
+  for (list_cg_x86_64_op_it it = list_cg_x86_64_op_begin(text->operands);
+       !END(it); NEXT(it)) {
+    if (ops_cnt == 2) {
+      return 0;
+    }
+    ops[ops_cnt++] = GET(it);
+  }
+
+  cg_inst inst;
+  memset(&inst, 0, sizeof(inst));
+
+  cg_x86_64_size size = cg_x86_64_mnem_size(text->mnem);
+  int            ok   = 0;
+
+  switch (text->mnem) {
+    case CG_X86_64_MNEM_PUSHQ:
+    case CG_X86_64_MNEM_POPQ:
+      ok = ops_cnt == 1 && cg_encode_push_pop(
+                               &inst, text->mnem == CG_X86_64_MNEM_PUSHQ,
+                               ops[0]);
+      break;
+    case CG_X86_64_MNEM_MOVB:
+    case CG_X86_64_MNEM_MOVL:
+    case CG_X86_64_MNEM_MOVQ:
+      ok = ops_cnt == 2 && cg_encode_mov(&inst, size, ops[0], ops[1]);
+      break;
+    case CG_X86_64_MNEM_RETQ:
+      cg_inst_opcode(&inst, 0xC3);
+      ok = ops_cnt == 0;
+      break;
+    case CG_X86_64_MNEM_SYSCALL:
+      cg_inst_opcode(&inst, 0x0F);
+      cg_inst_opcode(&inst, 0x05);
+      ok = ops_cnt == 0;
+      break;
+    case CG_X86_64_MNEM_XORQ:
+      ok = ops_cnt == 2 &&
+           cg_encode_alu(&inst, &CG_ALU_XOR, size, ops[0], ops[1]);
+      break;
+    case CG_X86_64_MNEM_SUBQ:
+      ok = ops_cnt == 2 &&
+           cg_encode_alu(&inst, &CG_ALU_SUB, size, ops[0], ops[1]);
+      break;
+    case CG_X86_64_MNEM_ADDQ:
+      ok = ops_cnt == 2 &&
+           cg_encode_alu(&inst, &CG_ALU_ADD, size, ops[0], ops[1]);
+      break;
+    case CG_X86_64_MNEM_CMPB:
+    case CG_X86_64_MNEM_CMPL:
+    case CG_X86_64_MNEM_CMPQ:
+      ok = ops_cnt == 2 &&
+           cg_encode_alu(&inst, &CG_ALU_CMP, size, ops[0], ops[1]);
+      break;
+    case CG_X86_64_MNEM_LEAQ:
+      ok = ops_cnt == 2 && cg_encode_lea(&inst, ops[0], ops[1]);
+      break;
+    case CG_X86_64_MNEM_TESTB:
+      ok = ops_cnt == 2 && cg_encode_test(&inst, size, ops[0], ops[1]);
+      break;
+    case CG_X86_64_MNEM_CALL:
+    case CG_X86_64_MNEM_JZ:
+    case CG_X86_64_MNEM_JNZ:
+    case CG_X86_64_MNEM_JL:
+    case CG_X86_64_MNEM_JLE:
+    case CG_X86_64_MNEM_JG:
+    case CG_X86_64_MNEM_JGE:
+    case CG_X86_64_MNEM_JB:
+    case CG_X86_64_MNEM_JBE:
+    case CG_X86_64_MNEM_JA:
+    case CG_X86_64_MNEM_JAE:
+    case CG_X86_64_MNEM_JMP:
+      ok = ops_cnt == 1 && cg_encode_branch(&inst, text->mnem, ops[0], 0);
+      break;
+  }
+
+  if (ok) {
+    cg_inst_emit(&inst, out, relocs);
+  }
+  return ok;
+}
+
+const char *cg_x86_64_encode_branch_target(const cg_x86_64_text *text) {
+  switch (text->mnem) {
+    case CG_X86_64_MNEM_JZ:
+    case CG_X86_64_MNEM_JNZ:
+    case CG_X86_64_MNEM_JL:
+    case CG_X86_64_MNEM_JLE:
+    case CG_X86_64_MNEM_JG:
+    case CG_X86_64_MNEM_JGE:
+    case CG_X86_64_MNEM_JB:
+    case CG_X86_64_MNEM_JBE:
+    case CG_X86_64_MNEM_JA:
+    case CG_X86_64_MNEM_JAE:
+    case CG_X86_64_MNEM_JMP:
+      break;
+    default:
+      return NULL;
+  }
+  if (list_cg_x86_64_op_size(text->operands) != 1) {
+    return NULL;
+  }
+  const cg_x86_64_op *op = list_cg_x86_64_op_front(text->operands);
+  return op->kind == CG_X86_64_MODE_DIRECT ? op->direct.sym_addr : NULL;
+}
+
+int cg_x86_64_encode_branch_rel8(cg_x86_64_bytes      *out,
+                                 const cg_x86_64_text *text, int8_t rel) {
+  if (!cg_x86_64_encode_branch_target(text)) {
+    return 0;
+  }
+
+  cg_inst inst;
+  memset(&inst, 0, sizeof(inst));
+  if (!cg_encode_branch(&inst, text->mnem,
+                        list_cg_x86_64_op_front(text->operands), 1)) {
+    return 0;
+  }
+  inst.imm = (uint8_t)rel;
+  cg_inst_emit(&inst, out, NULL);
+  return 1;
+}
+
+static int cg_hex_digit(uint8_t c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+// escapes are interpreted the same way as by gas in .ascii
+static void cg_encode_ascii(cg_x86_64_bytes *out, const uint8_t *cur) {
+  while (*cur) {
+    uint8_t c = *cur++;
+    if (c != '\\' || !*cur) {
+      cg_x86_64_bytes_append(out, &c, 1);
+      continue;
+    }
+
+    c = *cur++;
+    switch (c) {
+      case 'b':
+        c = '\b';
+        break;
+      case 'f':
+        c = '\f';
+        break;
+      case 'n':
+        c = '\n';
+        break;
+      case 'r':
+        c = '\r';
+        break;
+      case 't':
+        c = '\t';
+        break;
+      case 'x':
+      case 'X': {
+        uint8_t value = 0;
+        while (cg_hex_digit(*cur) >= 0) {
+          value = (value << 4) | cg_hex_digit(*cur++);
+        }
+        c = value;
+        break;
+      }
+      default:
+        if (c >= '0' && c <= '7') {
+          uint8_t value = c - '0';
+          for (int i = 0; i < 2 && *cur >= '0' && *cur <= '7'; ++i) {
+            value = (value << 3) | (*cur++ - '0');
+          }
+          c = value;
+        }
+        break;
+    }
+    cg_x86_64_bytes_append(out, &c, 1);
+  }
+
+  uint8_t end = '\0';
+  cg_x86_64_bytes_append(out, &end, 1);
+}
+
+void cg_x86_64_encode_data(cg_x86_64_bytes *out, list_cg_x86_64_reloc *relocs,
+                           const cg_x86_64_data *data) {
+  switch (data->kind) {
+    case CG_X86_64_DATA_BYTE:
+      cg_x86_64_bytes_append_le(out, data->data_byte, 1);
+      return;
+    case CG_X86_64_DATA_WORD:
+      cg_x86_64_bytes_append_le(out, data->data_word, 2);
+      return;
+    case CG_X86_64_DATA_LONG:
+      cg_x86_64_bytes_append_le(out, data->data_long, 4);
+      return;
+    case CG_X86_64_DATA_QUAD:
+      cg_x86_64_bytes_append_le(out, data->data_quad, 8);
+      return;
+    case CG_X86_64_DATA_ASCII:
+      cg_encode_ascii(out, data->data_ascii);
+      return;
+    case CG_X86_64_DATA_BYTES:
+      cg_x86_64_bytes_append(out, data->data_bytes, data->data_len);
+      return;
+    case CG_X86_64_DATA_SYMBOL:
+      list_cg_x86_64_reloc_push_back(
+          relocs, cg_x86_64_reloc_new(CG_X86_64_RELOC_64, out->size,
+                                      data->data_symbol, 0));
+      cg_x86_64_bytes_append_le(out, 0, 8);
+      return;
+  }
+  error("unexpected data kind %d %p", data->kind, data);
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "compiler/codegen/x86_64/x86_64.h"
+
+// values match relocation types of ELF x86-64 psABI
+typedef enum cg_x86_64_reloc_kind_enum {
+  CG_X86_64_RELOC_64    = 1,  // absolute quad
+  CG_X86_64_RELOC_PC32  = 2,  // relative to next instruction
+  CG_X86_64_RELOC_PLT32 = 4,  // call or jump, linker may redirect to plt
+  CG_X86_64_RELOC_32S   = 11, // absolute, sign extended to quad
+} cg_x86_64_reloc_kind;
+
+typedef struct cg_x86_64_reloc_struct {
+  cg_x86_64_reloc_kind kind;
+  uint64_t             offset; // in section
+  const char          *sym_ref;
+  int64_t              addend;
+} cg_x86_64_reloc;
+
+cg_x86_64_reloc *cg_x86_64_reloc_new(cg_x86_64_reloc_kind kind,
+                                     uint64_t offset, const char *sym_ref,
+                                     int64_t addend);
+void             cg_x86_64_reloc_free(cg_x86_64_reloc *self);
+
+static inline void container_delete_cg_x86_64_reloc(void *data) {
+  cg_x86_64_reloc_free(data);
+}
+LIST_DECLARE_STATIC_INLINE(list_cg_x86_64_reloc, cg_x86_64_reloc,
+                           container_cmp_false, container_new_move,
+                           container_delete_cg_x86_64_reloc);
+
+typedef struct cg_x86_64_bytes_struct {
+  uint8_t *data;
+  size_t   size;
+  size_t   capacity;
+} cg_x86_64_bytes;
+
+void cg_x86_64_bytes_init(cg_x86_64_bytes *self);
+void cg_x86_64_bytes_deinit(cg_x86_64_bytes *self);
+void cg_x86_64_bytes_append(cg_x86_64_bytes *self, const void *data,
+                            size_t size);
+
+// appends machine code of instruction, symbols are left to relocations that
+// are relative to section start. Returns 0 if operands can't be encoded
+int cg_x86_64_encode_text(cg_x86_64_bytes *out, list_cg_x86_64_reloc *relocs,
+                          const cg_x86_64_text *text);
+
+#define CG_X86_64_BRANCH_REL8_SIZE 2
+
+// returns target of jmp or jcc that has short form, NULL for other
+// instructions
+const char *cg_x86_64_encode_branch_target(const cg_x86_64_text *text);
+
+// appends jmp or jcc in short form, rel is counted from the end of
+// instruction. Returns 0 if instruction has no short form
+int cg_x86_64_encode_branch_rel8(cg_x86_64_bytes      *out,
+                                 const cg_x86_64_text *text, int8_t rel);
+
+void cg_x86_64_encode_data(cg_x86_64_bytes *out, list_cg_x86_64_reloc *relocs,
+                           const cg_x86_64_data *data);
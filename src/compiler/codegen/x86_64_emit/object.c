@@ -0,0 +1,308 @@
+#include "object.h"
+
+#include "compiler/codegen/exception.h"
+#include "util/log.h"
+#include "util/macro.h"
+
+// SYM
+cg_x86_64_object_sym *cg_x86_64_object_sym_new(const char *name) {
+  cg_x86_64_object_sym *self = MALLOC(cg_x86_64_object_sym);
+  self->name                 = name;
+  self->section              = CG_X86_64_OBJECT_SECTION_UNDEF;
+  self->value                = 0;
+  self->global               = 0;
+  self->idx                  = 0;
+  return self;
+}
+
+void cg_x86_64_object_sym_free(cg_x86_64_object_sym *self) {
+  if (self) {
+    free(self);
+  }
+}
+
+// OBJECT
+void cg_x86_64_object_init(cg_x86_64_object *self,
+                           list_exception   *exceptions) {
+  self->exceptions = exceptions;
+  self->syms       = hashset_cg_x86_64_object_sym_new();
+  self->sym_refs   = list_cg_x86_64_object_sym_ref_new();
+
+  for (size_t i = 0; i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    cg_x86_64_bytes_init(&self->sections[i].bytes);
+    self->sections[i].relocs = list_cg_x86_64_reloc_new();
+  }
+}
+
+void cg_x86_64_object_deinit(cg_x86_64_object *self) {
+  for (size_t i = 0; i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    cg_x86_64_bytes_deinit(&self->sections[i].bytes);
+    list_cg_x86_64_reloc_free(self->sections[i].relocs);
+  }
+  list_cg_x86_64_object_sym_ref_free(self->sym_refs);
+  hashset_cg_x86_64_object_sym_free(self->syms);
+  self->exceptions = NULL;
+}
+
+cg_x86_64_object_sym *cg_x86_64_object_sym_get(cg_x86_64_object *self,
+                                               const char       *name) {
+  hashset_cg_x86_64_object_sym_it it = hashset_cg_x86_64_object_sym_find(
+      self->syms, &(cg_x86_64_object_sym){.name = name});
+  if (!END(it)) {
+    return GET(it);
+  }
+  it = hashset_cg_x86_64_object_sym_insert(self->syms,
+                                           cg_x86_64_object_sym_new(name));
+  cg_x86_64_object_sym *sym = GET(it);
+  list_cg_x86_64_object_sym_ref_push_back(self->sym_refs, sym);
+  return sym;
+}
+
+// RELAX
+// jmp or jcc that is encoded in short form
+typedef struct cg_object_branch_struct {
+  int    relaxed;
+  size_t target; // index of label unit
+  int8_t rel;
+} cg_object_branch;
+
+static cg_x86_64_object_sym *
+cg_object_label_get(hashset_cg_x86_64_object_sym *labels, const char *name) {
+  hashset_cg_x86_64_object_sym_it it = hashset_cg_x86_64_object_sym_find(
+      labels, &(cg_x86_64_object_sym){.name = name});
+  if (END(it)) {
+    it = hashset_cg_x86_64_object_sym_insert(labels,
+                                             cg_x86_64_object_sym_new(name));
+  }
+  return GET(it);
+}
+
+// branches to labels of the same section that aren't global are resolved
+// without relocation, so they get rel8 where displacement fits, as gas does.
+// All of them start short and are grown to rel32 until every displacement
+// fits, layout only grows so iteration ends
+static cg_object_branch *cg_object_relax(cg_x86_64_object         *self,
+                                         const vec_cg_x86_64_unit *units) {
+  size_t            cnt      = vec_cg_x86_64_unit_size(units);
+  size_t           *sizes    = MALLOCN(size_t, cnt); // of long form
+  size_t           *offsets  = MALLOCN(size_t, cnt);
+  cg_object_branch *branches = MALLOCN(cg_object_branch, cnt);
+
+  hashset_cg_x86_64_object_sym *labels = hashset_cg_x86_64_object_sym_new();
+  list_cg_x86_64_reloc         *relocs = list_cg_x86_64_reloc_new();
+  cg_x86_64_bytes               scratch;
+  cg_x86_64_bytes_init(&scratch);
+
+  for (size_t i = 0; i < cnt; ++i) {
+    const cg_x86_64_unit   *unit = vec_cg_x86_64_unit_at(units, i);
+    const cg_x86_64_symbol *symbol;
+    cg_x86_64_object_sym   *label;
+
+    branches[i].relaxed = 0;
+    scratch.size        = 0;
+
+    switch (unit->kind) {
+      case CG_X86_64_UNIT_DATA:
+        cg_x86_64_encode_data(&scratch, relocs, (cg_x86_64_data *)unit);
+        break;
+      case CG_X86_64_UNIT_TEXT:
+        cg_x86_64_encode_text(&scratch, relocs, (cg_x86_64_text *)unit);
+        break;
+      case CG_X86_64_UNIT_SYMBOL:
+        symbol = (cg_x86_64_symbol *)unit;
+        if (symbol->kind == CG_X86_64_SYMBOL_EXTERN) {
+          break;
+        }
+        label = cg_object_label_get(labels, symbol->name);
+        if (symbol->kind == CG_X86_64_SYMBOL_GLOBAL) {
+          label->global = 1;
+        } else if (label->section == CG_X86_64_OBJECT_SECTION_UNDEF) {
+          label->section = CG_X86_64_OBJECT_SECTION_TEXT;
+          label->value   = i;
+        }
+        break;
+      default:
+        break;
+    }
+    sizes[i] = scratch.size;
+  }
+
+  for (size_t i = 0; i < cnt; ++i) {
+    const cg_x86_64_unit *unit = vec_cg_x86_64_unit_at(units, i);
+    if (unit->kind != CG_X86_64_UNIT_TEXT) {
+      continue;
+    }
+    const char *target =
+        cg_x86_64_encode_branch_target((cg_x86_64_text *)unit);
+    if (!target) {
+      continue;
+    }
+
+    hashset_cg_x86_64_object_sym_it label_it =
+        hashset_cg_x86_64_object_sym_find(
+            labels, &(cg_x86_64_object_sym){.name = target});
+    hashset_cg_x86_64_object_sym_it sym_it = hashset_cg_x86_64_object_sym_find(
+        self->syms, &(cg_x86_64_object_sym){.name = target});
+    if (END(label_it) || GET(label_it)->global ||
+        GET(label_it)->section == CG_X86_64_OBJECT_SECTION_UNDEF ||
+        (!END(sym_it) && GET(sym_it)->global)) {
+      continue;
+    }
+    branches[i].relaxed = 1;
+    branches[i].target  = GET(label_it)->value;
+  }
+
+  int changed;
+  do {
+    size_t offset = 0;
+    for (size_t i = 0; i < cnt; ++i) {
+      offsets[i] = offset;
+      offset += branches[i].relaxed ? CG_X86_64_BRANCH_REL8_SIZE : sizes[i];
+    }
+
+    changed = 0;
+    for (size_t i = 0; i < cnt; ++i) {
+      if (!branches[i].relaxed) {
+        continue;
+      }
+      int64_t rel = (int64_t)offsets[branches[i].target] -
+                    (int64_t)(offsets[i] + CG_X86_64_BRANCH_REL8_SIZE);
+      if (rel < INT8_MIN || rel > INT8_MAX) {
+        branches[i].relaxed = 0;
+        changed             = 1;
+      } else {
+        branches[i].rel = (int8_t)rel;
+      }
+    }
+  } while (changed);
+
+  cg_x86_64_bytes_deinit(&scratch);
+  list_cg_x86_64_reloc_free(relocs);
+  hashset_cg_x86_64_object_sym_free(labels);
+  free(offsets);
+  free(sizes);
+  return branches;
+}
+
+// BUILD
+static void cg_object_build_symbol(cg_x86_64_object            *self,
+                                   cg_x86_64_object_section_idx idx,
+                                   const cg_x86_64_symbol      *symbol) {
+  cg_x86_64_object_sym *sym;
+
+  switch (symbol->kind) {
+    case CG_X86_64_SYMBOL_DATA:
+    case CG_X86_64_SYMBOL_DATA_LN:
+    case CG_X86_64_SYMBOL_TEXT:
+      sym = cg_x86_64_object_sym_get(self, symbol->name);
+      if (sym->section != CG_X86_64_OBJECT_SECTION_UNDEF) {
+        cg_exception_add_error(self->exceptions,
+                               EXCEPTION_CG_SYMBOL_REDEFINITION, NULL,
+                               "symbol '%s' is already defined", symbol->name);
+        return;
+      }
+      sym->section = idx;
+      sym->value   = self->sections[idx].bytes.size;
+      return;
+    case CG_X86_64_SYMBOL_EXTERN:
+      // undefined symbols are external
+      return;
+    case CG_X86_64_SYMBOL_GLOBAL:
+      cg_x86_64_object_sym_get(self, symbol->name)->global = 1;
+      return;
+  }
+  error("unhandled symbol kind %d %p", symbol->kind, symbol);
+}
+
+static void cg_object_build_section(cg_x86_64_object            *self,
+                                    cg_x86_64_object_section_idx idx,
+                                    const vec_cg_x86_64_unit    *units,
+                                    const cg_object_branch      *branches) {
+  cg_x86_64_object_section *section = &self->sections[idx];
+  size_t                    i       = 0;
+
+  for (vec_cg_x86_64_unit_it it = vec_cg_x86_64_unit_begin(units); !END(it);
+       NEXT(it), ++i) {
+    const cg_x86_64_unit *unit = GET(it);
+
+    switch (unit->kind) {
+      case CG_X86_64_UNIT_DATA:
+        cg_x86_64_encode_data(&section->bytes, section->relocs,
+                              (cg_x86_64_data *)unit);
+        break;
+      case CG_X86_64_UNIT_TEXT:
+        if (branches && branches[i].relaxed) {
+          cg_x86_64_encode_branch_rel8(&section->bytes, (cg_x86_64_text *)unit,
+                                       branches[i].rel);
+        } else if (!cg_x86_64_encode_text(&section->bytes, section->relocs,
+                                   (cg_x86_64_text *)unit)) {
+          cg_exception_add_error(self->exceptions,
+                                 EXCEPTION_CG_UNSUPPORTED_INSTRUCTION, NULL,
+                                 "can't encode instruction with mnemonic %d",
+                                 ((cg_x86_64_text *)unit)->mnem);
+        }
+        break;
+      case CG_X86_64_UNIT_SYMBOL:
+        cg_object_build_symbol(self, idx, (cg_x86_64_symbol *)unit);
+        break;
+      default:
+        error("unexpected unit kind %d %p", unit->kind, unit);
+        break;
+    }
+  }
+}
+
+static void cg_write_i32(uint8_t *data, int64_t value) {
+  for (size_t i = 0; i < 4; ++i) {
+    data[i] = (uint8_t)((uint64_t)value >> (i * 8));
+  }
+}
+
+// relative references to local symbols of the same section are known before
+// linking, they are patched in place and removed
+static void cg_object_resolve_section(cg_x86_64_object            *self,
+                                      cg_x86_64_object_section_idx idx) {
+  cg_x86_64_object_section *section = &self->sections[idx];
+  list_cg_x86_64_reloc     *relocs  = list_cg_x86_64_reloc_new();
+
+  while (!list_cg_x86_64_reloc_empty(section->relocs)) {
+    cg_x86_64_reloc *reloc = list_cg_x86_64_reloc_pop_front(section->relocs);
+    cg_x86_64_object_sym *sym = cg_x86_64_object_sym_get(self, reloc->sym_ref);
+
+    if ((reloc->kind == CG_X86_64_RELOC_PC32 ||
+         reloc->kind == CG_X86_64_RELOC_PLT32) &&
+        sym->section == idx && !sym->global) {
+      cg_write_i32(section->bytes.data + reloc->offset,
+                   (int64_t)sym->value + reloc->addend -
+                       (int64_t)reloc->offset);
+      cg_x86_64_reloc_free(reloc);
+    } else {
+      list_cg_x86_64_reloc_push_back(relocs, reloc);
+    }
+  }
+
+  list_cg_x86_64_reloc_free(section->relocs);
+  section->relocs = relocs;
+}
+
+void cg_x86_64_object_build(cg_x86_64_object *self, const cg_x86_64 *code) {
+  cg_object_build_section(self, CG_X86_64_OBJECT_SECTION_DATA, code->data,
+                          NULL);
+
+  cg_object_branch *branches = cg_object_relax(self, code->text);
+  cg_object_build_section(self, CG_X86_64_OBJECT_SECTION_TEXT, code->text,
+                          branches);
+  free(branches);
+
+  cg_object_build_section(self, CG_X86_64_OBJECT_SECTION_DEBUG_INFO,
+                          code->debug_info, NULL);
+  cg_object_build_section(self, CG_X86_64_OBJECT_SECTION_DEBUG_LINE,
+                          code->debug_line, NULL);
+  cg_object_build_section(self, CG_X86_64_OBJECT_SECTION_DEBUG_STR,
+                          code->debug_str, NULL);
+
+  for (size_t i = CG_X86_64_OBJECT_SECTION_DATA;
+       i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    cg_object_resolve_section(self, i);
+  }
+}
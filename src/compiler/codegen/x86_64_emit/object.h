@@ -0,0 +1,76 @@
+#pragma once
+
+#include "compiler/codegen/x86_64/x86_64.h"
+#include "compiler/codegen/x86_64_emit/encode.h"
+#include "compiler/exception/list.h"
+#include "util/hashset.h"
+
+// sections with content, 0 is reserved for undefined
+typedef enum cg_x86_64_object_section_idx_enum {
+  CG_X86_64_OBJECT_SECTION_UNDEF = 0,
+  CG_X86_64_OBJECT_SECTION_DATA,
+  CG_X86_64_OBJECT_SECTION_TEXT,
+  CG_X86_64_OBJECT_SECTION_DEBUG_INFO,
+  CG_X86_64_OBJECT_SECTION_DEBUG_LINE,
+  CG_X86_64_OBJECT_SECTION_DEBUG_STR,
+  CG_X86_64_OBJECT_SECTION_CNT,
+} cg_x86_64_object_section_idx;
+
+typedef struct cg_x86_64_object_sym_struct {
+  const char *name;
+  size_t      section; // CG_X86_64_OBJECT_SECTION_UNDEF if not defined
+  uint64_t    value;   // offset in section
+  int         global;
+  uint32_t    idx; // free for writers
+} cg_x86_64_object_sym;
+
+cg_x86_64_object_sym *cg_x86_64_object_sym_new(const char *name);
+void                  cg_x86_64_object_sym_free(cg_x86_64_object_sym *self);
+
+static inline void container_delete_cg_x86_64_object_sym(void *data) {
+  cg_x86_64_object_sym_free(data);
+}
+static inline int container_cmp_cg_x86_64_object_sym(const void *lsv,
+                                                     const void *rsv) {
+  const cg_x86_64_object_sym *l = lsv;
+  const cg_x86_64_object_sym *r = rsv;
+  return container_cmp_chars(l->name, r->name);
+}
+static inline uint64_t container_hash_cg_x86_64_object_sym(const void *lsv) {
+  const cg_x86_64_object_sym *l = lsv;
+  return container_hash_chars(l->name);
+}
+HASHSET_DECLARE_STATIC_INLINE(hashset_cg_x86_64_object_sym,
+                              cg_x86_64_object_sym,
+                              container_cmp_cg_x86_64_object_sym,
+                              container_new_move,
+                              container_delete_cg_x86_64_object_sym,
+                              container_hash_cg_x86_64_object_sym);
+
+LIST_DECLARE_STATIC_INLINE(list_cg_x86_64_object_sym_ref, cg_x86_64_object_sym,
+                           container_cmp_false, container_new_move,
+                           container_delete_false);
+
+typedef struct cg_x86_64_object_section_struct {
+  cg_x86_64_bytes       bytes;
+  list_cg_x86_64_reloc *relocs; // relative to section start
+} cg_x86_64_object_section;
+
+// encoded code with symbols that is not bound to addresses yet
+typedef struct cg_x86_64_object_struct {
+  list_exception                 *exceptions;
+  hashset_cg_x86_64_object_sym   *syms;
+  list_cg_x86_64_object_sym_ref  *sym_refs; // to preserve order
+  cg_x86_64_object_section        sections[CG_X86_64_OBJECT_SECTION_CNT];
+} cg_x86_64_object;
+
+void cg_x86_64_object_init(cg_x86_64_object *self, list_exception *exceptions);
+void cg_x86_64_object_deinit(cg_x86_64_object *self);
+
+// encodes all sections, relative references to local symbols of the same
+// section are patched in place, other relocations are left
+void cg_x86_64_object_build(cg_x86_64_object *self, const cg_x86_64 *code);
+
+// returns symbol by name, it is created undefined if it doesn't exist
+cg_x86_64_object_sym *cg_x86_64_object_sym_get(cg_x86_64_object *self,
+                                               const char       *name);
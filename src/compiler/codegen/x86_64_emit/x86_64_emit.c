@@ -3,22 +3,38 @@
 #include "compiler/codegen/x86_64_emit/emit.h"
 
 cg_x86_64_emit_result cg_x86_64_emit(const cg_x86_64      *code,
-                                     cg_x86_64_emit_format format) {
+                                     cg_x86_64_emit_format format,
+                                     FILE *stream, FILE *tee) {
   cg_x86_64_emit_result result = {
-      .asm_str    = NULL,
       .exceptions = list_exception_new(),
   };
 
   cg_x86_64_emit_ctx ctx = {
       .exceptions = result.exceptions,
+      .stream     = stream,
+      .tee        = tee,
   };
 
-  if (format == CG_X86_64_EMIT_FORMAT_GAS) {
-    result.asm_str = cg_x86_64_emit_gas(&ctx, code);
-  } else {
-    cg_exception_add_error(result.exceptions,
-                           EXCEPTION_CG_UNEXPECTED_EMIT_FORMAT, NULL,
-                           "only GAS format is supported");
+  uint8_t *obj;
+  size_t   obj_size;
+
+  switch (format) {
+    case CG_X86_64_EMIT_FORMAT_GAS:
+      cg_x86_64_emit_gas(&ctx, code);
+      break;
+    case CG_X86_64_EMIT_FORMAT_ELF:
+      // section offsets are known only after encoding
+      obj = cg_x86_64_emit_elf(&ctx, code, &obj_size);
+      if (obj) {
+        fwrite(obj, 1, obj_size, stream);
+      }
+      free(obj);
+      break;
+    default:
+      cg_exception_add_error(result.exceptions,
+                             EXCEPTION_CG_UNEXPECTED_EMIT_FORMAT, NULL,
+                             "only GAS and ELF formats are supported");
+      break;
   }
 
   return result;
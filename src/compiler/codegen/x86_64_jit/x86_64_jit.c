@@ -0,0 +1,266 @@
+#include "x86_64_jit.h"
+
+#include "compiler/codegen/exception.h"
+#include "compiler/codegen/x86_64_emit/object.h"
+#include "util/macro.h"
+#include <dlfcn.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// memory is placed below runtime in steps until it is in reach of rel32
+#define CG_JIT_MAP_ATTEMPTS 64
+#define CG_JIT_MAP_STEP (16ull << 20)
+
+// sym->idx of external symbols
+#define CG_JIT_SYM_UNRESOLVED 0
+#define CG_JIT_SYM_RESOLVED 1
+#define CG_JIT_SYM_MISSING 2
+
+void cg_x86_64_jit_free(cg_x86_64_jit *self) {
+  if (self) {
+    if (self->memory) {
+      munmap(self->memory, self->size);
+    }
+    free(self);
+  }
+}
+
+// CTX
+typedef struct cg_ctx_struct {
+  list_exception   *exceptions;
+  cg_x86_64_object *obj;
+  uint8_t          *memory;
+  size_t            size;
+  size_t            page;
+  uint64_t          offsets[CG_X86_64_OBJECT_SECTION_CNT];
+  // range of addresses of external symbols
+  uintptr_t ext_min;
+  uintptr_t ext_max;
+} cg_ctx;
+
+static size_t cg_align_up(size_t value, size_t align) {
+  return (value + align - 1) / align * align;
+}
+
+static int cg_fits_i32(int64_t value) {
+  return value >= INT32_MIN && value <= INT32_MAX;
+}
+
+static int cg_section_loaded(size_t section) {
+  return section == CG_X86_64_OBJECT_SECTION_TEXT ||
+         section == CG_X86_64_OBJECT_SECTION_DATA;
+}
+
+// text and data are placed on separate pages to be protected differently
+static void cg_ctx_layout(cg_ctx *ctx) {
+  const cg_x86_64_object_section *text =
+      &ctx->obj->sections[CG_X86_64_OBJECT_SECTION_TEXT];
+  const cg_x86_64_object_section *data =
+      &ctx->obj->sections[CG_X86_64_OBJECT_SECTION_DATA];
+
+  ctx->offsets[CG_X86_64_OBJECT_SECTION_TEXT] = 0;
+  ctx->offsets[CG_X86_64_OBJECT_SECTION_DATA] =
+      cg_align_up(text->bytes.size, ctx->page);
+  ctx->size = cg_align_up(ctx->offsets[CG_X86_64_OBJECT_SECTION_DATA] +
+                              data->bytes.size,
+                          ctx->page);
+  if (!ctx->size) {
+    ctx->size = ctx->page;
+  }
+}
+
+static void cg_ctx_resolve_section(cg_ctx *ctx, size_t idx) {
+  const cg_x86_64_object_section *section = &ctx->obj->sections[idx];
+
+  for (list_cg_x86_64_reloc_it it = list_cg_x86_64_reloc_begin(section->relocs);
+       !END(it); NEXT(it)) {
+    const cg_x86_64_reloc *reloc = GET(it);
+    cg_x86_64_object_sym  *sym =
+        cg_x86_64_object_sym_get(ctx->obj, reloc->sym_ref);
+
+    if (sym->section != CG_X86_64_OBJECT_SECTION_UNDEF ||
+        sym->idx != CG_JIT_SYM_UNRESOLVED) {
+      continue;
+    }
+
+    void *address = dlsym(RTLD_DEFAULT, sym->name);
+    if (!address) {
+      sym->idx = CG_JIT_SYM_MISSING;
+      cg_exception_add_error(ctx->exceptions, EXCEPTION_CG_UNDEFINED_SYMBOL,
+                             NULL, "symbol '%s' is not found in runtime",
+                             sym->name);
+      continue;
+    }
+
+    sym->idx   = CG_JIT_SYM_RESOLVED;
+    sym->value = (uintptr_t)address;
+    if (!ctx->ext_min || (uintptr_t)address < ctx->ext_min) {
+      ctx->ext_min = (uintptr_t)address;
+    }
+    if ((uintptr_t)address > ctx->ext_max) {
+      ctx->ext_max = (uintptr_t)address;
+    }
+  }
+}
+
+static int cg_ctx_in_reach(cg_ctx *ctx, uintptr_t base) {
+  if (!ctx->ext_min) {
+    return 1;
+  }
+  return cg_fits_i32((int64_t)(ctx->ext_max - base)) &&
+         cg_fits_i32((int64_t)(ctx->ext_min - (base + ctx->size)));
+}
+
+static int cg_ctx_map(cg_ctx *ctx) {
+  int prot  = PROT_READ | PROT_WRITE;
+  int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+  if (!ctx->ext_min) {
+    void *memory = mmap(NULL, ctx->size, prot, flags, -1, 0);
+    ctx->memory  = memory == MAP_FAILED ? NULL : memory;
+    return ctx->memory != NULL;
+  }
+
+  uintptr_t start = (ctx->ext_min & ~(ctx->page - 1)) - ctx->size;
+  for (size_t i = 0; i < CG_JIT_MAP_ATTEMPTS; ++i) {
+    void *hint   = (void *)(start - i * CG_JIT_MAP_STEP);
+    void *memory = mmap(hint, ctx->size, prot, flags, -1, 0);
+    if (memory == MAP_FAILED) {
+      continue;
+    }
+    if (cg_ctx_in_reach(ctx, (uintptr_t)memory)) {
+      ctx->memory = memory;
+      return 1;
+    }
+    munmap(memory, ctx->size);
+  }
+  return 0;
+}
+
+static uintptr_t cg_ctx_sym_address(cg_ctx *ctx,
+                                    const cg_x86_64_object_sym *sym) {
+  if (sym->section == CG_X86_64_OBJECT_SECTION_UNDEF) {
+    return sym->value;
+  }
+  return (uintptr_t)ctx->memory + ctx->offsets[sym->section] + sym->value;
+}
+
+static void cg_ctx_relocate_section(cg_ctx *ctx, size_t idx) {
+  const cg_x86_64_object_section *section = &ctx->obj->sections[idx];
+  uint8_t *base = ctx->memory + ctx->offsets[idx];
+
+  for (list_cg_x86_64_reloc_it it = list_cg_x86_64_reloc_begin(section->relocs);
+       !END(it); NEXT(it)) {
+    const cg_x86_64_reloc      *reloc = GET(it);
+    const cg_x86_64_object_sym *sym =
+        cg_x86_64_object_sym_get(ctx->obj, reloc->sym_ref);
+
+    if (sym->section == CG_X86_64_OBJECT_SECTION_UNDEF
+            ? sym->idx != CG_JIT_SYM_RESOLVED
+            : !cg_section_loaded(sym->section)) {
+      continue;
+    }
+
+    uint8_t *place = base + reloc->offset;
+    int64_t  value = (int64_t)cg_ctx_sym_address(ctx, sym) + reloc->addend;
+    switch (reloc->kind) {
+      case CG_X86_64_RELOC_64:
+        memcpy(place, &value, sizeof(uint64_t));
+        continue;
+      case CG_X86_64_RELOC_PC32:
+      case CG_X86_64_RELOC_PLT32:
+        value -= (int64_t)(uintptr_t)place;
+        break;
+      case CG_X86_64_RELOC_32S:
+        break;
+    }
+
+    if (!cg_fits_i32(value)) {
+      cg_exception_add_error(ctx->exceptions, EXCEPTION_CG_RELOCATION_OVERFLOW,
+                             NULL, "symbol '%s' is out of reach", sym->name);
+      continue;
+    }
+    int32_t value_i32 = (int32_t)value;
+    memcpy(place, &value_i32, sizeof(int32_t));
+  }
+}
+
+static int cg_ctx_load(cg_ctx *ctx) {
+  cg_ctx_layout(ctx);
+
+  cg_ctx_resolve_section(ctx, CG_X86_64_OBJECT_SECTION_TEXT);
+  cg_ctx_resolve_section(ctx, CG_X86_64_OBJECT_SECTION_DATA);
+
+  if (!cg_ctx_map(ctx)) {
+    cg_exception_add_error(ctx->exceptions, EXCEPTION_CG_EXECUTABLE_MEMORY,
+                           NULL, "can't map %lu bytes in reach of runtime",
+                           ctx->size);
+    return 0;
+  }
+
+  for (size_t i = CG_X86_64_OBJECT_SECTION_DATA;
+       i < CG_X86_64_OBJECT_SECTION_CNT; ++i) {
+    if (cg_section_loaded(i)) {
+      const cg_x86_64_bytes *bytes = &ctx->obj->sections[i].bytes;
+      if (bytes->size) {
+        memcpy(ctx->memory + ctx->offsets[i], bytes->data, bytes->size);
+      }
+    }
+  }
+
+  cg_ctx_relocate_section(ctx, CG_X86_64_OBJECT_SECTION_TEXT);
+  cg_ctx_relocate_section(ctx, CG_X86_64_OBJECT_SECTION_DATA);
+
+  // data is left writable
+  size_t text_size = ctx->offsets[CG_X86_64_OBJECT_SECTION_DATA];
+  if (text_size &&
+      mprotect(ctx->memory, text_size, PROT_READ | PROT_EXEC) != 0) {
+    cg_exception_add_error(ctx->exceptions, EXCEPTION_CG_EXECUTABLE_MEMORY,
+                           NULL, "can't make %lu bytes executable", text_size);
+    return 0;
+  }
+  return 1;
+}
+
+cg_x86_64_jit_result cg_x86_64_jit_load(const cg_x86_64 *code,
+                                        const char      *entry) {
+  cg_x86_64_jit_result result = {
+      .jit        = NULL,
+      .exceptions = list_exception_new(),
+  };
+
+  cg_x86_64_object obj;
+  cg_x86_64_object_init(&obj, result.exceptions);
+  cg_x86_64_object_build(&obj, code);
+
+  cg_ctx ctx;
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.exceptions = result.exceptions;
+  ctx.obj        = &obj;
+  ctx.page       = sysconf(_SC_PAGESIZE);
+
+  const cg_x86_64_object_sym *entry_sym =
+      cg_x86_64_object_sym_get(&obj, entry);
+  if (entry_sym->section != CG_X86_64_OBJECT_SECTION_TEXT) {
+    cg_exception_add_error(result.exceptions, EXCEPTION_CG_UNDEFINED_SYMBOL,
+                           NULL, "entry '%s' is not defined", entry);
+  }
+
+  int loaded = cg_ctx_load(&ctx);
+
+  if (loaded && !list_exception_count_by_level(result.exceptions,
+                                               EXCEPTION_LEVEL_ERROR)) {
+    result.jit         = MALLOC(cg_x86_64_jit);
+    result.jit->memory = ctx.memory;
+    result.jit->size   = ctx.size;
+    result.jit->entry =
+        (cg_x86_64_jit_entry *)cg_ctx_sym_address(&ctx, entry_sym);
+  } else if (ctx.memory) {
+    munmap(ctx.memory, ctx.size);
+  }
+
+  cg_x86_64_object_deinit(&obj);
+
+  return result;
+}
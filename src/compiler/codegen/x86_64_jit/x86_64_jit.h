@@ -0,0 +1,26 @@
+#pragma once
+
+#include "compiler/codegen/x86_64/x86_64.h"
+#include "compiler/exception/list.h"
+
+typedef int cg_x86_64_jit_entry(void);
+
+// code and data loaded into memory of current process
+typedef struct cg_x86_64_jit_struct {
+  uint8_t             *memory;
+  size_t               size;
+  cg_x86_64_jit_entry *entry;
+} cg_x86_64_jit;
+
+void cg_x86_64_jit_free(cg_x86_64_jit *self);
+
+typedef struct cg_x86_64_jit_result_struct {
+  cg_x86_64_jit  *jit; // NULL if code can't be loaded
+  list_exception *exceptions;
+} cg_x86_64_jit_result;
+
+// encodes code into executable memory, external symbols are resolved against
+// symbols exported by current executable (runtime libraries). Entry is the
+// symbol called to run program
+cg_x86_64_jit_result cg_x86_64_jit_load(const cg_x86_64 *code,
+                                        const char      *entry);
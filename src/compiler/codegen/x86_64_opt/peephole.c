@@ -0,0 +1,356 @@
+#include "peephole.h"
+#include "util/log.h"
+#include "util/macro.h"
+#include <string.h>
+
+// how far rules may look back for instruction they depend on
+#define CG_PEEPHOLE_WINDOW 8
+
+// processed units, rules are matched against the tail
+typedef struct cg_ctx_struct {
+  cg_x86_64_unit **units;
+  size_t           units_len;
+  size_t           units_cap;
+} cg_ctx;
+
+static void cg_ctx_init(cg_ctx *ctx) {
+  ctx->units_len = 0;
+  ctx->units_cap = 64;
+  ctx->units     = MALLOCN(cg_x86_64_unit *, ctx->units_cap);
+}
+
+static void cg_ctx_deinit(cg_ctx *ctx) {
+  free(ctx->units);
+  ctx->units     = NULL;
+  ctx->units_len = 0;
+  ctx->units_cap = 0;
+}
+
+static void cg_ctx_push(cg_ctx *ctx, cg_x86_64_unit *unit) {
+  if (ctx->units_len == ctx->units_cap) {
+    ctx->units_cap *= 2;
+    ctx->units =
+        realloc(ctx->units, sizeof(cg_x86_64_unit *) * ctx->units_cap);
+  }
+  ctx->units[ctx->units_len++] = unit;
+}
+
+// idx - position from the end, 0 is the last unit
+static cg_x86_64_unit *cg_ctx_back(cg_ctx *ctx, size_t idx) {
+  return idx < ctx->units_len ? ctx->units[ctx->units_len - 1 - idx] : NULL;
+}
+
+static cg_x86_64_text *cg_ctx_back_text(cg_ctx *ctx, size_t idx) {
+  cg_x86_64_unit *unit = cg_ctx_back(ctx, idx);
+  return unit && unit->kind == CG_X86_64_UNIT_TEXT ? (cg_x86_64_text *)unit
+                                                   : NULL;
+}
+
+static cg_x86_64_symbol *cg_ctx_back_label(cg_ctx *ctx, size_t idx) {
+  cg_x86_64_unit *unit = cg_ctx_back(ctx, idx);
+  if (unit && unit->kind == CG_X86_64_UNIT_SYMBOL) {
+    cg_x86_64_symbol *symbol = (typeof(symbol))unit;
+    if (symbol->kind == CG_X86_64_SYMBOL_TEXT) {
+      return symbol;
+    }
+  }
+  return NULL;
+}
+
+static void cg_ctx_erase(cg_ctx *ctx, size_t idx) {
+  size_t pos = ctx->units_len - 1 - idx;
+
+  cg_x86_64_unit_free(ctx->units[pos]);
+  memmove(ctx->units + pos, ctx->units + pos + 1,
+          sizeof(cg_x86_64_unit *) * idx);
+  --ctx->units_len;
+}
+
+// INSTRUCTION PROPERTIES
+static const cg_x86_64_op *cg_text_op(const cg_x86_64_text *text,
+                                      size_t                idx) {
+  for (list_cg_x86_64_op_it it = list_cg_x86_64_op_begin(text->operands);
+       !END(it); NEXT(it), --idx) {
+    if (!idx) {
+      return GET(it);
+    }
+  }
+  return NULL;
+}
+
+static int cg_text_is_jmp(const cg_x86_64_text *text) {
+  switch (text->mnem) {
+    case CG_X86_64_MNEM_JZ:
+    case CG_X86_64_MNEM_JNZ:
+    case CG_X86_64_MNEM_JL:
+    case CG_X86_64_MNEM_JLE:
+    case CG_X86_64_MNEM_JG:
+    case CG_X86_64_MNEM_JGE:
+    case CG_X86_64_MNEM_JB:
+    case CG_X86_64_MNEM_JBE:
+    case CG_X86_64_MNEM_JA:
+    case CG_X86_64_MNEM_JAE:
+    case CG_X86_64_MNEM_JMP:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+// control flow leaves instruction or registers are clobbered
+static int cg_text_is_barrier(const cg_x86_64_text *text) {
+  switch (text->mnem) {
+    case CG_X86_64_MNEM_CALL:
+    case CG_X86_64_MNEM_SYSCALL:
+    case CG_X86_64_MNEM_RETQ:
+      return 1;
+    default:
+      return cg_text_is_jmp(text);
+  }
+}
+
+// returns 1 if whole 64-bit register is overwritten without being read
+static int cg_text_overwrites_reg(const cg_x86_64_text *text,
+                                  cg_x86_64_reg        *reg) {
+  switch (text->mnem) {
+    case CG_X86_64_MNEM_MOVL: // zero extends
+    case CG_X86_64_MNEM_MOVQ:
+    case CG_X86_64_MNEM_LEAQ:
+      break;
+    default:
+      return 0;
+  }
+
+  const cg_x86_64_op *src = cg_text_op(text, 0);
+  const cg_x86_64_op *dst = cg_text_op(text, 1);
+
+  if (!src || !dst || dst->kind != CG_X86_64_MODE_REGISTER ||
+      cg_x86_64_op_has_reg(src, dst->reg.reg)) {
+    return 0;
+  }
+
+  *reg = dst->reg.reg;
+  return 1;
+}
+
+// returns 1 if register can be modified by instruction
+static int cg_text_writes_reg(const cg_x86_64_text *text, cg_x86_64_reg reg) {
+  switch (text->mnem) {
+    case CG_X86_64_MNEM_PUSHQ:
+    case CG_X86_64_MNEM_POPQ:
+      if (reg == CG_X86_64_REG_RSP) {
+        return 1;
+      }
+      break;
+    case CG_X86_64_MNEM_TESTB:
+    case CG_X86_64_MNEM_CMPB:
+    case CG_X86_64_MNEM_CMPL:
+    case CG_X86_64_MNEM_CMPQ:
+      return 0;
+    default:
+      if (cg_text_is_barrier(text)) {
+        return 1;
+      }
+      break;
+  }
+
+  const cg_x86_64_op *dst = NULL;
+  for (list_cg_x86_64_op_it it = list_cg_x86_64_op_begin(text->operands);
+       !END(it); NEXT(it)) {
+    dst = GET(it);
+  }
+
+  return dst && dst->kind == CG_X86_64_MODE_REGISTER && dst->reg.reg == reg;
+}
+
+static int cg_text_is_rsp_adjust(const cg_x86_64_text *text, int64_t *delta) {
+  if (text->mnem != CG_X86_64_MNEM_ADDQ && text->mnem != CG_X86_64_MNEM_SUBQ) {
+    return 0;
+  }
+
+  const cg_x86_64_op *src = cg_text_op(text, 0);
+  const cg_x86_64_op *dst = cg_text_op(text, 1);
+
+  if (!src || !dst || src->kind != CG_X86_64_MODE_IMMEDIATE ||
+      dst->kind != CG_X86_64_MODE_REGISTER ||
+      dst->reg.reg != CG_X86_64_REG_RSP) {
+    return 0;
+  }
+
+  *delta = text->mnem == CG_X86_64_MNEM_ADDQ ? (int64_t)src->imm.imm_const
+                                             : -(int64_t)src->imm.imm_const;
+  return 1;
+}
+
+// RULES
+// each rule looks at the tail of processed units, returns 1 if applied
+
+// jmp .L1; [labels...] .L1: -> [labels...] .L1:
+static int cg_rule_jmp_next(cg_ctx *ctx) {
+  const cg_x86_64_symbol *label = cg_ctx_back_label(ctx, 0);
+  if (!label) {
+    return 0;
+  }
+
+  size_t idx = 1;
+  while (cg_ctx_back_label(ctx, idx)) {
+    ++idx;
+  }
+
+  const cg_x86_64_text *text = cg_ctx_back_text(ctx, idx);
+  if (!text || !cg_text_is_jmp(text)) {
+    return 0;
+  }
+
+  const cg_x86_64_op *op = cg_text_op(text, 0);
+  if (!op || op->kind != CG_X86_64_MODE_DIRECT ||
+      strcmp(op->direct.sym_addr, label->name)) {
+    return 0;
+  }
+
+  cg_ctx_erase(ctx, idx);
+  return 1;
+}
+
+// movq $0x0, %rdi; leaq -0x18(%rbp), %rdi -> leaq -0x18(%rbp), %rdi
+static int cg_rule_mov_dead(cg_ctx *ctx) {
+  const cg_x86_64_text *cur  = cg_ctx_back_text(ctx, 0);
+  const cg_x86_64_text *prev = cg_ctx_back_text(ctx, 1);
+
+  cg_x86_64_reg reg;
+  if (!cur || !prev || !cg_text_overwrites_reg(cur, &reg)) {
+    return 0;
+  }
+
+  switch (prev->mnem) {
+    case CG_X86_64_MNEM_MOVB:
+    case CG_X86_64_MNEM_MOVL:
+    case CG_X86_64_MNEM_MOVQ:
+    case CG_X86_64_MNEM_LEAQ:
+      break;
+    default:
+      return 0;
+  }
+
+  const cg_x86_64_op *dst = cg_text_op(prev, 1);
+  if (!dst || dst->kind != CG_X86_64_MODE_REGISTER || dst->reg.reg != reg) {
+    return 0;
+  }
+
+  cg_ctx_erase(ctx, 1);
+  return 1;
+}
+
+// leaq -0x18(%rbp), %rdi; <no writes to rdi, rbp>; leaq -0x18(%rbp), %rdi
+// -> second leaq is dropped
+static int cg_rule_lea_repeat(cg_ctx *ctx) {
+  const cg_x86_64_text *cur = cg_ctx_back_text(ctx, 0);
+  if (!cur || cur->mnem != CG_X86_64_MNEM_LEAQ) {
+    return 0;
+  }
+
+  const cg_x86_64_op *src = cg_text_op(cur, 0);
+  const cg_x86_64_op *dst = cg_text_op(cur, 1);
+  if (!src || !dst || dst->kind != CG_X86_64_MODE_REGISTER ||
+      src->kind != CG_X86_64_MODE_BASE_IMM ||
+      src->base_imm.reg_base == dst->reg.reg) {
+    return 0;
+  }
+
+  for (size_t idx = 1; idx <= CG_PEEPHOLE_WINDOW; ++idx) {
+    const cg_x86_64_text *text = cg_ctx_back_text(ctx, idx);
+    // label or beginning of stream
+    if (!text) {
+      return 0;
+    }
+    if (!cg_x86_64_text_cmp(text, cur)) {
+      cg_ctx_erase(ctx, 0);
+      return 1;
+    }
+    if (cg_text_writes_reg(text, dst->reg.reg) ||
+        cg_text_writes_reg(text, src->base_imm.reg_base)) {
+      return 0;
+    }
+  }
+  return 0;
+}
+
+// addq $0x8, %rsp; subq $0x8, %rsp -> (nothing)
+// subq $0x8, %rsp; subq $0x10, %rsp -> subq $0x18, %rsp
+static int cg_rule_rsp_cancel(cg_ctx *ctx) {
+  const cg_x86_64_text *cur  = cg_ctx_back_text(ctx, 0);
+  const cg_x86_64_text *prev = cg_ctx_back_text(ctx, 1);
+
+  int64_t delta_cur, delta_prev;
+  if (!cur || !prev || !cg_text_is_rsp_adjust(cur, &delta_cur) ||
+      !cg_text_is_rsp_adjust(prev, &delta_prev)) {
+    return 0;
+  }
+
+  int64_t delta = delta_prev + delta_cur;
+
+  cg_ctx_erase(ctx, 0);
+  cg_ctx_erase(ctx, 0);
+
+  if (delta) {
+    list_cg_x86_64_op *ops = list_cg_x86_64_op_new();
+    list_cg_x86_64_op_push_back(
+        ops, cg_x86_64_op_new_immediate(delta > 0 ? delta : -delta));
+    list_cg_x86_64_op_push_back(ops,
+                                cg_x86_64_op_new_register(CG_X86_64_REG_RSP));
+
+    cg_ctx_push(ctx, (cg_x86_64_unit *)cg_x86_64_text_new(
+                         delta > 0 ? CG_X86_64_MNEM_ADDQ : CG_X86_64_MNEM_SUBQ,
+                         ops));
+  }
+  return 1;
+}
+
+typedef int cg_rule_f(cg_ctx *ctx);
+
+typedef struct cg_rule_struct {
+  const char *name;
+  cg_rule_f  *apply;
+} cg_rule;
+
+static const cg_rule cg_rules[] = {
+    {"jmp_next", cg_rule_jmp_next},
+    {"mov_dead", cg_rule_mov_dead},
+    {"lea_repeat", cg_rule_lea_repeat},
+    {"rsp_cancel", cg_rule_rsp_cancel},
+};
+
+#define CG_RULES_LEN (sizeof(cg_rules) / sizeof(cg_rules[0]))
+
+void cg_peephole(vec_cg_x86_64_unit *units, list_cg_x86_64_opt_stat *stats) {
+  uint64_t hits[CG_RULES_LEN] = {0};
+
+  cg_ctx ctx;
+  cg_ctx_init(&ctx);
+
+  while (!vec_cg_x86_64_unit_empty(units)) {
+    cg_ctx_push(&ctx, vec_cg_x86_64_unit_pop_front(units));
+
+    // rule can expose new match for another one at the tail
+    for (int applied = 1; applied;) {
+      applied = 0;
+      for (size_t i = 0; i < CG_RULES_LEN; ++i) {
+        if (cg_rules[i].apply(&ctx)) {
+          ++hits[i];
+          applied = 1;
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < ctx.units_len; ++i) {
+    vec_cg_x86_64_unit_push_back(units, ctx.units[i]);
+  }
+
+  for (size_t i = 0; i < CG_RULES_LEN; ++i) {
+    list_cg_x86_64_opt_stat_push_back(
+        stats, cg_x86_64_opt_stat_new("peephole", cg_rules[i].name, hits[i]));
+  }
+
+  cg_ctx_deinit(&ctx);
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "compiler/codegen/x86_64_opt/x86_64_opt.h"
+
+// applies pattern rules to instruction stream, adds hit counters to stats
+void cg_peephole(vec_cg_x86_64_unit *units, list_cg_x86_64_opt_stat *stats);
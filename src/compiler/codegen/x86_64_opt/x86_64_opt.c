@@ -0,0 +1,32 @@
+#include "x86_64_opt.h"
+#include "compiler/codegen/x86_64_opt/peephole.h"
+#include "util/macro.h"
+
+cg_x86_64_opt_stat *cg_x86_64_opt_stat_new(const char *pass_ref,
+                                           const char *rule_ref,
+                                           uint64_t    hits) {
+  cg_x86_64_opt_stat *self = MALLOC(cg_x86_64_opt_stat);
+  self->pass_ref           = pass_ref;
+  self->rule_ref           = rule_ref;
+  self->hits               = hits;
+  return self;
+}
+
+void cg_x86_64_opt_stat_free(cg_x86_64_opt_stat *self) {
+  if (self) {
+    free(self);
+  }
+}
+
+cg_x86_64_opt_result cg_x86_64_opt(cg_x86_64 *code, int level) {
+  cg_x86_64_opt_result result = {
+      .stats      = list_cg_x86_64_opt_stat_new(),
+      .exceptions = list_exception_new(),
+  };
+
+  if (level >= 1) {
+    cg_peephole(code->text, result.stats);
+  }
+
+  return result;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "compiler/codegen/x86_64/x86_64.h"
+#include "compiler/exception/list.h"
+
+// per-rule statistics of optimization passes
+typedef struct cg_x86_64_opt_stat_struct {
+  const char *pass_ref;
+  const char *rule_ref;
+  uint64_t    hits;
+} cg_x86_64_opt_stat;
+
+cg_x86_64_opt_stat *cg_x86_64_opt_stat_new(const char *pass_ref,
+                                           const char *rule_ref, uint64_t hits);
+void                cg_x86_64_opt_stat_free(cg_x86_64_opt_stat *self);
+
+static inline void container_delete_cg_x86_64_opt_stat(void *data) {
+  cg_x86_64_opt_stat_free(data);
+}
+LIST_DECLARE_STATIC_INLINE(list_cg_x86_64_opt_stat, cg_x86_64_opt_stat,
+                           container_cmp_false, container_new_move,
+                           container_delete_cg_x86_64_opt_stat);
+
+typedef struct cg_x86_64_opt_result_struct {
+  list_cg_x86_64_opt_stat *stats;
+  list_exception          *exceptions;
+} cg_x86_64_opt_result;
+
+// level - optimization level, 0 disables all passes
+cg_x86_64_opt_result cg_x86_64_opt(cg_x86_64 *code, int level);
@@ -264,15 +264,15 @@ static void dot_cfg_traverse(dot_ctx *ctx, const mir_subroutine *sub) {
     return;
   }
 
-  for (list_mir_bb_it it = list_mir_bb_begin(sub->defined.bbs); !END(it);
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
        NEXT(it)) {
     mir_bb *bb  = GET(it);
     ctx->bb_ref = bb;
 
     char label[64];
-    if (list_mir_bb_front(sub->defined.bbs) == bb) {
+    if (vec_mir_bb_front(sub->defined.bbs) == bb) {
       snprintf(label, STRMAXLEN(label), "block_%lu (START)", bb->id);
-    } else if (list_mir_bb_back(sub->defined.bbs) == bb) {
+    } else if (vec_mir_bb_back(sub->defined.bbs) == bb) {
       snprintf(label, STRMAXLEN(label), "block_%lu (END)", bb->id);
     } else {
       snprintf(label, STRMAXLEN(label), "block_%lu", bb->id);
@@ -1,5 +1,6 @@
 #include "dot.h"
 
+#include "compiler/mir_build/call_graph.h"
 #include "util/hashset.h"
 #include "util/log.h"
 #include "util/macro.h"
@@ -72,6 +73,7 @@ typedef struct dot_ctx_struct {
   size_t               sub_cnt;
   hashset_dot_sym_sub *map_sym_sub;
   hashset_dot_sub     *visited_subs;
+  mir_call_graph      *call_graph;
   strbuf              *buffer;
 } dot_ctx;
 
@@ -79,6 +81,7 @@ static void dot_ctx_init(dot_ctx *ctx, strbuf *buffer) {
   ctx->sub_cnt      = 0;
   ctx->map_sym_sub  = hashset_dot_sym_sub_new();
   ctx->visited_subs = hashset_dot_sub_new();
+  ctx->call_graph   = NULL;
   ctx->buffer       = buffer;
 }
 
@@ -86,10 +89,14 @@ static void dot_ctx_deinit(dot_ctx *ctx) {
   ctx->sub_cnt = 0;
   hashset_dot_sym_sub_free(ctx->map_sym_sub);
   hashset_dot_sub_free(ctx->visited_subs);
-  ctx->buffer = NULL;
+  mir_call_graph_free(ctx->call_graph);
+  ctx->call_graph = NULL;
+  ctx->buffer     = NULL;
 }
 
 static void dot_ctx_setup(dot_ctx *ctx, const mir *mir) {
+  ctx->call_graph = mir_call_graph_new(mir);
+
   for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
        !END(it); NEXT(it)) {
     mir_subroutine *sub = GET(it);
@@ -160,27 +167,22 @@ static dot_sub *dot_cg_traverse(dot_ctx *ctx, const mir_subroutine *sub) {
     return dot_cur;
   }
 
-  for (list_mir_bb_it it = list_mir_bb_begin(sub->defined.bbs); !END(it);
-       NEXT(it)) {
-    mir_bb *bb = GET(it);
-
-    for (list_mir_stmt_it it = list_mir_stmt_begin(bb->stmts); !END(it);
-         NEXT(it)) {
-      mir_stmt *stmt = GET(it);
-
-      if (stmt->kind != MIR_STMT_CALL) {
-        continue;
-      }
-
-      dot_sub *dot_child = dot_cg_traverse(ctx, stmt->call.sub);
-      if (!dot_child) {
-        warn("child sub %p traverse returned null");
-        continue;
-      }
+  mir_call_node *node = mir_call_graph_find(ctx->call_graph, sub);
+  if (!node) {
+    return dot_cur;
+  }
 
-      strbuf_append_f(ctx->buffer, buf, "subroutine_%lu -> subroutine_%lu;\n",
-                      dot_cur->id, dot_child->id);
+  for (list_mir_subroutine_ref_it it =
+           list_mir_subroutine_ref_begin(node->callees);
+       !END(it); NEXT(it)) {
+    dot_sub *dot_child = dot_cg_traverse(ctx, GET(it));
+    if (!dot_child) {
+      warn("child sub %p traverse returned null");
+      continue;
     }
+
+    strbuf_append_f(ctx->buffer, buf, "subroutine_%lu -> subroutine_%lu;\n",
+                    dot_cur->id, dot_child->id);
   }
   return dot_cur;
 }
@@ -272,6 +272,18 @@ const char *exception_subtype_cg_str(exception_subtype_cg type) {
       return "unsupported class declared subroutine";
     case EXCEPTION_CG_UNSUPPORTED_CLASS_IMPORTED:
       return "unsupported class imported subroutine";
+    case EXCEPTION_CG_UNSUPPORTED_INSTRUCTION:
+      return "unsupported instruction";
+    case EXCEPTION_CG_SYMBOL_REDEFINITION:
+      return "symbol redefinition";
+    case EXCEPTION_CG_UNDEFINED_SYMBOL:
+      return "undefined symbol";
+    case EXCEPTION_CG_RELOCATION_OVERFLOW:
+      return "relocation out of range";
+    case EXCEPTION_CG_EXECUTABLE_MEMORY:
+      return "executable memory unavailable";
+    case EXCEPTION_CG_CACHE_UNAVAILABLE:
+      return "build cache unavailable";
     case EXCEPTION_CG_UNKNOWN:
       break;
   }
@@ -77,6 +77,12 @@ typedef enum enception_subtype_cg_enum {
   EXCEPTION_CG_UNSUPPORTED_EXTERN_TYPE,
   EXCEPTION_CG_UNSUPPORTED_CLASS_DECLARED,
   EXCEPTION_CG_UNSUPPORTED_CLASS_IMPORTED,
+  EXCEPTION_CG_UNSUPPORTED_INSTRUCTION,
+  EXCEPTION_CG_SYMBOL_REDEFINITION,
+  EXCEPTION_CG_UNDEFINED_SYMBOL,
+  EXCEPTION_CG_RELOCATION_OVERFLOW,
+  EXCEPTION_CG_EXECUTABLE_MEMORY,
+  EXCEPTION_CG_CACHE_UNAVAILABLE,
 } exception_subtype_cg;
 
 typedef struct exception_struct {
@@ -3,17 +3,28 @@
 
 hir *hir_new() {
   hir *self         = MALLOC(hir);
-  self->classes     = list_hir_class_new();
-  self->subroutines = list_hir_subroutine_new();
+  self->arena       = arena_new(0);
+  self->classes     = list_hir_class_new_arena(self->arena);
+  self->subroutines = list_hir_subroutine_new_arena(self->arena);
   return self;
 }
 
 void hir_free(hir *self) {
   if (self) {
-    list_hir_class_free(self->classes);
-    self->classes = NULL;
-    list_hir_subroutine_free(self->subroutines);
-    self->subroutines = NULL;
+    arena_free(self->arena);
     free(self);
   }
 }
+
+void hir_merge(hir *self, hir *other) {
+  while (!list_hir_class_empty(other->classes)) {
+    list_hir_class_push_back(self->classes,
+                             list_hir_class_pop_front(other->classes));
+  }
+  while (!list_hir_subroutine_empty(other->subroutines)) {
+    list_hir_subroutine_push_back(
+        self->subroutines, list_hir_subroutine_pop_front(other->subroutines));
+  }
+  arena_merge(self->arena, other->arena);
+  free(other);
+}
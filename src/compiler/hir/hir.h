@@ -2,11 +2,18 @@
 
 #include "compiler/hir/node_class.h"
 #include "compiler/hir/node_subroutine.h"
+#include "util/arena.h"
 
 typedef struct hir_struct {
   list_hir_class      *classes;
   list_hir_subroutine *subroutines;
+  arena               *arena; // nodes owned by hir
 } hir;
 
+// nodes, containers, spans and strings they hold are allocated from arena of
+// hir they belong to, so hir is released at once with arena
 hir *hir_new();
 void hir_free(hir *self);
+// moves classes and subroutines of other to the end of self, arena of other is
+// merged into arena of self, frees other
+void hir_merge(hir *self, hir *other);
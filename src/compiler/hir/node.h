@@ -27,6 +27,3 @@ typedef struct hir_base_struct {
 } hir_base;
 
 void hir_base_init(hir_base *self, span *span, hir_node_enum kind);
-void hir_base_deinit(hir_base *self);
-
-void hir_node_free(hir_base *generic);
@@ -6,30 +6,22 @@
 
 // ID
 typedef struct hir_id_struct {
-  hir_base base;
-  char    *name;
+  hir_base    base;
+  const char *name; // interned
 } hir_id;
 
-typedef struct hir_id_data_struct {
-  span *span;
-  char *name;
-} hir_id_data;
+hir_id *hir_id_new(arena *arena, span *span, const char *name);
+hir_id *hir_id_copy(arena *arena, const hir_id *id);
 
-hir_id     *hir_id_new(span *span, char *name);
-hir_id     *hir_id_copy(const hir_id *id);
-hir_id_data hir_id_pop(hir_id *id);
-void        hir_id_free(hir_id *id);
-
-static inline void container_delete_hir_id(void *data) { hir_id_free(data); }
 LIST_DECLARE_STATIC_INLINE(list_hir_id, hir_id, container_cmp_false,
-                           container_new_move, container_delete_hir_id);
+                           container_new_move, container_delete_false);
 
 // LITERAL
 typedef union hir_lit_u_union {
   long  v_long;
   ulong v_ulong;
-  char *v_str;
-  char *v_char;
+  char *v_str;  // in arena of lit
+  char *v_char; // in arena of lit
   int   v_bool;
 } hir_lit_u;
 
@@ -43,9 +35,9 @@ typedef struct hir_lit_struct {
   hir_lit_u value;
 } hir_lit;
 
-hir_lit *hir_lit_new(span *span, hir_type_base *type, hir_lit_u value);
-hir_lit *hir_lit_copy(const hir_lit *self);
-void     hir_lit_free(hir_lit *self);
+hir_lit *hir_lit_new(arena *arena, span *span, hir_type_base *type,
+                     hir_lit_u value);
+hir_lit *hir_lit_copy(arena *arena, const hir_lit *self);
 
 // PARAM
 typedef struct hir_param {
@@ -61,15 +53,13 @@ typedef struct hir_param {
   };
 } hir_param;
 
-hir_param *hir_param_new(span *span, hir_id *id, hir_type_base *type);
-hir_param *hir_param_new_typed(span *span, hir_id *id, type_entry *type_ref);
-void       hir_param_free(hir_param *self);
+hir_param *hir_param_new(arena *arena, span *span, hir_id *id,
+                         hir_type_base *type);
+hir_param *hir_param_new_typed(arena *arena, span *span, hir_id *id,
+                               type_entry *type_ref);
 
-static inline void container_delete_hir_param(void *data) {
-  hir_param_free(data);
-}
 LIST_DECLARE_STATIC_INLINE(list_hir_param, hir_param, container_cmp_false,
-                           container_new_move, container_delete_hir_param);
+                           container_new_move, container_delete_false);
 
 // VAR
 typedef struct hir_var {
@@ -85,12 +75,10 @@ typedef struct hir_var {
   };
 } hir_var;
 
-hir_var *hir_var_new(span *span, hir_id *id, hir_type_base *type);
-hir_var *hir_var_new_typed(span *span, hir_id *id, type_entry *type_ref);
-void     hir_var_free(hir_var *self);
+hir_var *hir_var_new(arena *arena, span *span, hir_id *id,
+                     hir_type_base *type);
+hir_var *hir_var_new_typed(arena *arena, span *span, hir_id *id,
+                           type_entry *type_ref);
 
-static inline void container_delete_hir_var(void *data) {
-  hir_param_free(data);
-}
 LIST_DECLARE_STATIC_INLINE(list_hir_var, hir_var, container_cmp_false,
-                           container_new_move, container_delete_hir_var);
+                           container_new_move, container_delete_false);
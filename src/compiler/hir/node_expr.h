@@ -61,13 +61,8 @@ typedef struct hir_expr_base_struct {
   };
 } hir_expr_base;
 
-void hir_expr_free(hir_expr_base *generic);
-
-static inline void container_delete_hir_expr(void *data) {
-  hir_expr_free(data);
-}
 LIST_DECLARE_STATIC_INLINE(list_hir_expr, hir_expr_base, container_cmp_false,
-                           container_new_move, container_delete_hir_expr);
+                           container_new_move, container_delete_false);
 
 typedef struct hir_expr_unary_struct {
   hir_expr_base       base;
@@ -75,15 +70,15 @@ typedef struct hir_expr_unary_struct {
   hir_expr_base      *first;
 } hir_expr_unary;
 
-hir_expr_unary *hir_expr_unary_new(span *span, hir_type_base *type,
+hir_expr_unary *hir_expr_unary_new(arena *arena, span *span,
+                                   hir_type_base      *type,
                                    hir_expr_unary_enum op,
                                    hir_expr_base      *first);
-hir_expr_unary *hir_expr_unary_new_typed(span *span, type_entry *type_ref,
+hir_expr_unary *hir_expr_unary_new_typed(arena *arena, span *span,
+                                         type_entry         *type_ref,
                                          hir_expr_unary_enum op,
                                          hir_expr_base      *first);
 
-void hir_expr_unary_free(hir_expr_unary *self);
-
 typedef struct hir_expr_binary_struct {
   hir_expr_base        base;
   hir_expr_binary_enum op;
@@ -91,25 +86,26 @@ typedef struct hir_expr_binary_struct {
   hir_expr_base       *second;
 } hir_expr_binary;
 
-hir_expr_binary *hir_expr_binary_new(span *span, hir_type_base *type,
+hir_expr_binary *hir_expr_binary_new(arena *arena, span *span,
+                                     hir_type_base       *type,
                                      hir_expr_binary_enum op,
                                      hir_expr_base       *first,
                                      hir_expr_base       *second);
-hir_expr_binary *hir_expr_binary_new_typed(span *span, type_entry *type_ref,
+hir_expr_binary *hir_expr_binary_new_typed(arena *arena, span *span,
+                                           type_entry          *type_ref,
                                            hir_expr_binary_enum op,
                                            hir_expr_base       *first,
                                            hir_expr_base       *second);
-void             hir_expr_binary_free(hir_expr_binary *self);
 
 typedef struct hir_expr_lit_struct {
   hir_expr_base base;
   hir_lit      *lit;
 } hir_expr_lit;
 
-hir_expr_lit *hir_expr_lit_new(span *span, hir_type_base *type, hir_lit *lit);
-hir_expr_lit *hir_expr_lit_new_typed(span *span, type_entry *type_ref,
-                                     hir_lit *lit);
-void          hir_expr_lit_free(hir_expr_lit *self);
+hir_expr_lit *hir_expr_lit_new(arena *arena, span *span, hir_type_base *type,
+                               hir_lit *lit);
+hir_expr_lit *hir_expr_lit_new_typed(arena *arena, span *span,
+                                     type_entry *type_ref, hir_lit *lit);
 
 typedef struct hir_expr_id {
   hir_expr_base base;
@@ -119,10 +115,10 @@ typedef struct hir_expr_id {
   };
 } hir_expr_id;
 
-hir_expr_id *hir_expr_id_new(span *span, hir_type_base *type, hir_id *id);
-hir_expr_id *hir_expr_id_new_typed(span *span, type_entry *type_ref,
-                                   hir_id *id);
-void         hir_expr_id_free(hir_expr_id *self);
+hir_expr_id *hir_expr_id_new(arena *arena, span *span, hir_type_base *type,
+                             hir_id *id);
+hir_expr_id *hir_expr_id_new_typed(arena *arena, span *span,
+                                   type_entry *type_ref, hir_id *id);
 
 typedef struct hir_expr_call {
   hir_expr_base  base;
@@ -130,12 +126,12 @@ typedef struct hir_expr_call {
   list_hir_expr *args;
 } hir_expr_call;
 
-hir_expr_call *hir_expr_call_new(span *span, hir_type_base *type,
+hir_expr_call *hir_expr_call_new(arena *arena, span *span, hir_type_base *type,
                                  hir_expr_base *callee, list_hir_expr *args);
-hir_expr_call *hir_expr_call_new_typed(span *span, type_entry *type_ref,
+hir_expr_call *hir_expr_call_new_typed(arena *arena, span *span,
+                                       type_entry    *type_ref,
                                        hir_expr_base *callee,
                                        list_hir_expr *args);
-void           hir_expr_call_free(hir_expr_call *self);
 
 typedef struct hir_expr_index {
   hir_expr_base  base;
@@ -143,12 +139,13 @@ typedef struct hir_expr_index {
   list_hir_expr *args;
 } hir_expr_index;
 
-hir_expr_index *hir_expr_index_new(span *span, hir_type_base *type,
-                                   hir_expr_base *indexed, list_hir_expr *args);
-hir_expr_index *hir_expr_index_new_typed(span *span, type_entry *type_ref,
+hir_expr_index *hir_expr_index_new(arena *arena, span *span,
+                                   hir_type_base *type, hir_expr_base *indexed,
+                                   list_hir_expr *args);
+hir_expr_index *hir_expr_index_new_typed(arena *arena, span *span,
+                                         type_entry    *type_ref,
                                          hir_expr_base *indexed,
                                          list_hir_expr *args);
-void            hir_expr_index_free(hir_expr_index *self);
 
 typedef struct hir_expr_builtin {
   hir_expr_base         base;
@@ -156,10 +153,11 @@ typedef struct hir_expr_builtin {
   list_hir_expr        *args;
 } hir_expr_builtin;
 
-hir_expr_builtin *hir_expr_builtin_new(span *span, hir_type_base *type,
+hir_expr_builtin *hir_expr_builtin_new(arena *arena, span *span,
+                                       hir_type_base        *type,
                                        hir_expr_builtin_enum kind,
                                        list_hir_expr        *args);
-hir_expr_builtin *hir_expr_builtin_new_typed(span *span, type_entry *type_ref,
+hir_expr_builtin *hir_expr_builtin_new_typed(arena *arena, span *span,
+                                             type_entry           *type_ref,
                                              hir_expr_builtin_enum kind,
                                              list_hir_expr        *args);
-void              hir_expr_builtin_free(hir_expr_builtin *self);
@@ -19,15 +19,9 @@ typedef struct hir_stmt_base_struct {
 } hir_stmt_base;
 
 void hir_stmt_base_init(hir_stmt_base *self, span *span, hir_stmt_enum kind);
-void hir_stmt_base_deinit(hir_stmt_base *self);
 
-void hir_stmt_free(hir_stmt_base *generic);
-
-static inline void container_delete_hir_stmt(void *data) {
-  hir_stmt_free(data);
-}
 LIST_DECLARE_STATIC_INLINE(list_hir_stmt, hir_stmt_base, container_cmp_false,
-                           container_new_move, container_delete_hir_stmt);
+                           container_new_move, container_delete_false);
 
 typedef struct hir_stmt_if_struct {
   hir_stmt_base  base;
@@ -36,17 +30,16 @@ typedef struct hir_stmt_if_struct {
   hir_stmt_base *jz;
 } hir_stmt_if;
 
-hir_stmt_if *hir_stmt_if_new(span *span, hir_expr_base *cond, hir_stmt_base *je,
-                             hir_stmt_base *jz);
-void         hir_stmt_if_free(hir_stmt_if *self);
+hir_stmt_if *hir_stmt_if_new(arena *arena, span *span, hir_expr_base *cond,
+                             hir_stmt_base *je, hir_stmt_base *jz);
 
 typedef struct hir_stmt_block_struct {
   hir_stmt_base  base;
   list_hir_stmt *stmts;
 } hir_stmt_block;
 
-hir_stmt_block *hir_stmt_block_new(span *span, list_hir_stmt *stmts);
-void            hir_stmt_block_free(hir_stmt_block *self);
+hir_stmt_block *hir_stmt_block_new(arena *arena, span *span,
+                                   list_hir_stmt *stmts);
 
 typedef struct hir_stmt_while_struct {
   hir_stmt_base  base;
@@ -54,9 +47,8 @@ typedef struct hir_stmt_while_struct {
   hir_stmt_base *stmt;
 } hir_stmt_while;
 
-hir_stmt_while *hir_stmt_while_new(span *span, hir_expr_base *cond,
-                                   hir_stmt_base *stmt);
-void            hir_stmt_while_free(hir_stmt_while *self);
+hir_stmt_while *hir_stmt_while_new(arena *arena, span *span,
+                                   hir_expr_base *cond, hir_stmt_base *stmt);
 
 typedef struct hir_stmt_do_struct {
   hir_stmt_base  base;
@@ -65,29 +57,26 @@ typedef struct hir_stmt_do_struct {
   hir_stmt_base *stmt;
 } hir_stmt_do;
 
-hir_stmt_do *hir_stmt_do_new(span *span, int positive, hir_expr_base *cond,
-                             hir_stmt_base *stmt);
-void         hir_stmt_do_free(hir_stmt_do *self);
+hir_stmt_do *hir_stmt_do_new(arena *arena, span *span, int positive,
+                             hir_expr_base *cond, hir_stmt_base *stmt);
 
 typedef struct hir_stmt_break_struct {
   hir_stmt_base base;
 } hir_stmt_break;
 
-hir_stmt_break *hir_stmt_break_new(span *span);
-void            hir_stmt_break_free(hir_stmt_break *self);
+hir_stmt_break *hir_stmt_break_new(arena *arena, span *span);
 
 typedef struct hir_stmt_expr_struct {
   hir_stmt_base  base;
   hir_expr_base *expr;
 } hir_stmt_expr;
 
-hir_stmt_expr *hir_stmt_expr_new(span *span, hir_expr_base *expr);
-void           hir_stmt_expr_free(hir_stmt_expr *self);
+hir_stmt_expr *hir_stmt_expr_new(arena *arena, span *span, hir_expr_base *expr);
 
 typedef struct hir_stmt_return_struct {
   hir_stmt_base  base;
   hir_expr_base *expr;
 } hir_stmt_return;
 
-hir_stmt_return *hir_stmt_return_new(span *span, hir_expr_base *expr);
-void             hir_stmt_return_free(hir_stmt_return *self);
+hir_stmt_return *hir_stmt_return_new(arena *arena, span *span,
+                                     hir_expr_base *expr);
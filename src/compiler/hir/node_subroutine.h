@@ -44,29 +44,25 @@ typedef struct hir_subroutine {
   hir_subroutine_body *body;
 } hir_subroutine;
 
-hir_subroutine_body *hir_subroutine_body_new_block(list_hir_var   *vars,
+hir_subroutine_body *hir_subroutine_body_new_block(arena          *arena,
+                                                   list_hir_var   *vars,
                                                    hir_stmt_block *block);
-hir_subroutine_body *hir_subroutine_body_new_import(hir_lit *entry,
+hir_subroutine_body *hir_subroutine_body_new_import(arena   *arena,
+                                                    hir_lit *entry,
                                                     hir_lit *lib);
-void                 hir_subroutine_body_free(hir_subroutine_body *self);
 
-hir_subroutine *hir_subroutine_new(span *span, hir_id *id,
+hir_subroutine *hir_subroutine_new(arena *arena, span *span, hir_id *id,
                                    list_hir_param      *params,
                                    hir_type_base       *ret_type,
                                    hir_subroutine_spec  spec,
                                    hir_subroutine_body *body);
 
-hir_subroutine *hir_subroutine_new_typed(span *span, hir_id *id,
+hir_subroutine *hir_subroutine_new_typed(arena *arena, span *span, hir_id *id,
                                          list_hir_param      *params,
                                          type_entry          *type_ref,
                                          hir_subroutine_spec  spec,
                                          hir_subroutine_body *body);
 
-void hir_subroutine_free(hir_subroutine *self);
-
-static inline void container_delete_hir_subroutine(void *data) {
-  hir_subroutine_free(data);
-}
 LIST_DECLARE_STATIC_INLINE(list_hir_subroutine, hir_subroutine,
                            container_cmp_false, container_new_move,
-                           container_delete_hir_subroutine);
+                           container_delete_false);
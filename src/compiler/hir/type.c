@@ -7,74 +7,23 @@
 #include <stdlib.h>
 #include <string.h>
 
-static void hir_type_base_deinit(hir_type_base *self) { span_free(self->span); }
-
-static void hir_type_base_free(hir_type_base *self) {
-  if (self) {
-    hir_type_base_deinit(self);
-    free(self);
-  }
-}
-
 static void hir_type_base_init(hir_type_base *self, hir_type_enum type,
                                span *span) {
   self->type = type;
   self->span = span;
 }
 
-static void hir_type_custom_free(hir_type_custom *self) {
-  if (self) {
-    if (self->name) {
-      free(self->name);
-    }
-    list_hir_type_free(self->templates);
-    hir_type_base_deinit(&self->base);
-    free(self);
-  }
-}
-
-static void hir_type_array_free(hir_type_array *self) {
-  if (self) {
-    hir_type_free(self->elem_type);
-    hir_type_base_deinit(&self->base);
-    free(self);
-  }
-}
-
 static inline uint64_t hash_combine(uint64_t seed, uint64_t value) {
   return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
 }
 
-hir_type_base *hir_type_base_new(span *span, hir_type_enum type) {
-  hir_type_base *self = MALLOC(hir_type_base);
+hir_type_base *hir_type_base_new(arena *arena, span *span, hir_type_enum type) {
+  hir_type_base *self = ARENA_MALLOC(arena, hir_type_base);
   hir_type_base_init(self, type, span);
   return self;
 }
 
-void hir_type_free(hir_type_base *generic) {
-  if (generic) {
-    switch (generic->type) {
-      case HIR_TYPE_BOOL:
-      case HIR_TYPE_BYTE:
-      case HIR_TYPE_INT:
-      case HIR_TYPE_UINT:
-      case HIR_TYPE_LONG:
-      case HIR_TYPE_ULONG:
-      case HIR_TYPE_CHAR:
-      case HIR_TYPE_STRING:
-      case HIR_TYPE_VOID:
-      case HIR_TYPE_ANY:
-        return hir_type_base_free(generic);
-      case HIR_TYPE_CUSTOM:
-        return hir_type_custom_free((hir_type_custom *)generic);
-      case HIR_TYPE_ARRAY:
-        return hir_type_array_free((hir_type_array *)generic);
-    }
-    error("unknown hir type %d", generic->type);
-  }
-}
-
-hir_type_base *hir_type_copy(const hir_type_base *self) {
+hir_type_base *hir_type_copy(arena *arena, const hir_type_base *self) {
   if (!self) {
     return NULL;
   }
@@ -89,17 +38,20 @@ hir_type_base *hir_type_copy(const hir_type_base *self) {
     case HIR_TYPE_STRING:
     case HIR_TYPE_VOID:
     case HIR_TYPE_ANY:
-      return hir_type_base_new(span_copy(self->span), self->type);
+      return hir_type_base_new(arena, span_copy_arena(arena, self->span),
+                               self->type);
     case HIR_TYPE_CUSTOM: {
       const hir_type_custom *custom = (typeof(custom))self;
       return (hir_type_base *)hir_type_custom_new(
-          span_copy(self->span), strdup(custom->name),
-          hir_type_copy_list(custom->templates));
+          arena, span_copy_arena(arena, self->span),
+          arena_strdup(arena, custom->name),
+          hir_type_copy_list(arena, custom->templates));
     }
     case HIR_TYPE_ARRAY: {
       const hir_type_array *array = (typeof(array))self;
       return (hir_type_base *)hir_type_array_new(
-          span_copy(self->span), hir_type_copy(array->elem_type));
+          arena, span_copy_arena(arena, self->span),
+          hir_type_copy(arena, array->elem_type));
     }
   }
 
@@ -186,13 +138,13 @@ uint64_t hir_type_hash(const hir_type_base *lsv) {
   return 0;
 }
 
-list_hir_type *hir_type_copy_list(const list_hir_type *in) {
+list_hir_type *hir_type_copy_list(arena *arena, const list_hir_type *in) {
   if (!in) {
     return NULL;
   }
-  list_hir_type *nlist = list_hir_type_new();
+  list_hir_type *nlist = list_hir_type_new_arena(arena);
   for (list_hir_type_it it = list_hir_type_begin(in); !END(it); NEXT(it)) {
-    list_hir_type_push_back(nlist, hir_type_copy(GET(it)));
+    list_hir_type_push_back(nlist, hir_type_copy(arena, GET(it)));
   }
   return nlist;
 }
@@ -235,17 +187,18 @@ uint64_t hir_type_hash_list(const list_hir_type *list) {
   return hash;
 }
 
-hir_type_custom *hir_type_custom_new(span *span, char *name,
+hir_type_custom *hir_type_custom_new(arena *arena, span *span, char *name,
                                      list_hir_type *templates) {
-  hir_type_custom *self = MALLOC(hir_type_custom);
+  hir_type_custom *self = ARENA_MALLOC(arena, hir_type_custom);
   hir_type_base_init(&self->base, HIR_TYPE_CUSTOM, span);
   self->name      = name;
   self->templates = templates;
   return self;
 }
 
-hir_type_array *hir_type_array_new(span *span, hir_type_base *elem_type) {
-  hir_type_array *self = MALLOC(hir_type_array);
+hir_type_array *hir_type_array_new(arena *arena, span *span,
+                                   hir_type_base *elem_type) {
+  hir_type_array *self = ARENA_MALLOC(arena, hir_type_array);
   hir_type_base_init(&self->base, HIR_TYPE_ARRAY, span);
   self->elem_type = elem_type;
   return self;
@@ -6,16 +6,16 @@
 #include "util/macro.h"
 #include <string.h>
 
-// hir_scope
+// hir_scope (names of ids are interned, so they are compared by pointer)
 static inline int container_cmp_hir_scope_entry(const void *lsv,
                                                 const void *rsv) {
   const symbol_entry *l = lsv;
   const symbol_entry *r = rsv;
-  return container_cmp_chars(l->name, r->name);
+  return container_cmp_ptr(l->name, r->name);
 }
 static inline uint64_t container_hash_hir_scope_entry(const void *lsv) {
   const symbol_entry *l = lsv;
-  return container_hash_chars(l->name);
+  return container_hash_ptr(l->name);
 }
 HASHSET_DECLARE_STATIC_INLINE(hir_scope, symbol_entry,
                               container_cmp_hir_scope_entry, container_new_move,
@@ -59,9 +59,11 @@ static void hir_ctx_scopes_pop(hir_ctx *ctx) {
   // debug("scopes_height: %zu", list_hir_scope_size(ctx->scopes));
 }
 
+// symbol table outlives hir, so it owns a copy of span from arena of hir
 static inline symbol_entry *
-hir_ctx_table_emplace(hir_ctx *ctx, char *id, type_entry *type, span *span) {
-  return symbol_table_emplace(ctx->symbol_table, id, type, span);
+hir_ctx_table_emplace(hir_ctx *ctx, const char *id, type_entry *type,
+                      const span *span) {
+  return symbol_table_emplace(ctx->symbol_table, id, type, span_copy(span));
 }
 
 static symbol_entry *hir_ctx_scopes_find(const hir_ctx *ctx, const char *id) {
@@ -69,7 +71,7 @@ static symbol_entry *hir_ctx_scopes_find(const hir_ctx *ctx, const char *id) {
        NEXT(it)) {
     hir_scope   *scope = GET(it);
     hir_scope_it scope_it =
-        hir_scope_find(scope, &(symbol_entry){.name = (char *)id});
+        hir_scope_find(scope, &(symbol_entry){.name = id});
 
     if (!END(scope_it)) {
       return GET(scope_it);
@@ -104,12 +106,11 @@ static int hir_bind_var(hir_ctx *ctx, hir_var *var) {
     }
 
     symbol_entry *entry = hir_ctx_table_emplace(
-        ctx, strdup(var->id_hir->name), is_bind_type ? var->type_ref : NULL,
+        ctx, var->id_hir->name, is_bind_type ? var->type_ref : NULL,
         var->base.span);
 
     hir_ctx_scopes_insert(ctx, entry);
 
-    hir_id_free(var->id_hir);
     var->id_ref    = entry;
     var->base.span = NULL;
     var->state |= HIR_STATE_BIND_SYMBOL;
@@ -134,12 +135,11 @@ static int hir_bind_param(hir_ctx *ctx, hir_param *param) {
     }
 
     symbol_entry *entry = hir_ctx_table_emplace(
-        ctx, strdup(param->id_hir->name), is_bind_type ? param->type_ref : NULL,
+        ctx, param->id_hir->name, is_bind_type ? param->type_ref : NULL,
         param->base.span);
 
     hir_ctx_scopes_insert(ctx, entry);
 
-    hir_id_free(param->id_hir);
     param->id_ref    = entry;
     param->base.span = NULL;
     param->state |= HIR_STATE_BIND_SYMBOL;
@@ -191,7 +191,6 @@ static void hir_bind_subroutine_body_expr(hir_ctx *ctx, hir_expr_base *base) {
           return;
         }
 
-        hir_id_free(self->id_hir);
         self->id_ref = found;
         self->base.state |= HIR_STATE_BIND_SYMBOL;
       }
@@ -294,13 +293,12 @@ static void hir_bind_subroutine_signature(hir_ctx        *ctx,
     }
 
     symbol_entry *entry =
-        hir_ctx_table_emplace(ctx, strdup(hir_subroutine->id_hir->name),
+        hir_ctx_table_emplace(ctx, hir_subroutine->id_hir->name,
                               is_bind_type ? hir_subroutine->type_ref : NULL,
                               hir_subroutine->base.span);
 
     hir_ctx_scopes_insert(ctx, entry);
 
-    hir_id_free(hir_subroutine->id_hir);
     hir_subroutine->id_ref    = entry;
     hir_subroutine->base.span = NULL;
     hir_subroutine->state |= HIR_STATE_BIND_SYMBOL;
@@ -367,7 +365,6 @@ static void hir_bind_class(hir_ctx *ctx, hir_class *hir_class) {
     hir_method *method = GET(it);
 
     // update span for bind_subroutine to get relevant info about location
-    span_free(method->subroutine->base.span);
     method->subroutine->base.span = method->base.span;
     method->base.span             = NULL;
 
@@ -17,7 +17,7 @@ typedef enum ctx_scope_kind_enum {
 
 // scope_entry
 typedef struct hir_scope_entry_struct {
-  hir_type_base *type_hir;
+  hir_type_base *type_hir; // in arena of ctx
   ctx_scope_kind kind;
   type_entry    *type_ref;
 } hir_scope_entry;
@@ -34,7 +34,6 @@ static hir_scope_entry *hir_scope_entry_new(hir_type_base *type_hir,
 
 static void hir_scope_entry_free(hir_scope_entry *self) {
   if (self) {
-    hir_type_free(self->type_hir);
     self->type_ref = NULL;
     free(self);
   }
@@ -96,6 +95,7 @@ typedef struct hir_ctx_struct {
   size_t          scope_depth;
   list_exception *exceptions;
   type_table     *type_table;
+  arena          *arena; // of scope types
 } hir_ctx;
 
 static hir_scope_entry *hir_ctx_scopes_insert(hir_ctx         *ctx,
@@ -114,16 +114,26 @@ static void hir_ctx_init(hir_ctx *ctx, type_table *type_table,
   ctx->scope_depth = 0;
   ctx->type_table  = type_table;
   ctx->exceptions  = exceptions;
+  ctx->arena       = arena_new(0);
 }
 
 static void hir_ctx_deinit(hir_ctx *ctx) {
   list_hir_scope_free(ctx->scopes);
   ctx->scope_depth = 0;
+  arena_free(ctx->arena);
 }
 
+// declarations (classes and typenames), type table outlives hir, so it owns
+// a copy of span from arena of hir
 static inline type_entry *
-hir_ctx_table_emplace(hir_ctx *ctx, type_base *type_base, span *span) {
-  return type_table_emplace(ctx->type_table, type_base, span);
+hir_ctx_table_emplace(hir_ctx *ctx, type_base *type_base, const span *span) {
+  return type_table_emplace(ctx->type_table, type_base, span_copy(span));
+}
+
+// usages, equal types share entry
+static inline type_entry *
+hir_ctx_table_intern(hir_ctx *ctx, type_base *type_base, span *span) {
+  return type_table_intern(ctx->type_table, type_base, span);
 }
 
 static hir_scope_entry *hir_ctx_scopes_find(const hir_ctx       *ctx,
@@ -186,9 +196,8 @@ static hir_scope_entry *hir_ctx_scopes_resolve(hir_ctx             *ctx,
   hir_scope_entry *entry;
 
   if (!base) {
-    hir_type_base *any = hir_type_base_new(NULL, HIR_TYPE_ANY);
-    entry              = hir_ctx_scopes_find(ctx, any, kind, scope_out);
-    hir_type_free(any);
+    entry = hir_ctx_scopes_find(ctx, &(hir_type_base){.type = HIR_TYPE_ANY},
+                                kind, scope_out);
   } else {
     entry = hir_ctx_scopes_find(ctx, base, kind, scope_out);
   }
@@ -201,8 +210,9 @@ static hir_scope_entry *hir_ctx_scopes_resolve(hir_ctx             *ctx,
     case HIR_TYPE_CUSTOM: {
       const hir_type_custom *self = (typeof(self))base;
 
-      hir_type_custom *basic =
-          hir_type_custom_new(NULL, strdup(self->name), list_hir_type_new());
+      hir_type_custom *basic = hir_type_custom_new(
+          ctx->arena, NULL, arena_strdup(ctx->arena, self->name),
+          list_hir_type_new_arena(ctx->arena));
 
       if (self->templates) {
         for (size_t i = 0, sz = list_hir_type_size(self->templates); i < sz;
@@ -214,8 +224,6 @@ static hir_scope_entry *hir_ctx_scopes_resolve(hir_ctx             *ctx,
       hir_scope_entry *template = hir_ctx_scopes_find(
           ctx, (hir_type_base *)basic, CTX_SCOPE_DECLARATION, &scope_max);
 
-      hir_type_free((hir_type_base *)basic);
-
       if (!template) {
         return NULL;
       }
@@ -245,13 +253,13 @@ static hir_scope_entry *hir_ctx_scopes_resolve(hir_ctx             *ctx,
         }
       }
 
-      type_entry *type_ref = hir_ctx_table_emplace(
+      type_entry *type_ref = hir_ctx_table_intern(
           ctx, (type_base *)mono, span_copy(template->type_ref->span));
 
       entry = hir_ctx_scopes_insert_sel(
           ctx,
-          hir_scope_entry_new(hir_type_copy((hir_type_base *)self), kind,
-                              type_ref),
+          hir_scope_entry_new(hir_type_copy(ctx->arena, (hir_type_base *)self),
+                              kind, type_ref),
           scope_max);
       break;
     }
@@ -272,13 +280,13 @@ static hir_scope_entry *hir_ctx_scopes_resolve(hir_ctx             *ctx,
       }
 
       type_array *array    = type_array_new(sub_entry->type_ref->type);
-      type_entry *type_ref = hir_ctx_table_emplace(ctx, (type_base *)array,
-                                                   span_copy(self->base.span));
+      type_entry *type_ref = hir_ctx_table_intern(ctx, (type_base *)array,
+                                                  span_copy(self->base.span));
 
       entry = hir_ctx_scopes_insert_sel(
           ctx,
-          hir_scope_entry_new(hir_type_copy((hir_type_base *)self), kind,
-                              type_ref),
+          hir_scope_entry_new(hir_type_copy(ctx->arena, (hir_type_base *)self),
+                              kind, type_ref),
           scope_max);
       break;
     }
@@ -362,72 +370,80 @@ static void hir_ctx_error(hir_ctx *ctx, exception_subtype_hir subtype,
 static void hir_bind_builtin(hir_ctx *ctx) {
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_BOOL), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_BOOL),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_BOOL),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_BYTE), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_BYTE),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_BYTE),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx,
       hir_scope_entry_new(
-          hir_type_base_new(NULL, HIR_TYPE_INT), CTX_SCOPE_USAGE,
-          hir_ctx_table_emplace(
+          hir_type_base_new(ctx->arena, NULL, HIR_TYPE_INT), CTX_SCOPE_USAGE,
+          hir_ctx_table_intern(
               ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_INT), NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_UINT), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_UINT),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_UINT),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_LONG), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_LONG),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_LONG),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_ULONG), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_ULONG),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_ULONG),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_CHAR), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_CHAR),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_CHAR),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_STRING), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_STRING),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_STRING),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx, hir_scope_entry_new(
-               hir_type_base_new(NULL, HIR_TYPE_VOID), CTX_SCOPE_USAGE,
-               hir_ctx_table_emplace(
+               hir_type_base_new(ctx->arena, NULL, HIR_TYPE_VOID),
+               CTX_SCOPE_USAGE,
+               hir_ctx_table_intern(
                    ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_VOID),
                    NULL)));
 
   hir_ctx_scopes_insert_global(
       ctx,
       hir_scope_entry_new(
-          hir_type_base_new(NULL, HIR_TYPE_ANY), CTX_SCOPE_USAGE,
-          hir_ctx_table_emplace(
+          hir_type_base_new(ctx->arena, NULL, HIR_TYPE_ANY), CTX_SCOPE_USAGE,
+          hir_ctx_table_intern(
               ctx, (type_base *)type_primitive_new(TYPE_PRIMITIVE_ANY), NULL)));
 }
 
@@ -447,7 +463,6 @@ static void hir_bind_lit(hir_ctx *ctx, hir_lit *lit) {
     free(type_s);
     return;
   }
-  hir_type_free(lit->type_hir);
   lit->type_ref = entry->type_ref;
 
   lit->state |= HIR_STATE_BIND_TYPE;
@@ -487,7 +502,6 @@ static void hir_bind_subroutine_signature(hir_ctx        *ctx,
         return; // can't parse subroutine type signature
       }
 
-      hir_type_free(param->type_hir);
       param->type_ref = param_entry->type_ref;
 
       param->state |= HIR_STATE_BIND_TYPE;
@@ -502,10 +516,9 @@ static void hir_bind_subroutine_signature(hir_ctx        *ctx,
 
   // add to type table, but not to scopes
   // callable types can't be declared using grammar
-  type_entry *callable_entry = hir_ctx_table_emplace(
+  type_entry *callable_entry = hir_ctx_table_intern(
       ctx, (type_base *)callable, span_copy(subroutine->base.span));
 
-  hir_type_free(subroutine->type_ret);
   subroutine->type_ref = callable_entry;
   subroutine->state |= HIR_STATE_BIND_TYPE;
 }
@@ -529,7 +542,6 @@ static void hir_bind_vars(hir_ctx *ctx, list_hir_var *vars) {
       continue;
     }
 
-    hir_type_free(var->type_hir);
     var->type_ref = entry->type_ref;
 
     var->state |= HIR_STATE_BIND_TYPE;
@@ -605,7 +617,6 @@ static void hir_bind_expr(hir_ctx *ctx, hir_expr_base *base) {
       return;
     }
 
-    hir_type_free(base->type_hir);
     base->type_ref = entry->type_ref;
 
     base->state |= HIR_STATE_BIND_TYPE;
@@ -695,7 +706,8 @@ static type_class_t *hir_bind_class_id(hir_ctx *ctx, hir_class *hir_class) {
   hir_scope_entry *found;
 
   hir_type_custom *hir_class_type = hir_type_custom_new(
-      NULL, strdup(hir_class->id->name), list_hir_type_new());
+      ctx->arena, NULL, arena_strdup(ctx->arena, hir_class->id->name),
+      list_hir_type_new_arena(ctx->arena));
 
   for (size_t i = 0, sz = list_hir_id_size(hir_class->typenames); i < sz; ++i) {
     list_hir_type_push_back(hir_class_type->templates, NULL);
@@ -709,12 +721,11 @@ static type_class_t *hir_bind_class_id(hir_ctx *ctx, hir_class *hir_class) {
                   "type name collision %s with %s", type_s, type_s);
     free(type_s);
     free(found_s);
-    hir_type_free((hir_type_base *)hir_class_type);
     return NULL;
   }
 
   type_class_t *class = type_class_t_new(
-      hir_class->id->name, list_type_ref_new(), list_type_ref_new());
+      strdup(hir_class->id->name), list_type_ref_new(), list_type_ref_new());
   type_entry *class_entry =
       hir_ctx_table_emplace(ctx, (type_base *)class, hir_class->base.span);
 
@@ -723,9 +734,7 @@ static type_class_t *hir_bind_class_id(hir_ctx *ctx, hir_class *hir_class) {
                                CTX_SCOPE_DECLARATION, class_entry));
   hir_class_type = NULL;
 
-  // cleanup hir class id and span, now bound to type table
-  hir_class->id->name = NULL;
-  hir_id_free(hir_class->id);
+  // drop hir class id and span, now bound to type table
   hir_class->id        = NULL;
   hir_class->base.span = NULL;
 
@@ -741,8 +750,8 @@ static void hir_bind_class_typenames(hir_ctx *ctx, hir_class *hir_class,
        NEXT(it)) {
     hir_id *hir_typename = GET(it);
 
-    hir_type_custom *hir_typename_type =
-        hir_type_custom_new(NULL, strdup(hir_typename->name), NULL);
+    hir_type_custom *hir_typename_type = hir_type_custom_new(
+        ctx->arena, NULL, arena_strdup(ctx->arena, hir_typename->name), NULL);
 
     if ((found = hir_ctx_scopes_find(ctx, (hir_type_base *)hir_typename_type,
                                      CTX_SCOPE_USAGE, NULL))) {
@@ -753,12 +762,11 @@ static void hir_bind_class_typenames(hir_ctx *ctx, hir_class *hir_class,
                     type_s, found_s);
       free(type_s);
       free(found_s);
-      hir_type_free((hir_type_base *)hir_typename_type);
       break;
     }
 
     type_typename *typename =
-        type_typename_new(hir_typename->name, (type_base *)class);
+        type_typename_new(strdup(hir_typename->name), (type_base *)class);
     type_entry *typename_entry = hir_ctx_table_emplace(
         ctx, (type_base *)typename, hir_typename->base.span);
     hir_ctx_scopes_insert(
@@ -767,10 +775,8 @@ static void hir_bind_class_typenames(hir_ctx *ctx, hir_class *hir_class,
 
     list_type_ref_push_back(class->typenames, (type_base *)typename);
 
-    hir_typename->name      = NULL;
     hir_typename->base.span = NULL;
   }
-  list_hir_id_free(hir_class->typenames);
   hir_class->typenames = NULL;
 }
 
@@ -816,7 +822,6 @@ static void hir_bind_class_parents(hir_ctx *ctx, hir_class *hir_class,
     list_type_ref_push_back(class->parents, found->type_ref->type);
   }
 
-  list_hir_type_free(hir_class->parents);
   hir_class->parents = NULL;
 }
 
@@ -841,7 +846,6 @@ static void hir_bind_class_fields(hir_ctx *ctx, hir_class *hir_class,
         continue;
       }
 
-      hir_type_free(var->type_hir);
       var->type_ref = var_entry->type_ref;
 
       var->state |= HIR_STATE_BIND_TYPE;
@@ -864,7 +868,6 @@ static void hir_bind_class_methods(hir_ctx *ctx, hir_class *hir_class,
         hir_ctx_scopes_resolve(ctx, first->type_hir, CTX_SCOPE_USAGE, NULL)
             ->type_ref;
 
-    hir_type_free(first->type_hir);
     first->type_ref = first_type;
     first->state |= HIR_STATE_BIND_TYPE;
 
@@ -903,10 +906,11 @@ static void hir_bind_classes(hir_ctx *ctx, hir *hir) {
            !END(it); NEXT(it)) {
         type_typename *typename = (typeof(typename))GET(it);
         hir_ctx_scopes_insert(
-            ctx, hir_scope_entry_new((hir_type_base *)hir_type_custom_new(
-                                         NULL, strdup(typename->id), NULL),
-                                     CTX_SCOPE_USAGE,
-                                     typename->base.type_entry_ref));
+            ctx, hir_scope_entry_new(
+                     (hir_type_base *)hir_type_custom_new(
+                         ctx->arena, NULL,
+                         arena_strdup(ctx->arena, typename->id), NULL),
+                     CTX_SCOPE_USAGE, typename->base.type_entry_ref));
       }
 
       hir_bind_class_parents(ctx, hir_class, class);
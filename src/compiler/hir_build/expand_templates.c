@@ -9,9 +9,16 @@
 #include <string.h>
 
 // 1. erase classes with templates from hir list, add to the list for expansion
-// 2. add templates to list of to be expanded
-// 3. expand preorder, add types that aren't currently expanded
-// 4. infinite recursion -> stack overflow (maybe handle different way later)
+// 2. walk concrete code (subroutines and classes without templates), add mono
+//    class types it uses to be expanded, remember identifiers it uses
+// 3. expand class fields and methods whose names are used, rest of methods
+//    are pending until their name is used by concrete or expanded code
+// 4. walk expanded code as in 2, repeat 3 until nothing is left to expand
+// 5. infinite recursion -> stack overflow (maybe handle different way later)
+//
+// symbols are not bound yet and members are looked up at runtime, so methods
+// are required by name (member access or identifier with the same name), types
+// are interned so instantiation is memoized by mono
 
 LIST_DECLARE_STATIC_INLINE(list_type_mono_ref, type_mono, container_cmp_false,
                            container_new_move, container_delete_false);
@@ -54,19 +61,10 @@ HASHSET_DECLARE_STATIC_INLINE(hashset_hir_type_tmpl, hir_type_tmpl,
                               container_delete_hir_type_tmpl,
                               container_hash_hir_type_tmpl);
 
-// TYPE INDEX
-static inline int container_cmp_type_ref(const void *lsv, const void *rsv) {
-  const type_base *l = lsv;
-  const type_base *r = rsv;
-  return type_cmp(l, r);
-}
-static inline uint64_t container_hash_type_ref(const void *lsv) {
-  const type_base *l = lsv;
-  return type_hash(l);
-}
-HASHSET_DECLARE_STATIC_INLINE(hashset_type_ref, type_base,
-                              container_cmp_type_ref, container_new_move,
-                              container_delete_false, container_hash_type_ref);
+// TYPE INDEX (types are interned in type table, so compared by pointer)
+HASHSET_DECLARE_STATIC_INLINE(hashset_type_ref, type_base, container_cmp_ptr,
+                              container_new_move, container_delete_false,
+                              container_hash_ptr);
 
 // TYPE_MAPPINGS
 typedef struct hir_type_map_struct {
@@ -105,13 +103,77 @@ HASHSET_DECLARE_STATIC_INLINE(hashset_hir_type_map, hir_type_map,
                               container_delete_hir_type_map,
                               container_hash_hir_type_map);
 
+// NAMES (identifiers used by concrete and expanded code)
+HASHSET_DECLARE_STATIC_INLINE(hashset_hir_name, char, container_cmp_chars,
+                              container_new_move, container_delete_false,
+                              container_hash_chars);
+
+// INSTANTIATION
+typedef struct hir_inst_struct {
+  const type_mono      *mono_ref;
+  const hir_class      *template_ref;
+  hir_class            *class_ref; // methods are appended on demand
+  hashset_hir_type_map *map_type_tmpl;
+} hir_inst;
+
+static hir_inst *hir_inst_new(const type_mono *mono_ref,
+                              const hir_class *template_ref) {
+  hir_inst *self      = MALLOC(hir_inst);
+  self->mono_ref      = mono_ref;
+  self->template_ref  = template_ref;
+  self->class_ref     = NULL;
+  self->map_type_tmpl = hashset_hir_type_map_new();
+  return self;
+}
+
+static void hir_inst_free(hir_inst *self) {
+  if (self) {
+    hashset_hir_type_map_free(self->map_type_tmpl);
+    free(self);
+  }
+}
+
+static inline void container_delete_hir_inst(void *self) {
+  hir_inst_free(self);
+}
+LIST_DECLARE_STATIC_INLINE(list_hir_inst, hir_inst, container_cmp_false,
+                           container_new_move, container_delete_hir_inst);
+
+// method of instantiation that is not used yet
+typedef struct hir_pending_struct {
+  hir_inst         *inst_ref;
+  const hir_method *method_ref;
+} hir_pending;
+
+static hir_pending *hir_pending_new(hir_inst         *inst_ref,
+                                    const hir_method *method_ref) {
+  hir_pending *self = MALLOC(hir_pending);
+  self->inst_ref    = inst_ref;
+  self->method_ref  = method_ref;
+  return self;
+}
+
+static void hir_pending_free(hir_pending *self) {
+  if (self) {
+    free(self);
+  }
+}
+
+static inline void container_delete_hir_pending(void *self) {
+  hir_pending_free(self);
+}
+LIST_DECLARE_STATIC_INLINE(list_hir_pending, hir_pending, container_cmp_false,
+                           container_new_move, container_delete_hir_pending);
+
 // CONTEXT
 typedef struct hir_ctx_struct {
   list_hir_class        *hir_tmpl_classes;  // stores actual class templates
   hashset_hir_type_tmpl *map_type_hir_tmpl; // matches types and their templates
-  hashset_type_ref      *insted_types; // already instantiated/resolved types
-  hashset_type_ref      *registered_types; // present in type table
+  hashset_type_ref      *insted_types; // requested to be instantiated
   list_type_mono_ref    *instto_types;
+  list_hir_inst         *insts;
+  list_hir_pending      *pending;    // methods of insts, not used yet
+  hashset_hir_name      *used_names; // identifiers of concrete/expanded code
 
   // no scopes as there is not constructions for recursive expansion
   hashset_hir_type_map *map_type_tmpl;
@@ -119,36 +181,42 @@ typedef struct hir_ctx_struct {
   type_table     *type_table;
   list_hir_class *hir_classes;
   list_exception *exceptions;
+  arena          *arena; // of hir, expanded nodes are allocated there
 } hir_ctx;
 
 static void hir_ctx_init(hir_ctx *ctx, type_table *type_table,
-                         list_exception *exceptions,
-                         list_hir_class *hir_classes) {
+                         list_exception *exceptions, hir *hir) {
   ctx->hir_tmpl_classes  = list_hir_class_new();
   ctx->map_type_hir_tmpl = hashset_hir_type_tmpl_new();
   ctx->insted_types      = hashset_type_ref_new();
-  ctx->registered_types  = hashset_type_ref_new();
   ctx->instto_types      = list_type_mono_ref_new();
+  ctx->insts             = list_hir_inst_new();
+  ctx->pending           = list_hir_pending_new();
+  ctx->used_names        = hashset_hir_name_new();
 
   ctx->map_type_tmpl = NULL;
 
   ctx->type_table  = type_table;
-  ctx->hir_classes = hir_classes;
+  ctx->hir_classes = hir->classes;
   ctx->exceptions  = exceptions;
+  ctx->arena       = hir->arena;
 }
 
 static void hir_ctx_deinit(hir_ctx *ctx) {
   list_hir_class_free(ctx->hir_tmpl_classes);
   hashset_hir_type_tmpl_free(ctx->map_type_hir_tmpl);
   hashset_type_ref_free(ctx->insted_types);
-  hashset_type_ref_free(ctx->registered_types);
   list_type_mono_ref_free(ctx->instto_types);
+  list_hir_pending_free(ctx->pending);
+  list_hir_inst_free(ctx->insts);
+  hashset_hir_name_free(ctx->used_names);
 
   ctx->map_type_tmpl = NULL; // typenames in this context
 
   ctx->type_table  = NULL;
   ctx->hir_classes = NULL;
   ctx->exceptions  = NULL;
+  ctx->arena       = NULL;
 }
 
 static type_base *hir_ctx_type_tmpl_find(hir_ctx *ctx, const type_base *type) {
@@ -160,27 +228,24 @@ static type_base *hir_ctx_type_tmpl_find(hir_ctx *ctx, const type_base *type) {
   return (type_base *)GET(it)->to;
 }
 
-// add to registered types and add to type_table
+// interns type in type_table, returns type that is already present if equal
 static type_base *hir_ctx_type_register(hir_ctx *ctx, type_base *type,
                                         const span *span_ref) {
+  type_entry *entry = type_table_find(ctx->type_table, type);
 
-  hashset_type_ref_it it = hashset_type_ref_find(ctx->registered_types, type);
-
-  if (END(it)) {
-    hashset_type_ref_insert(ctx->registered_types, type);
-    type_entry *entry =
-        type_table_emplace(ctx->type_table, type, span_copy(span_ref));
-
-    char *type_s = type_str(type);
-    debug("registered %s", type_s);
-    if (type_s)
-      free(type_s);
-
+  if (entry) {
+    type_free(type);
     return entry->type;
   }
 
-  type_free(type);
-  return GET(it);
+  entry = type_table_intern(ctx->type_table, type, span_copy(span_ref));
+
+  char *type_s = type_str(type);
+  debug("registered %s", type_s);
+  if (type_s)
+    free(type_s);
+
+  return entry->type;
 }
 
 static void hir_ctx_debug(const hir_ctx *ctx, const char *s) {
@@ -191,10 +256,14 @@ static void hir_ctx_debug(const hir_ctx *ctx, const char *s) {
   debug("  map_type_hir_tmpl (index) -> size: %lu",
         ctx->map_type_hir_tmpl->hashset.size);
   debug("  insted_types (index) -> size: %lu", ctx->insted_types->hashset.size);
-  debug("  registered_types (index) -> size: %lu",
-        ctx->registered_types->hashset.size);
+  debug("  type_table (index) -> size: %lu",
+        ctx->type_table->index->hashset.size);
   debug("  instto_types -> size: %lu",
         list_type_mono_ref_size(ctx->instto_types));
+  debug("  insts -> size: %lu", list_hir_inst_size(ctx->insts));
+  debug("  pending (methods) -> size: %lu",
+        list_hir_pending_size(ctx->pending));
+  debug("  used_names (index) -> size: %lu", ctx->used_names->hashset.size);
 
   debug("  exceptions -> size: %lu", list_exception_size(ctx->exceptions));
 }
@@ -242,45 +311,259 @@ static list_hir_class *hir_filter_templated_hir_classes(hir *hir) {
   return classes_t;
 }
 
-// get class types that need to be instantiated
-static list_type_mono_ref *
-hir_get_mono_full_class_types(type_table *type_table) {
-  list_type_mono_ref *classes_t = list_type_mono_ref_new();
+// REQUIRE (what concrete and expanded code uses)
+static int hir_ctx_name_used(hir_ctx *ctx, const char *name) {
+  hashset_hir_name_it it = hashset_hir_name_find(ctx->used_names, (char *)name);
+  return !END(it);
+}
 
-  for (list_type_entry_it it = list_type_entry_begin(type_table->entries);
-       !END(it); NEXT(it)) {
-    const type_entry *entry = GET(it);
-    type_base        *type  = entry->type;
+static void hir_require_name(hir_ctx *ctx, const char *name) {
+  if (name && !hir_ctx_name_used(ctx, name)) {
+    hashset_hir_name_insert(ctx->used_names, (char *)name);
+  }
+}
 
-    type_mono_enum mono = type_fetch_mono(type);
-    switch (mono) {
-      case TYPE_MONO_FULL: {
-        if (type->kind == TYPE_MONO) {
-          type_mono *mono = (type_mono *)type;
-          type_enum  kind = mono->type_ref->kind;
-          if (kind == TYPE_CLASS_T) {
-            list_type_mono_ref_push_back(classes_t, mono);
-          } else if (mono->type_ref->kind == TYPE_MONO) {
-            error("unexpected mono as base for mono (%p -> %p)", mono,
-                  mono->type_ref);
-          }
-        }
-        break;
+// adds mono class types to be instantiated, each mono only once
+static void hir_require_type(hir_ctx *ctx, type_base *type) {
+  if (!type) {
+    return;
+  }
+
+  // class is never mono-full by itself, but its parents can be
+  if (type->kind == TYPE_CLASS_T) {
+    type_class_t *self = (typeof(self))type;
+    for (list_type_ref_it it = list_type_ref_begin(self->parents); !END(it);
+         NEXT(it)) {
+      hir_require_type(ctx, GET(it));
+    }
+    return;
+  }
+
+  if (type_fetch_mono(type) != TYPE_MONO_FULL) {
+    return;
+  }
+
+  switch (type->kind) {
+    case TYPE_ARRAY: {
+      type_array *self = (typeof(self))type;
+      hir_require_type(ctx, self->element_ref);
+      break;
+    }
+    case TYPE_CALLABLE: {
+      type_callable *self = (typeof(self))type;
+      for (list_type_ref_it it = list_type_ref_begin(self->params); !END(it);
+           NEXT(it)) {
+        hir_require_type(ctx, GET(it));
       }
-      case TYPE_MONO_NOT_FULL: {
+      hir_require_type(ctx, self->ret_ref);
+      break;
+    }
+    case TYPE_MONO: {
+      type_mono *self = (typeof(self))type;
+      if (self->type_ref->kind != TYPE_CLASS_T) {
+        error("unexpected mono as base for mono (%p -> %p)", self,
+              self->type_ref);
         break;
       }
-      case TYPE_MONO_UNSET:
-      default: {
-        char *type_s = type_str(type);
-        error("mono should be set for class with type %s %p", type_s, type);
-        if (type_s)
-          free(type_s);
+
+      hashset_type_ref_it it = hashset_type_ref_find(ctx->insted_types, type);
+      if (!END(it)) {
         break;
       }
+      hashset_type_ref_insert(ctx->insted_types, type);
+      list_type_mono_ref_push_back(ctx->instto_types, self);
+
+      for (list_type_ref_it it = list_type_ref_begin(self->types); !END(it);
+           NEXT(it)) {
+        hir_require_type(ctx, GET(it));
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+static inline void hir_require_type_ref(hir_ctx *ctx, hir_state_enum state,
+                                        const type_entry *type_ref) {
+  if ((state & HIR_STATE_BIND_TYPE) && type_ref) {
+    hir_require_type(ctx, type_ref->type);
+  }
+}
+
+static void hir_require_expr(hir_ctx *ctx, const hir_expr_base *expr) {
+  if (!expr) {
+    return;
+  }
+
+  hir_require_type_ref(ctx, expr->state, expr->type_ref);
+
+  switch (expr->kind) {
+    case HIR_EXPR_UNARY: {
+      const hir_expr_unary *self = (typeof(self))expr;
+      hir_require_expr(ctx, self->first);
+      break;
+    }
+    case HIR_EXPR_BINARY: {
+      const hir_expr_binary *self = (typeof(self))expr;
+      hir_require_expr(ctx, self->first);
+      hir_require_expr(ctx, self->second);
+
+      // member is accessed by literal name, methods are looked up at runtime
+      if (self->op == HIR_EXPR_BINARY_MEMBER &&
+          self->second->kind == HIR_EXPR_LITERAL) {
+        const hir_lit *lit = ((hir_expr_lit *)self->second)->lit;
+        hir_require_name(ctx, lit->value.v_str);
+      }
+      break;
+    }
+    case HIR_EXPR_LITERAL:
+      break;
+    case HIR_EXPR_IDENTIFIER: {
+      const hir_expr_id *self = (typeof(self))expr;
+      if (!(expr->state & HIR_STATE_BIND_SYMBOL) && self->id_hir) {
+        hir_require_name(ctx, self->id_hir->name);
+      }
+      break;
+    }
+    case HIR_EXPR_CALL: {
+      const hir_expr_call *self = (typeof(self))expr;
+      hir_require_expr(ctx, self->callee);
+      for (list_hir_expr_it it = list_hir_expr_begin(self->args); !END(it);
+           NEXT(it)) {
+        hir_require_expr(ctx, GET(it));
+      }
+      break;
+    }
+    case HIR_EXPR_INDEX: {
+      const hir_expr_index *self = (typeof(self))expr;
+      hir_require_expr(ctx, self->indexed);
+      for (list_hir_expr_it it = list_hir_expr_begin(self->args); !END(it);
+           NEXT(it)) {
+        hir_require_expr(ctx, GET(it));
+      }
+      break;
+    }
+    case HIR_EXPR_BUILTIN: {
+      const hir_expr_builtin *self = (typeof(self))expr;
+      for (list_hir_expr_it it = list_hir_expr_begin(self->args); !END(it);
+           NEXT(it)) {
+        hir_require_expr(ctx, GET(it));
+      }
+      break;
+    }
+  }
+}
+
+static void hir_require_stmt(hir_ctx *ctx, const hir_stmt_base *stmt) {
+  if (!stmt) {
+    return;
+  }
+
+  switch (stmt->kind) {
+    case HIR_STMT_IF: {
+      const hir_stmt_if *self = (typeof(self))stmt;
+      hir_require_expr(ctx, self->cond);
+      hir_require_stmt(ctx, self->je);
+      hir_require_stmt(ctx, self->jz);
+      break;
+    }
+    case HIR_STMT_BLOCK: {
+      const hir_stmt_block *self = (typeof(self))stmt;
+      for (list_hir_stmt_it it = list_hir_stmt_begin(self->stmts); !END(it);
+           NEXT(it)) {
+        hir_require_stmt(ctx, GET(it));
+      }
+      break;
+    }
+    case HIR_STMT_WHILE: {
+      const hir_stmt_while *self = (typeof(self))stmt;
+      hir_require_expr(ctx, self->cond);
+      hir_require_stmt(ctx, self->stmt);
+      break;
+    }
+    case HIR_STMT_DO: {
+      const hir_stmt_do *self = (typeof(self))stmt;
+      hir_require_expr(ctx, self->cond);
+      hir_require_stmt(ctx, self->stmt);
+      break;
+    }
+    case HIR_STMT_BREAK:
+      break;
+    case HIR_STMT_EXPR: {
+      const hir_stmt_expr *self = (typeof(self))stmt;
+      hir_require_expr(ctx, self->expr);
+      break;
+    }
+    case HIR_STMT_RETURN: {
+      const hir_stmt_return *self = (typeof(self))stmt;
+      hir_require_expr(ctx, self->expr);
+      break;
+    }
+  }
+}
+
+static void hir_require_vars(hir_ctx *ctx, const list_hir_var *vars) {
+  for (list_hir_var_it it = list_hir_var_begin((list_hir_var *)vars); !END(it);
+       NEXT(it)) {
+    const hir_var *var = GET(it);
+    hir_require_type_ref(ctx, var->state, var->type_ref);
+  }
+}
+
+static void hir_require_subroutine(hir_ctx              *ctx,
+                                   const hir_subroutine *subroutine) {
+  if (!subroutine) {
+    return;
+  }
+
+  hir_require_type_ref(ctx, subroutine->state, subroutine->type_ref);
+
+  for (list_hir_param_it it = list_hir_param_begin(subroutine->params);
+       !END(it); NEXT(it)) {
+    const hir_param *param = GET(it);
+    hir_require_type_ref(ctx, param->state, param->type_ref);
+  }
+
+  if (subroutine->body &&
+      subroutine->body->kind == HIR_SUBROUTINE_BODY_BLOCK) {
+    hir_require_vars(ctx, subroutine->body->body.block.vars);
+    hir_require_stmt(ctx,
+                     (hir_stmt_base *)subroutine->body->body.block.block);
+  }
+}
+
+// parents and fields, methods are required separately
+static void hir_require_class(hir_ctx *ctx, const hir_class *class) {
+  if (!(class->state & HIR_STATE_BIND_TYPE) || !class->type_ref) {
+    return;
+  }
+
+  type_base *type = class->type_ref->type;
+  if (type->kind == TYPE_MONO) {
+    type = ((type_mono *)type)->type_ref;
+  }
+  hir_require_type(ctx, type);
+
+  hir_require_vars(ctx, class->fields);
+}
+
+// concrete code is lowered as a whole, so everything it uses is required
+static void hir_setup_ctx_required(hir_ctx *ctx, const hir *hir) {
+  for (list_hir_subroutine_it it = list_hir_subroutine_begin(hir->subroutines);
+       !END(it); NEXT(it)) {
+    hir_require_subroutine(ctx, GET(it));
+  }
+
+  for (list_hir_class_it it = list_hir_class_begin(hir->classes); !END(it);
+       NEXT(it)) {
+    const hir_class *class = GET(it);
+    hir_require_class(ctx, class);
+    for (list_hir_method_it m_it = list_hir_method_begin(class->methods);
+         !END(m_it); NEXT(m_it)) {
+      hir_require_subroutine(ctx, GET(m_it)->subroutine);
     }
   }
-  return classes_t;
 }
 
 // adds errors if can't instantiate
@@ -326,23 +609,6 @@ static void hir_setup_ctx_hir_templates(hir_ctx        *ctx,
   list_hir_class_free(templated_classes);
 }
 
-// register types
-static void hir_setup_ctx(hir_ctx *ctx) {
-  for (list_type_entry_it it = list_type_entry_begin(ctx->type_table->entries);
-       !END(it); NEXT(it)) {
-    hashset_type_ref_insert(ctx->registered_types, GET(it)->type);
-  }
-}
-
-static void hir_setup_ctx_instto_types(hir_ctx            *ctx,
-                                       list_type_mono_ref *instto_types) {
-  while (!list_type_mono_ref_empty(instto_types)) {
-    type_mono *mono = list_type_mono_ref_pop_front(instto_types);
-    list_type_mono_ref_push_back(ctx->instto_types, mono);
-  }
-  list_type_mono_ref_free(instto_types);
-}
-
 // unwrap recursively, because without constructions like
 // class B<T> : A<array [] of T> doesn't work
 static type_base *hir_expand_type(hir_ctx *ctx, type_base *type) {
@@ -489,9 +755,6 @@ static type_base *hir_expand_type(hir_ctx *ctx, type_base *type) {
             new_self = (type_mono *)hir_ctx_type_register(
                 ctx, (type_base *)new_self, type->type_entry_ref->span);
 
-            // add template for further instantiation
-            list_type_mono_ref_push_back(ctx->instto_types, new_self);
-
             // new_type_s = type_str((type_base *)new_self);
             // info("registered %s", new_type_s);
             // free(new_type_s);
@@ -512,8 +775,9 @@ static hir_var *hir_expand_templates_var(hir_ctx *ctx, const hir_var *var_t) {
   type_base *type_ref =
       hir_expand_type(ctx, var_t->type_ref ? var_t->type_ref->type : NULL);
 
-  return hir_var_new_typed(span_copy(var_t->base.span),
-                           hir_id_copy(var_t->id_hir),
+  return hir_var_new_typed(ctx->arena,
+                           span_copy_arena(ctx->arena, var_t->base.span),
+                           hir_id_copy(ctx->arena, var_t->id_hir),
                            type_ref ? type_ref->type_entry_ref : NULL);
 }
 
@@ -522,8 +786,9 @@ static hir_param *hir_expand_templates_param(hir_ctx         *ctx,
   type_base *type_ref =
       hir_expand_type(ctx, param_t->type_ref ? param_t->type_ref->type : NULL);
 
-  return hir_param_new_typed(span_copy(param_t->base.span),
-                             hir_id_copy(param_t->id_hir),
+  return hir_param_new_typed(ctx->arena,
+                             span_copy_arena(ctx->arena, param_t->base.span),
+                             hir_id_copy(ctx->arena, param_t->id_hir),
                              type_ref ? type_ref->type_entry_ref : NULL);
 }
 
@@ -550,57 +815,60 @@ static hir_expr_base *hir_expand_templates_expr(hir_ctx             *ctx,
     case HIR_EXPR_UNARY: {
       const hir_expr_unary *self = (typeof(self))expr_t;
       return (hir_expr_base *)hir_expr_unary_new_typed(
-          span_copy(span), new_type_ref, self->op,
+          ctx->arena, span_copy_arena(ctx->arena, span), new_type_ref, self->op,
           hir_expand_templates_expr(ctx, self->first));
     }
     case HIR_EXPR_BINARY: {
       const hir_expr_binary *self = (typeof(self))expr_t;
       return (hir_expr_base *)hir_expr_binary_new_typed(
-          span_copy(span), new_type_ref, self->op,
+          ctx->arena, span_copy_arena(ctx->arena, span), new_type_ref, self->op,
           hir_expand_templates_expr(ctx, self->first),
           hir_expand_templates_expr(ctx, self->second));
     }
     case HIR_EXPR_LITERAL: {
       const hir_expr_lit *self = (typeof(self))expr_t;
       return (hir_expr_base *)hir_expr_lit_new_typed(
-          span_copy(span), new_type_ref, hir_lit_copy(self->lit));
+          ctx->arena, span_copy_arena(ctx->arena, span), new_type_ref,
+          hir_lit_copy(ctx->arena, self->lit));
     }
     case HIR_EXPR_IDENTIFIER: {
       const hir_expr_id *self = (typeof(self))expr_t;
       return (hir_expr_base *)hir_expr_id_new_typed(
-          span_copy(span), new_type_ref, hir_id_copy(self->id_hir));
+          ctx->arena, span_copy_arena(ctx->arena, span), new_type_ref,
+          hir_id_copy(ctx->arena, self->id_hir));
     }
     case HIR_EXPR_CALL: {
       const hir_expr_call *self = (typeof(self))expr_t;
-      list_hir_expr       *args = list_hir_expr_new();
+      list_hir_expr       *args = list_hir_expr_new_arena(ctx->arena);
       for (list_hir_expr_it it = list_hir_expr_begin(self->args); !END(it);
            NEXT(it)) {
         list_hir_expr_push_back(args, hir_expand_templates_expr(ctx, GET(it)));
       }
       return (hir_expr_base *)hir_expr_call_new_typed(
-          span_copy(span), new_type_ref,
+          ctx->arena, span_copy_arena(ctx->arena, span), new_type_ref,
           hir_expand_templates_expr(ctx, self->callee), args);
     }
     case HIR_EXPR_INDEX: {
       const hir_expr_index *self = (typeof(self))expr_t;
-      list_hir_expr        *args = list_hir_expr_new();
+      list_hir_expr        *args = list_hir_expr_new_arena(ctx->arena);
       for (list_hir_expr_it it = list_hir_expr_begin(self->args); !END(it);
            NEXT(it)) {
         list_hir_expr_push_back(args, hir_expand_templates_expr(ctx, GET(it)));
       }
       return (hir_expr_base *)hir_expr_index_new_typed(
-          span_copy(span), new_type_ref,
+          ctx->arena, span_copy_arena(ctx->arena, span), new_type_ref,
           hir_expand_templates_expr(ctx, self->indexed), args);
     }
     case HIR_EXPR_BUILTIN: {
       const hir_expr_builtin *self = (typeof(self))expr_t;
-      list_hir_expr          *args = list_hir_expr_new();
+      list_hir_expr          *args = list_hir_expr_new_arena(ctx->arena);
       for (list_hir_expr_it it = list_hir_expr_begin(self->args); !END(it);
            NEXT(it)) {
         list_hir_expr_push_back(args, hir_expand_templates_expr(ctx, GET(it)));
       }
       return (hir_expr_base *)hir_expr_builtin_new_typed(
-          span_copy(span), new_type_ref, self->kind, args);
+          ctx->arena, span_copy_arena(ctx->arena, span), new_type_ref,
+          self->kind, args);
     }
   }
   error("unexpected expr kind %d %p", expr_t->kind, expr_t);
@@ -619,44 +887,50 @@ static hir_stmt_base *hir_expand_templates_stmt(hir_ctx             *ctx,
     case HIR_STMT_IF: {
       const hir_stmt_if *self = (typeof(self))stmt_t;
       return (hir_stmt_base *)hir_stmt_if_new(
-          span_copy(span), hir_expand_templates_expr(ctx, self->cond),
+          ctx->arena, span_copy_arena(ctx->arena, span),
+          hir_expand_templates_expr(ctx, self->cond),
           hir_expand_templates_stmt(ctx, self->je),
           hir_expand_templates_stmt(ctx, self->jz));
     }
     case HIR_STMT_BLOCK: {
       const hir_stmt_block *self  = (typeof(self))stmt_t;
-      list_hir_stmt        *stmts = list_hir_stmt_new();
+      list_hir_stmt        *stmts = list_hir_stmt_new_arena(ctx->arena);
       for (list_hir_stmt_it it = list_hir_stmt_begin(self->stmts); !END(it);
            NEXT(it)) {
         list_hir_stmt_push_back(stmts, hir_expand_templates_stmt(ctx, GET(it)));
       }
-      return (hir_stmt_base *)hir_stmt_block_new(span_copy(span), stmts);
+      return (hir_stmt_base *)hir_stmt_block_new(
+          ctx->arena, span_copy_arena(ctx->arena, span), stmts);
     }
     case HIR_STMT_WHILE: {
       const hir_stmt_while *self = (typeof(self))stmt_t;
       return (hir_stmt_base *)hir_stmt_while_new(
-          span_copy(span), hir_expand_templates_expr(ctx, self->cond),
+          ctx->arena, span_copy_arena(ctx->arena, span),
+          hir_expand_templates_expr(ctx, self->cond),
           hir_expand_templates_stmt(ctx, self->stmt));
     }
     case HIR_STMT_DO: {
       const hir_stmt_do *self = (typeof(self))stmt_t;
       return (hir_stmt_base *)hir_stmt_do_new(
-          span_copy(span), self->positive,
+          ctx->arena, span_copy_arena(ctx->arena, span), self->positive,
           hir_expand_templates_expr(ctx, self->cond),
           hir_expand_templates_stmt(ctx, self->stmt));
     }
     case HIR_STMT_BREAK: {
-      return (hir_stmt_base *)hir_stmt_break_new(span_copy(span));
+      return (hir_stmt_base *)hir_stmt_break_new(
+          ctx->arena, span_copy_arena(ctx->arena, span));
     }
     case HIR_STMT_EXPR: {
       const hir_stmt_expr *self = (typeof(self))stmt_t;
       return (hir_stmt_base *)hir_stmt_expr_new(
-          span_copy(span), hir_expand_templates_expr(ctx, self->expr));
+          ctx->arena, span_copy_arena(ctx->arena, span),
+          hir_expand_templates_expr(ctx, self->expr));
     }
     case HIR_STMT_RETURN: {
       const hir_stmt_return *self = (typeof(self))stmt_t;
       return (hir_stmt_base *)hir_stmt_return_new(
-          span_copy(span), hir_expand_templates_expr(ctx, self->expr));
+          ctx->arena, span_copy_arena(ctx->arena, span),
+          hir_expand_templates_expr(ctx, self->expr));
     }
   }
   error("unexpected stmt kind %d %p", stmt_t->kind, stmt_t);
@@ -666,7 +940,7 @@ static hir_stmt_base *hir_expand_templates_stmt(hir_ctx             *ctx,
 static hir_subroutine *
 hir_expand_templates_subroutine(hir_ctx              *ctx,
                                 const hir_subroutine *subroutine_t) {
-  list_hir_param *params = list_hir_param_new();
+  list_hir_param *params = list_hir_param_new_arena(ctx->arena);
   for (list_hir_param_it it = list_hir_param_begin(subroutine_t->params);
        !END(it); NEXT(it)) {
     list_hir_param_push_back(params, hir_expand_templates_param(ctx, GET(it)));
@@ -678,18 +952,19 @@ hir_expand_templates_subroutine(hir_ctx              *ctx,
     switch (subroutine_t->body->kind) {
       case HIR_SUBROUTINE_BODY_IMPORT:
         body = hir_subroutine_body_new_import(
-            hir_lit_copy(subroutine_t->body->body.import.entry),
-            hir_lit_copy(subroutine_t->body->body.import.lib));
+            ctx->arena,
+            hir_lit_copy(ctx->arena, subroutine_t->body->body.import.entry),
+            hir_lit_copy(ctx->arena, subroutine_t->body->body.import.lib));
         break;
       case HIR_SUBROUTINE_BODY_BLOCK: {
-        list_hir_var *vars = list_hir_var_new();
+        list_hir_var *vars = list_hir_var_new_arena(ctx->arena);
         for (list_hir_var_it it =
                  list_hir_var_begin(subroutine_t->body->body.block.vars);
              !END(it); NEXT(it)) {
           list_hir_var_push_back(vars, hir_expand_templates_var(ctx, GET(it)));
         }
         body = hir_subroutine_body_new_block(
-            vars,
+            ctx->arena, vars,
             (hir_stmt_block *)hir_expand_templates_stmt(
                 ctx, (hir_stmt_base *)subroutine_t->body->body.block.block));
         break;
@@ -702,12 +977,51 @@ hir_expand_templates_subroutine(hir_ctx              *ctx,
   }
 
   return hir_subroutine_new_typed(
-      span_copy(subroutine_t->base.span), hir_id_copy(subroutine_t->id_hir),
-      params,
+      ctx->arena, span_copy_arena(ctx->arena, subroutine_t->base.span),
+      hir_id_copy(ctx->arena, subroutine_t->id_hir), params,
       hir_expand_type(ctx, subroutine_t->type_ref->type)->type_entry_ref,
       subroutine_t->spec, body);
 }
 
+// method is added to instantiated class, its usages are required
+static void hir_expand_templates_method(hir_ctx *ctx, hir_inst *inst,
+                                        const hir_method *method_t) {
+  ctx->map_type_tmpl = inst->map_type_tmpl;
+
+  hir_subroutine *sub =
+      hir_expand_templates_subroutine(ctx, method_t->subroutine);
+  if (sub) {
+    list_hir_method_push_back(
+        inst->class_ref->methods,
+        hir_method_new(ctx->arena,
+                       span_copy_arena(ctx->arena, method_t->base.span),
+                       method_t->modifier, sub));
+    hir_require_subroutine(ctx, sub);
+  }
+
+  ctx->map_type_tmpl = NULL;
+}
+
+// expands pending methods whose names became used, returns if any was
+static int hir_expand_templates_pending(hir_ctx *ctx) {
+  int expanded = 0;
+
+  for (size_t i = 0, sz = list_hir_pending_size(ctx->pending); i < sz; ++i) {
+    hir_pending      *pending  = list_hir_pending_pop_front(ctx->pending);
+    const hir_method *method_t = pending->method_ref;
+
+    if (hir_ctx_name_used(ctx, method_t->subroutine->id_hir->name)) {
+      hir_expand_templates_method(ctx, pending->inst_ref, method_t);
+      hir_pending_free(pending);
+      expanded = 1;
+    } else {
+      list_hir_pending_push_back(ctx->pending, pending);
+    }
+  }
+
+  return expanded;
+}
+
 static hir_class *hir_expand_templates_class(hir_ctx   *ctx,
                                              type_mono *mono_type) {
 
@@ -721,8 +1035,11 @@ static hir_class *hir_expand_templates_class(hir_ctx   *ctx,
   // info("expanding type %s", type_s);
   // free(type_s);
 
+  hir_inst *inst = hir_inst_new(mono_type, class_t);
+  list_hir_inst_push_back(ctx->insts, inst);
+
   // setup templates that need to be replaced
-  ctx->map_type_tmpl = hashset_hir_type_map_new();
+  ctx->map_type_tmpl = inst->map_type_tmpl;
 
   type_class_t *class_t_type = (typeof(class_t_type))class_t->type_ref->type;
 
@@ -757,13 +1074,17 @@ static hir_class *hir_expand_templates_class(hir_ctx   *ctx,
     }
 
     if (type_changed) {
+      type_table_unindex(ctx->type_table, (type_base *)mono_type);
       mono_type->type_ref = (type_base *)new_class_t_type;
+      type_table_reindex(ctx->type_table, (type_base *)mono_type);
     }
   }
 
   hir_class *hir_class = hir_class_new_typed(
-      span_copy(class_t->base.span), mono_type->base.type_entry_ref,
-      list_hir_var_new(), list_hir_method_new());
+      ctx->arena, span_copy_arena(ctx->arena, class_t->base.span),
+      mono_type->base.type_entry_ref, list_hir_var_new_arena(ctx->arena),
+      list_hir_method_new_arena(ctx->arena));
+  inst->class_ref = hir_class;
 
   for (list_hir_var_it it = list_hir_var_begin(class_t->fields); !END(it);
        NEXT(it)) {
@@ -773,29 +1094,29 @@ static hir_class *hir_expand_templates_class(hir_ctx   *ctx,
     }
   }
 
+  ctx->map_type_tmpl = NULL;
+
+  hir_require_class(ctx, hir_class);
+
+  // methods are expanded only when something may call them
   for (list_hir_method_it it = list_hir_method_begin(class_t->methods);
        !END(it); NEXT(it)) {
     const hir_method *method_t = GET(it);
-    hir_subroutine   *sub =
-        hir_expand_templates_subroutine(ctx, method_t->subroutine);
-    if (sub) {
-      list_hir_method_push_back(hir_class->methods,
-                                hir_method_new(span_copy(method_t->base.span),
-                                               method_t->modifier, sub));
+    if (hir_ctx_name_used(ctx, method_t->subroutine->id_hir->name)) {
+      hir_expand_templates_method(ctx, inst, method_t);
+    } else {
+      list_hir_pending_push_back(ctx->pending, hir_pending_new(inst, method_t));
     }
   }
 
-  hashset_hir_type_map_free(ctx->map_type_tmpl);
-
   return hir_class;
 }
 
-static void hir_expand_templates_all(hir_ctx *ctx) {
-  size_t i = 0;
+static void hir_expand_templates_classes(hir_ctx *ctx, size_t *cnt) {
   while (!list_type_mono_ref_empty(ctx->instto_types)) {
     type_mono *mono = list_type_mono_ref_pop_front(ctx->instto_types);
 
-    if (++i == 100) {
+    if (++*cnt == 100) {
       break;
     }
 
@@ -804,13 +1125,6 @@ static void hir_expand_templates_all(hir_ctx *ctx) {
       hir_class *class;
     } hir;
 
-    hashset_type_ref_it found =
-        hashset_type_ref_find(ctx->insted_types, (type_base *)mono);
-
-    if (!END(found)) {
-      continue;
-    }
-
 #ifndef NDEBUG
     char *type_from_s = type_str((type_base *)mono);
 #endif
@@ -849,12 +1163,18 @@ static void hir_expand_templates_all(hir_ctx *ctx) {
 #endif
 
     if (hir.result) {
-      hashset_type_ref_insert(ctx->insted_types, (type_base *)mono);
       list_hir_class_push_back(ctx->hir_classes, hir.result);
     }
   }
 }
 
+static void hir_expand_templates_all(hir_ctx *ctx) {
+  size_t cnt = 0;
+  do {
+    hir_expand_templates_classes(ctx, &cnt);
+  } while (cnt < 100 && hir_expand_templates_pending(ctx));
+}
+
 hir_expand_templates_result hir_expand_templates(hir        *hir,
                                                  type_table *type_table) {
   hir_expand_templates_result result = {
@@ -864,11 +1184,10 @@ hir_expand_templates_result hir_expand_templates(hir        *hir,
   hir_ctx ctx;
 
   // will append classes and exceptions
-  hir_ctx_init(&ctx, type_table, result.exceptions, hir->classes);
+  hir_ctx_init(&ctx, type_table, result.exceptions, hir);
 
-  hir_setup_ctx(&ctx);
   hir_setup_ctx_hir_templates(&ctx, hir_filter_templated_hir_classes(hir));
-  hir_setup_ctx_instto_types(&ctx, hir_get_mono_full_class_types(type_table));
+  hir_setup_ctx_required(&ctx, hir);
 
   hir_ctx_debug(&ctx, "before expansion");
 
@@ -0,0 +1,121 @@
+#include "front.h"
+
+#include "compiler/hir_build/lower_ast.h"
+#include "compiler/hir_build/parse.h"
+#include "util/file.h"
+#include "util/macro.h"
+#include "util/parallel.h"
+
+typedef struct hir_front_file_struct {
+  const char     *path_ref;
+  ast            *ast;
+  hir            *hir;
+  list_exception *exceptions; // of hand-written parser or reading
+  list_exception *lower_exceptions;
+} hir_front_file;
+
+typedef struct hir_front_ctx_struct {
+  hir_front_file *files;
+  int             hand_parser;
+  int             ignore_errors;
+} hir_front_ctx;
+
+static int hir_front_file_has_errors(hir_front_file *file) {
+  if (file->ast) {
+    return list_exception_count_by_level(ast_lexer_exceptions(file->ast),
+                                         EXCEPTION_LEVEL_ERROR) ||
+           list_exception_count_by_level(ast_parser_exceptions(file->ast),
+                                         EXCEPTION_LEVEL_ERROR);
+  }
+  return list_exception_count_by_level(file->exceptions,
+                                       EXCEPTION_LEVEL_ERROR);
+}
+
+// task touches only its own file, exceptions and hir are merged after all
+// tasks are done
+static void hir_front_file_run(void *arg, size_t idx) {
+  hir_front_ctx  *ctx  = arg;
+  hir_front_file *file = &ctx->files[idx];
+  file_map        source;
+
+  if (file_map_open(&source, file->path_ref)) {
+    file->exceptions = list_exception_new();
+    list_exception_push_back(
+        file->exceptions,
+        exception_new_f(EXCEPTION_LEVEL_ERROR, EXCEPTION_LEXER,
+                        EXCEPTION_LEXER_UNKNOWN, file->path_ref, 0, 0,
+                        "can't read file", "can't read file '%s'",
+                        file->path_ref));
+    return;
+  }
+
+  if (ctx->hand_parser) {
+    hir_parse_result r = hir_parse(file->path_ref, source.chars, source.len);
+    file_map_close(&source);
+    file->hir        = r.hir;
+    file->exceptions = r.exceptions;
+    return;
+  }
+
+  file->ast = ast_build(file->path_ref, source);
+
+  if (!hir_front_file_has_errors(file) || ctx->ignore_errors) {
+    hir_lower_ast_result r = hir_lower_ast(file->ast);
+    file->hir              = r.hir;
+    file->lower_exceptions = r.exceptions;
+  }
+}
+
+hir_front_result hir_front(const char *const *paths, size_t paths_cnt,
+                           int hand_parser, int ignore_errors, size_t jobs) {
+  hir_front_result result = {
+      .asts       = list_ast_new(),
+      .hir        = hir_new(),
+      .exceptions = list_exception_new(),
+  };
+
+  hir_front_ctx ctx = {
+      .files         = MALLOCN(hir_front_file, paths_cnt),
+      .hand_parser   = hand_parser,
+      .ignore_errors = ignore_errors,
+  };
+  for (size_t i = 0; i < paths_cnt; ++i) {
+    ctx.files[i] = (hir_front_file){.path_ref = paths[i]};
+  }
+
+  parallel_for(paths_cnt, jobs ? jobs : parallel_jobs_default(),
+               hir_front_file_run, &ctx);
+
+  for (size_t i = 0; i < paths_cnt; ++i) {
+    hir_front_file *file = &ctx.files[i];
+    if (file->ast) {
+      list_exception_splice_back(result.exceptions,
+                                 ast_lexer_exceptions(file->ast));
+      list_exception_splice_back(result.exceptions,
+                                 ast_parser_exceptions(file->ast));
+      list_ast_push_back(result.asts, file->ast);
+    } else {
+      list_exception_extend(result.exceptions, file->exceptions);
+    }
+  }
+
+  // files without syntax errors are lowered anyway, but their exceptions are
+  // reported only if all files are parsed as sequential build does
+  int lower = ignore_errors || !list_exception_count_by_level(
+                                   result.exceptions, EXCEPTION_LEVEL_ERROR);
+
+  for (size_t i = 0; i < paths_cnt; ++i) {
+    hir_front_file *file = &ctx.files[i];
+    if (file->hir) {
+      hir_merge(result.hir, file->hir);
+    }
+    if (lower) {
+      list_exception_extend(result.exceptions, file->lower_exceptions);
+    } else {
+      list_exception_free(file->lower_exceptions);
+    }
+  }
+
+  free(ctx.files);
+  return result;
+}
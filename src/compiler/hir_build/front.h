@@ -0,0 +1,19 @@
+#pragma once
+
+#include "compiler/ast/ast.h"
+#include "compiler/exception/list.h"
+#include "compiler/hir/hir.h"
+
+typedef struct hir_front_result_struct {
+  list_ast       *asts; // for dot output, empty with hand-written parser
+  hir            *hir;
+  list_exception *exceptions;
+} hir_front_result;
+
+// reads, parses and lowers each file to its own hir on up to jobs threads, 0
+// for each processor. Results are merged in order of paths: lexer and parser
+// exceptions of all files go first, then lowering ones, so output is the same
+// as of sequential build. Files aren't lowered if there are syntax errors,
+// unless ignore_errors is set
+hir_front_result hir_front(const char *const *paths, size_t paths_cnt,
+                           int hand_parser, int ignore_errors, size_t jobs);
@@ -1,6 +1,5 @@
 #pragma once
 
-#include "compiler/ast/ast.h"
 #include "compiler/exception/list.h"
 #include "compiler/hir/hir.h"
 #include "compiler/symbol_table/symbol_table.h"
@@ -13,4 +12,6 @@ typedef struct hir_build_result_struct {
   list_exception *exceptions;
 } hir_build_result;
 
-hir_build_result hir_build(const list_ast *asts, int ignore_errors);
+// binds types, expands templates and binds symbols of hir lowered or parsed by
+// hir_front, takes its ownership
+hir_build_result hir_build(hir *hir, int ignore_errors);
@@ -42,33 +42,30 @@ static void hir_dispay_error(pANTLR3_BASE_RECOGNIZER recognizer,
   list_exception_push_back(ctx->exceptions, exc);
 }
 
-hir_lower_ast_result hir_lower_ast(const list_ast *asts) {
+hir_lower_ast_result hir_lower_ast(const ast *ast) {
   hir_lower_ast_result result = {
       .hir        = hir_new(),
       .exceptions = list_exception_new(),
   };
 
   hir_lower_ast_ctx ctx = {
-      .hir_ref    = result.hir,
-      .exceptions = result.exceptions,
+      .hir_ref     = result.hir,
+      .exceptions  = result.exceptions,
+      .ast_cur_ref = ast,
+      .arena       = result.hir->arena,
   };
 
-  for (list_ast_it it = list_ast_begin(asts); !END(it); NEXT(it)) {
-    const ast *ast  = GET(it);
-    ctx.ast_cur_ref = ast;
+  ANTLR3_COMMON_TREE_NODE_STREAM *nodes =
+      antlr3CommonTreeNodeStreamNewTree(ast->tree, ANTLR3_SIZE_HINT);
+  HirBuilder *builder = HirBuilderNew(nodes);
 
-    ANTLR3_COMMON_TREE_NODE_STREAM *nodes =
-        antlr3CommonTreeNodeStreamNewTree(ast->tree, ANTLR3_SIZE_HINT);
-    HirBuilder *builder = HirBuilderNew(nodes);
+  builder->pTreeParser->rec->state->userp            = &ctx;
+  builder->pTreeParser->rec->displayRecognitionError = hir_dispay_error;
 
-    builder->pTreeParser->rec->state->userp            = &ctx;
-    builder->pTreeParser->rec->displayRecognitionError = hir_dispay_error;
+  builder->source(builder);
 
-    builder->source(builder);
-
-    builder->free(builder);
-    nodes->free(nodes);
-  }
+  builder->free(builder);
+  nodes->free(nodes);
 
   return result;
 }
@@ -8,6 +8,7 @@ typedef struct hir_lower_ast_ctx_struct {
   hir            *hir_ref;
   list_exception *exceptions;
   const ast      *ast_cur_ref;
+  arena          *arena; // of hir_ref
 } hir_lower_ast_ctx;
 
 typedef struct hir_lower_ast_result_struct {
@@ -15,4 +16,6 @@ typedef struct hir_lower_ast_result_struct {
   list_exception *exceptions;
 } hir_lower_ast_result;
 
-hir_lower_ast_result hir_lower_ast(const list_ast *asts);
+// lowers ast of single file to its own hir, so files can be lowered
+// concurrently and merged with hir_merge
+hir_lower_ast_result hir_lower_ast(const ast *ast);
@@ -5,29 +5,47 @@
 #include "compiler/hir_build/exception.h"
 #include "compiler/span/span.h"
 // #include "compiler/span/str.h"
+#include "util/intern.h"
 // #include "util/log.h"
 #include "util/macro.h"
 #include <antlr3basetree.h>
 #include <antlr3commontoken.h>
 #include <errno.h>
 
-static span *hir_span_new(ANTLR3_BASE_TREE *first, const char *source) {
+static span *hir_span_new(hir_ctx *ctx, ANTLR3_BASE_TREE *first) {
+  const char *source = ctx->ast_cur_ref->name_ref;
   if (!first || !first->getToken(first)) {
     // debug("span is set to default");
-    return span_new(source, 0, 0, 0, 0);
+    return span_new_arena(ctx->arena, source, 0, 0, 0, 0);
   }
   ANTLR3_COMMON_TOKEN *first_token = first->getToken(first);
 
-  span *span = span_new(source, first_token->line, first_token->line,
-                        first_token->getCharPositionInLine(first_token),
-                        first_token->getCharPositionInLine(first_token) +
-                            (first_token->stop - first_token->start + 1));
+  span *span = span_new_arena(
+      ctx->arena, source, first_token->line, first_token->line,
+      first_token->getCharPositionInLine(first_token),
+      first_token->getCharPositionInLine(first_token) +
+          (first_token->stop - first_token->start + 1));
   return span;
 }
 
-static span *hir_span_new_range(const span *first, const span *second) {
-  span *span = span_new(first->source_ref, first->line_start, second->line_end,
-                        first->pos_start, second->pos_end);
+// text of token in source without creating antlr string. Imaginary tokens and
+// tokens with text set by rewrite rules don't point to source
+static const char *hir_token_chars(ANTLR3_BASE_TREE *node, size_t *len) {
+  ANTLR3_COMMON_TOKEN *token = node->getToken(node);
+  if (token && token->input && token->textState == ANTLR3_TEXT_NONE) {
+    *len = token->stop - token->start + 1;
+    return (const char *)token->start;
+  }
+  const char *chars = ANTLR3_CHARS(node);
+  *len              = strlen(chars);
+  return chars;
+}
+
+static span *hir_span_new_range(hir_ctx *ctx, const span *first,
+                                const span *second) {
+  span *span = span_new_arena(ctx->arena, first->source_ref, first->line_start,
+                              second->line_end, first->pos_start,
+                              second->pos_end);
   return span;
 }
 
@@ -116,36 +134,34 @@ static void hir_error_add(hir_ctx *ctx, exception_subtype_hir subtype,
 
 // IDENTIFIER
 hir_id *hir_build_id(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  const char *name = ANTLR3_CHARS(node);
-  return hir_id_new(hir_span_new(node, ctx->ast_cur_ref->name_ref),
-                    strdup(name));
+  size_t      len;
+  const char *name = hir_token_chars(node, &len);
+  return hir_id_new(ctx->arena, hir_span_new(ctx, node), intern_n(name, len));
 }
 
 // LITERALS
 hir_lit *hir_build_str(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span       *span  = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  const char *chars = ANTLR3_CHARS(node);
-  size_t      len   = strlen(chars);
-  char       *data  = malloc(len - 1);
-  strncpy(data, chars + 1, len - 2);
-  data[len - 2] = '\0';
-  return hir_lit_new(span, hir_type_base_new(span_copy(span), HIR_TYPE_STRING),
-                     (hir_lit_u){.v_str = data});
+  span       *span  = hir_span_new(ctx, node);
+  size_t      len;
+  const char *chars = hir_token_chars(node, &len);
+  char       *data  = arena_strndup(ctx->arena, chars + 1, len - 2);
+  hir_type_base *type = hir_type_base_new(
+      ctx->arena, span_copy_arena(ctx->arena, span), HIR_TYPE_STRING);
+  return hir_lit_new(ctx->arena, span, type, (hir_lit_u){.v_str = data});
 }
 
 hir_lit *hir_build_rune(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span       *span  = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  const char *chars = ANTLR3_CHARS(node);
-  size_t      len   = strlen(chars);
-  char       *data  = malloc(len - 1);
-  strncpy(data, chars + 1, len - 2);
-  data[len - 2] = '\0';
-  return hir_lit_new(span, hir_type_base_new(span_copy(span), HIR_TYPE_CHAR),
-                     (hir_lit_u){.v_char = data});
+  span       *span  = hir_span_new(ctx, node);
+  size_t      len;
+  const char *chars = hir_token_chars(node, &len);
+  char       *data  = arena_strndup(ctx->arena, chars + 1, len - 2);
+  hir_type_base *type = hir_type_base_new(
+      ctx->arena, span_copy_arena(ctx->arena, span), HIR_TYPE_CHAR);
+  return hir_lit_new(ctx->arena, span, type, (hir_lit_u){.v_char = data});
 }
 
 hir_lit *hir_build_hex(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span       *span  = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span       *span  = hir_span_new(ctx, node);
   const char *chars = ANTLR3_CHARS(node) + 2;
 
   char *err_msg = NULL;
@@ -159,15 +175,17 @@ hir_lit *hir_build_hex(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
       free(err_msg);
       return NULL;
     }
-    return hir_lit_new(span, hir_type_base_new(NULL, HIR_TYPE_ULONG),
+    return hir_lit_new(ctx->arena, span,
+                       hir_type_base_new(ctx->arena, NULL, HIR_TYPE_ULONG),
                        (hir_lit_u){.v_ulong = uvalue});
   }
-  return hir_lit_new(span, hir_type_base_new(NULL, HIR_TYPE_LONG),
+  return hir_lit_new(ctx->arena, span,
+                     hir_type_base_new(ctx->arena, NULL, HIR_TYPE_LONG),
                      (hir_lit_u){.v_long = value});
 }
 
 hir_lit *hir_build_bits(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span       *span  = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span       *span  = hir_span_new(ctx, node);
   const char *chars = ANTLR3_CHARS(node) + 2;
 
   char *err_msg = NULL;
@@ -181,15 +199,17 @@ hir_lit *hir_build_bits(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
       free(err_msg);
       return NULL;
     }
-    return hir_lit_new(span, hir_type_base_new(NULL, HIR_TYPE_ULONG),
+    return hir_lit_new(ctx->arena, span,
+                       hir_type_base_new(ctx->arena, NULL, HIR_TYPE_ULONG),
                        (hir_lit_u){.v_ulong = uvalue});
   }
-  return hir_lit_new(span, hir_type_base_new(NULL, HIR_TYPE_LONG),
+  return hir_lit_new(ctx->arena, span,
+                     hir_type_base_new(ctx->arena, NULL, HIR_TYPE_LONG),
                      (hir_lit_u){.v_long = value});
 }
 
 hir_lit *hir_build_dec(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span       *span  = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span       *span  = hir_span_new(ctx, node);
   const char *chars = ANTLR3_CHARS(node);
 
   char *err_msg = NULL;
@@ -203,15 +223,17 @@ hir_lit *hir_build_dec(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
       free(err_msg);
       return NULL;
     }
-    return hir_lit_new(span, hir_type_base_new(NULL, HIR_TYPE_ULONG),
+    return hir_lit_new(ctx->arena, span,
+                       hir_type_base_new(ctx->arena, NULL, HIR_TYPE_ULONG),
                        (hir_lit_u){.v_ulong = uvalue});
   }
-  return hir_lit_new(span, hir_type_base_new(NULL, HIR_TYPE_LONG),
+  return hir_lit_new(ctx->arena, span,
+                     hir_type_base_new(ctx->arena, NULL, HIR_TYPE_LONG),
                      (hir_lit_u){.v_long = value});
 }
 
 hir_lit *hir_build_bool(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span       *span  = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span       *span  = hir_span_new(ctx, node);
   const char *chars = ANTLR3_CHARS(node);
 
   hir_lit_u u;
@@ -224,66 +246,65 @@ hir_lit *hir_build_bool(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
                   "%s is invalid boolean const", chars);
     return NULL;
   }
-  return hir_lit_new(span, hir_type_base_new(NULL, HIR_TYPE_BOOL), u);
+  return hir_lit_new(ctx->arena, span,
+                     hir_type_base_new(ctx->arena, NULL, HIR_TYPE_BOOL), u);
 }
 
 // TYPES
 hir_type_base *hir_build_type_bool(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_BOOL);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_BOOL);
 }
 
 hir_type_base *hir_build_type_byte(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_BYTE);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_BYTE);
 }
 
 hir_type_base *hir_build_type_int(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_INT);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_INT);
 }
 
 hir_type_base *hir_build_type_uint(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_UINT);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_UINT);
 }
 
 hir_type_base *hir_build_type_long(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_LONG);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_LONG);
 }
 
 hir_type_base *hir_build_type_ulong(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_ULONG);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_ULONG);
 }
 
 hir_type_base *hir_build_type_char(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_CHAR);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_CHAR);
 }
 
 hir_type_base *hir_build_type_string(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_STRING);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_STRING);
 }
 
 hir_type_base *hir_build_type_void(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_VOID);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_VOID);
 }
 
 hir_type_base *hir_build_type_any(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_type_base_new(span, HIR_TYPE_ANY);
+  span *span = hir_span_new(ctx, node);
+  return hir_type_base_new(ctx->arena, span, HIR_TYPE_ANY);
 }
 
 hir_type_custom *hir_build_type_custom(hir_ctx *ctx, hir_id *id,
                                        list_hir_type *templates) {
-  UNUSED(ctx);
-  hir_id_data      id_data = hir_id_pop(id);
-  hir_type_custom *custom =
-      hir_type_custom_new(id_data.span, id_data.name, templates);
+  hir_type_custom *custom = hir_type_custom_new(
+      ctx->arena, id->base.span, arena_strdup(ctx->arena, id->name), templates);
 
   char *str = hir_type_str((hir_type_base *)custom);
   free(str);
@@ -294,68 +315,67 @@ hir_type_custom *hir_build_type_custom(hir_ctx *ctx, hir_id *id,
 hir_type_array *hir_build_type_array(hir_ctx *ctx, ANTLR3_BASE_TREE *node,
                                      ANTLR3_BASE_TREE *dimensions_node,
                                      hir_type_base    *elem_type) {
-  span  *root       = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span  *root       = hir_span_new(ctx, node);
   size_t dimensions = ANTLR3_SIZE(dimensions_node);
-  span  *span_m     = hir_span_new_range(root, elem_type->span);
-  span_free(root);
+  span  *span_m     = hir_span_new_range(ctx, root, elem_type->span);
 
   hir_type_base *type_root = elem_type;
   for (size_t i = 0; i < dimensions; ++i) {
-    type_root =
-        (hir_type_base *)hir_type_array_new(span_copy(span_m), type_root);
+    type_root = (hir_type_base *)hir_type_array_new(
+        ctx->arena, span_copy_arena(ctx->arena, span_m), type_root);
   }
-  return hir_type_array_new(span_m, type_root);
+  return hir_type_array_new(ctx->arena, span_m, type_root);
 }
 
 hir_param *hir_build_param(hir_ctx *ctx, hir_id *id, hir_type_base *type) {
-  UNUSED(ctx);
   span *span;
   if (type) {
-    span = hir_span_new_range(id->base.span, type->span);
+    span = hir_span_new_range(ctx, id->base.span, type->span);
   } else {
-    span = span_copy(id->base.span);
+    span = span_copy_arena(ctx->arena, id->base.span);
   }
-  return hir_param_new(span, id, type);
+  return hir_param_new(ctx->arena, span, id, type);
 }
 
 hir_subroutine *hir_build_signature(hir_ctx *ctx, ANTLR3_BASE_TREE *root,
                                     hir_id *id, list_hir_param *params,
                                     hir_type_base *ret_type) {
-  span *root_span = hir_span_new(root, ctx->ast_cur_ref->name_ref);
+  span *root_span = hir_span_new(ctx, root);
   span *span;
   if (ret_type) {
-    span = hir_span_new_range(root_span, ret_type->span);
+    span = hir_span_new_range(ctx, root_span, ret_type->span);
   } else if (list_hir_param_size(params) > 0) {
-    span =
-        hir_span_new_range(root_span, list_hir_param_back(params)->base.span);
+    span = hir_span_new_range(ctx, root_span,
+                              list_hir_param_back(params)->base.span);
   } else {
-    span = hir_span_new_range(root_span, id->base.span);
+    span = hir_span_new_range(ctx, root_span, id->base.span);
   }
-  span_free(root_span);
   // debug("%zu:%zu %zu:%zu", span->line_start, span->pos_start, span->line_end,
   // span->pos_end);
-  return hir_subroutine_new(span, id, params, ret_type,
+  return hir_subroutine_new(ctx->arena, span, id, params, ret_type,
                             HIR_SUBROUTINE_SPEC_EMPTY, NULL);
 }
 
 list_hir_var *hir_build_var_entry(hir_ctx *ctx, list_hir_id *ids,
                                   hir_type_base *type) {
-  UNUSED(ctx);
-  list_hir_var *var_list = list_hir_var_new();
+  list_hir_var *var_list = list_hir_var_new_arena(ctx->arena);
 
   size_t id_size = list_hir_id_size(ids);
   for (size_t i = 1; i < id_size; ++i) {
     hir_id *id = list_hir_id_pop_front(ids);
-    list_hir_var_push_back(var_list, hir_var_new(span_copy(id->base.span), id,
-                                                 hir_type_copy(type)));
+    list_hir_var_push_back(
+        var_list,
+        hir_var_new(ctx->arena, span_copy_arena(ctx->arena, id->base.span), id,
+                    hir_type_copy(ctx->arena, type)));
   }
   if (id_size > 0) {
     hir_id *id = list_hir_id_pop_front(ids);
-    list_hir_var_push_back(var_list,
-                           hir_var_new(span_copy(id->base.span), id, type));
+    list_hir_var_push_back(
+        var_list, hir_var_new(ctx->arena,
+                              span_copy_arena(ctx->arena, id->base.span), id,
+                              type));
   }
 
-  list_hir_id_free(ids);
   return var_list;
 }
 
@@ -367,20 +387,17 @@ void hir_build_var_list_extend(hir_ctx *ctx, list_hir_var *first,
     hir_var *var = list_hir_var_pop_front(second);
     list_hir_var_push_back(first, var);
   }
-  list_hir_var_free(second);
 }
 
 hir_subroutine *hir_build_func(hir_ctx *ctx, hir_subroutine *subroutine,
                                hir_subroutine_body *body,
                                ANTLR3_BASE_TREE    *sp_extern) {
-  UNUSED(ctx);
 
   // include specifiers into subroutine span
   if (sp_extern) {
-    span *span_extern = hir_span_new(sp_extern, ctx->ast_cur_ref->name_ref);
-    span *span        = hir_span_new_range(span_extern, subroutine->base.span);
-    span_free(span_extern);
-    span_free(subroutine->base.span);
+    span *span_extern = hir_span_new(ctx, sp_extern);
+    span *span =
+        hir_span_new_range(ctx, span_extern, subroutine->base.span);
     subroutine->base.span = span;
   }
 
@@ -394,14 +411,12 @@ hir_subroutine *hir_build_func(hir_ctx *ctx, hir_subroutine *subroutine,
 
 hir_subroutine_body *hir_build_func_body_block(hir_ctx *ctx, list_hir_var *vars,
                                                hir_stmt_block *body) {
-  UNUSED(ctx);
-  return hir_subroutine_body_new_block(vars, body);
+  return hir_subroutine_body_new_block(ctx->arena, vars, body);
 }
 
 hir_subroutine_body *hir_build_func_body_import(hir_ctx *ctx, hir_lit *lib,
                                                 hir_lit *entry) {
-  UNUSED(ctx);
-  return hir_subroutine_body_new_import(entry, lib);
+  return hir_subroutine_body_new_import(ctx->arena, entry, lib);
 }
 
 // CLASS
@@ -409,214 +424,210 @@ hir_method *hir_build_method(hir_ctx *ctx, ANTLR3_BASE_TREE *mod_t,
                              hir_method_modifier_enum modifier,
                              hir_subroutine *func, const hir_id *class_id_ref,
                              const list_hir_id *typenames_ref) {
-  UNUSED(ctx);
 
   // add implicit this first param
-  list_hir_type *typenames = list_hir_type_new();
+  list_hir_type *typenames = list_hir_type_new_arena(ctx->arena);
   for (list_hir_id_it it = list_hir_id_begin(typenames_ref); !END(it);
        NEXT(it)) {
-    list_hir_type_push_back(typenames, (hir_type_base *)hir_type_custom_new(
-                                           NULL, strdup(GET(it)->name), NULL));
+    list_hir_type_push_back(
+        typenames,
+        (hir_type_base *)hir_type_custom_new(
+            ctx->arena, NULL, arena_strdup(ctx->arena, GET(it)->name), NULL));
   }
 
   list_hir_param_push_front(
       func->params,
-      hir_param_new(NULL, hir_id_new(NULL, strdup("this")),
+      hir_param_new(ctx->arena, NULL,
+                    hir_id_new(ctx->arena, NULL, intern("this")),
                     (hir_type_base *)hir_type_custom_new(
-                        NULL, strdup(class_id_ref->name), typenames)));
+                        ctx->arena, NULL,
+                        arena_strdup(ctx->arena, class_id_ref->name),
+                        typenames)));
 
   if (!mod_t || modifier == HIR_METHOD_MODIFIER_ENUM_EMPTY) {
-    span *span = span_copy(func->base.span);
-    return hir_method_new(span, modifier, func);
+    span *span = span_copy_arena(ctx->arena, func->base.span);
+    return hir_method_new(ctx->arena, span, modifier, func);
   } else {
-    span *mod_span = hir_span_new(mod_t, ctx->ast_cur_ref->name_ref);
-    span *span     = hir_span_new_range(mod_span, func->base.span);
-    span_free(mod_span);
-    return hir_method_new(span, modifier, func);
+    span *mod_span = hir_span_new(ctx, mod_t);
+    span *span     = hir_span_new_range(ctx, mod_span, func->base.span);
+    return hir_method_new(ctx->arena, span, modifier, func);
   }
 }
 
 hir_class *hir_build_class(hir_ctx *ctx, ANTLR3_BASE_TREE *root, hir_id *id,
                            list_hir_id *typenames, list_hir_type *parents,
                            list_hir_var *fields, list_hir_method *methods) {
-  span *root_span = hir_span_new(root, ctx->ast_cur_ref->name_ref);
+  span *root_span = hir_span_new(ctx, root);
   span *span;
   if (list_hir_type_size(parents)) {
-    span = hir_span_new_range(root_span, list_hir_type_back(parents)->span);
-  } else if (list_hir_id_size(typenames)) {
     span =
-        hir_span_new_range(root_span, list_hir_id_back(typenames)->base.span);
+        hir_span_new_range(ctx, root_span, list_hir_type_back(parents)->span);
+  } else if (list_hir_id_size(typenames)) {
+    span = hir_span_new_range(ctx, root_span,
+                              list_hir_id_back(typenames)->base.span);
   } else {
-    span = hir_span_new_range(root_span, id->base.span);
+    span = hir_span_new_range(ctx, root_span, id->base.span);
   }
-  span_free(root_span);
 
-  return hir_class_new(span, id, typenames, parents, fields, methods);
+  return hir_class_new(ctx->arena, span, id, typenames, parents, fields,
+                       methods);
 }
 
 // EXPRESSIONS
 hir_expr_lit *hir_build_expr_lit(hir_ctx *ctx, hir_lit *lit) {
-  UNUSED(ctx);
-  return hir_expr_lit_new(span_copy(lit->base.span), NULL, lit);
+  return hir_expr_lit_new(ctx->arena,
+                          span_copy_arena(ctx->arena, lit->base.span), NULL,
+                          lit);
 }
 
 hir_expr_id *hir_build_expr_id(hir_ctx *ctx, hir_id *id) {
-  UNUSED(ctx);
-  return hir_expr_id_new(span_copy(id->base.span), NULL, id);
+  return hir_expr_id_new(ctx->arena, span_copy_arena(ctx->arena, id->base.span),
+                         NULL, id);
 }
 
 hir_expr_index *hir_build_expr_indexer(hir_ctx *ctx, hir_expr_base *indexed,
                                        list_hir_expr *args) {
-  UNUSED(ctx);
   span *span;
   if (list_hir_expr_size(args) > 0) {
-    span = hir_span_new_range(indexed->base.span,
+    span = hir_span_new_range(ctx, indexed->base.span,
                               list_hir_expr_back(args)->base.span);
   } else {
-    span = span_copy(indexed->base.span);
+    span = span_copy_arena(ctx->arena, indexed->base.span);
   }
-  return hir_expr_index_new(span, NULL, indexed, args);
+  return hir_expr_index_new(ctx->arena, span, NULL, indexed, args);
 }
 
 hir_expr_call *hir_build_expr_caller(hir_ctx *ctx, hir_expr_base *indexed,
                                      list_hir_expr *args) {
-  UNUSED(ctx);
   span *span;
   if (list_hir_expr_size(args) > 0) {
-    span = hir_span_new_range(indexed->base.span,
+    span = hir_span_new_range(ctx, indexed->base.span,
                               list_hir_expr_back(args)->base.span);
   } else {
-    span = span_copy(indexed->base.span);
+    span = span_copy_arena(ctx->arena, indexed->base.span);
   }
-  return hir_expr_call_new(span, NULL, indexed, args);
+  return hir_expr_call_new(ctx->arena, span, NULL, indexed, args);
 }
 
 hir_expr_unary *hir_build_expr_unary(hir_ctx *ctx, hir_expr_base *first,
                                      ANTLR3_BASE_TREE   *op_node,
                                      hir_expr_unary_enum op) {
-  span *op_span = hir_span_new(op_node, ctx->ast_cur_ref->name_ref);
+  span *op_span = hir_span_new(ctx, op_node);
   span *span;
   if (op_span->line_start < first->base.span->line_start) {
-    span = hir_span_new_range(op_span, first->base.span);
+    span = hir_span_new_range(ctx, op_span, first->base.span);
   } else {
-    span = hir_span_new_range(first->base.span, op_span);
+    span = hir_span_new_range(ctx, first->base.span, op_span);
   }
-  span_free(op_span);
-  return hir_expr_unary_new(span, NULL, op, first);
+  return hir_expr_unary_new(ctx->arena, span, NULL, op, first);
 }
 
 hir_expr_binary *hir_build_expr_binary(hir_ctx *ctx, hir_expr_base *first,
                                        hir_expr_base       *second,
                                        ANTLR3_BASE_TREE    *op_node,
                                        hir_expr_binary_enum op) {
-  UNUSED(ctx);
   UNUSED(op_node);
   return hir_expr_binary_new(
-      hir_span_new_range(first->base.span, second->base.span), NULL, op, first,
-      second);
+      ctx->arena, hir_span_new_range(ctx, first->base.span, second->base.span),
+      NULL, op, first, second);
 }
 
 // convert id to literal because it is not actually a symbol
 hir_expr_binary *hir_build_expr_member(hir_ctx *ctx, hir_expr_base *first,
                                        hir_id           *second,
                                        ANTLR3_BASE_TREE *op_node) {
-  UNUSED(ctx);
   UNUSED(op_node);
 
-  hir_id_data data      = hir_id_pop(second);
-  span       *expr_span = hir_span_new_range(first->base.span, data.span);
+  span    *expr_span =
+      hir_span_new_range(ctx, first->base.span, second->base.span);
+  hir_lit *lit = hir_lit_new(
+      ctx->arena, second->base.span,
+      hir_type_base_new(ctx->arena, NULL, HIR_TYPE_STRING),
+      (hir_lit_u){.v_str = arena_strdup(ctx->arena, second->name)});
 
   return hir_expr_binary_new(
-      expr_span, NULL, HIR_EXPR_BINARY_MEMBER, first,
-      (hir_expr_base *)hir_expr_lit_new(
-          NULL, NULL,
-          hir_lit_new(data.span, hir_type_base_new(NULL, HIR_TYPE_STRING),
-                      (hir_lit_u){.v_str = data.name})));
+      ctx->arena, expr_span, NULL, HIR_EXPR_BINARY_MEMBER, first,
+      (hir_expr_base *)hir_expr_lit_new(ctx->arena, NULL, NULL, lit));
 }
 
 hir_expr_builtin *hir_build_expr_builtin(hir_ctx *ctx, ANTLR3_BASE_TREE *node,
                                          hir_expr_builtin_enum kind,
                                          hir_type_base        *type,
                                          list_hir_expr        *args) {
-  span *node_span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span *node_span = hir_span_new(ctx, node);
   span *span;
 
   if (list_hir_expr_size(args)) {
-    span = hir_span_new_range(node_span, list_hir_expr_back(args)->base.span);
-    span_free(node_span);
+    span = hir_span_new_range(ctx, node_span,
+                              list_hir_expr_back(args)->base.span);
   } else if (type) {
-    span = hir_span_new_range(node_span, type->span);
-    span_free(node_span);
+    span = hir_span_new_range(ctx, node_span, type->span);
   } else {
     span = node_span;
   }
 
-  return hir_expr_builtin_new(span, type, kind, args);
+  return hir_expr_builtin_new(ctx->arena, span, type, kind, args);
 }
 
 // STATEMENTS
 hir_stmt_if *hir_build_stmt_if(hir_ctx *ctx, ANTLR3_BASE_TREE *node,
                                hir_expr_base *cond, hir_stmt_base *je,
                                hir_stmt_base *jz) {
-  span *node_span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span *node_span = hir_span_new(ctx, node);
   span *span;
   if (jz) {
-    span = hir_span_new_range(node_span, jz->base.span);
+    span = hir_span_new_range(ctx, node_span, jz->base.span);
   } else {
-    span = hir_span_new_range(node_span, je->base.span);
+    span = hir_span_new_range(ctx, node_span, je->base.span);
   }
-  span_free(node_span);
   // debug("%zu:%zu %zu:%zu", span->line_start, span->pos_start,
   // span->line_end, span->pos_end);
-  return hir_stmt_if_new(span, cond, je, jz);
+  return hir_stmt_if_new(ctx->arena, span, cond, je, jz);
 }
 
 hir_stmt_block *hir_build_stmt_block(hir_ctx *ctx, ANTLR3_BASE_TREE *node,
                                      list_hir_stmt *stmts) {
-  span *node_span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
+  span *node_span = hir_span_new(ctx, node);
   span *span;
   if (list_hir_stmt_size(stmts) > 0) {
-    span = hir_span_new_range(node_span, list_hir_stmt_back(stmts)->base.span);
-    span_free(node_span);
+    span = hir_span_new_range(ctx, node_span,
+                              list_hir_stmt_back(stmts)->base.span);
   } else {
     span = node_span;
   }
-  return hir_stmt_block_new(span, stmts);
+  return hir_stmt_block_new(ctx->arena, span, stmts);
 }
 
 hir_stmt_while *hir_build_stmt_while(hir_ctx *ctx, ANTLR3_BASE_TREE *node,
                                      hir_expr_base *cond, hir_stmt_base *stmt) {
-  span *node_span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  span *span      = hir_span_new_range(node_span, stmt->base.span);
-  span_free(node_span);
-  return hir_stmt_while_new(span, cond, stmt);
+  span *node_span = hir_span_new(ctx, node);
+  span *span      = hir_span_new_range(ctx, node_span, stmt->base.span);
+  return hir_stmt_while_new(ctx->arena, span, cond, stmt);
 }
 
 hir_stmt_do *hir_build_stmt_do(hir_ctx *ctx, ANTLR3_BASE_TREE *node,
                                int positive, hir_expr_base *cond,
                                hir_stmt_base *stmt) {
-  span *node_span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  span *span      = hir_span_new_range(node_span, cond->base.span);
-  span_free(node_span);
-  return hir_stmt_do_new(span, positive, cond, stmt);
+  span *node_span = hir_span_new(ctx, node);
+  span *span      = hir_span_new_range(ctx, node_span, cond->base.span);
+  return hir_stmt_do_new(ctx->arena, span, positive, cond, stmt);
 }
 
 hir_stmt_break *hir_build_stmt_break(hir_ctx *ctx, ANTLR3_BASE_TREE *node) {
-  span *node_span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  return hir_stmt_break_new(node_span);
+  span *node_span = hir_span_new(ctx, node);
+  return hir_stmt_break_new(ctx->arena, node_span);
 }
 
 hir_stmt_expr *hir_build_stmt_expr(hir_ctx *ctx, hir_expr_base *expr) {
-  UNUSED(ctx);
-  return hir_stmt_expr_new(span_copy(expr->base.span), expr);
+  return hir_stmt_expr_new(ctx->arena,
+                           span_copy_arena(ctx->arena, expr->base.span), expr);
 }
 
 hir_stmt_return *hir_build_stmt_return(hir_ctx *ctx, ANTLR3_BASE_TREE *node,
                                        hir_expr_base *expr) {
-  span *node_span = hir_span_new(node, ctx->ast_cur_ref->name_ref);
-  span *span      = hir_span_new_range(node_span, expr->base.span);
-  span_free(node_span);
-  return hir_stmt_return_new(span, expr);
+  span *node_span = hir_span_new(ctx, node);
+  span *span      = hir_span_new_range(ctx, node_span, expr->base.span);
+  return hir_stmt_return_new(ctx->arena, span, expr);
 }
 
 // HIR
@@ -0,0 +1,1115 @@
+#include "parse.h"
+
+#include "compiler/exception/exception.h"
+#include "compiler/hir_build/exception.h"
+#include "compiler/lexer/scanner.h"
+#include "compiler/span/span.h"
+#include "util/intern.h"
+#include "util/macro.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct hir_parse_ctx_struct {
+  scanner         scanner;
+  scanner_token   cur;
+  scanner_token   next; // lookahead for '<' '<' and '>' '>' shifts
+  const char     *name_ref;
+  list_exception *exceptions;
+  arena          *arena; // of hir, nodes dropped on errors stay there
+} hir_parse_ctx;
+
+static hir_type_base  *hir_parse_type(hir_parse_ctx *ctx);
+static hir_expr_base  *hir_parse_expr(hir_parse_ctx *ctx);
+static hir_stmt_base  *hir_parse_stmt(hir_parse_ctx *ctx);
+static hir_stmt_block *hir_parse_stmt_block(hir_parse_ctx *ctx);
+
+// TOKENS
+static void hir_parse_advance(hir_parse_ctx *ctx) {
+  ctx->cur  = ctx->next;
+  ctx->next = scanner_next(&ctx->scanner);
+}
+
+static int hir_parse_is(const hir_parse_ctx *ctx, scanner_token_kind kind) {
+  return ctx->cur.kind == kind;
+}
+
+static int hir_parse_accept(hir_parse_ctx *ctx, scanner_token_kind kind) {
+  if (hir_parse_is(ctx, kind)) {
+    hir_parse_advance(ctx);
+    return 1;
+  }
+  return 0;
+}
+
+static void hir_parse_error(hir_parse_ctx *ctx, const char *expected) {
+  const scanner_token *token = &ctx->cur;
+  exception           *exc;
+  if (token->kind == SCANNER_TOKEN_EOF) {
+    exc = exception_new_f(EXCEPTION_LEVEL_ERROR, EXCEPTION_PARSER,
+                          EXCEPTION_PARSER_EOF, ctx->name_ref, token->line,
+                          token->pos, "unexpected token",
+                          "at <EOF>, expected %s", expected);
+  } else {
+    exc = exception_new_f(EXCEPTION_LEVEL_ERROR, EXCEPTION_PARSER,
+                          EXCEPTION_PARSER_GENERIC, ctx->name_ref, token->line,
+                          token->pos, "unexpected token",
+                          "near '%.*s', expected %s", (int)token->len,
+                          token->chars, expected);
+  }
+  list_exception_push_back(ctx->exceptions, exc);
+}
+
+static int hir_parse_expect(hir_parse_ctx *ctx, scanner_token_kind kind) {
+  if (hir_parse_accept(ctx, kind)) {
+    return 1;
+  }
+  hir_parse_error(ctx, scanner_token_kind_str(kind));
+  return 0;
+}
+
+// SPANS
+static span *hir_parse_span(const hir_parse_ctx *ctx,
+                            const scanner_token *token) {
+  return span_new_arena(ctx->arena, ctx->name_ref, token->line, token->line,
+                        token->pos, token->pos + token->len);
+}
+
+static span *hir_parse_span_range(const hir_parse_ctx *ctx, const span *first,
+                                  const span *second) {
+  return span_new_arena(ctx->arena, first->source_ref, first->line_start,
+                        second->line_end, first->pos_start, second->pos_end);
+}
+
+// TERMINALS
+static hir_id *hir_parse_id(hir_parse_ctx *ctx) {
+  scanner_token token = ctx->cur;
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_IDENTIFIER)) {
+    return NULL;
+  }
+  return hir_id_new(ctx->arena, hir_parse_span(ctx, &token),
+                    intern_n(token.chars, token.len));
+}
+
+// digits are checked by scanner, so only overflow of ulong is an error
+static hir_lit *hir_parse_lit_number(hir_parse_ctx *ctx, span *span,
+                                     const char *chars, size_t len, int base,
+                                     exception_subtype_hir subtype) {
+  char *str = strndup(chars, len);
+
+  errno      = 0;
+  long value = strtol(str, NULL, base);
+  if (errno != ERANGE) {
+    free(str);
+    return hir_lit_new(ctx->arena, span,
+                       hir_type_base_new(ctx->arena, NULL, HIR_TYPE_LONG),
+                       (hir_lit_u){.v_long = value});
+  }
+
+  errno        = 0;
+  ulong uvalue = strtoul(str, NULL, base);
+  if (errno == ERANGE) {
+    hir_exception_add_error(ctx->exceptions, subtype, span,
+                            "%s invalid (overflow occurred)", str);
+    free(str);
+    return NULL;
+  }
+  free(str);
+  return hir_lit_new(ctx->arena, span,
+                     hir_type_base_new(ctx->arena, NULL, HIR_TYPE_ULONG),
+                     (hir_lit_u){.v_ulong = uvalue});
+}
+
+static hir_lit *hir_parse_lit(hir_parse_ctx *ctx) {
+  scanner_token token = ctx->cur;
+  span         *span  = hir_parse_span(ctx, &token);
+  hir_parse_advance(ctx);
+
+  switch (token.kind) {
+    case SCANNER_TOKEN_STR:
+      return hir_lit_new(
+          ctx->arena, span,
+          hir_type_base_new(ctx->arena, span_copy_arena(ctx->arena, span),
+                            HIR_TYPE_STRING),
+          (hir_lit_u){.v_str = arena_strndup(ctx->arena, token.chars + 1,
+                                             token.len - 2)});
+    case SCANNER_TOKEN_CHAR:
+      return hir_lit_new(
+          ctx->arena, span,
+          hir_type_base_new(ctx->arena, span_copy_arena(ctx->arena, span),
+                            HIR_TYPE_CHAR),
+          (hir_lit_u){.v_char = arena_strndup(ctx->arena, token.chars + 1,
+                                             token.len - 2)});
+    case SCANNER_TOKEN_HEX:
+      return hir_parse_lit_number(ctx, span, token.chars + 2, token.len - 2,
+                                  16, EXCEPTION_HIR_HEX_VALIDATION);
+    case SCANNER_TOKEN_BITS:
+      return hir_parse_lit_number(ctx, span, token.chars + 2, token.len - 2, 2,
+                                  EXCEPTION_HIR_BITS_VALIDATION);
+    case SCANNER_TOKEN_DEC:
+      return hir_parse_lit_number(ctx, span, token.chars, token.len, 10,
+                                  EXCEPTION_HIR_DEC_VALIDATION);
+    default:
+      return hir_lit_new(ctx->arena, span,
+                         hir_type_base_new(ctx->arena, NULL, HIR_TYPE_BOOL),
+                         (hir_lit_u){.v_bool = token.chars[0] == 't'});
+  }
+}
+
+static hir_lit *hir_parse_lit_str(hir_parse_ctx *ctx) {
+  if (!hir_parse_is(ctx, SCANNER_TOKEN_STR)) {
+    hir_parse_error(ctx, scanner_token_kind_str(SCANNER_TOKEN_STR));
+    return NULL;
+  }
+  return hir_parse_lit(ctx);
+}
+
+// TYPES
+static hir_type_enum hir_parse_type_primitive(scanner_token_kind kind) {
+  switch (kind) {
+    case SCANNER_TOKEN_KW_BOOL:
+      return HIR_TYPE_BOOL;
+    case SCANNER_TOKEN_KW_BYTE:
+      return HIR_TYPE_BYTE;
+    case SCANNER_TOKEN_KW_INT:
+      return HIR_TYPE_INT;
+    case SCANNER_TOKEN_KW_UINT:
+      return HIR_TYPE_UINT;
+    case SCANNER_TOKEN_KW_LONG:
+      return HIR_TYPE_LONG;
+    case SCANNER_TOKEN_KW_ULONG:
+      return HIR_TYPE_ULONG;
+    case SCANNER_TOKEN_KW_CHAR:
+      return HIR_TYPE_CHAR;
+    case SCANNER_TOKEN_KW_STRING:
+      return HIR_TYPE_STRING;
+    case SCANNER_TOKEN_KW_VOID:
+      return HIR_TYPE_VOID;
+    case SCANNER_TOKEN_KW_ANY:
+      return HIR_TYPE_ANY;
+    default:
+      return 0;
+  }
+}
+
+static int hir_parse_is_type(const hir_parse_ctx *ctx) {
+  return hir_parse_type_primitive(ctx->cur.kind) ||
+         hir_parse_is(ctx, SCANNER_TOKEN_IDENTIFIER) ||
+         hir_parse_is(ctx, SCANNER_TOKEN_KW_ARRAY);
+}
+
+// '<' (type (',' type)*)? '>'
+static list_hir_type *hir_parse_type_template(hir_parse_ctx *ctx) {
+  list_hir_type *types = list_hir_type_new_arena(ctx->arena);
+  hir_parse_advance(ctx);
+
+  if (!hir_parse_is(ctx, SCANNER_TOKEN_GT)) {
+    do {
+      hir_type_base *type = hir_parse_type(ctx);
+      if (!type) {
+        return NULL;
+      }
+      list_hir_type_push_back(types, type);
+    } while (hir_parse_accept(ctx, SCANNER_TOKEN_COMMA));
+  }
+
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_GT)) {
+    return NULL;
+  }
+  return types;
+}
+
+static hir_type_base *hir_parse_type_custom(hir_parse_ctx *ctx) {
+  scanner_token  token     = ctx->cur;
+  list_hir_type *templates = NULL;
+  hir_parse_advance(ctx);
+
+  if (hir_parse_is(ctx, SCANNER_TOKEN_LT)) {
+    templates = hir_parse_type_template(ctx);
+    if (!templates) {
+      return NULL;
+    }
+  }
+  return (hir_type_base *)hir_type_custom_new(
+      ctx->arena, hir_parse_span(ctx, &token),
+      arena_strndup(ctx->arena, token.chars, token.len), templates);
+}
+
+// 'array' '[' ','* ']' 'of' type
+static hir_type_base *hir_parse_type_array(hir_parse_ctx *ctx) {
+  scanner_token token      = ctx->cur;
+  size_t        dimensions = 0;
+  hir_parse_advance(ctx);
+
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_LBRACKET)) {
+    return NULL;
+  }
+  while (hir_parse_accept(ctx, SCANNER_TOKEN_COMMA)) {
+    ++dimensions;
+  }
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_RBRACKET) ||
+      !hir_parse_expect(ctx, SCANNER_TOKEN_KW_OF)) {
+    return NULL;
+  }
+
+  hir_type_base *elem_type = hir_parse_type(ctx);
+  if (!elem_type) {
+    return NULL;
+  }
+
+  span *root   = hir_parse_span(ctx, &token);
+  span *span_m = hir_parse_span_range(ctx, root, elem_type->span);
+
+  hir_type_base *type_root = elem_type;
+  for (size_t i = 0; i < dimensions; ++i) {
+    type_root = (hir_type_base *)hir_type_array_new(
+        ctx->arena, span_copy_arena(ctx->arena, span_m), type_root);
+  }
+  return (hir_type_base *)hir_type_array_new(ctx->arena, span_m, type_root);
+}
+
+static hir_type_base *hir_parse_type(hir_parse_ctx *ctx) {
+  hir_type_enum primitive = hir_parse_type_primitive(ctx->cur.kind);
+  if (primitive) {
+    span *span = hir_parse_span(ctx, &ctx->cur);
+    hir_parse_advance(ctx);
+    return hir_type_base_new(ctx->arena, span, primitive);
+  } else if (hir_parse_is(ctx, SCANNER_TOKEN_IDENTIFIER)) {
+    return hir_parse_type_custom(ctx);
+  } else if (hir_parse_is(ctx, SCANNER_TOKEN_KW_ARRAY)) {
+    return hir_parse_type_array(ctx);
+  }
+  hir_parse_error(ctx, "type");
+  return NULL;
+}
+
+// VARIABLES & PARAMETERS
+// identifier (',' identifier)* (':' type)? ';', vars are appended to list
+static int hir_parse_var_entry(hir_parse_ctx *ctx, list_hir_var *vars) {
+  list_hir_id   *ids  = list_hir_id_new_arena(ctx->arena);
+  hir_type_base *type = NULL;
+
+  do {
+    hir_id *id = hir_parse_id(ctx);
+    if (!id) {
+      return 0;
+    }
+    list_hir_id_push_back(ids, id);
+  } while (hir_parse_accept(ctx, SCANNER_TOKEN_COMMA));
+
+  if (hir_parse_accept(ctx, SCANNER_TOKEN_COLON) &&
+      !(type = hir_parse_type(ctx))) {
+    return 0;
+  }
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_SEMICOLON)) {
+    return 0;
+  }
+
+  // last var takes type, others have copies
+  while (!list_hir_id_empty(ids)) {
+    hir_id        *id      = list_hir_id_pop_front(ids);
+    hir_type_base *id_type =
+        list_hir_id_empty(ids) ? type : hir_type_copy(ctx->arena, type);
+    list_hir_var_push_back(
+        vars,
+        hir_var_new(ctx->arena, span_copy_arena(ctx->arena, id->base.span), id,
+                    id_type));
+  }
+  return 1;
+}
+
+static list_hir_var *hir_parse_vars(hir_parse_ctx *ctx) {
+  list_hir_var *vars = list_hir_var_new_arena(ctx->arena);
+  while (hir_parse_is(ctx, SCANNER_TOKEN_IDENTIFIER)) {
+    if (!hir_parse_var_entry(ctx, vars)) {
+      return NULL;
+    }
+  }
+  return vars;
+}
+
+// (param (',' param)*)? where param is identifier (':' type)?
+static list_hir_param *hir_parse_params(hir_parse_ctx *ctx) {
+  list_hir_param *params = list_hir_param_new_arena(ctx->arena);
+  if (hir_parse_is(ctx, SCANNER_TOKEN_RPAREN)) {
+    return params;
+  }
+
+  do {
+    hir_id        *id   = hir_parse_id(ctx);
+    hir_type_base *type = NULL;
+    if (!id) {
+      return NULL;
+    }
+    if (hir_parse_accept(ctx, SCANNER_TOKEN_COLON) &&
+        !(type = hir_parse_type(ctx))) {
+      return NULL;
+    }
+
+    span *span = type ? hir_parse_span_range(ctx, id->base.span, type->span)
+                      : span_copy_arena(ctx->arena, id->base.span);
+    list_hir_param_push_back(params,
+                             hir_param_new(ctx->arena, span, id, type));
+  } while (hir_parse_accept(ctx, SCANNER_TOKEN_COMMA));
+
+  return params;
+}
+
+// FUNCTIONS
+// identifier '(' params ')' ':' type?, span starts from 'method' token
+static hir_subroutine *hir_parse_signature(hir_parse_ctx       *ctx,
+                                           const scanner_token *root) {
+  hir_id *id = hir_parse_id(ctx);
+  if (!id) {
+    return NULL;
+  }
+  list_hir_param *params = NULL;
+  hir_type_base  *type   = NULL;
+
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_LPAREN) ||
+      !(params = hir_parse_params(ctx)) ||
+      !hir_parse_expect(ctx, SCANNER_TOKEN_RPAREN) ||
+      !hir_parse_expect(ctx, SCANNER_TOKEN_COLON) ||
+      (hir_parse_is_type(ctx) && !(type = hir_parse_type(ctx)))) {
+    return NULL;
+  }
+
+  span *root_span = hir_parse_span(ctx, root);
+  span *span;
+  if (type) {
+    span = hir_parse_span_range(ctx, root_span, type->span);
+  } else if (list_hir_param_size(params) > 0) {
+    span = hir_parse_span_range(ctx, root_span,
+                                list_hir_param_back(params)->base.span);
+  } else {
+    span = hir_parse_span_range(ctx, root_span, id->base.span);
+  }
+
+  return hir_subroutine_new(ctx->arena, span, id, params, type,
+                            HIR_SUBROUTINE_SPEC_EMPTY, NULL);
+}
+
+// 'from' (entry=str 'in')? lib=str
+static hir_subroutine_body *hir_parse_func_import(hir_parse_ctx *ctx) {
+  hir_parse_advance(ctx);
+
+  hir_lit *entry = NULL;
+  hir_lit *lib   = hir_parse_lit_str(ctx);
+  if (!lib) {
+    return NULL;
+  }
+  if (hir_parse_accept(ctx, SCANNER_TOKEN_KW_IN)) {
+    entry = lib;
+    lib   = hir_parse_lit_str(ctx);
+    if (!lib) {
+      return NULL;
+    }
+  }
+  return hir_subroutine_body_new_import(ctx->arena, entry, lib);
+}
+
+// ('var' var_entry*)? block
+static hir_subroutine_body *hir_parse_func_block(hir_parse_ctx *ctx) {
+  list_hir_var *vars;
+  if (hir_parse_accept(ctx, SCANNER_TOKEN_KW_VAR)) {
+    vars = hir_parse_vars(ctx);
+    if (!vars) {
+      return NULL;
+    }
+  } else {
+    vars = list_hir_var_new_arena(ctx->arena);
+  }
+
+  hir_stmt_block *block = hir_parse_stmt_block(ctx);
+  if (!block) {
+    return NULL;
+  }
+  return hir_subroutine_body_new_block(ctx->arena, vars, block);
+}
+
+// (body | import) ';'? | ';', body is NULL for declarations
+static int hir_parse_func_body(hir_parse_ctx *ctx, hir_subroutine_body **body) {
+  *body = NULL;
+  if (hir_parse_accept(ctx, SCANNER_TOKEN_SEMICOLON)) {
+    return 1;
+  }
+
+  if (hir_parse_is(ctx, SCANNER_TOKEN_KW_FROM)) {
+    *body = hir_parse_func_import(ctx);
+  } else {
+    *body = hir_parse_func_block(ctx);
+  }
+  if (!*body) {
+    return 0;
+  }
+
+  hir_parse_accept(ctx, SCANNER_TOKEN_SEMICOLON);
+  return 1;
+}
+
+// 'extern'? 'method' signature body
+static hir_subroutine *hir_parse_func(hir_parse_ctx *ctx) {
+  span *span_extern = NULL;
+  if (hir_parse_is(ctx, SCANNER_TOKEN_KW_EXTERN)) {
+    span_extern = hir_parse_span(ctx, &ctx->cur);
+    hir_parse_advance(ctx);
+  }
+
+  scanner_token   root       = ctx->cur;
+  hir_subroutine *subroutine = NULL;
+
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_KW_METHOD) ||
+      !(subroutine = hir_parse_signature(ctx, &root)) ||
+      !hir_parse_func_body(ctx, &subroutine->body)) {
+    return NULL;
+  }
+
+  // include specifiers into subroutine span
+  if (span_extern) {
+    span *span = hir_parse_span_range(ctx, span_extern, subroutine->base.span);
+    subroutine->base.span  = span;
+    subroutine->spec      |= HIR_SUBROUTINE_SPEC_EXTERN;
+  }
+  return subroutine;
+}
+
+// CLASS
+// ('public' | 'private')? func, implicit this is added as first param
+static hir_method *hir_parse_method(hir_parse_ctx *ctx, const hir_id *class_id,
+                                    const list_hir_id *typenames_ref) {
+  hir_method_modifier_enum modifier = HIR_METHOD_MODIFIER_ENUM_EMPTY;
+  span                    *mod_span = NULL;
+
+  if (hir_parse_is(ctx, SCANNER_TOKEN_KW_PUBLIC) ||
+      hir_parse_is(ctx, SCANNER_TOKEN_KW_PRIVATE)) {
+    modifier = hir_parse_is(ctx, SCANNER_TOKEN_KW_PUBLIC)
+                   ? HIR_METHOD_MODIFIER_ENUM_PUBLIC
+                   : HIR_METHOD_MODIFIER_ENUM_PRIVATE;
+    mod_span = hir_parse_span(ctx, &ctx->cur);
+    hir_parse_advance(ctx);
+  }
+
+  hir_subroutine *func = hir_parse_func(ctx);
+  if (!func) {
+    return NULL;
+  }
+
+  list_hir_type *typenames = list_hir_type_new_arena(ctx->arena);
+  for (list_hir_id_it it = list_hir_id_begin(typenames_ref); !END(it);
+       NEXT(it)) {
+    list_hir_type_push_back(
+        typenames,
+        (hir_type_base *)hir_type_custom_new(
+            ctx->arena, NULL, arena_strdup(ctx->arena, GET(it)->name), NULL));
+  }
+  list_hir_param_push_front(
+      func->params,
+      hir_param_new(ctx->arena, NULL,
+                    hir_id_new(ctx->arena, NULL, intern("this")),
+                    (hir_type_base *)hir_type_custom_new(
+                        ctx->arena, NULL,
+                        arena_strdup(ctx->arena, class_id->name), typenames)));
+
+  span *span;
+  if (mod_span) {
+    span = hir_parse_span_range(ctx, mod_span, func->base.span);
+  } else {
+    span = span_copy_arena(ctx->arena, func->base.span);
+  }
+  return hir_method_new(ctx->arena, span, modifier, func);
+}
+
+// '<' (identifier (',' identifier)*)? '>'
+static int hir_parse_class_typenames(hir_parse_ctx *ctx,
+                                     list_hir_id   *typenames) {
+  hir_parse_advance(ctx);
+  if (!hir_parse_is(ctx, SCANNER_TOKEN_GT)) {
+    do {
+      hir_id *id = hir_parse_id(ctx);
+      if (!id) {
+        return 0;
+      }
+      list_hir_id_push_back(typenames, id);
+    } while (hir_parse_accept(ctx, SCANNER_TOKEN_COMMA));
+  }
+  return hir_parse_expect(ctx, SCANNER_TOKEN_GT);
+}
+
+// ':' type (',' type)*
+static int hir_parse_class_parents(hir_parse_ctx *ctx, list_hir_type *parents) {
+  hir_parse_advance(ctx);
+  do {
+    hir_type_base *type = hir_parse_type(ctx);
+    if (!type) {
+      return 0;
+    }
+    list_hir_type_push_back(parents, type);
+  } while (hir_parse_accept(ctx, SCANNER_TOKEN_COMMA));
+  return 1;
+}
+
+static int hir_parse_class_methods(hir_parse_ctx *ctx, const hir_id *id,
+                                   const list_hir_id *typenames,
+                                   list_hir_method   *methods) {
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_KW_BEGIN)) {
+    return 0;
+  }
+  while (!hir_parse_accept(ctx, SCANNER_TOKEN_KW_END)) {
+    hir_method *method = hir_parse_method(ctx, id, typenames);
+    if (!method) {
+      return 0;
+    }
+    list_hir_method_push_back(methods, method);
+  }
+  return 1;
+}
+
+// 'class' identifier typenames? parents? 'var' var_entry* 'begin' method*
+// 'end' ';'
+static hir_class *hir_parse_class(hir_parse_ctx *ctx) {
+  scanner_token root = ctx->cur;
+  hir_parse_advance(ctx);
+
+  hir_id          *id        = hir_parse_id(ctx);
+  list_hir_id     *typenames = list_hir_id_new_arena(ctx->arena);
+  list_hir_type   *parents   = list_hir_type_new_arena(ctx->arena);
+  list_hir_var    *fields    = NULL;
+  list_hir_method *methods   = list_hir_method_new_arena(ctx->arena);
+
+  if (!id ||
+      (hir_parse_is(ctx, SCANNER_TOKEN_LT) &&
+       !hir_parse_class_typenames(ctx, typenames)) ||
+      (hir_parse_is(ctx, SCANNER_TOKEN_COLON) &&
+       !hir_parse_class_parents(ctx, parents)) ||
+      !hir_parse_expect(ctx, SCANNER_TOKEN_KW_VAR) ||
+      !(fields = hir_parse_vars(ctx)) ||
+      !hir_parse_class_methods(ctx, id, typenames, methods) ||
+      !hir_parse_expect(ctx, SCANNER_TOKEN_SEMICOLON)) {
+    return NULL;
+  }
+
+  span *root_span = hir_parse_span(ctx, &root);
+  span *span;
+  if (list_hir_type_size(parents)) {
+    span = hir_parse_span_range(ctx, root_span,
+                                list_hir_type_back(parents)->span);
+  } else if (list_hir_id_size(typenames)) {
+    span = hir_parse_span_range(ctx, root_span,
+                                list_hir_id_back(typenames)->base.span);
+  } else {
+    span = hir_parse_span_range(ctx, root_span, id->base.span);
+  }
+
+  return hir_class_new(ctx->arena, span, id, typenames, parents, fields,
+                       methods);
+}
+
+// EXPRESSIONS
+// (expr (',' expr)*)? close, open token is already consumed
+static list_hir_expr *hir_parse_args(hir_parse_ctx     *ctx,
+                                     scanner_token_kind close) {
+  list_hir_expr *args = list_hir_expr_new_arena(ctx->arena);
+  if (!hir_parse_is(ctx, close)) {
+    do {
+      hir_expr_base *expr = hir_parse_expr(ctx);
+      if (!expr) {
+        return NULL;
+      }
+      list_hir_expr_push_back(args, expr);
+    } while (hir_parse_accept(ctx, SCANNER_TOKEN_COMMA));
+  }
+  if (!hir_parse_expect(ctx, close)) {
+    return NULL;
+  }
+  return args;
+}
+
+static hir_expr_builtin_enum hir_parse_builtin_kind(scanner_token_kind kind) {
+  switch (kind) {
+    case SCANNER_TOKEN_KW_CAST:
+      return HIR_EXPR_BUILTIN_CAST;
+    case SCANNER_TOKEN_KW_MAKE:
+      return HIR_EXPR_BUILTIN_MAKE;
+    case SCANNER_TOKEN_KW_PRINT:
+      return HIR_EXPR_BUILTIN_PRINT;
+    case SCANNER_TOKEN_KW_TYPE:
+      return HIR_EXPR_BUILTIN_TYPE;
+    default:
+      return 0;
+  }
+}
+
+// ('cast!' | 'make!') '<' type '>' '(' args ')' | ('print!' | 'type!') '('
+// args ')'
+static hir_expr_base *hir_parse_expr_builtin(hir_parse_ctx *ctx) {
+  scanner_token         root = ctx->cur;
+  hir_expr_builtin_enum kind = hir_parse_builtin_kind(root.kind);
+  hir_parse_advance(ctx);
+
+  hir_type_base *type = NULL;
+  list_hir_expr *args = NULL;
+  if ((kind == HIR_EXPR_BUILTIN_CAST || kind == HIR_EXPR_BUILTIN_MAKE) &&
+      (!hir_parse_expect(ctx, SCANNER_TOKEN_LT) ||
+       !(type = hir_parse_type(ctx)) ||
+       !hir_parse_expect(ctx, SCANNER_TOKEN_GT))) {
+    return NULL;
+  }
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_LPAREN) ||
+      !(args = hir_parse_args(ctx, SCANNER_TOKEN_RPAREN))) {
+    return NULL;
+  }
+
+  span *node_span = hir_parse_span(ctx, &root);
+  span *span;
+  if (list_hir_expr_size(args)) {
+    span = hir_parse_span_range(ctx, node_span,
+                                list_hir_expr_back(args)->base.span);
+  } else if (type) {
+    span = hir_parse_span_range(ctx, node_span, type->span);
+  } else {
+    span = node_span;
+  }
+  return (hir_expr_base *)hir_expr_builtin_new(ctx->arena, span, type, kind,
+                                               args);
+}
+
+static hir_expr_base *hir_parse_expr_primary(hir_parse_ctx *ctx) {
+  if (hir_parse_accept(ctx, SCANNER_TOKEN_LPAREN)) {
+    hir_expr_base *expr = hir_parse_expr(ctx);
+    if (!expr || !hir_parse_expect(ctx, SCANNER_TOKEN_RPAREN)) {
+      return NULL;
+    }
+    return expr;
+  } else if (hir_parse_is(ctx, SCANNER_TOKEN_IDENTIFIER)) {
+    hir_id *id = hir_parse_id(ctx);
+    return (hir_expr_base *)hir_expr_id_new(
+        ctx->arena, span_copy_arena(ctx->arena, id->base.span), NULL, id);
+  } else if (hir_parse_builtin_kind(ctx->cur.kind)) {
+    return hir_parse_expr_builtin(ctx);
+  }
+  hir_parse_error(ctx, "expression");
+  return NULL;
+}
+
+// convert id to literal because it is not actually a symbol
+static hir_expr_base *hir_parse_expr_member(hir_parse_ctx *ctx,
+                                            hir_expr_base *first) {
+  scanner_token token = ctx->cur;
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_IDENTIFIER)) {
+    return NULL;
+  }
+  span *id_span   = hir_parse_span(ctx, &token);
+  span *expr_span = hir_parse_span_range(ctx, first->base.span, id_span);
+
+  hir_lit *lit = hir_lit_new(
+      ctx->arena, id_span, hir_type_base_new(ctx->arena, NULL, HIR_TYPE_STRING),
+      (hir_lit_u){.v_str = arena_strndup(ctx->arena, token.chars, token.len)});
+  return (hir_expr_base *)hir_expr_binary_new(
+      ctx->arena, expr_span, NULL, HIR_EXPR_BINARY_MEMBER, first,
+      (hir_expr_base *)hir_expr_lit_new(ctx->arena, NULL, NULL, lit));
+}
+
+// primary ('(' args ')' | '[' args ']' | '.' identifier)* | literal
+static hir_expr_base *hir_parse_expr_postfix(hir_parse_ctx *ctx) {
+  switch (ctx->cur.kind) {
+    case SCANNER_TOKEN_BOOL:
+    case SCANNER_TOKEN_STR:
+    case SCANNER_TOKEN_CHAR:
+    case SCANNER_TOKEN_HEX:
+    case SCANNER_TOKEN_BITS:
+    case SCANNER_TOKEN_DEC: {
+      hir_lit *lit = hir_parse_lit(ctx);
+      if (!lit) {
+        return NULL;
+      }
+      return (hir_expr_base *)hir_expr_lit_new(
+          ctx->arena, span_copy_arena(ctx->arena, lit->base.span), NULL, lit);
+    }
+    default:
+      break;
+  }
+
+  hir_expr_base *first = hir_parse_expr_primary(ctx);
+  while (first) {
+    scanner_token_kind kind = ctx->cur.kind;
+    if (kind == SCANNER_TOKEN_DOT) {
+      hir_parse_advance(ctx);
+      first = hir_parse_expr_member(ctx, first);
+    } else if (kind == SCANNER_TOKEN_LPAREN || kind == SCANNER_TOKEN_LBRACKET) {
+      hir_parse_advance(ctx);
+      list_hir_expr *args = hir_parse_args(
+          ctx, kind == SCANNER_TOKEN_LPAREN ? SCANNER_TOKEN_RPAREN
+                                            : SCANNER_TOKEN_RBRACKET);
+      if (!args) {
+        return NULL;
+      }
+
+      span *span;
+      if (list_hir_expr_size(args) > 0) {
+        span = hir_parse_span_range(ctx, first->base.span,
+                                    list_hir_expr_back(args)->base.span);
+      } else {
+        span = span_copy_arena(ctx->arena, first->base.span);
+      }
+      if (kind == SCANNER_TOKEN_LPAREN) {
+        first = (hir_expr_base *)hir_expr_call_new(ctx->arena, span, NULL,
+                                                   first, args);
+      } else {
+        first = (hir_expr_base *)hir_expr_index_new(ctx->arena, span, NULL,
+                                                    first, args);
+      }
+    } else {
+      break;
+    }
+  }
+  return first;
+}
+
+static hir_expr_unary_enum hir_parse_unary_op(scanner_token_kind kind) {
+  switch (kind) {
+    case SCANNER_TOKEN_DEC_OP:
+      return HIR_EXPR_UNARY_DEC;
+    case SCANNER_TOKEN_INC_OP:
+      return HIR_EXPR_UNARY_INC;
+    case SCANNER_TOKEN_NOT:
+      return HIR_EXPR_UNARY_LOGICAL_NOT;
+    case SCANNER_TOKEN_BIT_NOT:
+      return HIR_EXPR_UNARY_BITWISE_NOT;
+    case SCANNER_TOKEN_PLUS:
+      return HIR_EXPR_UNARY_PLUS;
+    case SCANNER_TOKEN_MINUS:
+      return HIR_EXPR_UNARY_MINUS;
+    default:
+      return 0;
+  }
+}
+
+static hir_expr_base *hir_parse_expr_unary(hir_parse_ctx *ctx) {
+  hir_expr_unary_enum op = hir_parse_unary_op(ctx->cur.kind);
+  if (!op) {
+    return hir_parse_expr_postfix(ctx);
+  }
+
+  scanner_token token = ctx->cur;
+  hir_parse_advance(ctx);
+  hir_expr_base *first = hir_parse_expr_unary(ctx);
+  if (!first) {
+    return NULL;
+  }
+
+  span *op_span = hir_parse_span(ctx, &token);
+  span *span;
+  if (op_span->line_start < first->base.span->line_start) {
+    span = hir_parse_span_range(ctx, op_span, first->base.span);
+  } else {
+    span = hir_parse_span_range(ctx, first->base.span, op_span);
+  }
+  return (hir_expr_base *)hir_expr_unary_new(ctx->arena, span, NULL, op, first);
+}
+
+// returns precedence of binary operator at current token or 0 if it isn't
+// binary. Shifts are two tokens ('<' '<' and '>' '>') as in grammar
+static int hir_parse_binary_op(const hir_parse_ctx *ctx,
+                               hir_expr_binary_enum *op, size_t *tokens) {
+  *tokens = 1;
+  switch (ctx->cur.kind) {
+    case SCANNER_TOKEN_ASSIGN:
+      *op = HIR_EXPR_BINARY_ASSIGN;
+      return 1;
+    case SCANNER_TOKEN_OR:
+      *op = HIR_EXPR_BINARY_LOGICAL_OR;
+      return 2;
+    case SCANNER_TOKEN_AND:
+      *op = HIR_EXPR_BINARY_LOGICAL_AND;
+      return 3;
+    case SCANNER_TOKEN_BIT_OR:
+      *op = HIR_EXPR_BINARY_BITWISE_OR;
+      return 4;
+    case SCANNER_TOKEN_BIT_XOR:
+      *op = HIR_EXPR_BINARY_BITWISE_XOR;
+      return 5;
+    case SCANNER_TOKEN_BIT_AND:
+      *op = HIR_EXPR_BINARY_BITWISE_AND;
+      return 6;
+    case SCANNER_TOKEN_EQ:
+      *op = HIR_EXPR_BINARY_EQUALS;
+      return 7;
+    case SCANNER_TOKEN_NE:
+      *op = HIR_EXPR_BINARY_NOT_EQUALS;
+      return 7;
+    case SCANNER_TOKEN_LT:
+      if (ctx->next.kind == SCANNER_TOKEN_LT) {
+        *op     = HIR_EXPR_BINARY_BITWISE_SHIFT_LEFT;
+        *tokens = 2;
+        return 9;
+      }
+      *op = HIR_EXPR_BINARY_LESS;
+      return 8;
+    case SCANNER_TOKEN_LE:
+      *op = HIR_EXPR_BINARY_LESS_EQUALS;
+      return 8;
+    case SCANNER_TOKEN_GT:
+      if (ctx->next.kind == SCANNER_TOKEN_GT) {
+        *op     = HIR_EXPR_BINARY_BITWISE_SHIFT_RIGHT;
+        *tokens = 2;
+        return 9;
+      }
+      *op = HIR_EXPR_BINARY_GREATER;
+      return 8;
+    case SCANNER_TOKEN_GE:
+      *op = HIR_EXPR_BINARY_GREATER_EQUALS;
+      return 8;
+    case SCANNER_TOKEN_PLUS:
+      *op = HIR_EXPR_BINARY_ADD;
+      return 10;
+    case SCANNER_TOKEN_MINUS:
+      *op = HIR_EXPR_BINARY_SUB;
+      return 10;
+    case SCANNER_TOKEN_MUL:
+      *op = HIR_EXPR_BINARY_MUL;
+      return 11;
+    case SCANNER_TOKEN_DIV:
+      *op = HIR_EXPR_BINARY_DIV;
+      return 11;
+    case SCANNER_TOKEN_REM:
+      *op = HIR_EXPR_BINARY_REM;
+      return 11;
+    default:
+      return 0;
+  }
+}
+
+// operators are left associative, except assignment
+static hir_expr_base *hir_parse_expr_binary(hir_parse_ctx *ctx, int min_prec) {
+  hir_expr_base *first = hir_parse_expr_unary(ctx);
+
+  while (first) {
+    hir_expr_binary_enum op;
+    size_t               tokens;
+    int                  prec = hir_parse_binary_op(ctx, &op, &tokens);
+    if (!prec || prec < min_prec) {
+      break;
+    }
+    for (size_t i = 0; i < tokens; ++i) {
+      hir_parse_advance(ctx);
+    }
+
+    hir_expr_base *second = hir_parse_expr_binary(
+        ctx, op == HIR_EXPR_BINARY_ASSIGN ? prec : prec + 1);
+    if (!second) {
+      return NULL;
+    }
+    first = (hir_expr_base *)hir_expr_binary_new(
+        ctx->arena,
+        hir_parse_span_range(ctx, first->base.span, second->base.span), NULL,
+        op, first, second);
+  }
+  return first;
+}
+
+static hir_expr_base *hir_parse_expr(hir_parse_ctx *ctx) {
+  return hir_parse_expr_binary(ctx, 1);
+}
+
+// STATEMENTS
+// 'if' expr 'then' stmt ('else' stmt)?
+static hir_stmt_base *hir_parse_stmt_if(hir_parse_ctx *ctx) {
+  scanner_token root = ctx->cur;
+  hir_parse_advance(ctx);
+
+  hir_expr_base *cond = hir_parse_expr(ctx);
+  hir_stmt_base *je   = NULL;
+  hir_stmt_base *jz   = NULL;
+  if (!cond || !hir_parse_expect(ctx, SCANNER_TOKEN_KW_THEN) ||
+      !(je = hir_parse_stmt(ctx)) ||
+      (hir_parse_accept(ctx, SCANNER_TOKEN_KW_ELSE) &&
+       !(jz = hir_parse_stmt(ctx)))) {
+    return NULL;
+  }
+
+  span *node_span = hir_parse_span(ctx, &root);
+  span *span =
+      hir_parse_span_range(ctx, node_span, jz ? jz->base.span : je->base.span);
+  return (hir_stmt_base *)hir_stmt_if_new(ctx->arena, span, cond, je, jz);
+}
+
+// 'begin' stmt* 'end'
+static hir_stmt_block *hir_parse_stmt_block(hir_parse_ctx *ctx) {
+  scanner_token root = ctx->cur;
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_KW_BEGIN)) {
+    return NULL;
+  }
+
+  list_hir_stmt *stmts = list_hir_stmt_new_arena(ctx->arena);
+  while (!hir_parse_accept(ctx, SCANNER_TOKEN_KW_END)) {
+    hir_stmt_base *stmt = hir_parse_stmt(ctx);
+    if (!stmt) {
+      return NULL;
+    }
+    list_hir_stmt_push_back(stmts, stmt);
+  }
+
+  span *node_span = hir_parse_span(ctx, &root);
+  span *span;
+  if (list_hir_stmt_size(stmts) > 0) {
+    span = hir_parse_span_range(ctx, node_span,
+                                list_hir_stmt_back(stmts)->base.span);
+  } else {
+    span = node_span;
+  }
+  return hir_stmt_block_new(ctx->arena, span, stmts);
+}
+
+// 'while' expr 'do' stmt
+static hir_stmt_base *hir_parse_stmt_while(hir_parse_ctx *ctx) {
+  scanner_token root = ctx->cur;
+  hir_parse_advance(ctx);
+
+  hir_expr_base *cond = hir_parse_expr(ctx);
+  hir_stmt_base *stmt = NULL;
+  if (!cond || !hir_parse_expect(ctx, SCANNER_TOKEN_KW_DO) ||
+      !(stmt = hir_parse_stmt(ctx))) {
+    return NULL;
+  }
+
+  span *node_span = hir_parse_span(ctx, &root);
+  span *span      = hir_parse_span_range(ctx, node_span, stmt->base.span);
+  return (hir_stmt_base *)hir_stmt_while_new(ctx->arena, span, cond, stmt);
+}
+
+// 'repeat' stmt ('while' | 'until') expr ';', span starts from condition
+static hir_stmt_base *hir_parse_stmt_do(hir_parse_ctx *ctx) {
+  hir_parse_advance(ctx);
+
+  hir_stmt_base *stmt = hir_parse_stmt(ctx);
+  if (!stmt) {
+    return NULL;
+  }
+
+  scanner_token root = ctx->cur;
+  if (!hir_parse_accept(ctx, SCANNER_TOKEN_KW_WHILE) &&
+      !hir_parse_accept(ctx, SCANNER_TOKEN_KW_UNTIL)) {
+    hir_parse_error(ctx, "'while' or 'until'");
+    return NULL;
+  }
+
+  hir_expr_base *cond = hir_parse_expr(ctx);
+  if (!cond || !hir_parse_expect(ctx, SCANNER_TOKEN_SEMICOLON)) {
+    return NULL;
+  }
+
+  span *node_span = hir_parse_span(ctx, &root);
+  span *span      = hir_parse_span_range(ctx, node_span, cond->base.span);
+  return (hir_stmt_base *)hir_stmt_do_new(
+      ctx->arena, span, root.kind == SCANNER_TOKEN_KW_WHILE, cond, stmt);
+}
+
+// 'break' ';'
+static hir_stmt_base *hir_parse_stmt_break(hir_parse_ctx *ctx) {
+  span *span = hir_parse_span(ctx, &ctx->cur);
+  hir_parse_advance(ctx);
+  if (!hir_parse_expect(ctx, SCANNER_TOKEN_SEMICOLON)) {
+    return NULL;
+  }
+  return (hir_stmt_base *)hir_stmt_break_new(ctx->arena, span);
+}
+
+// 'return' expr ';'
+static hir_stmt_base *hir_parse_stmt_return(hir_parse_ctx *ctx) {
+  scanner_token root = ctx->cur;
+  hir_parse_advance(ctx);
+
+  hir_expr_base *expr = hir_parse_expr(ctx);
+  if (!expr || !hir_parse_expect(ctx, SCANNER_TOKEN_SEMICOLON)) {
+    return NULL;
+  }
+
+  span *node_span = hir_parse_span(ctx, &root);
+  span *span      = hir_parse_span_range(ctx, node_span, expr->base.span);
+  return (hir_stmt_base *)hir_stmt_return_new(ctx->arena, span, expr);
+}
+
+// expr ';'
+static hir_stmt_base *hir_parse_stmt_expr(hir_parse_ctx *ctx) {
+  hir_expr_base *expr = hir_parse_expr(ctx);
+  if (!expr || !hir_parse_expect(ctx, SCANNER_TOKEN_SEMICOLON)) {
+    return NULL;
+  }
+  return (hir_stmt_base *)hir_stmt_expr_new(
+      ctx->arena, span_copy_arena(ctx->arena, expr->base.span), expr);
+}
+
+static hir_stmt_base *hir_parse_stmt(hir_parse_ctx *ctx) {
+  switch (ctx->cur.kind) {
+    case SCANNER_TOKEN_KW_IF:
+      return hir_parse_stmt_if(ctx);
+    case SCANNER_TOKEN_KW_BEGIN:
+      return (hir_stmt_base *)hir_parse_stmt_block(ctx);
+    case SCANNER_TOKEN_KW_WHILE:
+      return hir_parse_stmt_while(ctx);
+    case SCANNER_TOKEN_KW_REPEAT:
+      return hir_parse_stmt_do(ctx);
+    case SCANNER_TOKEN_KW_BREAK:
+      return hir_parse_stmt_break(ctx);
+    case SCANNER_TOKEN_KW_RETURN:
+      return hir_parse_stmt_return(ctx);
+    default:
+      return hir_parse_stmt_expr(ctx);
+  }
+}
+
+// SOURCE
+static int hir_parse_is_item(const hir_parse_ctx *ctx) {
+  return ctx->cur.pos == 0 && (hir_parse_is(ctx, SCANNER_TOKEN_KW_CLASS) ||
+                               hir_parse_is(ctx, SCANNER_TOKEN_KW_EXTERN) ||
+                               hir_parse_is(ctx, SCANNER_TOKEN_KW_METHOD));
+}
+
+// skips tokens to the next class or method at line start, item that failed
+// on its first token is skipped too
+static void hir_parse_recover(hir_parse_ctx *ctx, const char *item_start) {
+  if (ctx->cur.chars != item_start && hir_parse_is_item(ctx)) {
+    return;
+  }
+  do {
+    hir_parse_advance(ctx);
+  } while (!hir_parse_is(ctx, SCANNER_TOKEN_EOF) && !hir_parse_is_item(ctx));
+}
+
+hir_parse_result hir_parse(const char *name_ref, const char *source,
+                           size_t len) {
+  hir_parse_result result = {
+      .hir        = hir_new(),
+      .exceptions = list_exception_new(),
+  };
+
+  hir_parse_ctx ctx = {
+      .name_ref   = name_ref,
+      .exceptions = result.exceptions,
+      .arena      = result.hir->arena,
+  };
+  scanner_init(&ctx.scanner, name_ref, source, len, result.exceptions);
+  ctx.next = scanner_next(&ctx.scanner);
+  hir_parse_advance(&ctx);
+
+  while (!hir_parse_is(&ctx, SCANNER_TOKEN_EOF)) {
+    const char *item_start = ctx.cur.chars;
+
+    if (hir_parse_is(&ctx, SCANNER_TOKEN_KW_CLASS)) {
+      hir_class *class = hir_parse_class(&ctx);
+      if (class) {
+        list_hir_class_push_back(result.hir->classes, class);
+        continue;
+      }
+    } else {
+      hir_subroutine *func = hir_parse_func(&ctx);
+      if (func) {
+        list_hir_subroutine_push_back(result.hir->subroutines, func);
+        continue;
+      }
+    }
+    hir_parse_recover(&ctx, item_start);
+  }
+
+  return result;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/hir/hir.h"
+
+typedef struct hir_parse_result_struct {
+  hir            *hir;
+  list_exception *exceptions; // lexer, parser and literal errors
+} hir_parse_result;
+
+// hand-written recursive descent (and precedence climbing for expressions)
+// parser of antlr3/rec/Main.g3 grammar. It builds hir straight from tokens
+// without antlr tree, spans of nodes are the same as built by hir_lower_ast.
+// After syntax error parser skips to the next class or method at line start
+hir_parse_result hir_parse(const char *name_ref, const char *source,
+                           size_t len);
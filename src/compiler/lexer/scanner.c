@@ -0,0 +1,456 @@
+#include "scanner.h"
+
+#include "compiler/exception/exception.h"
+#include <string.h>
+
+typedef struct scanner_keyword_struct {
+  const char        *chars;
+  scanner_token_kind kind;
+} scanner_keyword;
+
+static const scanner_keyword scanner_keywords[] = {
+    {"true", SCANNER_TOKEN_BOOL},
+    {"false", SCANNER_TOKEN_BOOL},
+    {"bool", SCANNER_TOKEN_KW_BOOL},
+    {"byte", SCANNER_TOKEN_KW_BYTE},
+    {"int", SCANNER_TOKEN_KW_INT},
+    {"uint", SCANNER_TOKEN_KW_UINT},
+    {"long", SCANNER_TOKEN_KW_LONG},
+    {"ulong", SCANNER_TOKEN_KW_ULONG},
+    {"char", SCANNER_TOKEN_KW_CHAR},
+    {"string", SCANNER_TOKEN_KW_STRING},
+    {"void", SCANNER_TOKEN_KW_VOID},
+    {"any", SCANNER_TOKEN_KW_ANY},
+    {"array", SCANNER_TOKEN_KW_ARRAY},
+    {"of", SCANNER_TOKEN_KW_OF},
+    {"extern", SCANNER_TOKEN_KW_EXTERN},
+    {"method", SCANNER_TOKEN_KW_METHOD},
+    {"from", SCANNER_TOKEN_KW_FROM},
+    {"in", SCANNER_TOKEN_KW_IN},
+    {"class", SCANNER_TOKEN_KW_CLASS},
+    {"var", SCANNER_TOKEN_KW_VAR},
+    {"begin", SCANNER_TOKEN_KW_BEGIN},
+    {"end", SCANNER_TOKEN_KW_END},
+    {"public", SCANNER_TOKEN_KW_PUBLIC},
+    {"private", SCANNER_TOKEN_KW_PRIVATE},
+    {"if", SCANNER_TOKEN_KW_IF},
+    {"then", SCANNER_TOKEN_KW_THEN},
+    {"else", SCANNER_TOKEN_KW_ELSE},
+    {"while", SCANNER_TOKEN_KW_WHILE},
+    {"do", SCANNER_TOKEN_KW_DO},
+    {"repeat", SCANNER_TOKEN_KW_REPEAT},
+    {"until", SCANNER_TOKEN_KW_UNTIL},
+    {"break", SCANNER_TOKEN_KW_BREAK},
+    {"return", SCANNER_TOKEN_KW_RETURN},
+};
+
+// builtins are keywords only with '!' suffix, without it they are identifiers
+static const scanner_keyword scanner_builtins[] = {
+    {"cast", SCANNER_TOKEN_KW_CAST},
+    {"make", SCANNER_TOKEN_KW_MAKE},
+    {"print", SCANNER_TOKEN_KW_PRINT},
+    {"type", SCANNER_TOKEN_KW_TYPE},
+};
+
+void scanner_init(scanner *self, const char *name_ref, const char *source,
+                  size_t len, list_exception *exceptions_ref) {
+  self->name_ref       = name_ref;
+  self->cur            = source;
+  self->end            = source + len;
+  self->line           = 1;
+  self->pos            = 0;
+  self->exceptions_ref = exceptions_ref;
+}
+
+static int scanner_peek(const scanner *self, size_t offset) {
+  if (self->cur + offset >= self->end) {
+    return -1;
+  }
+  return (unsigned char)self->cur[offset];
+}
+
+// positions are counted in characters, utf-8 continuation bytes are skipped
+static void scanner_advance(scanner *self) {
+  unsigned char c = *self->cur++;
+  if (c == '\n') {
+    ++self->line;
+    self->pos = 0;
+  } else if ((c & 0xC0) != 0x80) {
+    ++self->pos;
+  }
+}
+
+static void scanner_advance_n(scanner *self, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    scanner_advance(self);
+  }
+}
+
+static void scanner_error(scanner *self, size_t line, size_t pos) {
+  list_exception_push_back(
+      self->exceptions_ref,
+      exception_new_f(EXCEPTION_LEVEL_ERROR, EXCEPTION_LEXER,
+                      EXCEPTION_LEXER_MATCHING, self->name_ref, self->line,
+                      self->pos, "no viable alternative",
+                      "error matching from [Line: %zu, LinePos: %zu]", line,
+                      pos));
+}
+
+static int scanner_is_alpha(int c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+static int scanner_is_digit(int c) { return c >= '0' && c <= '9'; }
+
+static int scanner_is_hex(int c) {
+  return scanner_is_digit(c) || (c >= 'a' && c <= 'f') ||
+         (c >= 'A' && c <= 'F');
+}
+
+static int scanner_is_bit(int c) { return c == '0' || c == '1'; }
+
+// returns 0 if comment isn't terminated
+static int scanner_skip_hidden(scanner *self) {
+  for (;;) {
+    int c = scanner_peek(self, 0);
+    if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+      scanner_advance(self);
+    } else if (c == '/' && scanner_peek(self, 1) == '/') {
+      while (self->cur < self->end && *self->cur != '\n') {
+        scanner_advance(self);
+      }
+    } else if (c == '/' && scanner_peek(self, 1) == '*') {
+      size_t line = self->line;
+      size_t pos  = self->pos;
+      scanner_advance_n(self, 2);
+      while (self->cur < self->end &&
+             !(scanner_peek(self, 0) == '*' && scanner_peek(self, 1) == '/')) {
+        scanner_advance(self);
+      }
+      if (self->cur >= self->end) {
+        scanner_error(self, line, pos);
+        return 0;
+      }
+      scanner_advance_n(self, 2);
+    } else {
+      return 1;
+    }
+  }
+}
+
+static scanner_token_kind scanner_word_kind(const char *chars, size_t len) {
+  for (size_t i = 0; i < sizeof(scanner_keywords) / sizeof(*scanner_keywords);
+       ++i) {
+    if (strlen(scanner_keywords[i].chars) == len &&
+        !strncmp(scanner_keywords[i].chars, chars, len)) {
+      return scanner_keywords[i].kind;
+    }
+  }
+  return SCANNER_TOKEN_IDENTIFIER;
+}
+
+static scanner_token_kind scanner_builtin_kind(const char *chars, size_t len) {
+  for (size_t i = 0; i < sizeof(scanner_builtins) / sizeof(*scanner_builtins);
+       ++i) {
+    if (strlen(scanner_builtins[i].chars) == len &&
+        !strncmp(scanner_builtins[i].chars, chars, len)) {
+      return scanner_builtins[i].kind;
+    }
+  }
+  return SCANNER_TOKEN_EOF;
+}
+
+// returns length of quoted literal including quotes or 0 if not terminated
+static size_t scanner_quoted_len(const scanner *self, char quote) {
+  size_t len = 1;
+  for (;;) {
+    int c = scanner_peek(self, len);
+    if (c < 0) {
+      return 0;
+    } else if (c == '\\') {
+      if (scanner_peek(self, len + 1) < 0) {
+        return 0;
+      }
+      len += 2;
+    } else if (c == quote) {
+      return len + 1;
+    } else {
+      ++len;
+    }
+  }
+}
+
+// returns kind and length of punctuation at current position, EOF if none
+static scanner_token_kind scanner_punct_kind(const scanner *self,
+                                             size_t        *len) {
+  int c  = scanner_peek(self, 0);
+  int c1 = scanner_peek(self, 1);
+  *len   = 2;
+  switch (c) {
+    case '=':
+      if (c1 == '=') {
+        return SCANNER_TOKEN_EQ;
+      }
+      break;
+    case '!':
+      if (c1 == '=') {
+        return SCANNER_TOKEN_NE;
+      }
+      break;
+    case '<':
+      if (c1 == '=') {
+        return SCANNER_TOKEN_LE;
+      }
+      break;
+    case '>':
+      if (c1 == '=') {
+        return SCANNER_TOKEN_GE;
+      }
+      break;
+    case '|':
+      if (c1 == '|') {
+        return SCANNER_TOKEN_OR;
+      }
+      break;
+    case '&':
+      if (c1 == '&') {
+        return SCANNER_TOKEN_AND;
+      }
+      break;
+    case '-':
+      if (c1 == '-') {
+        return SCANNER_TOKEN_DEC_OP;
+      }
+      break;
+    case '+':
+      if (c1 == '+') {
+        return SCANNER_TOKEN_INC_OP;
+      }
+      break;
+  }
+
+  *len = 1;
+  switch (c) {
+    case '(':
+      return SCANNER_TOKEN_LPAREN;
+    case ')':
+      return SCANNER_TOKEN_RPAREN;
+    case '[':
+      return SCANNER_TOKEN_LBRACKET;
+    case ']':
+      return SCANNER_TOKEN_RBRACKET;
+    case ',':
+      return SCANNER_TOKEN_COMMA;
+    case ':':
+      return SCANNER_TOKEN_COLON;
+    case ';':
+      return SCANNER_TOKEN_SEMICOLON;
+    case '.':
+      return SCANNER_TOKEN_DOT;
+    case '=':
+      return SCANNER_TOKEN_ASSIGN;
+    case '|':
+      return SCANNER_TOKEN_BIT_OR;
+    case '^':
+      return SCANNER_TOKEN_BIT_XOR;
+    case '&':
+      return SCANNER_TOKEN_BIT_AND;
+    case '<':
+      return SCANNER_TOKEN_LT;
+    case '>':
+      return SCANNER_TOKEN_GT;
+    case '+':
+      return SCANNER_TOKEN_PLUS;
+    case '-':
+      return SCANNER_TOKEN_MINUS;
+    case '*':
+      return SCANNER_TOKEN_MUL;
+    case '/':
+      return SCANNER_TOKEN_DIV;
+    case '%':
+      return SCANNER_TOKEN_REM;
+    case '!':
+      return SCANNER_TOKEN_NOT;
+    case '~':
+      return SCANNER_TOKEN_BIT_NOT;
+  }
+  *len = 0;
+  return SCANNER_TOKEN_EOF;
+}
+
+// matches token at current position, returns 0 if nothing is matched
+static int scanner_match(scanner *self, scanner_token *token) {
+  int    c   = scanner_peek(self, 0);
+  size_t len = 0;
+
+  if (scanner_is_alpha(c)) {
+    while (scanner_is_alpha(scanner_peek(self, len)) ||
+           scanner_is_digit(scanner_peek(self, len))) {
+      ++len;
+    }
+    token->kind = scanner_word_kind(self->cur, len);
+    if (token->kind == SCANNER_TOKEN_IDENTIFIER &&
+        scanner_peek(self, len) == '!') {
+      scanner_token_kind kind = scanner_builtin_kind(self->cur, len);
+      if (kind != SCANNER_TOKEN_EOF) {
+        token->kind = kind;
+        ++len;
+      }
+    }
+  } else if (c == '0' && (scanner_peek(self, 1) | 0x20) == 'b' &&
+             scanner_is_bit(scanner_peek(self, 2))) {
+    for (len = 2; scanner_is_bit(scanner_peek(self, len)); ++len) {
+    }
+    token->kind = SCANNER_TOKEN_BITS;
+  } else if (c == '0' && (scanner_peek(self, 1) | 0x20) == 'x' &&
+             scanner_is_hex(scanner_peek(self, 2))) {
+    for (len = 2; scanner_is_hex(scanner_peek(self, len)); ++len) {
+    }
+    token->kind = SCANNER_TOKEN_HEX;
+  } else if (scanner_is_digit(c)) {
+    while (scanner_is_digit(scanner_peek(self, len))) {
+      ++len;
+    }
+    token->kind = SCANNER_TOKEN_DEC;
+  } else if (c == '"') {
+    len         = scanner_quoted_len(self, '"');
+    token->kind = SCANNER_TOKEN_STR;
+  } else if (c == '\'') {
+    len = scanner_quoted_len(self, '\'');
+    // exactly one (maybe escaped) character between quotes
+    if (len != 3 && !(len == 4 && scanner_peek(self, 1) == '\\')) {
+      len = 0;
+    }
+    token->kind = SCANNER_TOKEN_CHAR;
+  } else {
+    token->kind = scanner_punct_kind(self, &len);
+  }
+
+  token->chars = self->cur;
+  token->len   = len;
+  token->line  = self->line;
+  token->pos   = self->pos;
+  scanner_advance_n(self, len);
+  return len > 0;
+}
+
+scanner_token scanner_next(scanner *self) {
+  scanner_token token;
+  for (;;) {
+    if (!scanner_skip_hidden(self) || self->cur >= self->end) {
+      token = (scanner_token){
+          .kind  = SCANNER_TOKEN_EOF,
+          .chars = self->end,
+          .len   = 0,
+          .line  = self->line,
+          .pos   = self->pos,
+      };
+      return token;
+    }
+    if (scanner_match(self, &token)) {
+      return token;
+    }
+    // skip one character the same way as antlr does
+    scanner_error(self, self->line, self->pos);
+    scanner_advance(self);
+    while (self->cur < self->end && (*self->cur & 0xC0) == 0x80) {
+      scanner_advance(self);
+    }
+  }
+}
+
+const char *scanner_token_kind_str(scanner_token_kind kind) {
+  switch (kind) {
+    case SCANNER_TOKEN_EOF:
+      return "<EOF>";
+    case SCANNER_TOKEN_IDENTIFIER:
+      return "identifier";
+    case SCANNER_TOKEN_BOOL:
+      return "bool";
+    case SCANNER_TOKEN_BITS:
+      return "bits";
+    case SCANNER_TOKEN_HEX:
+      return "hex";
+    case SCANNER_TOKEN_DEC:
+      return "dec";
+    case SCANNER_TOKEN_CHAR:
+      return "char";
+    case SCANNER_TOKEN_STR:
+      return "str";
+    case SCANNER_TOKEN_KW_CAST:
+      return "'cast!'";
+    case SCANNER_TOKEN_KW_MAKE:
+      return "'make!'";
+    case SCANNER_TOKEN_KW_PRINT:
+      return "'print!'";
+    case SCANNER_TOKEN_KW_TYPE:
+      return "'type!'";
+    case SCANNER_TOKEN_LPAREN:
+      return "'('";
+    case SCANNER_TOKEN_RPAREN:
+      return "')'";
+    case SCANNER_TOKEN_LBRACKET:
+      return "'['";
+    case SCANNER_TOKEN_RBRACKET:
+      return "']'";
+    case SCANNER_TOKEN_COMMA:
+      return "','";
+    case SCANNER_TOKEN_COLON:
+      return "':'";
+    case SCANNER_TOKEN_SEMICOLON:
+      return "';'";
+    case SCANNER_TOKEN_DOT:
+      return "'.'";
+    case SCANNER_TOKEN_ASSIGN:
+      return "'='";
+    case SCANNER_TOKEN_OR:
+      return "'||'";
+    case SCANNER_TOKEN_AND:
+      return "'&&'";
+    case SCANNER_TOKEN_BIT_OR:
+      return "'|'";
+    case SCANNER_TOKEN_BIT_XOR:
+      return "'^'";
+    case SCANNER_TOKEN_BIT_AND:
+      return "'&'";
+    case SCANNER_TOKEN_EQ:
+      return "'=='";
+    case SCANNER_TOKEN_NE:
+      return "'!='";
+    case SCANNER_TOKEN_LT:
+      return "'<'";
+    case SCANNER_TOKEN_LE:
+      return "'<='";
+    case SCANNER_TOKEN_GT:
+      return "'>'";
+    case SCANNER_TOKEN_GE:
+      return "'>='";
+    case SCANNER_TOKEN_PLUS:
+      return "'+'";
+    case SCANNER_TOKEN_MINUS:
+      return "'-'";
+    case SCANNER_TOKEN_MUL:
+      return "'*'";
+    case SCANNER_TOKEN_DIV:
+      return "'/'";
+    case SCANNER_TOKEN_REM:
+      return "'%'";
+    case SCANNER_TOKEN_DEC_OP:
+      return "'--'";
+    case SCANNER_TOKEN_INC_OP:
+      return "'++'";
+    case SCANNER_TOKEN_NOT:
+      return "'!'";
+    case SCANNER_TOKEN_BIT_NOT:
+      return "'~'";
+    default:
+      break;
+  }
+  for (size_t i = 0; i < sizeof(scanner_keywords) / sizeof(*scanner_keywords);
+       ++i) {
+    if (scanner_keywords[i].kind == kind) {
+      return scanner_keywords[i].chars;
+    }
+  }
+  return "<unknown>";
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include <stddef.h>
+
+// hand-written lexer for the same tokens as antlr3/rec/Main.g3, it doesn't
+// depend on antlr runtime. Tokens point into source and aren't terminated
+typedef enum scanner_token_enum {
+  SCANNER_TOKEN_EOF,
+  // terminals
+  SCANNER_TOKEN_IDENTIFIER,
+  SCANNER_TOKEN_BOOL,
+  SCANNER_TOKEN_BITS,
+  SCANNER_TOKEN_HEX,
+  SCANNER_TOKEN_DEC,
+  SCANNER_TOKEN_CHAR,
+  SCANNER_TOKEN_STR,
+  // keywords
+  SCANNER_TOKEN_KW_BOOL,
+  SCANNER_TOKEN_KW_BYTE,
+  SCANNER_TOKEN_KW_INT,
+  SCANNER_TOKEN_KW_UINT,
+  SCANNER_TOKEN_KW_LONG,
+  SCANNER_TOKEN_KW_ULONG,
+  SCANNER_TOKEN_KW_CHAR,
+  SCANNER_TOKEN_KW_STRING,
+  SCANNER_TOKEN_KW_VOID,
+  SCANNER_TOKEN_KW_ANY,
+  SCANNER_TOKEN_KW_ARRAY,
+  SCANNER_TOKEN_KW_OF,
+  SCANNER_TOKEN_KW_EXTERN,
+  SCANNER_TOKEN_KW_METHOD,
+  SCANNER_TOKEN_KW_FROM,
+  SCANNER_TOKEN_KW_IN,
+  SCANNER_TOKEN_KW_CLASS,
+  SCANNER_TOKEN_KW_VAR,
+  SCANNER_TOKEN_KW_BEGIN,
+  SCANNER_TOKEN_KW_END,
+  SCANNER_TOKEN_KW_PUBLIC,
+  SCANNER_TOKEN_KW_PRIVATE,
+  SCANNER_TOKEN_KW_IF,
+  SCANNER_TOKEN_KW_THEN,
+  SCANNER_TOKEN_KW_ELSE,
+  SCANNER_TOKEN_KW_WHILE,
+  SCANNER_TOKEN_KW_DO,
+  SCANNER_TOKEN_KW_REPEAT,
+  SCANNER_TOKEN_KW_UNTIL,
+  SCANNER_TOKEN_KW_BREAK,
+  SCANNER_TOKEN_KW_RETURN,
+  SCANNER_TOKEN_KW_CAST,
+  SCANNER_TOKEN_KW_MAKE,
+  SCANNER_TOKEN_KW_PRINT,
+  SCANNER_TOKEN_KW_TYPE,
+  // punctuation
+  SCANNER_TOKEN_LPAREN,
+  SCANNER_TOKEN_RPAREN,
+  SCANNER_TOKEN_LBRACKET,
+  SCANNER_TOKEN_RBRACKET,
+  SCANNER_TOKEN_COMMA,
+  SCANNER_TOKEN_COLON,
+  SCANNER_TOKEN_SEMICOLON,
+  SCANNER_TOKEN_DOT,
+  SCANNER_TOKEN_ASSIGN,
+  SCANNER_TOKEN_OR,
+  SCANNER_TOKEN_AND,
+  SCANNER_TOKEN_BIT_OR,
+  SCANNER_TOKEN_BIT_XOR,
+  SCANNER_TOKEN_BIT_AND,
+  SCANNER_TOKEN_EQ,
+  SCANNER_TOKEN_NE,
+  SCANNER_TOKEN_LT,
+  SCANNER_TOKEN_LE,
+  SCANNER_TOKEN_GT,
+  SCANNER_TOKEN_GE,
+  SCANNER_TOKEN_PLUS,
+  SCANNER_TOKEN_MINUS,
+  SCANNER_TOKEN_MUL,
+  SCANNER_TOKEN_DIV,
+  SCANNER_TOKEN_REM,
+  SCANNER_TOKEN_DEC_OP,
+  SCANNER_TOKEN_INC_OP,
+  SCANNER_TOKEN_NOT,
+  SCANNER_TOKEN_BIT_NOT,
+} scanner_token_kind;
+
+// line starts from 1, pos is offset in line in characters (as in antlr)
+typedef struct scanner_token_struct {
+  scanner_token_kind kind;
+  const char        *chars;
+  size_t             len;
+  size_t             line;
+  size_t             pos;
+} scanner_token;
+
+typedef struct scanner_struct {
+  const char     *name_ref;
+  const char     *cur;
+  const char     *end;
+  size_t          line;
+  size_t          pos;
+  list_exception *exceptions_ref;
+} scanner;
+
+void scanner_init(scanner *self, const char *name_ref, const char *source,
+                  size_t len, list_exception *exceptions_ref);
+// hidden tokens (whitespaces and comments) are skipped, unmatched characters
+// are reported to exceptions and skipped too
+scanner_token scanner_next(scanner *self);
+
+const char *scanner_token_kind_str(scanner_token_kind kind);
@@ -1,4 +1,6 @@
+#include <errno.h>
 #include <getopt.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -6,11 +8,14 @@
 #include "compiler/codegen/x86_64/x86_64.h"
 #include "compiler/codegen/x86_64_build/x86_64_build.h"
 #include "compiler/codegen/x86_64_emit/x86_64_emit.h"
+#include "compiler/codegen/x86_64_jit/x86_64_jit.h"
+#include "compiler/codegen/x86_64_opt/x86_64_opt.h"
 #include "compiler/dot/dot.h"
 #include "compiler/exception/exception.h"
 #include "compiler/hir/hir.h"
 #include "compiler/hir/str.h"
 #include "compiler/hir_build/hir_build.h"
+#include "compiler/hir_build/front.h"
 #include "compiler/mir/mir.h"
 #include "compiler/mir/str.h"
 #include "compiler/mir_build/mir_build.h"
@@ -18,6 +23,7 @@
 #include "compiler/type_table/str.h"
 #include "util/container_util.h"
 #include "util/file.h"
+#include "util/intern.h"
 #include "util/list.h"
 #include "util/macro.h"
 
@@ -32,7 +38,10 @@ typedef struct args_struct {
   char       *output_file;
   int         ignore_errors;
   int         tee;
+  int         obj;
+  int         run;
   int         ast;
+  int         hand_parser;
   int         cfg;
   int         cfg_add_expr;
   int         cg;
@@ -41,6 +50,10 @@ typedef struct args_struct {
   int         hir_symbols;
   int         hir_types;
   int         mir;
+  int         opt_level;
+  int         opt_stats;
+  int         jobs;
+  char       *cache_dir;
   // status
   int code;
   int help;
@@ -58,8 +71,11 @@ static args *args_new() {
   args->output_file   = "a.asm";
   args->ignore_errors = 0;
   args->tee           = 0;
+  args->obj           = 0;
+  args->run           = 0;
 
-  args->ast = 0;
+  args->ast         = 0;
+  args->hand_parser = 0;
 
   args->cfg            = 0;
   args->cfg_add_expr   = 0;
@@ -72,6 +88,11 @@ static args *args_new() {
 
   args->mir = 0;
 
+  args->opt_level = 0;
+  args->opt_stats = 0;
+  args->jobs      = 0;
+  args->cache_dir = NULL;
+
   args->code = 0;
   args->help = 0;
 
@@ -103,8 +124,14 @@ static void usage(args *args) {
          "-d <directory>   - output directory (current: %s)\n"
          "-o <file>        - main output file (current: %s)\n"
          "--tee            - print to file and to stdout (current: %d)\n"
+         "--obj            - write ELF object instead of assembly "
+         "(current: %d)\n"
+         "--run            - run program in compiler process instead of "
+         "writing output (current: %d)\n"
          "--ignore-errors  - continue execution on errors (current: %d)\n"
          "--ast            - add AST output (current: %d)\n"
+         "--hand-parser    - parse with hand-written parser straight to HIR, "
+         "without AST (current: %d)\n"
          "--cfg            - add global subroutines control flow graph output "
          "(current: %d)\n"
          "--cfg-add-expr   - include expressions in control flow graph "
@@ -117,12 +144,32 @@ static void usage(args *args) {
          "--hir-symbols    - print HIR symbol table (current: %d)\n"
          "--hir-types      - print HIR type table (current: %d)\n"
          "--mir            - print MIR tree (current: %d)\n"
+         "-O <level>       - optimization level (current: %d)\n"
+         "--opt-stats      - print optimization statistics (current: %d)\n"
+         "-j <jobs>        - front end and code generation threads, 0 for "
+         "each processor (current: %d)\n"
+         "-c <directory>   - cache of instantiated subroutines, only changed "
+         "ones are rebuilt (current: %s)\n"
          "-h\n"
          "--help           - show help\n",
          args->prog_name, args->output_dir, args->output_file, args->tee,
-         args->ignore_errors, args->ast, args->cfg, args->cfg_add_expr,
-         args->cg, cg_subroutines, args->hir_tree, args->hir_symbols,
-         args->hir_types, args->mir);
+         args->obj, args->run, args->ignore_errors, args->ast,
+         args->hand_parser, args->cfg, args->cfg_add_expr, args->cg,
+         cg_subroutines, args->hir_tree, args->hir_symbols, args->hir_types,
+         args->mir, args->opt_level, args->opt_stats, args->jobs,
+         args->cache_dir ? args->cache_dir : "");
+}
+
+// returns 0 if whole str is decimal number in [min, max], -1 otherwise
+static int parse_int(const char *str, long min, long max, int *out) {
+  char *end;
+  errno      = 0;
+  long value = strtol(str, &end, 10);
+  if (end == str || *end || errno == ERANGE || value < min || value > max) {
+    return -1;
+  }
+  *out = (int)value;
+  return 0;
 }
 
 static void parse(args *args, int argc, char *argv[]) {
@@ -130,8 +177,11 @@ static void parse(args *args, int argc, char *argv[]) {
   int           has_next;
   struct option long_options[] = {
       {"tee", no_argument, &args->tee, 1},
+      {"obj", no_argument, &args->obj, 1},
+      {"run", no_argument, &args->run, 1},
       {"ignore-errors", no_argument, &args->ignore_errors, 1},
       {"ast", no_argument, &args->ast, 1},
+      {"hand-parser", no_argument, &args->hand_parser, 1},
       {"cfg", no_argument, &args->cfg, 1},
       {"cfg-add-expr", no_argument, &args->cfg_add_expr, 1},
       {"cg", no_argument, &args->cg, 1},
@@ -139,6 +189,7 @@ static void parse(args *args, int argc, char *argv[]) {
       {"hir-symbols", no_argument, &args->hir_symbols, 1},
       {"hir-types", no_argument, &args->hir_types, 1},
       {"mir", no_argument, &args->mir, 1},
+      {"opt-stats", no_argument, &args->opt_stats, 1},
       {"help", no_argument, &args->help, 1},
   };
 
@@ -152,7 +203,7 @@ static void parse(args *args, int argc, char *argv[]) {
   while (has_next) {
     unsigned c;
 
-    c = getopt_long(argc, argv, "o:d:s:h", long_options, &option_index);
+    c = getopt_long(argc, argv, "o:d:s:hO:j:c:", long_options, &option_index);
 
     switch (c) {
       case EOF:
@@ -175,6 +226,27 @@ static void parse(args *args, int argc, char *argv[]) {
       case 's':
         list_chars_push_back(args->cg_subroutines, strdup(optarg));
         break;
+      case 'O':
+        if (parse_int(optarg, 0, 2, &args->opt_level)) {
+          printf("%s: invalid optimization level '%s', expected 0..2\n",
+                 args->prog_name, optarg);
+          args->code = -1;
+          args->help = 1;
+          has_next   = 0;
+        }
+        break;
+      case 'j':
+        if (parse_int(optarg, 0, INT_MAX, &args->jobs)) {
+          printf("%s: invalid jobs count '%s', expected non-negative number\n",
+                 args->prog_name, optarg);
+          args->code = -1;
+          args->help = 1;
+          has_next   = 0;
+        }
+        break;
+      case 'c':
+        args->cache_dir = optarg;
+        break;
       case 'h':
         args->help = 1;
         has_next   = 0;
@@ -304,16 +376,14 @@ static void write_dot(args *args, const dot_string *dot, const char *path) {
   }
 }
 
-static void write_asm(args *args, const char *data, const char *path) {
-  if (args->tee) {
-    printf("%s\n", data);
-  }
+// assembly and objects are streamed, file is written while code is emitted
+static FILE *open_output(const char *path) {
   ensure_dir_exist(path);
-  if (path) {
-    FILE *path_fd = fopen(path, "wb");
-    fwrite(data, strlen(data), 1, path_fd);
-    fclose(path_fd);
+  FILE *path_fd = fopen(path, "wb");
+  if (!path_fd) {
+    fprintf(stderr, "can't open output file '%s'\n", path);
   }
+  return path_fd;
 }
 
 static int execute_ok(args *args) {
@@ -321,27 +391,26 @@ static int execute_ok(args *args) {
 }
 
 static int execute(args *args) {
-  list_ast *asts = list_ast_new();
-
-  // stage: tokenize and parse to AST
+  // stage: read, tokenize, parse and lower files concurrently
+  size_t       paths_cnt = list_chars_size(args->input_files);
+  const char **paths     = MALLOCN(const char *, paths_cnt);
+  size_t       paths_idx = 0;
   for (list_chars_it it = list_chars_begin(args->input_files); !END(it);
        NEXT(it)) {
-    const char *path   = GET(it);
-    char       *source = read_file(path);
-
-    ast *ast = ast_build(path, source);
+    paths[paths_idx++] = GET(it);
+  }
 
-    if (list_exception_count_by_level(ast_lexer_exceptions(ast),
-                                      EXCEPTION_LEVEL_ERROR) ||
-        list_exception_count_by_level(ast_parser_exceptions(ast),
-                                      EXCEPTION_LEVEL_ERROR)) {
-      args->code = 1;
-    }
-    print_exceptions(args, ast_lexer_exceptions(ast));
-    print_exceptions(args, ast_parser_exceptions(ast));
+  hir_front_result front = hir_front(paths, paths_cnt, args->hand_parser,
+                                     args->ignore_errors, args->jobs);
+  list_ast        *asts  = front.asts;
+  hir             *hir   = front.hir;
+  free(paths);
 
-    list_ast_push_back(asts, ast);
+  if (list_exception_count_by_level(front.exceptions, EXCEPTION_LEVEL_ERROR)) {
+    args->code = 1;
   }
+  print_exceptions(args, front.exceptions);
+  list_exception_free(front.exceptions);
 
   // stage: dot ast
   if (execute_ok(args) && args->ast) {
@@ -356,12 +425,11 @@ static int execute(args *args) {
   }
 
   // stage: build hir + handle exceptions
-  hir          *hir              = NULL;
   symbol_table *hir_symbol_table = NULL;
   type_table   *hir_type_table   = NULL;
 
   if (execute_ok(args)) {
-    hir_build_result result = hir_build(asts, args->ignore_errors);
+    hir_build_result result = hir_build(hir, args->ignore_errors);
     hir                     = result.hir;
     hir_symbol_table        = result.symbol_table;
     hir_type_table          = result.type_table;
@@ -405,7 +473,8 @@ static int execute(args *args) {
 
   if (execute_ok(args)) {
     mir_build_result result =
-        mir_build(hir, hir_symbol_table, hir_type_table, args->ignore_errors);
+        mir_build(hir, hir_symbol_table, hir_type_table, args->opt_level,
+                  args->ignore_errors);
     mir = result.mir;
 
     if (list_exception_count_by_level(result.exceptions,
@@ -466,7 +535,9 @@ static int execute(args *args) {
 
   // stage: build x86_64 structs
   if (!args->code || args->ignore_errors) {
-    cg_x86_64_build_result result = cg_x86_64_build(mir, args->ignore_errors);
+    cg_x86_64_build_result result =
+        cg_x86_64_build(mir, args->opt_level, args->ignore_errors, args->jobs,
+                        args->cache_dir);
     code                          = result.code;
 
     if (list_exception_count_by_level(result.exceptions,
@@ -477,22 +548,69 @@ static int execute(args *args) {
     list_exception_free(result.exceptions);
   }
 
-  // stage: emit x86_64 assembly code
+  // stage: optimize x86_64 structs
   if (!args->code || args->ignore_errors) {
-    cg_x86_64_emit_result result =
-        cg_x86_64_emit(code, CG_X86_64_EMIT_FORMAT_GAS);
+    cg_x86_64_opt_result result = cg_x86_64_opt(code, args->opt_level);
 
     if (list_exception_count_by_level(result.exceptions,
                                       EXCEPTION_LEVEL_ERROR)) {
       args->code = 1;
-    } else {
-      char *path = get_asm_path(args, args->output_file);
-      write_asm(args, result.asm_str, path);
-      free(path);
-      free(result.asm_str);
     }
     print_exceptions(args, result.exceptions);
     list_exception_free(result.exceptions);
+
+    if (args->opt_stats) {
+      fprintf(stdout, "X86_64 OPT:\n");
+      for (list_cg_x86_64_opt_stat_it it =
+               list_cg_x86_64_opt_stat_begin(result.stats);
+           !END(it); NEXT(it)) {
+        const cg_x86_64_opt_stat *stat = GET(it);
+        fprintf(stdout, "%s.%s: %lu\n", stat->pass_ref, stat->rule_ref,
+                stat->hits);
+      }
+    }
+    list_cg_x86_64_opt_stat_free(result.stats);
+  }
+
+  // stage: load x86_64 code into memory and run it
+  if (args->run && (!args->code || args->ignore_errors)) {
+    cg_x86_64_jit_result result = cg_x86_64_jit_load(code, "main");
+
+    print_exceptions(args, result.exceptions);
+    list_exception_free(result.exceptions);
+
+    if (result.jit) {
+      // program terminates process itself, output of compiler goes first
+      fflush(NULL);
+      args->code = result.jit->entry();
+      cg_x86_64_jit_free(result.jit);
+    } else {
+      args->code = 1;
+    }
+  }
+
+  // stage: emit x86_64 assembly code or object
+  if (!args->run && (!args->code || args->ignore_errors)) {
+    char *path   = get_asm_path(args, args->output_file);
+    FILE *stream = open_output(path);
+    free(path);
+
+    if (stream) {
+      cg_x86_64_emit_format format =
+          args->obj ? CG_X86_64_EMIT_FORMAT_ELF : CG_X86_64_EMIT_FORMAT_GAS;
+      FILE *tee = args->tee ? stdout : NULL;
+      cg_x86_64_emit_result result = cg_x86_64_emit(code, format, stream, tee);
+      fclose(stream);
+
+      if (list_exception_count_by_level(result.exceptions,
+                                        EXCEPTION_LEVEL_ERROR)) {
+        args->code = 1;
+      }
+      print_exceptions(args, result.exceptions);
+      list_exception_free(result.exceptions);
+    } else {
+      args->code = 1;
+    }
   }
 
   cg_x86_64_free(code);
@@ -530,6 +648,8 @@ int main(int argc, char *argv[]) {
   code = args->code;
 
   args_free(args);
+  // names of ids and symbols
+  intern_free();
 
   return code;
 }
@@ -0,0 +1,178 @@
+#include "hash.h"
+#include "compiler/type_table/str.h"
+#include "str.h"
+#include "util/hash.h"
+#include "util/log.h"
+#include "util/macro.h"
+
+static uint64_t mir_hash_type(uint64_t hash, const type_entry *type) {
+  if (!type) {
+    return hash_chars(hash, NULL);
+  }
+  char *type_s = type_str(type->type);
+  hash         = hash_chars(hash, type_s);
+  free(type_s);
+  return hash;
+}
+
+static uint64_t mir_hash_symbol(uint64_t hash, const symbol_entry *symbol) {
+  return hash_chars(hash, symbol ? symbol->name : NULL);
+}
+
+static uint64_t mir_hash_value(uint64_t hash, const mir_value *value) {
+  if (!value) {
+    return hash_uint64(hash, UINT64_MAX);
+  }
+  return hash_uint64(hash, value->id);
+}
+
+static uint64_t mir_hash_lit(uint64_t hash, const mir_lit *lit) {
+  char *lit_s = mir_lit_value_str(lit);
+  hash        = hash_chars(hash, lit_s);
+  free(lit_s);
+  return mir_hash_type(hash, lit->type_ref);
+}
+
+static uint64_t mir_hash_values(uint64_t hash, const vec_mir_value *values) {
+  for (vec_mir_value_it it = vec_mir_value_begin(values); !END(it);
+       NEXT(it)) {
+    const mir_value *value = GET(it);
+    hash                   = mir_hash_value(hash, value);
+    hash                   = mir_hash_symbol(hash, value->symbol_ref);
+    hash                   = mir_hash_type(hash, value->type_ref);
+  }
+  return hash_uint64(hash, vec_mir_value_size(values));
+}
+
+static uint64_t mir_hash_args(uint64_t hash, const vec_mir_value_ref *args) {
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(args); !END(it);
+       NEXT(it)) {
+    hash = mir_hash_value(hash, GET(it));
+  }
+  return hash_uint64(hash, vec_mir_value_ref_size(args));
+}
+
+static uint64_t mir_hash_debug(uint64_t hash, const mir_debug *debug) {
+  hash = hash_chars(hash, debug->source_ref);
+  hash = hash_uint64(hash, debug->line);
+  return hash_uint64(hash, debug->pos);
+}
+
+static uint64_t mir_hash_stmt(uint64_t hash, const mir_stmt *stmt) {
+  hash = hash_uint64(hash, stmt->kind);
+
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      hash = hash_uint64(hash, stmt->op.kind);
+      hash = mir_hash_value(hash, stmt->op.ret);
+      hash = mir_hash_args(hash, stmt->op.args);
+      break;
+    case MIR_STMT_CALL:
+      hash = mir_hash_value(hash, stmt->call.ret);
+      hash = mir_hash_symbol(hash, stmt->call.sub->symbol_ref);
+      hash = mir_hash_args(hash, stmt->call.args);
+      break;
+    case MIR_STMT_MEMBER:
+    case MIR_STMT_MEMBER_REF:
+      hash = mir_hash_value(hash, stmt->member.ret);
+      hash = mir_hash_value(hash, stmt->member.obj);
+      hash = mir_hash_lit(hash, stmt->member.member);
+      break;
+    case MIR_STMT_BUILTIN:
+      hash = hash_uint64(hash, stmt->builtin.kind);
+      hash = mir_hash_value(hash, stmt->builtin.ret);
+      hash = mir_hash_type(hash, stmt->builtin.type);
+      hash = mir_hash_args(hash, stmt->builtin.args);
+      hash = hash_uint64(hash, stmt->builtin.frame_capacity);
+      break;
+    case MIR_STMT_ASSIGN:
+      hash = hash_uint64(hash, stmt->assign.kind);
+      hash = mir_hash_value(hash, stmt->assign.to);
+      switch (stmt->assign.kind) {
+        case MIR_STMT_ASSIGN_VALUE:
+        case MIR_STMT_ASSIGN_MOVE:
+          hash = mir_hash_value(hash, stmt->assign.from_value);
+          break;
+        case MIR_STMT_ASSIGN_LIT:
+          hash = mir_hash_lit(hash, stmt->assign.from_lit);
+          break;
+        case MIR_STMT_ASSIGN_SUB:
+          hash = mir_hash_symbol(hash, stmt->assign.from_sub->symbol_ref);
+          break;
+        default:
+          warn("unhandled mir stmt assign kind %d %p", stmt->assign.kind, stmt);
+          break;
+      }
+      break;
+    default:
+      warn("unexpected stmt kind %d %p", stmt->kind, stmt);
+      break;
+  }
+
+  return mir_hash_debug(hash, &stmt->debug);
+}
+
+static uint64_t mir_hash_bb(uint64_t hash, const mir_bb *bb) {
+  hash = hash_uint64(hash, bb->id);
+
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+       NEXT(it)) {
+    hash = mir_hash_stmt(hash, GET(it));
+  }
+  hash = hash_uint64(hash, vec_mir_stmt_size(bb->stmts));
+
+  hash = hash_uint64(hash, mir_bb_get_cond(bb));
+  hash = mir_hash_value(hash, bb->jmp.cond_ref);
+  hash = hash_uint64(hash, bb->jmp.je_ref ? bb->jmp.je_ref->id : UINT64_MAX);
+  hash = hash_uint64(hash, bb->jmp.jz_ref ? bb->jmp.jz_ref->id : UINT64_MAX);
+  return mir_hash_debug(hash, &bb->jmp.debug);
+}
+
+uint64_t mir_subroutine_decl_hash(uint64_t hash, const mir_subroutine *sub) {
+  hash = hash_uint64(hash, sub->kind);
+  hash = hash_uint64(hash, sub->spec);
+  hash = mir_hash_symbol(hash, sub->symbol_ref);
+  return mir_hash_type(hash, sub->type_ref);
+}
+
+uint64_t mir_subroutine_hash(uint64_t hash, const mir_subroutine *sub) {
+  hash = mir_subroutine_decl_hash(hash, sub);
+
+  switch (sub->kind) {
+    case MIR_SUBROUTINE_DEFINED:
+      hash = mir_hash_value(hash, sub->defined.ret);
+      hash = mir_hash_type(hash, sub->defined.ret->type_ref);
+      hash = mir_hash_values(hash, sub->defined.params);
+      hash = mir_hash_values(hash, sub->defined.vars);
+      hash = mir_hash_values(hash, sub->defined.tmps);
+      for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+           NEXT(it)) {
+        hash = mir_hash_bb(hash, GET(it));
+      }
+      hash = hash_uint64(hash, vec_mir_bb_size(sub->defined.bbs));
+      break;
+    case MIR_SUBROUTINE_DECLARED:
+      break;
+    case MIR_SUBROUTINE_IMPORTED:
+      hash = hash_chars(hash, sub->imported.lib);
+      hash = hash_chars(hash, sub->imported.entry);
+      break;
+    default:
+      warn("unexpected subroutine kind %d %p", sub->kind, sub);
+      break;
+  }
+
+  return hash;
+}
+
+uint64_t mir_class_hash(uint64_t hash, const mir_class *class) {
+  hash = mir_hash_type(hash, class->type_ref);
+  hash = mir_hash_values(hash, class->fields);
+
+  for (list_mir_subroutine_ref_it it =
+           list_mir_subroutine_ref_begin(class->methods);
+       !END(it); NEXT(it)) {
+    hash = mir_hash_symbol(hash, GET(it)->symbol_ref);
+  }
+  return hash_uint64(hash, list_mir_subroutine_ref_size(class->methods));
+}
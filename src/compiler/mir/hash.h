@@ -0,0 +1,12 @@
+#pragma once
+
+#include "compiler/mir/mir.h"
+
+// hashes are stable between runs: they depend on names, types, literal values
+// and debug info, but not on addresses. Value and bb ids are local to
+// subroutine, so equal subroutines of different programs hash equally
+
+// signature only: kind, spec, name and type
+uint64_t mir_subroutine_decl_hash(uint64_t hash, const mir_subroutine *sub);
+uint64_t mir_subroutine_hash(uint64_t hash, const mir_subroutine *sub);
+uint64_t mir_class_hash(uint64_t hash, const mir_class *class);
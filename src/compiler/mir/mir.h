@@ -2,7 +2,9 @@
 
 #include "compiler/hir/node_expr.h"
 #include "compiler/symbol_table/symbol_table.h"
+#include "util/arena.h"
 #include "util/list.h"
+#include "util/vec.h"
 
 typedef struct mir_subroutine_struct     mir_subroutine;
 typedef struct mir_subroutine_ext_struct mir_subroutine_ext;
@@ -27,18 +29,15 @@ typedef struct mir_value_struct {
   const type_entry   *type_ref;
 } mir_value;
 
-mir_value *mir_value_new(size_t id, const symbol_entry *symbol_ref,
-                         const type_entry *type_ref);
-void       mir_value_free(mir_value *self);
+mir_value *mir_value_new(arena *arena, size_t id,
+                         const symbol_entry *symbol_ref,
+                         const type_entry   *type_ref);
 
-static inline void container_delete_mir_value(void *data) {
-  return mir_value_free(data);
-}
-LIST_DECLARE_STATIC_INLINE(list_mir_value, mir_value, container_cmp_false,
-                           container_new_move, container_delete_mir_value);
+VEC_DECLARE_STATIC_INLINE(vec_mir_value, mir_value, container_cmp_false,
+                          container_new_move, container_delete_false);
 
-LIST_DECLARE_STATIC_INLINE(list_mir_value_ref, mir_value, container_cmp_false,
-                           container_new_move, container_delete_false);
+VEC_DECLARE_STATIC_INLINE(vec_mir_value_ref, mir_value, container_cmp_false,
+                          container_new_move, container_delete_false);
 
 // LIT
 typedef union mir_lit_value_union {
@@ -49,7 +48,7 @@ typedef union mir_lit_value_union {
   int64_t  v_long;
   uint64_t v_ulong;
   uint8_t  v_char;
-  uint8_t *v_str;
+  uint8_t *v_str; // in arena of mir
 } mir_lit_value;
 
 typedef struct mir_lit_struct {
@@ -58,13 +57,11 @@ typedef struct mir_lit_struct {
   mir_lit_value     value;
 } mir_lit;
 
-mir_lit *mir_lit_new(size_t id, const type_entry *type_ref,
+mir_lit *mir_lit_new(arena *arena, size_t id, const type_entry *type_ref,
                      mir_lit_value value);
-void     mir_lit_free(mir_lit *self);
 
-static inline void container_delete_mir_lit(void *data) { mir_lit_free(data); }
 LIST_DECLARE_STATIC_INLINE(list_mir_lit, mir_lit, container_cmp_false,
-                           container_new_move, container_delete_mir_lit);
+                           container_new_move, container_delete_false);
 
 // MIR_STMT
 typedef enum mir_stmt_enum {
@@ -118,6 +115,7 @@ typedef enum mir_stmt_assign_enum {
   MIR_STMT_ASSIGN_LIT = 1,
   MIR_STMT_ASSIGN_VALUE,
   MIR_STMT_ASSIGN_SUB,
+  MIR_STMT_ASSIGN_MOVE, // source is not used after, it is left void
 } mir_stmt_assign_enum;
 
 // NOTE: references elements that are stored elsewhere
@@ -126,14 +124,14 @@ typedef struct mir_stmt_struct {
   mir_debug     debug;
   union {
     struct {
-      mir_stmt_op_enum    kind;
-      mir_value          *ret;
-      list_mir_value_ref *args;
+      mir_stmt_op_enum   kind;
+      mir_value         *ret;
+      vec_mir_value_ref *args;
     } op;
     struct {
-      mir_value          *ret;
-      mir_subroutine     *sub;
-      list_mir_value_ref *args;
+      mir_value         *ret;
+      mir_subroutine    *sub;
+      vec_mir_value_ref *args;
     } call;
     struct {
       mir_value *ret;
@@ -144,7 +142,8 @@ typedef struct mir_stmt_struct {
       mir_stmt_builtin_enum kind;
       mir_value            *ret;
       type_entry           *type; // template
-      list_mir_value_ref   *args;
+      vec_mir_value_ref    *args;
+      uint64_t              frame_capacity; // make in frame if not 0
     } builtin;
     struct {
       mir_stmt_assign_enum kind;
@@ -158,27 +157,29 @@ typedef struct mir_stmt_struct {
   };
 } mir_stmt;
 
-mir_stmt *mir_stmt_new_op(mir_stmt_op_enum kind, mir_value *ret,
-                          list_mir_value_ref *args);
-mir_stmt *mir_stmt_new_call(mir_value *ret, mir_subroutine *sub,
-                            list_mir_value_ref *args);
-mir_stmt *mir_stmt_new_member(mir_value *ret, mir_value *obj, mir_lit *member);
-mir_stmt *mir_stmt_new_member_ref(mir_value *ret, mir_value *obj,
+mir_stmt *mir_stmt_new_op(arena *arena, mir_stmt_op_enum kind, mir_value *ret,
+                          vec_mir_value_ref *args);
+mir_stmt *mir_stmt_new_call(arena *arena, mir_value *ret, mir_subroutine *sub,
+                            vec_mir_value_ref *args);
+mir_stmt *mir_stmt_new_member(arena *arena, mir_value *ret, mir_value *obj,
+                              mir_lit *member);
+mir_stmt *mir_stmt_new_member_ref(arena *arena, mir_value *ret, mir_value *obj,
                                   mir_lit *member);
-mir_stmt *mir_stmt_new_builtin(mir_stmt_builtin_enum kind, mir_value *ret,
-                               type_entry *type, list_mir_value_ref *args);
-mir_stmt *mir_stmt_new_assign(mir_stmt_assign_enum kind, mir_value *to,
-                              void *from);
+mir_stmt *mir_stmt_new_builtin(arena *arena, mir_stmt_builtin_enum kind,
+                               mir_value *ret, type_entry *type,
+                               vec_mir_value_ref *args);
+mir_stmt *mir_stmt_new_assign(arena *arena, mir_stmt_assign_enum kind,
+                              mir_value *to, void *from);
 
 void mir_stmt_debug_init_span(mir_stmt *stmt, const span *span);
 
-void mir_stmt_free(mir_stmt *self);
+// returns value that is written by statement
+mir_value *mir_stmt_get_ret(const mir_stmt *self);
+// assignment of value also reads target, because it dispatches on it
+int        mir_stmt_reads_value(const mir_stmt *self, const mir_value *value);
 
-static inline void container_delete_mir_stmt(void *data) {
-  mir_stmt_free(data);
-}
-LIST_DECLARE_STATIC_INLINE(list_mir_stmt, mir_stmt, container_cmp_false,
-                           container_new_move, container_delete_mir_stmt);
+VEC_DECLARE_STATIC_INLINE(vec_mir_stmt, mir_stmt, container_cmp_false,
+                          container_new_move, container_delete_false);
 
 // BB
 typedef enum mir_bb_enum {
@@ -190,8 +191,8 @@ typedef enum mir_bb_enum {
 
 typedef struct mir_bb_struct mir_bb;
 struct mir_bb_struct {
-  size_t         id;
-  list_mir_stmt *stmts;
+  size_t        id;
+  vec_mir_stmt *stmts;
   struct { // terminator
     mir_value *cond_ref;
     mir_bb    *je_ref;
@@ -206,17 +207,15 @@ struct mir_bb_struct {
   list_hir_expr_ref *hir_exprs;
 };
 
-mir_bb *mir_bb_new(size_t id, list_mir_stmt *stmts, mir_value *jmp_cond,
-                   mir_bb *jmp_je_ref, mir_bb *jmp_jz_ref,
+mir_bb *mir_bb_new(arena *arena, size_t id, vec_mir_stmt *stmts,
+                   mir_value *jmp_cond, mir_bb *jmp_je_ref, mir_bb *jmp_jz_ref,
                    list_hir_expr_ref *hir_exprs);
 void    mir_bb_jmp_debug_init_span(mir_bb *bb, const span *span);
-void    mir_bb_free(mir_bb *self);
 
 mir_bb_enum mir_bb_get_cond(const mir_bb *self);
 
-static inline void container_delete_mir_bb(void *data) { mir_bb_free(data); }
-LIST_DECLARE_STATIC_INLINE(list_mir_bb, mir_bb, container_cmp_false,
-                           container_new_move, container_delete_mir_bb);
+VEC_DECLARE_STATIC_INLINE(vec_mir_bb, mir_bb, container_cmp_false,
+                          container_new_move, container_delete_false);
 
 // SUBROUTINE
 typedef enum mir_subroutine_enum {
@@ -236,15 +235,15 @@ struct mir_subroutine_struct {
   const type_entry   *type_ref;
   union {
     struct {
-      mir_value      *ret;
-      list_mir_value *params;
-      list_mir_value *vars;
-      list_mir_value *tmps;
-      list_mir_bb    *bbs;
+      mir_value     *ret;
+      vec_mir_value *params;
+      vec_mir_value *vars;
+      vec_mir_value *tmps;
+      vec_mir_bb    *bbs;
     } defined;
     struct {
     } declared;
-    struct {
+    struct { // in arena of mir
       char *lib;
       char *entry;
     } imported;
@@ -253,24 +252,22 @@ struct mir_subroutine_struct {
 };
 
 mir_subroutine *mir_subroutine_new_defined(
-    const symbol_entry *symbol_ref, const type_entry *type_ref,
-    mir_subroutine_spec spec, mir_value *ret, list_mir_value *params,
-    list_mir_value *vars, list_mir_value *tmps, list_mir_bb *bbs);
-mir_subroutine *mir_subroutine_new_declared(const symbol_entry *symbol_ref,
+    arena *arena, const symbol_entry *symbol_ref, const type_entry *type_ref,
+    mir_subroutine_spec spec, mir_value *ret, vec_mir_value *params,
+    vec_mir_value *vars, vec_mir_value *tmps, vec_mir_bb *bbs);
+mir_subroutine *mir_subroutine_new_declared(arena              *arena,
+                                            const symbol_entry *symbol_ref,
                                             const type_entry   *type_ref,
                                             mir_subroutine_spec spec);
-mir_subroutine *mir_subroutine_new_imported(const symbol_entry *symbol_ref,
+mir_subroutine *mir_subroutine_new_imported(arena              *arena,
+                                            const symbol_entry *symbol_ref,
                                             const type_entry   *type_ref,
                                             mir_subroutine_spec spec, char *lib,
                                             char *entry);
-void            mir_subroutine_free(mir_subroutine *self);
 
-static inline void container_delete_mir_subroutine(void *data) {
-  mir_subroutine_free(data);
-}
 LIST_DECLARE_STATIC_INLINE(list_mir_subroutine, mir_subroutine,
                            container_cmp_false, container_new_move,
-                           container_delete_mir_subroutine);
+                           container_delete_false);
 
 LIST_DECLARE_STATIC_INLINE(list_mir_subroutine_ref, mir_subroutine,
                            container_cmp_false, container_new_move,
@@ -279,19 +276,16 @@ LIST_DECLARE_STATIC_INLINE(list_mir_subroutine_ref, mir_subroutine,
 // CLASSES
 typedef struct mir_class_struct {
   const type_entry        *type_ref;
-  list_mir_value          *fields;
+  vec_mir_value           *fields;
   list_mir_subroutine_ref *methods;
 } mir_class;
 
-mir_class *mir_class_new(const type_entry *type_ref, list_mir_value *fields,
+mir_class *mir_class_new(arena *arena, const type_entry *type_ref,
+                         vec_mir_value           *fields,
                          list_mir_subroutine_ref *methods);
-void       mir_class_free(mir_class *self);
 
-static inline void container_delete_mir_class(void *data) {
-  mir_class_free(data);
-}
 LIST_DECLARE_STATIC_INLINE(list_mir_class, mir_class, container_cmp_false,
-                           container_new_move, container_delete_mir_class);
+                           container_new_move, container_delete_false);
 
 // MIR
 typedef struct mir_struct {
@@ -301,7 +295,10 @@ typedef struct mir_struct {
   list_mir_subroutine *methods;
   list_mir_class      *classes;
   list_mir_lit        *literals;
+  arena               *arena; // nodes owned by mir
 } mir;
 
+// nodes, containers and strings they hold are allocated from arena of mir they
+// belong to (vec/list *_new_arena), so mir is released at once with arena
 mir *mir_new();
 void mir_free(mir *self);
@@ -65,11 +65,11 @@ static void mir_str_value(strbuf *buffer, size_t pad, const mir_value *value,
 }
 
 static void mir_str_stmt_args(strbuf *buffer, size_t pad,
-                              const list_mir_value_ref *args) {
+                              const vec_mir_value_ref *args) {
   UNUSED(pad);
   char buf[64];
   strbuf_append(buffer, "(");
-  list_mir_value_ref_it it = list_mir_value_ref_begin(args);
+  vec_mir_value_ref_it it = vec_mir_value_ref_begin(args);
   if (!END(it)) {
     strbuf_append_f(buffer, buf, "_%lu", GET(it)->id);
     for (NEXT(it); !END(it); NEXT(it)) {
@@ -147,6 +147,10 @@ static void mir_str_stmt(strbuf *buffer, size_t pad, const mir_stmt *stmt) {
         }
         strbuf_append(buffer, ">");
       }
+      if (stmt->builtin.frame_capacity) {
+        strbuf_append_f(buffer, buf, "[frame %lu]",
+                        stmt->builtin.frame_capacity);
+      }
       mir_str_stmt_args(buffer, pad, stmt->builtin.args);
       break;
 
@@ -156,6 +160,10 @@ static void mir_str_stmt(strbuf *buffer, size_t pad, const mir_stmt *stmt) {
         case MIR_STMT_ASSIGN_VALUE:
           strbuf_append_f(buffer, buf, "_%lu)", stmt->assign.from_value->id);
           break;
+        case MIR_STMT_ASSIGN_MOVE:
+          strbuf_append_f(buffer, buf, "move _%lu)",
+                          stmt->assign.from_value->id);
+          break;
         case MIR_STMT_ASSIGN_LIT:
           strbuf_append_f(buffer, buf, "lit.%lu)", stmt->assign.from_lit->id);
           char *lit_s = mir_lit_value_str(stmt->assign.from_lit);
@@ -205,9 +213,9 @@ static void mir_str_bb(strbuf *buffer, size_t pad, const mir_subroutine *sub,
   strbuf_append_f(buffer, buf, "hir_expr_trees_sz: %lu",
                   list_hir_expr_ref_size(bb->hir_exprs));
 
-  if (!list_mir_stmt_empty(bb->stmts)) {
+  if (!vec_mir_stmt_empty(bb->stmts)) {
     strbuf_append_clx(buffer, "", pad);
-    for (list_mir_stmt_it it = list_mir_stmt_begin(bb->stmts); !END(it);
+    for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
          NEXT(it)) {
       const mir_stmt *stmt = GET(it);
       strbuf_append_clx(buffer, "", pad);
@@ -296,21 +304,21 @@ static void mir_str_subroutine(strbuf *buffer, size_t pad,
       strbuf_append_clx(buffer, "", pad);
       mir_str_value(buffer, pad, sub->defined.ret, "ret");
       // params
-      for (list_mir_value_it it = list_mir_value_begin(sub->defined.params);
+      for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.params);
            !END(it); NEXT(it)) {
         const mir_value *param = GET(it);
         strbuf_append_clx(buffer, "", pad);
         mir_str_value(buffer, pad, param, "param");
       }
       // vars
-      for (list_mir_value_it it = list_mir_value_begin(sub->defined.vars);
+      for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.vars);
            !END(it); NEXT(it)) {
         const mir_value *param = GET(it);
         strbuf_append_clx(buffer, "", pad);
         mir_str_value(buffer, pad, param, "var");
       }
       // tmps
-      for (list_mir_value_it it = list_mir_value_begin(sub->defined.tmps);
+      for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.tmps);
            !END(it); NEXT(it)) {
         const mir_value *param = GET(it);
         strbuf_append_clx(buffer, "", pad);
@@ -318,7 +326,7 @@ static void mir_str_subroutine(strbuf *buffer, size_t pad,
       }
       // bbs
       strbuf_append_clx(buffer, "", pad);
-      for (list_mir_bb_it it = list_mir_bb_begin(sub->defined.bbs); !END(it);
+      for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
            NEXT(it)) {
         const mir_bb *bb = GET(it);
         strbuf_append_clx(buffer, "", pad);
@@ -359,9 +367,9 @@ static void mir_str_class(strbuf *buffer, size_t pad, const mir_class *class) {
   strbuf_append_clx(buffer, "type: ", pad);
   mir_str_type(buffer, pad, class->type_ref);
 
-  if (!list_mir_value_empty(class->fields)) {
+  if (!vec_mir_value_empty(class->fields)) {
     strbuf_append_clx(buffer, "", pad);
-    for (list_mir_value_it it = list_mir_value_begin(class->fields); !END(it);
+    for (vec_mir_value_it it = vec_mir_value_begin(class->fields); !END(it);
          NEXT(it)) {
       const mir_value *var = GET(it);
 
@@ -0,0 +1,336 @@
+#include "analysis.h"
+
+#include "util/log.h"
+#include "util/macro.h"
+
+int mir_value_set_contains(hashset_mir_value_ref *set, const mir_value *value) {
+  hashset_mir_value_ref_it it =
+      hashset_mir_value_ref_find(set, (mir_value *)value);
+  return !END(it);
+}
+
+void mir_value_set_erase(hashset_mir_value_ref *set, const mir_value *value) {
+  hashset_mir_value_ref_it it =
+      hashset_mir_value_ref_find(set, (mir_value *)value);
+  if (!END(it)) {
+    hashset_mir_value_ref_erase(set, it);
+  }
+}
+
+int mir_value_is_tmp(const mir_subroutine *sub, const mir_value *value) {
+  return value && !value->symbol_ref && value != sub->defined.ret;
+}
+
+static void mir_args_insert(const vec_mir_value_ref *args,
+                            hashset_mir_value_ref   *set) {
+  if (!args) {
+    return;
+  }
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(args); !END(it);
+       NEXT(it)) {
+    hashset_mir_value_ref_insert(set, GET(it));
+  }
+}
+
+void mir_stmt_uses_insert(const mir_stmt *stmt, hashset_mir_value_ref *uses) {
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      mir_args_insert(stmt->op.args, uses);
+      break;
+    case MIR_STMT_CALL:
+      mir_args_insert(stmt->call.args, uses);
+      break;
+    case MIR_STMT_MEMBER:
+    case MIR_STMT_MEMBER_REF:
+      hashset_mir_value_ref_insert(uses, stmt->member.obj);
+      break;
+    case MIR_STMT_BUILTIN:
+      mir_args_insert(stmt->builtin.args, uses);
+      break;
+    case MIR_STMT_ASSIGN:
+      switch (stmt->assign.kind) {
+        case MIR_STMT_ASSIGN_VALUE:
+        case MIR_STMT_ASSIGN_MOVE:
+          hashset_mir_value_ref_insert(uses, stmt->assign.from_value);
+          break;
+        case MIR_STMT_ASSIGN_LIT:
+        case MIR_STMT_ASSIGN_SUB:
+          break;
+      }
+      break;
+  }
+}
+
+void mir_stmt_reads_insert(const mir_stmt *stmt, hashset_mir_value_ref *reads) {
+  mir_stmt_uses_insert(stmt, reads);
+  if (stmt->kind == MIR_STMT_ASSIGN &&
+      (stmt->assign.kind == MIR_STMT_ASSIGN_VALUE ||
+       stmt->assign.kind == MIR_STMT_ASSIGN_MOVE)) {
+    hashset_mir_value_ref_insert(reads, stmt->assign.to);
+  }
+}
+
+static void mir_sub_insert(const mir_subroutine *sub,
+                           void (*stmt_insert)(const mir_stmt *,
+                                               hashset_mir_value_ref *),
+                           hashset_mir_value_ref *set) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb = GET(it);
+    if (bb->jmp.cond_ref) {
+      hashset_mir_value_ref_insert(set, bb->jmp.cond_ref);
+    }
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      stmt_insert(GET(it_stmt), set);
+    }
+  }
+}
+
+void mir_sub_uses_insert(const mir_subroutine *sub,
+                         hashset_mir_value_ref *uses) {
+  mir_sub_insert(sub, mir_stmt_uses_insert, uses);
+}
+
+void mir_sub_reads_insert(const mir_subroutine *sub,
+                          hashset_mir_value_ref *reads) {
+  mir_sub_insert(sub, mir_stmt_reads_insert, reads);
+}
+
+static int mir_stmt_keeps_plain(const mir_stmt        *stmt,
+                                hashset_mir_value_ref *plain) {
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      return stmt->op.kind != MIR_STMT_OP_INDEX_REF;
+    case MIR_STMT_MEMBER_REF:
+      return 0;
+    case MIR_STMT_ASSIGN:
+      switch (stmt->assign.kind) {
+        case MIR_STMT_ASSIGN_VALUE:
+        case MIR_STMT_ASSIGN_MOVE:
+          return mir_value_set_contains(plain, stmt->assign.from_value);
+        case MIR_STMT_ASSIGN_LIT:
+        case MIR_STMT_ASSIGN_SUB:
+          return 1;
+      }
+      return 0;
+    case MIR_STMT_CALL:
+    case MIR_STMT_MEMBER:
+    case MIR_STMT_BUILTIN:
+      return 1;
+  }
+  return 0;
+}
+
+void mir_sub_plain_insert(const mir_subroutine *sub,
+                          hashset_mir_value_ref *plain) {
+  hashset_mir_value_ref_insert(plain, sub->defined.ret);
+  for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.vars); !END(it);
+       NEXT(it)) {
+    hashset_mir_value_ref_insert(plain, GET(it));
+  }
+  for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.tmps); !END(it);
+       NEXT(it)) {
+    hashset_mir_value_ref_insert(plain, GET(it));
+  }
+
+  int changed = 1;
+  while (changed) {
+    changed = 0;
+    for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+         NEXT(it)) {
+      for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(GET(it)->stmts);
+           !END(it_stmt); NEXT(it_stmt)) {
+        const mir_stmt *stmt = GET(it_stmt);
+        mir_value      *ret  = mir_stmt_get_ret(stmt);
+
+        if (ret && mir_value_set_contains(plain, ret) &&
+            !mir_stmt_keeps_plain(stmt, plain)) {
+          mir_value_set_erase(plain, ret);
+          changed = 1;
+        }
+      }
+    }
+  }
+}
+
+void mir_sub_tmps_prune(arena *arena, mir_subroutine *sub) {
+  hashset_mir_value_ref *used = hashset_mir_value_ref_new();
+  mir_sub_reads_insert(sub, used);
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(GET(it)->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      hashset_mir_value_ref_insert(used, mir_stmt_get_ret(GET(it_stmt)));
+    }
+  }
+
+  vec_mir_value *new_tmps = vec_mir_value_new_arena(arena);
+  while (!vec_mir_value_empty(sub->defined.tmps)) {
+    mir_value *tmp = vec_mir_value_pop_front(sub->defined.tmps);
+    if (mir_value_set_contains(used, tmp)) {
+      vec_mir_value_push_back(new_tmps, tmp);
+    }
+  }
+  sub->defined.tmps = new_tmps;
+
+  hashset_mir_value_ref_free(used);
+}
+
+size_t mir_sub_value_id_next(const mir_subroutine *sub) {
+  size_t id = sub->defined.ret ? sub->defined.ret->id + 1 : 0;
+
+  const vec_mir_value *lists[] = {sub->defined.params, sub->defined.vars,
+                                   sub->defined.tmps};
+  for (size_t i = 0; i < sizeof(lists) / sizeof(*lists); ++i) {
+    for (vec_mir_value_it it = vec_mir_value_begin(lists[i]); !END(it);
+         NEXT(it)) {
+      if (GET(it)->id >= id) {
+        id = GET(it)->id + 1;
+      }
+    }
+  }
+  return id;
+}
+
+size_t mir_sub_bb_id_next(const mir_subroutine *sub) {
+  size_t id = 0;
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    if (GET(it)->id >= id) {
+      id = GET(it)->id + 1;
+    }
+  }
+  return id;
+}
+
+void mir_sub_based_insert(const mir_subroutine *sub,
+                          hashset_mir_value_ref *based) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(GET(it)->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+
+      if (stmt->kind == MIR_STMT_OP && stmt->op.kind == MIR_STMT_OP_INDEX_REF &&
+          !vec_mir_value_ref_empty(stmt->op.args)) {
+        hashset_mir_value_ref_insert(based,
+                                     vec_mir_value_ref_front(stmt->op.args));
+      } else if (stmt->kind == MIR_STMT_MEMBER_REF) {
+        hashset_mir_value_ref_insert(based, stmt->member.obj);
+      }
+    }
+  }
+}
+
+// PURITY
+typedef struct mir_op_purity_struct {
+  mir_purity scalar; // every operand is scalar primitive
+  mir_purity other;
+} mir_op_purity;
+
+// purity table of op kinds
+static mir_op_purity mir_op_purity_get(mir_stmt_op_enum kind) {
+  switch (kind) {
+    case MIR_STMT_OP_UNARY_PLUS:
+    case MIR_STMT_OP_UNARY_MINUS:
+    case MIR_STMT_OP_UNARY_LOGICAL_NOT:
+    case MIR_STMT_OP_UNARY_BITWISE_NOT:
+    case MIR_STMT_OP_UNARY_INC:
+    case MIR_STMT_OP_UNARY_DEC:
+    case MIR_STMT_OP_BINARY_LOGICAL_OR:
+    case MIR_STMT_OP_BINARY_LOGICAL_AND:
+    case MIR_STMT_OP_BINARY_BITWISE_OR:
+    case MIR_STMT_OP_BINARY_BITWISE_XOR:
+    case MIR_STMT_OP_BINARY_BITWISE_AND:
+    case MIR_STMT_OP_BINARY_EQUALS:
+    case MIR_STMT_OP_BINARY_NOT_EQUALS:
+    case MIR_STMT_OP_BINARY_LESS:
+    case MIR_STMT_OP_BINARY_LESS_EQUALS:
+    case MIR_STMT_OP_BINARY_GREATER:
+    case MIR_STMT_OP_BINARY_GREATER_EQUALS:
+    case MIR_STMT_OP_BINARY_BITWISE_SHIFT_LEFT:
+    case MIR_STMT_OP_BINARY_BITWISE_SHIFT_RIGHT:
+    case MIR_STMT_OP_BINARY_ADD:
+    case MIR_STMT_OP_BINARY_SUB:
+    case MIR_STMT_OP_BINARY_MUL:
+    case MIR_STMT_OP_BINARY_DIV:
+    case MIR_STMT_OP_BINARY_REM:
+    // scalars are not indexable, it just makes an error
+    case MIR_STMT_OP_INDEX:
+      return (mir_op_purity){MIR_PURITY_VALUE, MIR_PURITY_MEMORY};
+    // invokes arbitrary subroutine
+    case MIR_STMT_OP_CALL:
+    // produces reference
+    case MIR_STMT_OP_INDEX_REF:
+    // operand is reference
+    case MIR_STMT_OP_DEREF:
+      return (mir_op_purity){MIR_PURITY_NONE, MIR_PURITY_NONE};
+  }
+  error("unhandled mir op kind %d", kind);
+  return (mir_op_purity){MIR_PURITY_NONE, MIR_PURITY_NONE};
+}
+
+// primitive that is stored inplace and has no storage to write through
+static int mir_value_is_scalar(const mir_value *value) {
+  const type_base *type = value->type_ref ? value->type_ref->type : NULL;
+  if (!type || type->kind != TYPE_PRIMITIVE) {
+    return 0;
+  }
+
+  switch (((const type_primitive *)type)->type) {
+    case TYPE_PRIMITIVE_BOOL:
+    case TYPE_PRIMITIVE_BYTE:
+    case TYPE_PRIMITIVE_INT:
+    case TYPE_PRIMITIVE_UINT:
+    case TYPE_PRIMITIVE_LONG:
+    case TYPE_PRIMITIVE_ULONG:
+    case TYPE_PRIMITIVE_CHAR:
+      return 1;
+    case TYPE_PRIMITIVE_STRING:
+    case TYPE_PRIMITIVE_VOID:
+    case TYPE_PRIMITIVE_ANY:
+      return 0;
+  }
+  return 0;
+}
+
+mir_purity mir_stmt_purity(const mir_stmt *stmt) {
+  switch (stmt->kind) {
+    case MIR_STMT_OP: {
+      mir_op_purity purity = mir_op_purity_get(stmt->op.kind);
+      for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(stmt->op.args);
+           !END(it); NEXT(it)) {
+        if (!mir_value_is_scalar(GET(it))) {
+          return purity.other;
+        }
+      }
+      return purity.scalar;
+    }
+    case MIR_STMT_MEMBER:
+      return MIR_PURITY_MEMORY;
+    case MIR_STMT_CALL:
+    case MIR_STMT_MEMBER_REF:
+    case MIR_STMT_BUILTIN:
+    case MIR_STMT_ASSIGN:
+      return MIR_PURITY_NONE;
+  }
+  return MIR_PURITY_NONE;
+}
+
+int mir_stmt_writes_memory(const mir_stmt        *stmt,
+                           hashset_mir_value_ref *plain) {
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      return stmt->op.kind == MIR_STMT_OP_CALL;
+    case MIR_STMT_CALL:
+    case MIR_STMT_BUILTIN:
+      return 1;
+    case MIR_STMT_MEMBER:
+    case MIR_STMT_MEMBER_REF:
+      return 0;
+    case MIR_STMT_ASSIGN:
+      return !mir_value_set_contains(plain, stmt->assign.to);
+  }
+  return 1;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "compiler/mir/mir.h"
+#include "util/container_util.h"
+#include "util/hashset.h"
+
+VEC_DECLARE_STATIC_INLINE(vec_mir_bb_ref, mir_bb, container_cmp_false,
+                          container_new_move, container_delete_false);
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_bb_ref, mir_bb, container_cmp_ptr,
+                              container_new_move, container_delete_false,
+                              container_hash_ptr);
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_value_ref, mir_value,
+                              container_cmp_ptr, container_new_move,
+                              container_delete_false, container_hash_ptr);
+
+int  mir_value_set_contains(hashset_mir_value_ref *set, const mir_value *value);
+void mir_value_set_erase(hashset_mir_value_ref *set, const mir_value *value);
+
+// value is temporary of subroutine (not param, var or ret)
+int mir_value_is_tmp(const mir_subroutine *sub, const mir_value *value);
+
+// inserts operands of stmt
+void mir_stmt_uses_insert(const mir_stmt *stmt, hashset_mir_value_ref *uses);
+// inserts operands of stmt and targets of assignment (it dispatches on them)
+void mir_stmt_reads_insert(const mir_stmt *stmt, hashset_mir_value_ref *reads);
+// inserts operands of stmts and conditions of subroutine
+void mir_sub_uses_insert(const mir_subroutine *sub,
+                         hashset_mir_value_ref *uses);
+// inserts values read by stmts and terminators of subroutine
+void mir_sub_reads_insert(const mir_subroutine *sub,
+                          hashset_mir_value_ref *reads);
+
+// inserts values of subroutine that never hold reference, so assignment to
+// them doesn't write through it. References are produced only by index_ref
+// and member_ref, other values are dereferenced before they are passed
+// anywhere. Params are excluded because they are bound by caller
+void mir_sub_plain_insert(const mir_subroutine *sub,
+                          hashset_mir_value_ref *plain);
+
+// inserts values whose storage is referenced by index_ref or member_ref
+void mir_sub_based_insert(const mir_subroutine *sub,
+                          hashset_mir_value_ref *based);
+
+typedef enum mir_purity_enum {
+  MIR_PURITY_NONE,   // has side effects or produces reference
+  MIR_PURITY_VALUE,  // result depends only on operand values
+  MIR_PURITY_MEMORY, // also reads storage that may be written through refs
+} mir_purity;
+
+// purity of op and member statements, it depends on types of operands: ops on
+// scalar primitives don't look into storage of any value
+mir_purity mir_stmt_purity(const mir_stmt *stmt);
+// stmt may write storage that is reachable from other values (assignment
+// through reference, calls)
+int        mir_stmt_writes_memory(const mir_stmt        *stmt,
+                                  hashset_mir_value_ref *plain);
+
+// removes temporaries that are not mentioned by any stmt or terminator, arena
+// is of mir
+void mir_sub_tmps_prune(arena *arena, mir_subroutine *sub);
+
+// ids that are not used by values and bbs of subroutine yet
+size_t mir_sub_value_id_next(const mir_subroutine *sub);
+size_t mir_sub_bb_id_next(const mir_subroutine *sub);
@@ -0,0 +1,146 @@
+#include "call_graph.h"
+
+#include "util/macro.h"
+
+static mir_call_node *mir_call_node_new(const mir_subroutine *sub) {
+  mir_call_node *self = MALLOC(mir_call_node);
+  self->sub           = sub;
+  self->callees       = list_mir_subroutine_ref_new();
+  self->recursive     = 0;
+  return self;
+}
+
+static void mir_call_node_free(mir_call_node *self) {
+  if (self) {
+    list_mir_subroutine_ref_free(self->callees);
+    free(self);
+  }
+}
+
+void container_delete_mir_call_node(void *data) { mir_call_node_free(data); }
+
+mir_call_node *mir_call_graph_find(const mir_call_graph *self,
+                                   const mir_subroutine *sub) {
+  if (!sub) {
+    return NULL;
+  }
+  hashset_mir_call_node_it it = hashset_mir_call_node_find(
+      self->nodes, &(mir_call_node){.sub = sub});
+  return END(it) ? NULL : GET(it);
+}
+
+static int mir_call_node_calls(const mir_call_node *self,
+                               const mir_subroutine *sub) {
+  for (list_mir_subroutine_ref_it it =
+           list_mir_subroutine_ref_begin(self->callees);
+       !END(it); NEXT(it)) {
+    if (GET(it) == sub) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void mir_call_node_callees_init(mir_call_node *self) {
+  if (self->sub->kind != MIR_SUBROUTINE_DEFINED) {
+    return;
+  }
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(self->sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(GET(it)->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+      if (stmt->kind == MIR_STMT_CALL && stmt->call.sub &&
+          !mir_call_node_calls(self, stmt->call.sub)) {
+        list_mir_subroutine_ref_push_back(self->callees, stmt->call.sub);
+      }
+    }
+  }
+}
+
+// postorder is collected by pushing after callees
+static void mir_call_graph_visit(mir_call_graph       *self,
+                                 const mir_subroutine *sub) {
+  if (!sub || mir_call_graph_find(self, sub)) {
+    return;
+  }
+
+  mir_call_node *node = mir_call_node_new(sub);
+  hashset_mir_call_node_insert(self->nodes, node);
+  mir_call_node_callees_init(node);
+
+  for (list_mir_subroutine_ref_it it =
+           list_mir_subroutine_ref_begin(node->callees);
+       !END(it); NEXT(it)) {
+    mir_call_graph_visit(self, GET(it));
+  }
+
+  if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+    list_mir_subroutine_ref_push_back(self->postorder, (mir_subroutine *)sub);
+  }
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_call_node_ref, mir_call_node,
+                              container_cmp_mir_call_node, container_new_move,
+                              container_delete_false,
+                              container_hash_mir_call_node);
+
+static int mir_call_graph_reaches(const mir_call_graph      *self,
+                                  const mir_call_node       *node,
+                                  const mir_subroutine      *target,
+                                  hashset_mir_call_node_ref *visited) {
+  for (list_mir_subroutine_ref_it it =
+           list_mir_subroutine_ref_begin(node->callees);
+       !END(it); NEXT(it)) {
+    if (GET(it) == target) {
+      return 1;
+    }
+
+    mir_call_node *callee = mir_call_graph_find(self, GET(it));
+    hashset_mir_call_node_ref_it visited_it =
+        hashset_mir_call_node_ref_find(visited, callee);
+    if (!END(visited_it)) {
+      continue;
+    }
+    hashset_mir_call_node_ref_insert(visited, callee);
+
+    if (mir_call_graph_reaches(self, callee, target, visited)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+mir_call_graph *mir_call_graph_new(const mir *mir) {
+  mir_call_graph *self = MALLOC(mir_call_graph);
+  self->nodes          = hashset_mir_call_node_new();
+  self->postorder      = list_mir_subroutine_ref_new();
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_call_graph_visit(self, GET(it));
+  }
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->methods);
+       !END(it); NEXT(it)) {
+    mir_call_graph_visit(self, GET(it));
+  }
+
+  for (hashset_mir_call_node_it it = hashset_mir_call_node_begin(self->nodes);
+       !END(it); NEXT(it)) {
+    mir_call_node             *node    = GET(it);
+    hashset_mir_call_node_ref *visited = hashset_mir_call_node_ref_new();
+    node->recursive = mir_call_graph_reaches(self, node, node->sub, visited);
+    hashset_mir_call_node_ref_free(visited);
+  }
+
+  return self;
+}
+
+void mir_call_graph_free(mir_call_graph *self) {
+  if (self) {
+    hashset_mir_call_node_free(self->nodes);
+    list_mir_subroutine_ref_free(self->postorder);
+    free(self);
+  }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "compiler/mir/mir.h"
+#include "util/container_util.h"
+#include "util/hashset.h"
+
+typedef struct mir_call_node_struct {
+  const mir_subroutine    *sub;
+  list_mir_subroutine_ref *callees;   // distinct, in order of the first call
+  int                      recursive; // sub reaches itself through callees
+} mir_call_node;
+
+static inline int container_cmp_mir_call_node(const void *_lsv,
+                                              const void *_rsv) {
+  const mir_call_node *lsv = _lsv;
+  const mir_call_node *rsv = _rsv;
+  return container_cmp_ptr(lsv->sub, rsv->sub);
+}
+void container_delete_mir_call_node(void *data);
+static inline uint64_t container_hash_mir_call_node(const void *data) {
+  const mir_call_node *self = data;
+  return container_hash_ptr(self->sub);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_call_node, mir_call_node,
+                              container_cmp_mir_call_node, container_new_move,
+                              container_delete_mir_call_node,
+                              container_hash_mir_call_node);
+
+// direct calls between subroutines reachable from defined subroutines and
+// methods. Declared and imported subroutines are leaves
+typedef struct mir_call_graph_struct {
+  hashset_mir_call_node   *nodes;
+  list_mir_subroutine_ref *postorder; // defined subs, callees go first
+} mir_call_graph;
+
+mir_call_graph *mir_call_graph_new(const mir *mir);
+void            mir_call_graph_free(mir_call_graph *self);
+
+mir_call_node *mir_call_graph_find(const mir_call_graph *self,
+                                   const mir_subroutine *sub);
@@ -0,0 +1,456 @@
+#include "copy_prop.h"
+
+#include "compiler/mir_build/analysis.h"
+#include "util/log.h"
+#include "util/macro.h"
+
+// MIR_COPY
+// to = from, both values hold the same data until one of them is written
+typedef struct mir_copy_struct {
+  mir_value *to;
+  mir_value *from;
+} mir_copy;
+
+static mir_copy *mir_copy_new(mir_value *to, mir_value *from) {
+  mir_copy *self = MALLOC(mir_copy);
+  self->to       = to;
+  self->from     = from;
+  return self;
+}
+
+static inline int container_cmp_mir_copy(const void *_lsv, const void *_rsv) {
+  const mir_copy *lsv = _lsv;
+  const mir_copy *rsv = _rsv;
+  return container_cmp_ptr(lsv->to, rsv->to);
+}
+static inline void     container_delete_mir_copy(void *data) { free(data); }
+static inline uint64_t container_hash_mir_copy(const void *data) {
+  const mir_copy *self = data;
+  return container_hash_ptr(self->to);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_copy, mir_copy,
+                              container_cmp_mir_copy, container_new_move,
+                              container_delete_mir_copy,
+                              container_hash_mir_copy);
+
+static mir_value *mir_copies_find(hashset_mir_copy *copies,
+                                  const mir_value  *value) {
+  mir_copy          key = {.to = (mir_value *)value};
+  hashset_mir_copy_it it  = hashset_mir_copy_find(copies, &key);
+  return END(it) ? NULL : GET(it)->from;
+}
+
+// forgets copies that mention value
+static void mir_copies_kill(hashset_mir_copy *copies, const mir_value *value) {
+  int found = 1;
+  while (found) {
+    found = 0;
+    for (hashset_mir_copy_it it = hashset_mir_copy_begin(copies); !END(it);
+         NEXT(it)) {
+      if (GET(it)->to == value || GET(it)->from == value) {
+        hashset_mir_copy_erase(copies, it);
+        found = 1;
+        break;
+      }
+    }
+  }
+}
+
+static void mir_copies_subst(hashset_mir_copy *copies, mir_value **value) {
+  mir_value *from = *value ? mir_copies_find(copies, *value) : NULL;
+  if (from) {
+    *value = from;
+  }
+}
+
+static void mir_copies_subst_args(hashset_mir_copy  *copies,
+                                  vec_mir_value_ref *args) {
+  if (!args) {
+    return;
+  }
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(args); !END(it);
+       NEXT(it)) {
+    mir_value *from = mir_copies_find(copies, GET(it));
+    if (from) {
+      vec_mir_value_ref_insert(args, it, from);
+    }
+  }
+}
+
+static void mir_copies_subst_stmt(hashset_mir_copy *copies, mir_stmt *stmt) {
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      mir_copies_subst_args(copies, stmt->op.args);
+      break;
+    case MIR_STMT_CALL:
+      mir_copies_subst_args(copies, stmt->call.args);
+      break;
+    case MIR_STMT_MEMBER:
+    case MIR_STMT_MEMBER_REF:
+      mir_copies_subst(copies, &stmt->member.obj);
+      break;
+    case MIR_STMT_BUILTIN:
+      mir_copies_subst_args(copies, stmt->builtin.args);
+      break;
+    case MIR_STMT_ASSIGN:
+      switch (stmt->assign.kind) {
+        case MIR_STMT_ASSIGN_VALUE:
+        case MIR_STMT_ASSIGN_MOVE:
+          mir_copies_subst(copies, &stmt->assign.from_value);
+          break;
+        case MIR_STMT_ASSIGN_LIT:
+        case MIR_STMT_ASSIGN_SUB:
+          break;
+      }
+      break;
+  }
+}
+
+// MIR_BB_LIVE
+typedef struct mir_bb_live_struct {
+  const mir_bb          *bb;
+  hashset_mir_value_ref *gen;  // read before written
+  hashset_mir_value_ref *kill; // written
+  hashset_mir_value_ref *in;   // live on entry
+} mir_bb_live;
+
+static mir_bb_live *mir_bb_live_new(const mir_bb *bb) {
+  mir_bb_live *self = MALLOC(mir_bb_live);
+  self->bb          = bb;
+  self->gen         = hashset_mir_value_ref_new();
+  self->kill        = hashset_mir_value_ref_new();
+  self->in          = hashset_mir_value_ref_new();
+  return self;
+}
+
+static void mir_bb_live_free(mir_bb_live *self) {
+  if (self) {
+    hashset_mir_value_ref_free(self->gen);
+    hashset_mir_value_ref_free(self->kill);
+    hashset_mir_value_ref_free(self->in);
+    free(self);
+  }
+}
+
+static inline int container_cmp_mir_bb_live(const void *_lsv,
+                                            const void *_rsv) {
+  const mir_bb_live *lsv = _lsv;
+  const mir_bb_live *rsv = _rsv;
+  return container_cmp_ptr(lsv->bb, rsv->bb);
+}
+static inline void container_delete_mir_bb_live(void *data) {
+  mir_bb_live_free(data);
+}
+static inline uint64_t container_hash_mir_bb_live(const void *data) {
+  const mir_bb_live *self = data;
+  return container_hash_ptr(self->bb);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_bb_live, mir_bb_live,
+                              container_cmp_mir_bb_live, container_new_move,
+                              container_delete_mir_bb_live,
+                              container_hash_mir_bb_live);
+
+// CTX
+typedef struct mir_ctx_struct {
+  arena                 *arena; // of mir
+  hashset_mir_value_ref *plain;
+  // values whose storage is referenced by index_ref or member_ref
+  hashset_mir_value_ref *based;
+  hashset_mir_bb_live   *lives;
+} mir_ctx;
+
+// value can be replaced with its copy and moved from
+static int mir_ctx_is_owned(mir_ctx *ctx, const mir_value *value) {
+  return mir_value_set_contains(ctx->plain, value) &&
+         !mir_value_set_contains(ctx->based, value);
+}
+
+static mir_bb_live *mir_ctx_live_find(mir_ctx *ctx, const mir_bb *bb) {
+  mir_bb_live         key = {.bb = bb};
+  hashset_mir_bb_live_it it  = hashset_mir_bb_live_find(ctx->lives, &key);
+  return END(it) ? NULL : GET(it);
+}
+
+// PROPAGATE
+static void mir_ctx_bb_propagate(mir_ctx *ctx, mir_bb *bb) {
+  hashset_mir_copy *copies = hashset_mir_copy_new();
+
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+       NEXT(it)) {
+    mir_stmt *stmt = GET(it);
+    mir_copies_subst_stmt(copies, stmt);
+
+    mir_value *ret = mir_stmt_get_ret(stmt);
+    if (ret) {
+      mir_copies_kill(copies, ret);
+    }
+    if (stmt->kind != MIR_STMT_ASSIGN) {
+      continue;
+    }
+
+    mir_value *from = stmt->assign.from_value;
+    switch (stmt->assign.kind) {
+      case MIR_STMT_ASSIGN_VALUE:
+        if (ret != from && mir_ctx_is_owned(ctx, ret) &&
+            mir_ctx_is_owned(ctx, from)) {
+          hashset_mir_copy_insert(copies, mir_copy_new(ret, from));
+        }
+        break;
+      case MIR_STMT_ASSIGN_MOVE:
+        // source is left void
+        mir_copies_kill(copies, from);
+        break;
+      case MIR_STMT_ASSIGN_LIT:
+      case MIR_STMT_ASSIGN_SUB:
+        break;
+    }
+  }
+
+  mir_copies_subst(copies, &bb->jmp.cond_ref);
+
+  hashset_mir_copy_free(copies);
+}
+
+// removes copies to temporaries that are not used anymore and self copies
+static void mir_ctx_sub_clean(mir_ctx *ctx, mir_subroutine *sub) {
+  hashset_mir_value_ref *uses = hashset_mir_value_ref_new();
+  mir_sub_uses_insert(sub, uses);
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    mir_bb       *bb        = GET(it);
+    vec_mir_stmt *new_stmts = vec_mir_stmt_new_arena(ctx->arena);
+
+    while (!vec_mir_stmt_empty(bb->stmts)) {
+      mir_stmt *stmt = vec_mir_stmt_pop_front(bb->stmts);
+
+      if (stmt->kind == MIR_STMT_ASSIGN &&
+          stmt->assign.kind == MIR_STMT_ASSIGN_VALUE &&
+          mir_ctx_is_owned(ctx, stmt->assign.to) &&
+          (stmt->assign.to == stmt->assign.from_value ||
+           (mir_value_is_tmp(sub, stmt->assign.to) &&
+            !mir_value_set_contains(uses, stmt->assign.to)))) {
+        continue;
+      }
+      vec_mir_stmt_push_back(new_stmts, stmt);
+    }
+
+    bb->stmts = new_stmts;
+  }
+
+  hashset_mir_value_ref_free(uses);
+
+  mir_sub_tmps_prune(ctx->arena, sub);
+}
+
+// LIVENESS
+// assignment reads target only to dispatch on it, every type accepts plain
+// value, so only reference targets are kept alive
+static void mir_ctx_stmt_reads_insert(mir_ctx *ctx, const mir_stmt *stmt,
+                                      hashset_mir_value_ref *reads) {
+  mir_stmt_uses_insert(stmt, reads);
+  if (stmt->kind == MIR_STMT_ASSIGN &&
+      !mir_value_set_contains(ctx->plain, stmt->assign.to)) {
+    hashset_mir_value_ref_insert(reads, stmt->assign.to);
+  }
+}
+
+static void mir_ctx_live_init(mir_ctx *ctx, const mir_subroutine *sub) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb   = GET(it);
+    mir_bb_live  *live = mir_bb_live_new(bb);
+
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt        *stmt  = GET(it_stmt);
+      hashset_mir_value_ref *reads = hashset_mir_value_ref_new();
+      mir_ctx_stmt_reads_insert(ctx, stmt, reads);
+
+      for (hashset_mir_value_ref_it it_read =
+               hashset_mir_value_ref_begin(reads);
+           !END(it_read); NEXT(it_read)) {
+        if (!mir_value_set_contains(live->kill, GET(it_read))) {
+          hashset_mir_value_ref_insert(live->gen, GET(it_read));
+        }
+      }
+      hashset_mir_value_ref_free(reads);
+
+      // assignment to reference writes through it
+      mir_value *ret = mir_stmt_get_ret(stmt);
+      if (ret && mir_value_set_contains(ctx->plain, ret)) {
+        hashset_mir_value_ref_insert(live->kill, ret);
+      }
+    }
+
+    if (bb->jmp.cond_ref &&
+        !mir_value_set_contains(live->kill, bb->jmp.cond_ref)) {
+      hashset_mir_value_ref_insert(live->gen, bb->jmp.cond_ref);
+    }
+
+    hashset_mir_bb_live_insert(ctx->lives, live);
+  }
+}
+
+static void mir_ctx_live_out(mir_ctx *ctx, const mir_bb *bb,
+                             hashset_mir_value_ref *out) {
+  const mir_bb *succs[] = {bb->jmp.je_ref, bb->jmp.jz_ref};
+  for (size_t i = 0; i < sizeof(succs) / sizeof(*succs); ++i) {
+    const mir_bb_live *live =
+        succs[i] ? mir_ctx_live_find(ctx, succs[i]) : NULL;
+    if (!live) {
+      continue;
+    }
+    for (hashset_mir_value_ref_it it = hashset_mir_value_ref_begin(live->in);
+         !END(it); NEXT(it)) {
+      hashset_mir_value_ref_insert(out, GET(it));
+    }
+  }
+}
+
+// returns 1 if value was not in set before
+static int mir_value_set_add(hashset_mir_value_ref *set, mir_value *value) {
+  if (mir_value_set_contains(set, value)) {
+    return 0;
+  }
+  hashset_mir_value_ref_insert(set, value);
+  return 1;
+}
+
+static void mir_ctx_live_solve(mir_ctx *ctx, const mir_subroutine *sub) {
+  int changed = 1;
+  while (changed) {
+    changed = 0;
+    for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+         NEXT(it)) {
+      mir_bb_live           *live = mir_ctx_live_find(ctx, GET(it));
+      hashset_mir_value_ref *out  = hashset_mir_value_ref_new();
+      mir_ctx_live_out(ctx, GET(it), out);
+
+      for (hashset_mir_value_ref_it it_gen =
+               hashset_mir_value_ref_begin(live->gen);
+           !END(it_gen); NEXT(it_gen)) {
+        changed |= mir_value_set_add(live->in, GET(it_gen));
+      }
+      for (hashset_mir_value_ref_it it_out = hashset_mir_value_ref_begin(out);
+           !END(it_out); NEXT(it_out)) {
+        if (!mir_value_set_contains(live->kill, GET(it_out))) {
+          changed |= mir_value_set_add(live->in, GET(it_out));
+        }
+      }
+
+      hashset_mir_value_ref_free(out);
+    }
+  }
+}
+
+// MOVE
+// assignment from temporary that is dead after it transfers ownership instead
+// of copying
+static void mir_ctx_bb_move(mir_ctx *ctx, const mir_subroutine *sub,
+                            mir_bb *bb) {
+  size_t     stmts_cnt = vec_mir_stmt_size(bb->stmts);
+  mir_stmt **stmts     = MALLOCN(mir_stmt *, stmts_cnt);
+
+  size_t i = 0;
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+       NEXT(it)) {
+    stmts[i++] = GET(it);
+  }
+
+  hashset_mir_value_ref *live = hashset_mir_value_ref_new();
+  mir_ctx_live_out(ctx, bb, live);
+  if (bb->jmp.cond_ref) {
+    hashset_mir_value_ref_insert(live, bb->jmp.cond_ref);
+  }
+
+  while (i--) {
+    mir_stmt *stmt = stmts[i];
+
+    if (stmt->kind == MIR_STMT_ASSIGN &&
+        stmt->assign.kind == MIR_STMT_ASSIGN_VALUE) {
+      mir_value *from = stmt->assign.from_value;
+      if (from != stmt->assign.to && mir_value_is_tmp(sub, from) &&
+          mir_ctx_is_owned(ctx, from) &&
+          mir_ctx_is_owned(ctx, stmt->assign.to) &&
+          !mir_value_set_contains(live, from)) {
+        stmt->assign.kind = MIR_STMT_ASSIGN_MOVE;
+      }
+    }
+
+    mir_value *ret = mir_stmt_get_ret(stmt);
+    if (ret && mir_value_set_contains(ctx->plain, ret)) {
+      mir_value_set_erase(live, ret);
+    }
+    mir_ctx_stmt_reads_insert(ctx, stmt, live);
+  }
+
+  hashset_mir_value_ref_free(live);
+  free(stmts);
+}
+
+static void mir_ctx_copy_prop_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
+  if (vec_mir_bb_empty(sub->defined.bbs)) {
+    return;
+  }
+
+  ctx->plain = hashset_mir_value_ref_new();
+  ctx->based = hashset_mir_value_ref_new();
+  ctx->lives = hashset_mir_bb_live_new();
+
+  mir_sub_plain_insert(sub, ctx->plain);
+  mir_sub_based_insert(sub, ctx->based);
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    mir_ctx_bb_propagate(ctx, GET(it));
+  }
+  mir_ctx_sub_clean(ctx, sub);
+
+  mir_ctx_live_init(ctx, sub);
+  mir_ctx_live_solve(ctx, sub);
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    mir_ctx_bb_move(ctx, sub, GET(it));
+  }
+
+  hashset_mir_bb_live_free(ctx->lives);
+  hashset_mir_value_ref_free(ctx->based);
+  hashset_mir_value_ref_free(ctx->plain);
+  ctx->lives = NULL;
+  ctx->based = NULL;
+  ctx->plain = NULL;
+}
+
+mir_copy_prop_result mir_copy_prop(mir *mir) {
+  mir_copy_prop_result result = {
+      .exceptions = list_exception_new(),
+  };
+
+  mir_ctx ctx = {
+      .arena = mir->arena,
+      .plain = NULL,
+      .based = NULL,
+      .lives = NULL,
+  };
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_copy_prop_subroutine(&ctx, sub);
+    }
+  }
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->methods);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_copy_prop_subroutine(&ctx, sub);
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+
+typedef struct mir_copy_prop_result_struct {
+  list_exception *exceptions;
+} mir_copy_prop_result;
+
+// replaces reads of copied values with their sources, removes copies that
+// became unused and turns assignments from dead temporaries into moves
+mir_copy_prop_result mir_copy_prop(mir *mir);
@@ -0,0 +1,194 @@
+#include "dead_subs.h"
+
+#include "util/hashset.h"
+#include "util/log.h"
+#include "util/macro.h"
+#include <string.h>
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_sub_ref, mir_subroutine,
+                              container_cmp_ptr, container_new_move,
+                              container_delete_false, container_hash_ptr);
+
+// types are interned in type table, so they are compared by pointer
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_type_ref, type_base,
+                              container_cmp_ptr, container_new_move,
+                              container_delete_false, container_hash_ptr);
+
+// CTX
+typedef struct mir_ctx_struct {
+  hashset_mir_sub_ref     *subs;    // reached subs and methods
+  hashset_mir_type_ref    *types;   // class types that are made
+  list_mir_subroutine_ref *pending; // reached, but not scanned yet
+} mir_ctx;
+
+static void mir_ctx_init(mir_ctx *ctx) {
+  ctx->subs    = hashset_mir_sub_ref_new();
+  ctx->types   = hashset_mir_type_ref_new();
+  ctx->pending = list_mir_subroutine_ref_new();
+}
+
+static void mir_ctx_deinit(mir_ctx *ctx) {
+  hashset_mir_sub_ref_free(ctx->subs);
+  hashset_mir_type_ref_free(ctx->types);
+  list_mir_subroutine_ref_free(ctx->pending);
+}
+
+static int mir_ctx_sub_reached(mir_ctx *ctx, const mir_subroutine *sub) {
+  hashset_mir_sub_ref_it it =
+      hashset_mir_sub_ref_find(ctx->subs, (mir_subroutine *)sub);
+  return !END(it);
+}
+
+static void mir_ctx_sub_reach(mir_ctx *ctx, mir_subroutine *sub) {
+  if (sub && !mir_ctx_sub_reached(ctx, sub)) {
+    hashset_mir_sub_ref_insert(ctx->subs, sub);
+    list_mir_subroutine_ref_push_back(ctx->pending, sub);
+  }
+}
+
+static int mir_ctx_type_reached(mir_ctx *ctx, const type_base *type) {
+  hashset_mir_type_ref_it it =
+      hashset_mir_type_ref_find(ctx->types, (type_base *)type);
+  return !END(it);
+}
+
+static void mir_ctx_type_reach(mir_ctx *ctx, const type_entry *type_ref) {
+  if (!type_ref || type_ref->type->kind != TYPE_MONO) {
+    return;
+  }
+  const type_mono *mono = (const type_mono *)type_ref->type;
+  if (mono->type_ref->kind == TYPE_CLASS_T &&
+      !mir_ctx_type_reached(ctx, type_ref->type)) {
+    hashset_mir_type_ref_insert(ctx->types, type_ref->type);
+  }
+}
+
+static void mir_ctx_scan_sub(mir_ctx *ctx, const mir_subroutine *sub) {
+  if (sub->kind != MIR_SUBROUTINE_DEFINED) {
+    return;
+  }
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(GET(it)->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+
+      switch (stmt->kind) {
+        case MIR_STMT_CALL:
+          mir_ctx_sub_reach(ctx, stmt->call.sub);
+          break;
+        case MIR_STMT_ASSIGN:
+          if (stmt->assign.kind == MIR_STMT_ASSIGN_SUB) {
+            mir_ctx_sub_reach(ctx, stmt->assign.from_sub);
+          }
+          break;
+        case MIR_STMT_BUILTIN:
+          if (stmt->builtin.kind == MIR_STMT_BUILTIN_MAKE) {
+            mir_ctx_type_reach(ctx, stmt->builtin.type);
+          }
+          break;
+        case MIR_STMT_OP:
+        case MIR_STMT_MEMBER:
+        case MIR_STMT_MEMBER_REF:
+          break;
+      }
+    }
+  }
+}
+
+// methods of classes made by reached code are reached, until nothing changes
+static void mir_ctx_reach(mir_ctx *ctx, const mir *mir) {
+  do {
+    while (!list_mir_subroutine_ref_empty(ctx->pending)) {
+      mir_ctx_scan_sub(ctx, list_mir_subroutine_ref_pop_front(ctx->pending));
+    }
+
+    for (list_mir_class_it it = list_mir_class_begin(mir->classes); !END(it);
+         NEXT(it)) {
+      const mir_class *class = GET(it);
+      if (!mir_ctx_type_reached(ctx, class->type_ref->type)) {
+        continue;
+      }
+      for (list_mir_subroutine_ref_it it_m =
+               list_mir_subroutine_ref_begin(class->methods);
+           !END(it_m); NEXT(it_m)) {
+        mir_ctx_sub_reach(ctx, GET(it_m));
+      }
+    }
+  } while (!list_mir_subroutine_ref_empty(ctx->pending));
+}
+
+// REMOVE
+static size_t mir_ctx_remove_subs(mir_ctx *ctx, list_mir_subroutine *subs) {
+  size_t size    = list_mir_subroutine_size(subs);
+  size_t removed = 0;
+
+  for (size_t i = 0; i < size; ++i) {
+    mir_subroutine *sub = list_mir_subroutine_pop_front(subs);
+    if (mir_ctx_sub_reached(ctx, sub)) {
+      list_mir_subroutine_push_back(subs, sub);
+    } else {
+      ++removed;
+    }
+  }
+  return removed;
+}
+
+static size_t mir_ctx_remove_classes(mir_ctx *ctx, list_mir_class *classes) {
+  size_t size    = list_mir_class_size(classes);
+  size_t removed = 0;
+
+  for (size_t i = 0; i < size; ++i) {
+    mir_class *class = list_mir_class_pop_front(classes);
+    if (mir_ctx_type_reached(ctx, class->type_ref->type)) {
+      list_mir_class_push_back(classes, class);
+    } else {
+      ++removed;
+    }
+  }
+  return removed;
+}
+
+static mir_subroutine *mir_find_main(const mir *mir) {
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->symbol_ref && !strcmp(sub->symbol_ref->name, "main")) {
+      return sub;
+    }
+  }
+  return NULL;
+}
+
+mir_dead_subs_result mir_dead_subs(mir *mir) {
+  mir_dead_subs_result result = {
+      .exceptions = list_exception_new(),
+      .subs       = 0,
+      .methods    = 0,
+      .classes    = 0,
+  };
+
+  mir_subroutine *entry = mir_find_main(mir);
+  if (!entry) {
+    return result;
+  }
+
+  mir_ctx ctx;
+  mir_ctx_init(&ctx);
+
+  mir_ctx_sub_reach(&ctx, entry);
+  mir_ctx_reach(&ctx, mir);
+
+  result.classes  = mir_ctx_remove_classes(&ctx, mir->classes);
+  result.methods  = mir_ctx_remove_subs(&ctx, mir->methods);
+  result.subs    += mir_ctx_remove_subs(&ctx, mir->defined_subs);
+  result.subs    += mir_ctx_remove_subs(&ctx, mir->declared_subs);
+  result.subs    += mir_ctx_remove_subs(&ctx, mir->imported_subs);
+
+  info("removed %zu subroutines, %zu methods, %zu classes", result.subs,
+       result.methods, result.classes);
+
+  mir_ctx_deinit(&ctx);
+  return result;
+}
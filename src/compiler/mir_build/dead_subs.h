@@ -0,0 +1,17 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+
+typedef struct mir_dead_subs_result_struct {
+  list_exception *exceptions;
+  size_t          subs;    // removed defined, declared and imported subs
+  size_t          methods; // removed methods
+  size_t          classes; // removed class initializers
+} mir_dead_subs_result;
+
+// removes subroutines, methods and classes not reachable from main. Subs are
+// reached by calls and assignments of subs, classes by make of their type,
+// methods of reached class are kept all, because initializer stores them in
+// object. Without main nothing is removed
+mir_dead_subs_result mir_dead_subs(mir *mir);
@@ -0,0 +1,160 @@
+#include "dominance.h"
+
+#include "util/macro.h"
+
+static mir_dom_node *mir_dom_node_new(mir_bb *bb) {
+  mir_dom_node *self = MALLOC(mir_dom_node);
+  self->bb           = bb;
+  self->rpo          = 0;
+  self->idom         = NULL;
+  self->children     = list_mir_dom_node_ref_new();
+  self->preds        = vec_mir_bb_ref_new();
+  return self;
+}
+
+static void mir_dom_node_free(mir_dom_node *self) {
+  if (self) {
+    list_mir_dom_node_ref_free(self->children);
+    vec_mir_bb_ref_free(self->preds);
+    free(self);
+  }
+}
+
+void container_delete_mir_dom_node(void *data) { mir_dom_node_free(data); }
+
+mir_dom_node *mir_dom_find(const mir_dom *self, const mir_bb *bb) {
+  if (!bb) {
+    return NULL;
+  }
+  hashset_mir_dom_node_it it = hashset_mir_dom_node_find(
+      self->nodes, &(mir_dom_node){.bb = (mir_bb *)bb});
+  return END(it) ? NULL : GET(it);
+}
+
+// postorder is collected and then reversed
+static void mir_dom_visit(mir_dom *self, mir_bb *bb) {
+  if (!bb || mir_dom_find(self, bb)) {
+    return;
+  }
+  hashset_mir_dom_node_insert(self->nodes, mir_dom_node_new(bb));
+
+  mir_dom_visit(self, bb->jmp.je_ref);
+  mir_dom_visit(self, bb->jmp.jz_ref);
+
+  vec_mir_bb_ref_push_back(self->rpo, bb);
+}
+
+static void mir_dom_preds_init(mir_dom *self) {
+  for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(self->rpo); !END(it);
+       NEXT(it)) {
+    mir_bb       *bb = GET(it);
+    mir_dom_node *je = mir_dom_find(self, bb->jmp.je_ref);
+    mir_dom_node *jz = mir_dom_find(self, bb->jmp.jz_ref);
+    if (je) {
+      vec_mir_bb_ref_push_back(je->preds, bb);
+    }
+    if (jz && jz != je) {
+      vec_mir_bb_ref_push_back(jz->preds, bb);
+    }
+  }
+}
+
+static mir_dom_node *mir_dom_intersect(mir_dom_node *lsv, mir_dom_node *rsv) {
+  while (lsv != rsv) {
+    while (lsv->rpo > rsv->rpo) {
+      lsv = lsv->idom;
+    }
+    while (rsv->rpo > lsv->rpo) {
+      rsv = rsv->idom;
+    }
+  }
+  return lsv;
+}
+
+// iterative algorithm of Cooper, Harvey and Kennedy, entry temporary
+// dominates itself to mark it processed
+static void mir_dom_idom_init(mir_dom *self) {
+  size_t rpo = 0;
+  for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(self->rpo); !END(it);
+       NEXT(it)) {
+    mir_dom_find(self, GET(it))->rpo = rpo++;
+  }
+
+  self->root       = mir_dom_find(self, vec_mir_bb_ref_front(self->rpo));
+  self->root->idom = self->root;
+
+  int changed = 1;
+  while (changed) {
+    changed = 0;
+    for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(self->rpo); !END(it);
+         NEXT(it)) {
+      mir_dom_node *node = mir_dom_find(self, GET(it));
+      if (node == self->root) {
+        continue;
+      }
+
+      mir_dom_node *idom = NULL;
+      for (vec_mir_bb_ref_it it_pred = vec_mir_bb_ref_begin(node->preds);
+           !END(it_pred); NEXT(it_pred)) {
+        mir_dom_node *pred = mir_dom_find(self, GET(it_pred));
+        if (!pred->idom) {
+          continue;
+        }
+        idom = idom ? mir_dom_intersect(pred, idom) : pred;
+      }
+
+      if (idom != node->idom) {
+        node->idom = idom;
+        changed    = 1;
+      }
+    }
+  }
+
+  self->root->idom = NULL;
+
+  for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(self->rpo); !END(it);
+       NEXT(it)) {
+    mir_dom_node *node = mir_dom_find(self, GET(it));
+    if (node->idom) {
+      list_mir_dom_node_ref_push_back(node->idom->children, node);
+    }
+  }
+}
+
+mir_dom *mir_dom_new(const mir_subroutine *sub) {
+  mir_dom *self = MALLOC(mir_dom);
+  self->nodes   = hashset_mir_dom_node_new();
+  self->rpo     = vec_mir_bb_ref_new();
+  self->root    = NULL;
+
+  if (!vec_mir_bb_empty(sub->defined.bbs)) {
+    mir_dom_visit(self, vec_mir_bb_front(sub->defined.bbs));
+    vec_mir_bb_ref_reverse(self->rpo);
+    mir_dom_preds_init(self);
+    mir_dom_idom_init(self);
+  }
+
+  return self;
+}
+
+void mir_dom_free(mir_dom *self) {
+  if (self) {
+    vec_mir_bb_ref_free(self->rpo);
+    hashset_mir_dom_node_free(self->nodes);
+    free(self);
+  }
+}
+
+int mir_dom_dominates(const mir_dom *self, const mir_bb *dom,
+                      const mir_bb *bb) {
+  const mir_dom_node *dom_node = mir_dom_find(self, dom);
+  const mir_dom_node *node     = mir_dom_find(self, bb);
+  if (!dom_node || !node) {
+    return 0;
+  }
+
+  while (node && node->rpo > dom_node->rpo) {
+    node = node->idom;
+  }
+  return node == dom_node;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "compiler/mir_build/analysis.h"
+
+typedef struct mir_dom_node_struct mir_dom_node;
+
+LIST_DECLARE_STATIC_INLINE(list_mir_dom_node_ref, mir_dom_node,
+                           container_cmp_false, container_new_move,
+                           container_delete_false);
+
+struct mir_dom_node_struct {
+  mir_bb                *bb;
+  size_t                 rpo;      // index in reverse postorder
+  mir_dom_node          *idom;     // NULL for entry
+  list_mir_dom_node_ref *children; // nodes immediately dominated, in rpo
+  vec_mir_bb_ref        *preds;    // reachable predecessors
+};
+
+static inline int container_cmp_mir_dom_node(const void *_lsv,
+                                             const void *_rsv) {
+  const mir_dom_node *lsv = _lsv;
+  const mir_dom_node *rsv = _rsv;
+  return container_cmp_ptr(lsv->bb, rsv->bb);
+}
+void container_delete_mir_dom_node(void *data);
+static inline uint64_t container_hash_mir_dom_node(const void *data) {
+  const mir_dom_node *self = data;
+  return container_hash_ptr(self->bb);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_dom_node, mir_dom_node,
+                              container_cmp_mir_dom_node, container_new_move,
+                              container_delete_mir_dom_node,
+                              container_hash_mir_dom_node);
+
+// dominator tree of subroutine, first bb is the entry. Unreachable bbs are
+// not included
+typedef struct mir_dom_struct {
+  hashset_mir_dom_node *nodes;
+  vec_mir_bb_ref       *rpo;
+  mir_dom_node         *root;
+} mir_dom;
+
+mir_dom *mir_dom_new(const mir_subroutine *sub);
+void     mir_dom_free(mir_dom *self);
+
+mir_dom_node *mir_dom_find(const mir_dom *self, const mir_bb *bb);
+// each path from entry to bb goes through dom, bb dominates itself
+int           mir_dom_dominates(const mir_dom *self, const mir_bb *dom,
+                                const mir_bb *bb);
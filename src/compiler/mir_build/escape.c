@@ -0,0 +1,273 @@
+#include "escape.h"
+
+#include "compiler/mir_build/analysis.h"
+#include "compiler/type_table/type.h"
+#include "util/macro.h"
+
+// capacity of array placed in frame when its length is not known
+#define MIR_ESCAPE_ARRAY_CAPACITY 16
+// larger data is left on heap to keep frames small
+#define MIR_ESCAPE_CAPACITY_MAX 256
+
+// CTX
+typedef struct mir_ctx_struct {
+  const mir             *mir;
+  mir_subroutine        *sub;
+  hashset_mir_value_ref *plain;
+} mir_ctx;
+
+static int mir_args_contain(const vec_mir_value_ref *args,
+                            hashset_mir_value_ref   *aliases) {
+  if (!args) {
+    return 0;
+  }
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(args); !END(it);
+       NEXT(it)) {
+    if (mir_value_set_contains(aliases, GET(it))) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static int mir_aliases_insert(hashset_mir_value_ref *aliases,
+                              mir_value             *value) {
+  if (!value || mir_value_set_contains(aliases, value)) {
+    return 0;
+  }
+  hashset_mir_value_ref_insert(aliases, value);
+  return 1;
+}
+
+// returns 1 if data escapes through stmt, results that may refer to data are
+// added to aliases
+static int mir_ctx_stmt_escapes(mir_ctx               *ctx,
+                                const mir_stmt        *stmt,
+                                hashset_mir_value_ref *aliases,
+                                int                   *changed) {
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      if (!mir_args_contain(stmt->op.args, aliases)) {
+        return 0;
+      }
+      switch (stmt->op.kind) {
+        case MIR_STMT_OP_CALL:
+          return 1;
+        case MIR_STMT_OP_INDEX:
+          // element is copied, data can't be stored in itself without escape
+          return 0;
+        default:
+          *changed |= mir_aliases_insert(aliases, stmt->op.ret);
+          return 0;
+      }
+    case MIR_STMT_CALL:
+      return mir_args_contain(stmt->call.args, aliases);
+    case MIR_STMT_MEMBER:
+      return 0;
+    case MIR_STMT_MEMBER_REF:
+      if (mir_value_set_contains(aliases, stmt->member.obj)) {
+        *changed |= mir_aliases_insert(aliases, stmt->member.ret);
+      }
+      return 0;
+    case MIR_STMT_BUILTIN:
+      if (stmt->builtin.kind == MIR_STMT_BUILTIN_CAST &&
+          mir_args_contain(stmt->builtin.args, aliases)) {
+        *changed |= mir_aliases_insert(aliases, stmt->builtin.ret);
+      }
+      return 0;
+    case MIR_STMT_ASSIGN:
+      switch (stmt->assign.kind) {
+        case MIR_STMT_ASSIGN_VALUE:
+        case MIR_STMT_ASSIGN_MOVE:
+          if (!mir_value_set_contains(aliases, stmt->assign.from_value)) {
+            return 0;
+          }
+          // ret, params and references outlive frame or point elsewhere
+          if (stmt->assign.to == ctx->sub->defined.ret ||
+              !mir_value_set_contains(ctx->plain, stmt->assign.to)) {
+            return 1;
+          }
+          *changed |= mir_aliases_insert(aliases, stmt->assign.to);
+          return 0;
+        case MIR_STMT_ASSIGN_LIT:
+        case MIR_STMT_ASSIGN_SUB:
+          return 0;
+      }
+  }
+  return 1;
+}
+
+static int mir_ctx_make_escapes(mir_ctx *ctx, const mir_stmt *make) {
+  hashset_mir_value_ref *aliases = hashset_mir_value_ref_new();
+  hashset_mir_value_ref_insert(aliases, make->builtin.ret);
+
+  int escapes = 0;
+  int changed = 1;
+
+  while (changed && !escapes) {
+    changed = 0;
+    for (vec_mir_bb_it it = vec_mir_bb_begin(ctx->sub->defined.bbs);
+         !END(it) && !escapes; NEXT(it)) {
+      const mir_bb *bb = GET(it);
+      for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+           !END(it_stmt) && !escapes; NEXT(it_stmt)) {
+        escapes = mir_ctx_stmt_escapes(ctx, GET(it_stmt), aliases, &changed);
+      }
+    }
+  }
+
+  hashset_mir_value_ref_free(aliases);
+  return escapes;
+}
+
+static int mir_lit_length(const mir_lit *lit, uint64_t *length) {
+  const type_base *type = lit->type_ref->type;
+  if (type->kind != TYPE_PRIMITIVE) {
+    return 0;
+  }
+  switch (((const type_primitive *)type)->type) {
+    case TYPE_PRIMITIVE_BYTE:
+      *length = lit->value.v_byte;
+      return 1;
+    case TYPE_PRIMITIVE_INT:
+      *length = lit->value.v_int < 0 ? 0 : (uint64_t)lit->value.v_int;
+      return 1;
+    case TYPE_PRIMITIVE_UINT:
+      *length = lit->value.v_uint;
+      return 1;
+    case TYPE_PRIMITIVE_LONG:
+      *length = lit->value.v_long < 0 ? 0 : (uint64_t)lit->value.v_long;
+      return 1;
+    case TYPE_PRIMITIVE_ULONG:
+      *length = lit->value.v_ulong;
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+// length if it is assigned once from literal, default capacity otherwise
+static uint64_t mir_ctx_array_capacity(mir_ctx         *ctx,
+                                       const mir_value *length) {
+  const mir_stmt *def      = NULL;
+  size_t          defs_cnt = 0;
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(ctx->sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb = GET(it);
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      if (mir_stmt_get_ret(GET(it_stmt)) == length) {
+        def = GET(it_stmt);
+        ++defs_cnt;
+      }
+    }
+  }
+
+  uint64_t capacity;
+  if (defs_cnt == 1 && def->kind == MIR_STMT_ASSIGN &&
+      def->assign.kind == MIR_STMT_ASSIGN_LIT &&
+      mir_lit_length(def->assign.from_lit, &capacity)) {
+    return capacity;
+  }
+  return MIR_ESCAPE_ARRAY_CAPACITY;
+}
+
+static uint64_t mir_ctx_class_capacity(mir_ctx *ctx, const type_base *type) {
+  for (list_mir_class_it it = list_mir_class_begin(ctx->mir->classes);
+       !END(it); NEXT(it)) {
+    const mir_class *class = GET(it);
+    if (class->type_ref->type == type) {
+      return vec_mir_value_size(class->fields) +
+             list_mir_subroutine_ref_size(class->methods);
+    }
+  }
+  return 0;
+}
+
+// elements or members of data created by make, 0 if it can't be in frame
+static uint64_t mir_ctx_make_capacity(mir_ctx *ctx, const mir_stmt *make) {
+  const type_base *type = make->builtin.type->type;
+
+  switch (type->kind) {
+    case TYPE_ARRAY: {
+      const type_array *array = (typeof(array))type;
+      if (array->element_ref->kind == TYPE_ARRAY ||
+          vec_mir_value_ref_size(make->builtin.args) != 1) {
+        return 0;
+      }
+      return mir_ctx_array_capacity(
+          ctx, vec_mir_value_ref_front(make->builtin.args));
+    }
+    case TYPE_MONO: {
+      const type_mono *mono = (typeof(mono))type;
+      if (mono->type_ref->kind != TYPE_CLASS_T) {
+        return 0;
+      }
+      return mir_ctx_class_capacity(ctx, type);
+    }
+    default:
+      return 0;
+  }
+}
+
+static void mir_ctx_escape_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
+  ctx->sub   = sub;
+  ctx->plain = hashset_mir_value_ref_new();
+  mir_sub_plain_insert(sub, ctx->plain);
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    mir_bb *bb = GET(it);
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      mir_stmt *stmt = GET(it_stmt);
+      if (stmt->kind != MIR_STMT_BUILTIN ||
+          stmt->builtin.kind != MIR_STMT_BUILTIN_MAKE || !stmt->builtin.ret ||
+          !stmt->builtin.type) {
+        continue;
+      }
+
+      uint64_t capacity = mir_ctx_make_capacity(ctx, stmt);
+      if (!capacity || capacity > MIR_ESCAPE_CAPACITY_MAX ||
+          mir_ctx_make_escapes(ctx, stmt)) {
+        continue;
+      }
+      stmt->builtin.frame_capacity = capacity;
+    }
+  }
+
+  hashset_mir_value_ref_free(ctx->plain);
+  ctx->plain = NULL;
+  ctx->sub   = NULL;
+}
+
+mir_escape_result mir_escape(mir *mir) {
+  mir_escape_result result = {
+      .exceptions = list_exception_new(),
+  };
+
+  mir_ctx ctx = {
+      .mir   = mir,
+      .sub   = NULL,
+      .plain = NULL,
+  };
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_escape_subroutine(&ctx, sub);
+    }
+  }
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->methods);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_escape_subroutine(&ctx, sub);
+    }
+  }
+
+  return result;
+}
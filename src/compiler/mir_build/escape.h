@@ -0,0 +1,13 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+
+typedef struct mir_escape_result_struct {
+  list_exception *exceptions;
+} mir_escape_result;
+
+// marks make of one dimensional arrays and class objects whose data is never
+// passed out of subroutine, so it can be placed in frame. Data escapes if it
+// is passed to call, returned or stored through reference
+mir_escape_result mir_escape(mir *mir);
@@ -0,0 +1,438 @@
+#include "gvn.h"
+
+#include "compiler/mir_build/analysis.h"
+#include "compiler/mir_build/dominance.h"
+#include "util/log.h"
+#include "util/macro.h"
+#include <stdint.h>
+#include <string.h>
+
+// MIR_EXPR
+// operation with its operands, the key of value numbering
+typedef struct mir_expr_struct {
+  mir_stmt_enum    kind;
+  mir_stmt_op_enum op;
+  size_t           args_cnt;
+  mir_value      **args;
+  const uint8_t   *member;
+  mir_purity       purity;
+  mir_value       *ret;
+} mir_expr;
+
+static int mir_op_commutative(mir_stmt_op_enum op) {
+  switch (op) {
+    case MIR_STMT_OP_BINARY_LOGICAL_OR:
+    case MIR_STMT_OP_BINARY_LOGICAL_AND:
+    case MIR_STMT_OP_BINARY_BITWISE_OR:
+    case MIR_STMT_OP_BINARY_BITWISE_XOR:
+    case MIR_STMT_OP_BINARY_BITWISE_AND:
+    case MIR_STMT_OP_BINARY_EQUALS:
+    case MIR_STMT_OP_BINARY_NOT_EQUALS:
+    case MIR_STMT_OP_BINARY_ADD:
+    case MIR_STMT_OP_BINARY_MUL:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+static mir_expr *mir_expr_new(const mir_stmt *stmt, mir_purity purity) {
+  mir_expr *self = MALLOC(mir_expr);
+  self->kind     = stmt->kind;
+  self->op       = 0;
+  self->member   = NULL;
+  self->purity   = purity;
+  self->ret      = mir_stmt_get_ret(stmt);
+
+  if (stmt->kind == MIR_STMT_OP) {
+    self->op       = stmt->op.kind;
+    self->args_cnt = vec_mir_value_ref_size(stmt->op.args);
+    self->args     = MALLOCN(mir_value *, self->args_cnt);
+
+    size_t i = 0;
+    for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(stmt->op.args);
+         !END(it); NEXT(it)) {
+      self->args[i++] = GET(it);
+    }
+
+    // errors on mismatched types mention operands in order
+    if (self->args_cnt == 2 && mir_op_commutative(self->op) &&
+        purity == MIR_PURITY_VALUE &&
+        self->args[0]->type_ref == self->args[1]->type_ref &&
+        (uintptr_t)self->args[0] > (uintptr_t)self->args[1]) {
+      mir_value *tmp = self->args[0];
+      self->args[0]  = self->args[1];
+      self->args[1]  = tmp;
+    }
+  } else {
+    self->args_cnt = 1;
+    self->args     = MALLOCN(mir_value *, 1);
+    self->args[0]  = stmt->member.obj;
+    self->member   = stmt->member.member->value.v_str;
+  }
+
+  return self;
+}
+
+static void mir_expr_free(mir_expr *self) {
+  if (self) {
+    free(self->args);
+    free(self);
+  }
+}
+
+static int mir_expr_mentions(const mir_expr *self, const mir_value *value) {
+  if (self->ret == value) {
+    return 1;
+  }
+  for (size_t i = 0; i < self->args_cnt; ++i) {
+    if (self->args[i] == value) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static inline int container_cmp_mir_expr(const void *_lsv, const void *_rsv) {
+  const mir_expr *lsv = _lsv;
+  const mir_expr *rsv = _rsv;
+  if (lsv->kind != rsv->kind || lsv->op != rsv->op ||
+      lsv->args_cnt != rsv->args_cnt) {
+    return 1;
+  }
+  for (size_t i = 0; i < lsv->args_cnt; ++i) {
+    if (lsv->args[i] != rsv->args[i]) {
+      return 1;
+    }
+  }
+  if (lsv->member && rsv->member) {
+    return strcmp((const char *)lsv->member, (const char *)rsv->member);
+  }
+  return lsv->member != rsv->member;
+}
+static inline void container_delete_mir_expr(void *data) {
+  mir_expr_free(data);
+}
+static inline uint64_t container_hash_mir_expr(const void *data) {
+  const mir_expr *self = data;
+  uint64_t        hash = (uint64_t)self->kind * 31 + self->op;
+  for (size_t i = 0; i < self->args_cnt; ++i) {
+    hash = hash * 31 + container_hash_ptr(self->args[i]);
+  }
+  if (self->member) {
+    hash = hash * 31 + container_hash_chars(self->member);
+  }
+  return hash;
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_expr, mir_expr,
+                              container_cmp_mir_expr, container_new_move,
+                              container_delete_mir_expr,
+                              container_hash_mir_expr);
+
+LIST_DECLARE_STATIC_INLINE(list_mir_expr_ref, mir_expr, container_cmp_false,
+                           container_new_move, container_delete_false);
+
+// MIR_VALUE_DEF
+// place of the only definition of value
+typedef struct mir_value_def_struct {
+  const mir_value *value;
+  size_t           defs_cnt;
+  const mir_bb    *bb;
+  size_t           stmt_i;
+} mir_value_def;
+
+static mir_value_def *mir_value_def_new(const mir_value *value,
+                                        const mir_bb *bb, size_t stmt_i) {
+  mir_value_def *self = MALLOC(mir_value_def);
+  self->value         = value;
+  self->defs_cnt      = 1;
+  self->bb            = bb;
+  self->stmt_i        = stmt_i;
+  return self;
+}
+
+static inline int container_cmp_mir_value_def(const void *_lsv,
+                                              const void *_rsv) {
+  const mir_value_def *lsv = _lsv;
+  const mir_value_def *rsv = _rsv;
+  return container_cmp_ptr(lsv->value, rsv->value);
+}
+static inline void container_delete_mir_value_def(void *data) { free(data); }
+static inline uint64_t container_hash_mir_value_def(const void *data) {
+  const mir_value_def *self = data;
+  return container_hash_ptr(self->value);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_value_def, mir_value_def,
+                              container_cmp_mir_value_def, container_new_move,
+                              container_delete_mir_value_def,
+                              container_hash_mir_value_def);
+
+// CTX
+typedef struct mir_ctx_struct {
+  const mir_subroutine  *sub;
+  mir_dom               *dom;
+  hashset_mir_value_ref *plain;
+  hashset_mir_value_ref *based;
+  hashset_mir_value_ref *params;
+  hashset_mir_value_def *defs;
+  hashset_mir_expr      *avail;
+} mir_ctx;
+
+static mir_value_def *mir_ctx_def_find(mir_ctx *ctx, const mir_value *value) {
+  hashset_mir_value_def_it it = hashset_mir_value_def_find(
+      ctx->defs, &(mir_value_def){.value = value});
+  return END(it) ? NULL : GET(it);
+}
+
+static void mir_ctx_def_add(mir_ctx *ctx, const mir_value *value,
+                            const mir_bb *bb, size_t stmt_i) {
+  mir_value_def *def = mir_ctx_def_find(ctx, value);
+  if (def) {
+    def->defs_cnt += 1;
+  } else {
+    hashset_mir_value_def_insert(ctx->defs,
+                                 mir_value_def_new(value, bb, stmt_i));
+  }
+}
+
+static void mir_ctx_defs_init(mir_ctx *ctx, const mir_subroutine *sub) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb     = GET(it);
+    size_t        stmt_i = 0;
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt), ++stmt_i) {
+      const mir_stmt *stmt = GET(it_stmt);
+      mir_value      *ret  = mir_stmt_get_ret(stmt);
+      if (ret) {
+        mir_ctx_def_add(ctx, ret, bb, stmt_i);
+      }
+      // moved source is left void
+      if (stmt->kind == MIR_STMT_ASSIGN &&
+          stmt->assign.kind == MIR_STMT_ASSIGN_MOVE) {
+        mir_ctx_def_add(ctx, stmt->assign.from_value, bb, stmt_i);
+      }
+    }
+  }
+}
+
+// value holds the same data at each execution of stmt and everywhere it
+// dominates
+static int mir_ctx_is_stable(mir_ctx *ctx, const mir_value *value,
+                             const mir_bb *bb, size_t stmt_i) {
+  if (mir_value_set_contains(ctx->based, value)) {
+    return 0;
+  }
+
+  const mir_value_def *def = mir_ctx_def_find(ctx, value);
+  if (!def) {
+    return 1;
+  }
+  if (def->defs_cnt > 1) {
+    return 0;
+  }
+  if (def->bb == bb) {
+    return def->stmt_i < stmt_i;
+  }
+  return mir_dom_dominates(ctx->dom, def->bb, bb);
+}
+
+// returns expression of stmt if its result can be numbered
+static mir_expr *mir_ctx_expr_new(mir_ctx *ctx, const mir_stmt *stmt) {
+  mir_purity purity = mir_stmt_purity(stmt);
+  mir_value *ret    = mir_stmt_get_ret(stmt);
+  if (purity == MIR_PURITY_NONE || !ret ||
+      !mir_value_set_contains(ctx->plain, ret) ||
+      mir_value_set_contains(ctx->based, ret)) {
+    return NULL;
+  }
+
+  mir_expr *expr = mir_expr_new(stmt, purity);
+  for (size_t i = 0; i < expr->args_cnt; ++i) {
+    const mir_value *arg = expr->args[i];
+    // params are bound by caller, but scalar can't be a reference
+    int operand = mir_value_set_contains(ctx->plain, arg) ||
+                  (purity == MIR_PURITY_VALUE &&
+                   mir_value_set_contains(ctx->params, arg));
+    if (!operand) {
+      mir_expr_free(expr);
+      return NULL;
+    }
+  }
+  return expr;
+}
+
+// forgets expressions of current block that mention value or read storage
+static void mir_ctx_kill(mir_ctx *ctx, list_mir_expr_ref *local,
+                         const mir_value *value, int memory) {
+  size_t cnt = list_mir_expr_ref_size(local);
+  for (size_t i = 0; i < cnt; ++i) {
+    mir_expr *expr = list_mir_expr_ref_pop_front(local);
+    if ((value && mir_expr_mentions(expr, value)) ||
+        (memory && expr->purity == MIR_PURITY_MEMORY)) {
+      hashset_mir_expr_erase(ctx->avail,
+                             hashset_mir_expr_find(ctx->avail, expr));
+    } else {
+      list_mir_expr_ref_push_back(local, expr);
+    }
+  }
+}
+
+static void mir_ctx_erase(mir_ctx *ctx, list_mir_expr_ref *exprs) {
+  while (!list_mir_expr_ref_empty(exprs)) {
+    mir_expr *expr = list_mir_expr_ref_pop_front(exprs);
+    hashset_mir_expr_erase(ctx->avail, hashset_mir_expr_find(ctx->avail, expr));
+  }
+}
+
+static void mir_stmt_to_assign_value(mir_stmt *stmt, mir_value *from) {
+  mir_value *to = mir_stmt_get_ret(stmt);
+  stmt->kind              = MIR_STMT_ASSIGN;
+  stmt->assign.kind       = MIR_STMT_ASSIGN_VALUE;
+  stmt->assign.to         = to;
+  stmt->assign.from_value = from;
+}
+
+// walks dominator tree, expressions of dominating blocks are visible
+static void mir_ctx_bb_number(mir_ctx *ctx, const mir_dom_node *node) {
+  mir_bb            *bb     = node->bb;
+  list_mir_expr_ref *local  = list_mir_expr_ref_new();
+  list_mir_expr_ref *global = list_mir_expr_ref_new();
+
+  size_t stmt_i = 0;
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+       NEXT(it), ++stmt_i) {
+    mir_stmt *stmt = GET(it);
+    mir_expr *expr = mir_ctx_expr_new(ctx, stmt);
+
+    if (expr) {
+      hashset_mir_expr_it found = hashset_mir_expr_find(ctx->avail, expr);
+      if (!END(found)) {
+        if (GET(found)->ret != expr->ret) {
+          mir_stmt_to_assign_value(stmt, GET(found)->ret);
+        }
+        mir_expr_free(expr);
+        expr = NULL;
+      }
+    }
+
+    mir_value *ret = mir_stmt_get_ret(stmt);
+    if (ret) {
+      mir_ctx_kill(ctx, local, ret, 0);
+    }
+    if (stmt->kind == MIR_STMT_ASSIGN &&
+        stmt->assign.kind == MIR_STMT_ASSIGN_MOVE) {
+      mir_ctx_kill(ctx, local, stmt->assign.from_value, 0);
+    }
+    if (mir_stmt_writes_memory(stmt, ctx->plain)) {
+      mir_ctx_kill(ctx, local, NULL, 1);
+    }
+
+    // result overwrote operand
+    for (size_t i = 0; expr && i < expr->args_cnt; ++i) {
+      if (expr->args[i] == ret) {
+        mir_expr_free(expr);
+        expr = NULL;
+      }
+    }
+    if (!expr) {
+      continue;
+    }
+
+    int is_global = expr->purity == MIR_PURITY_VALUE &&
+                    mir_ctx_is_stable(ctx, ret, bb, stmt_i + 1);
+    for (size_t i = 0; is_global && i < expr->args_cnt; ++i) {
+      is_global = mir_ctx_is_stable(ctx, expr->args[i], bb, stmt_i);
+    }
+
+    hashset_mir_expr_insert(ctx->avail, expr);
+    list_mir_expr_ref_push_back(is_global ? global : local, expr);
+  }
+
+  mir_ctx_erase(ctx, local);
+
+  for (list_mir_dom_node_ref_it it =
+           list_mir_dom_node_ref_begin(node->children);
+       !END(it); NEXT(it)) {
+    mir_ctx_bb_number(ctx, GET(it));
+  }
+
+  mir_ctx_erase(ctx, global);
+
+  list_mir_expr_ref_free(global);
+  list_mir_expr_ref_free(local);
+}
+
+static void mir_ctx_gvn_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
+  if (vec_mir_bb_empty(sub->defined.bbs)) {
+    return;
+  }
+
+  ctx->sub    = sub;
+  ctx->dom    = mir_dom_new(sub);
+  ctx->plain  = hashset_mir_value_ref_new();
+  ctx->based  = hashset_mir_value_ref_new();
+  ctx->params = hashset_mir_value_ref_new();
+  ctx->defs   = hashset_mir_value_def_new();
+  ctx->avail  = hashset_mir_expr_new();
+
+  mir_sub_plain_insert(sub, ctx->plain);
+  mir_sub_based_insert(sub, ctx->based);
+  for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.params);
+       !END(it); NEXT(it)) {
+    hashset_mir_value_ref_insert(ctx->params, GET(it));
+  }
+  mir_ctx_defs_init(ctx, sub);
+
+  mir_ctx_bb_number(ctx, ctx->dom->root);
+
+  hashset_mir_expr_free(ctx->avail);
+  hashset_mir_value_def_free(ctx->defs);
+  hashset_mir_value_ref_free(ctx->params);
+  hashset_mir_value_ref_free(ctx->based);
+  hashset_mir_value_ref_free(ctx->plain);
+  mir_dom_free(ctx->dom);
+  ctx->avail  = NULL;
+  ctx->defs   = NULL;
+  ctx->params = NULL;
+  ctx->based  = NULL;
+  ctx->plain  = NULL;
+  ctx->dom    = NULL;
+  ctx->sub    = NULL;
+}
+
+mir_gvn_result mir_gvn(mir *mir) {
+  mir_gvn_result result = {
+      .exceptions = list_exception_new(),
+  };
+
+  mir_ctx ctx = {
+      .sub    = NULL,
+      .dom    = NULL,
+      .plain  = NULL,
+      .based  = NULL,
+      .params = NULL,
+      .defs   = NULL,
+      .avail  = NULL,
+  };
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_gvn_subroutine(&ctx, sub);
+    }
+  }
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->methods);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_gvn_subroutine(&ctx, sub);
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+
+typedef struct mir_gvn_result_struct {
+  list_exception *exceptions;
+} mir_gvn_result;
+
+// replaces pure ops and member loads that are already computed on the same
+// operands with assignment of the previous result. Results on scalar operands
+// are reused in dominated blocks, loads from storage only inside the block
+// until something may write it
+mir_gvn_result mir_gvn(mir *mir);
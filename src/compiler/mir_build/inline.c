@@ -0,0 +1,442 @@
+#include "inline.h"
+
+#include "compiler/mir_build/analysis.h"
+#include "compiler/mir_build/call_graph.h"
+#include "util/log.h"
+#include "util/macro.h"
+
+// callee is inlined when it has no more statements than this plus number of
+// its params and vars, each of them costs make_void and drop on every call
+#define MIR_INLINE_SIZE_BASE 8
+// caller is not grown further after it has this many statements
+#define MIR_INLINE_CALLER_MAX 1024
+
+// MIR_VALUE_PAIR
+typedef struct mir_value_pair_struct {
+  const mir_value *from;
+  mir_value       *to;
+} mir_value_pair;
+
+static mir_value_pair *mir_value_pair_new(const mir_value *from,
+                                          mir_value       *to) {
+  mir_value_pair *self = MALLOC(mir_value_pair);
+  self->from           = from;
+  self->to             = to;
+  return self;
+}
+
+static inline int container_cmp_mir_value_pair(const void *_lsv,
+                                               const void *_rsv) {
+  const mir_value_pair *lsv = _lsv;
+  const mir_value_pair *rsv = _rsv;
+  return container_cmp_ptr(lsv->from, rsv->from);
+}
+static inline void container_delete_mir_value_pair(void *data) { free(data); }
+static inline uint64_t container_hash_mir_value_pair(const void *data) {
+  const mir_value_pair *self = data;
+  return container_hash_ptr(self->from);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_value_pair, mir_value_pair,
+                              container_cmp_mir_value_pair, container_new_move,
+                              container_delete_mir_value_pair,
+                              container_hash_mir_value_pair);
+
+// MIR_BB_PAIR
+typedef struct mir_bb_pair_struct {
+  const mir_bb *from;
+  mir_bb       *to;
+} mir_bb_pair;
+
+static mir_bb_pair *mir_bb_pair_new(const mir_bb *from, mir_bb *to) {
+  mir_bb_pair *self = MALLOC(mir_bb_pair);
+  self->from        = from;
+  self->to          = to;
+  return self;
+}
+
+static inline int container_cmp_mir_bb_pair(const void *_lsv,
+                                            const void *_rsv) {
+  const mir_bb_pair *lsv = _lsv;
+  const mir_bb_pair *rsv = _rsv;
+  return container_cmp_ptr(lsv->from, rsv->from);
+}
+static inline void container_delete_mir_bb_pair(void *data) { free(data); }
+static inline uint64_t container_hash_mir_bb_pair(const void *data) {
+  const mir_bb_pair *self = data;
+  return container_hash_ptr(self->from);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_bb_pair, mir_bb_pair,
+                              container_cmp_mir_bb_pair, container_new_move,
+                              container_delete_mir_bb_pair,
+                              container_hash_mir_bb_pair);
+
+// CTX
+typedef struct mir_ctx_struct {
+  mir_call_graph *call_graph;
+  arena          *arena; // of mir
+  // caller
+  mir_subroutine *sub;
+  size_t          stmts_cnt;
+  size_t          value_cnt;
+  size_t          bb_cnt;
+  mir_value      *sink; // receives vars of inlined bodies to reset them
+  // callee
+  hashset_mir_value_pair *values;
+  hashset_mir_bb_pair    *bbs;
+} mir_ctx;
+
+static size_t mir_sub_stmts_cnt(const mir_subroutine *sub) {
+  size_t cnt = 0;
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    cnt += vec_mir_stmt_size(GET(it)->stmts);
+  }
+  return cnt;
+}
+
+static int mir_ctx_is_inlinable(mir_ctx *ctx, const mir_stmt *stmt) {
+  if (stmt->kind != MIR_STMT_CALL) {
+    return 0;
+  }
+
+  const mir_subroutine *callee = stmt->call.sub;
+  if (!callee || callee == ctx->sub ||
+      callee->kind != MIR_SUBROUTINE_DEFINED ||
+      (callee->spec & MIR_SUBROUTINE_SPEC_EXTERN) ||
+      vec_mir_bb_empty(callee->defined.bbs)) {
+    return 0;
+  }
+
+  const mir_call_node *node = mir_call_graph_find(ctx->call_graph, callee);
+  if (!node || node->recursive) {
+    return 0;
+  }
+
+  size_t args_cnt = stmt->call.args ? vec_mir_value_ref_size(stmt->call.args)
+                                    : 0;
+  if (args_cnt != vec_mir_value_size(callee->defined.params)) {
+    return 0;
+  }
+
+  size_t cost    = mir_sub_stmts_cnt(callee);
+  size_t benefit = vec_mir_value_size(callee->defined.params) +
+                   vec_mir_value_size(callee->defined.vars);
+
+  return cost <= MIR_INLINE_SIZE_BASE + benefit &&
+         ctx->stmts_cnt + cost <= MIR_INLINE_CALLER_MAX;
+}
+
+static mir_value *mir_ctx_tmp_new(mir_ctx *ctx, const type_entry *type_ref) {
+  mir_value *value = mir_value_new(ctx->arena, ctx->value_cnt++, NULL,
+                                   type_ref);
+  vec_mir_value_push_back(ctx->sub->defined.tmps, value);
+  return value;
+}
+
+static void mir_ctx_value_emplace(mir_ctx *ctx, const mir_value *from,
+                                  mir_value *to) {
+  hashset_mir_value_pair_insert(ctx->values, mir_value_pair_new(from, to));
+}
+
+// every value of callee is mapped, other values are left as is
+static mir_value *mir_ctx_value(mir_ctx *ctx, mir_value *value) {
+  if (!value) {
+    return NULL;
+  }
+  hashset_mir_value_pair_it it = hashset_mir_value_pair_find(
+      ctx->values, &(mir_value_pair){.from = value});
+  return END(it) ? value : GET(it)->to;
+}
+
+static mir_bb *mir_ctx_bb(mir_ctx *ctx, mir_bb *bb) {
+  if (!bb) {
+    return NULL;
+  }
+  hashset_mir_bb_pair_it it =
+      hashset_mir_bb_pair_find(ctx->bbs, &(mir_bb_pair){.from = bb});
+  return END(it) ? bb : GET(it)->to;
+}
+
+static vec_mir_value_ref *mir_ctx_args_clone(mir_ctx           *ctx,
+                                             vec_mir_value_ref *args) {
+  if (!args) {
+    return NULL;
+  }
+  vec_mir_value_ref *new_args = vec_mir_value_ref_new_arena(ctx->arena);
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(args); !END(it);
+       NEXT(it)) {
+    vec_mir_value_ref_push_back(new_args, mir_ctx_value(ctx, GET(it)));
+  }
+  return new_args;
+}
+
+static mir_stmt *mir_ctx_stmt_clone(mir_ctx *ctx, const mir_stmt *stmt) {
+  mir_stmt *new_stmt = NULL;
+
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      new_stmt = mir_stmt_new_op(ctx->arena, stmt->op.kind,
+                                 mir_ctx_value(ctx, stmt->op.ret),
+                                 mir_ctx_args_clone(ctx, stmt->op.args));
+      break;
+    case MIR_STMT_CALL:
+      new_stmt = mir_stmt_new_call(ctx->arena,
+                                   mir_ctx_value(ctx, stmt->call.ret),
+                                   stmt->call.sub,
+                                   mir_ctx_args_clone(ctx, stmt->call.args));
+      break;
+    case MIR_STMT_MEMBER:
+      new_stmt = mir_stmt_new_member(ctx->arena,
+                                     mir_ctx_value(ctx, stmt->member.ret),
+                                     mir_ctx_value(ctx, stmt->member.obj),
+                                     stmt->member.member);
+      break;
+    case MIR_STMT_MEMBER_REF:
+      new_stmt = mir_stmt_new_member_ref(ctx->arena,
+                                         mir_ctx_value(ctx, stmt->member.ret),
+                                         mir_ctx_value(ctx, stmt->member.obj),
+                                         stmt->member.member);
+      break;
+    case MIR_STMT_BUILTIN:
+      new_stmt =
+          mir_stmt_new_builtin(ctx->arena, stmt->builtin.kind,
+                               mir_ctx_value(ctx, stmt->builtin.ret),
+                               stmt->builtin.type,
+                               mir_ctx_args_clone(ctx, stmt->builtin.args));
+      break;
+    case MIR_STMT_ASSIGN: {
+      void *from = NULL;
+      switch (stmt->assign.kind) {
+        case MIR_STMT_ASSIGN_LIT:
+          from = stmt->assign.from_lit;
+          break;
+        case MIR_STMT_ASSIGN_VALUE:
+        case MIR_STMT_ASSIGN_MOVE:
+          from = mir_ctx_value(ctx, stmt->assign.from_value);
+          break;
+        case MIR_STMT_ASSIGN_SUB:
+          from = stmt->assign.from_sub;
+          break;
+      }
+      new_stmt = mir_stmt_new_assign(ctx->arena, stmt->assign.kind,
+                                     mir_ctx_value(ctx, stmt->assign.to), from);
+      break;
+    }
+  }
+
+  if (!new_stmt) {
+    error("unhandled mir stmt kind %d %p", stmt->kind, stmt);
+    return NULL;
+  }
+  // points to the source of callee
+  new_stmt->debug = stmt->debug;
+  return new_stmt;
+}
+
+static void mir_ctx_values_init(mir_ctx *ctx, const mir_stmt *call) {
+  const mir_subroutine *callee = call->call.sub;
+
+  // callee assigns result through pointer to the value of caller
+  mir_value *ret = call->call.ret;
+  if (!ret) {
+    ret = mir_ctx_tmp_new(ctx, callee->defined.ret->type_ref);
+  }
+  mir_ctx_value_emplace(ctx, callee->defined.ret, ret);
+
+  vec_mir_value *lists[] = {callee->defined.params, callee->defined.vars,
+                             callee->defined.tmps};
+  for (size_t i = 0; i < sizeof(lists) / sizeof(*lists); ++i) {
+    for (vec_mir_value_it it = vec_mir_value_begin(lists[i]); !END(it);
+         NEXT(it)) {
+      mir_ctx_value_emplace(ctx, GET(it),
+                            mir_ctx_tmp_new(ctx, GET(it)->type_ref));
+    }
+  }
+}
+
+// vars of callee start as void on each call, params are copied like in
+// prologue of callee
+static void mir_ctx_entry_init(mir_ctx *ctx, mir_bb *bb, const mir_stmt *call) {
+  const mir_subroutine *callee = call->call.sub;
+
+  for (vec_mir_value_it it = vec_mir_value_begin(callee->defined.vars);
+       !END(it); NEXT(it)) {
+    if (!ctx->sink) {
+      ctx->sink = mir_ctx_tmp_new(ctx, NULL);
+    }
+    mir_stmt *stmt = mir_stmt_new_assign(ctx->arena, MIR_STMT_ASSIGN_MOVE,
+                                         ctx->sink,
+                                         mir_ctx_value(ctx, GET(it)));
+    stmt->debug    = call->debug;
+    vec_mir_stmt_push_back(bb->stmts, stmt);
+  }
+
+  vec_mir_value_ref_it it_arg = vec_mir_value_ref_begin(call->call.args);
+  for (vec_mir_value_it it = vec_mir_value_begin(callee->defined.params);
+       !END(it); NEXT(it), NEXT(it_arg)) {
+    mir_stmt *stmt = mir_stmt_new_assign(ctx->arena, MIR_STMT_ASSIGN_VALUE,
+                                         mir_ctx_value(ctx, GET(it)),
+                                         GET(it_arg));
+    stmt->debug = call->debug;
+    vec_mir_stmt_push_back(bb->stmts, stmt);
+  }
+}
+
+// copies of callee blocks are appended to caller, returned block continues
+// after the call
+static mir_bb *mir_ctx_call_inline(mir_ctx *ctx, mir_bb *bb, mir_stmt *call) {
+  const mir_subroutine *callee = call->call.sub;
+
+  ctx->values = hashset_mir_value_pair_new();
+  ctx->bbs    = hashset_mir_bb_pair_new();
+
+  // split block at call
+  vec_mir_stmt *after = vec_mir_stmt_new_arena(ctx->arena);
+  {
+    vec_mir_stmt *before = vec_mir_stmt_new_arena(ctx->arena);
+    while (!vec_mir_stmt_empty(bb->stmts)) {
+      mir_stmt *stmt = vec_mir_stmt_pop_front(bb->stmts);
+      if (stmt == call) {
+        break;
+      }
+      vec_mir_stmt_push_back(before, stmt);
+    }
+    while (!vec_mir_stmt_empty(bb->stmts)) {
+      vec_mir_stmt_push_back(after, vec_mir_stmt_pop_front(bb->stmts));
+    }
+    bb->stmts = before;
+  }
+
+  mir_bb *cont = mir_bb_new(ctx->arena, ctx->bb_cnt++, after, bb->jmp.cond_ref,
+                            bb->jmp.je_ref, bb->jmp.jz_ref,
+                            list_hir_expr_ref_new_arena(ctx->arena));
+  cont->jmp.debug = bb->jmp.debug;
+
+  mir_ctx_values_init(ctx, call);
+  mir_ctx_entry_init(ctx, bb, call);
+
+  // blocks are created first, jumps are resolved after
+  for (vec_mir_bb_it it = vec_mir_bb_begin(callee->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb      *callee_bb = GET(it);
+    list_hir_expr_ref *hir_exprs = list_hir_expr_ref_new_arena(ctx->arena);
+    for (list_hir_expr_ref_it it_expr =
+             list_hir_expr_ref_begin(callee_bb->hir_exprs);
+         !END(it_expr); NEXT(it_expr)) {
+      list_hir_expr_ref_push_back(hir_exprs, GET(it_expr));
+    }
+
+    mir_bb *new_bb =
+        mir_bb_new(ctx->arena, ctx->bb_cnt++,
+                   vec_mir_stmt_new_arena(ctx->arena), NULL, NULL, NULL,
+                   hir_exprs);
+    hashset_mir_bb_pair_insert(ctx->bbs, mir_bb_pair_new(callee_bb, new_bb));
+    vec_mir_bb_push_back(ctx->sub->defined.bbs, new_bb);
+
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(callee_bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      mir_stmt *stmt = mir_ctx_stmt_clone(ctx, GET(it_stmt));
+      if (stmt) {
+        vec_mir_stmt_push_back(new_bb->stmts, stmt);
+        ctx->stmts_cnt += 1;
+      }
+    }
+  }
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(callee->defined.bbs); !END(it);
+       NEXT(it)) {
+    mir_bb *callee_bb = GET(it);
+    mir_bb *new_bb    = mir_ctx_bb(ctx, callee_bb);
+
+    new_bb->jmp.cond_ref = mir_ctx_value(ctx, callee_bb->jmp.cond_ref);
+    new_bb->jmp.je_ref   = mir_ctx_bb(ctx, callee_bb->jmp.je_ref);
+    new_bb->jmp.jz_ref   = mir_ctx_bb(ctx, callee_bb->jmp.jz_ref);
+    new_bb->jmp.debug    = callee_bb->jmp.debug;
+
+    // return from callee
+    if (mir_bb_get_cond(new_bb) == MIR_BB_TERM) {
+      new_bb->jmp.next_ref = cont;
+    }
+  }
+
+  bb->jmp.cond_ref = NULL;
+  bb->jmp.je_ref   = NULL;
+  bb->jmp.next_ref = mir_ctx_bb(ctx, vec_mir_bb_front(callee->defined.bbs));
+  bb->jmp.debug    = call->debug;
+
+  ctx->stmts_cnt -= 1;
+
+  hashset_mir_bb_pair_free(ctx->bbs);
+  hashset_mir_value_pair_free(ctx->values);
+  ctx->bbs    = NULL;
+  ctx->values = NULL;
+
+  return cont;
+}
+
+static void mir_ctx_inline_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
+  ctx->sub       = sub;
+  ctx->stmts_cnt = mir_sub_stmts_cnt(sub);
+  ctx->value_cnt = mir_sub_value_id_next(sub);
+  ctx->bb_cnt    = mir_sub_bb_id_next(sub);
+  ctx->sink      = NULL;
+
+  // inlined blocks go right after the block with call, continuation is
+  // scanned next
+  vec_mir_bb *old_bbs = sub->defined.bbs;
+  sub->defined.bbs    = vec_mir_bb_new_arena(ctx->arena);
+
+  while (!vec_mir_bb_empty(old_bbs)) {
+    mir_bb *bb = vec_mir_bb_pop_front(old_bbs);
+    vec_mir_bb_push_back(sub->defined.bbs, bb);
+
+    mir_stmt *call = NULL;
+    for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+         NEXT(it)) {
+      if (mir_ctx_is_inlinable(ctx, GET(it))) {
+        call = GET(it);
+        break;
+      }
+    }
+
+    if (call) {
+      vec_mir_bb_push_front(old_bbs, mir_ctx_call_inline(ctx, bb, call));
+    }
+  }
+
+  ctx->sub  = NULL;
+  ctx->sink = NULL;
+}
+
+mir_inline_result mir_inline(mir *mir) {
+  mir_inline_result result = {
+      .exceptions = list_exception_new(),
+  };
+
+  mir_ctx ctx = {
+      .call_graph = mir_call_graph_new(mir),
+      .arena      = mir->arena,
+      .sub        = NULL,
+      .stmts_cnt  = 0,
+      .value_cnt  = 0,
+      .bb_cnt     = 0,
+      .sink       = NULL,
+      .values     = NULL,
+      .bbs        = NULL,
+  };
+
+  for (list_mir_subroutine_ref_it it =
+           list_mir_subroutine_ref_begin(ctx.call_graph->postorder);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (!vec_mir_bb_empty(sub->defined.bbs)) {
+      mir_ctx_inline_subroutine(&ctx, sub);
+    }
+  }
+
+  mir_call_graph_free(ctx.call_graph);
+
+  return result;
+}
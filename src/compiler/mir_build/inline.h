@@ -0,0 +1,13 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+
+typedef struct mir_inline_result_struct {
+  list_exception *exceptions;
+} mir_inline_result;
+
+// replaces calls of small non-recursive subroutines with copies of their
+// blocks. Callees are processed before callers, so already inlined bodies are
+// copied. Copied statements keep debug info of the callee
+mir_inline_result mir_inline(mir *mir);
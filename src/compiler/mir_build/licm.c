@@ -0,0 +1,385 @@
+#include "licm.h"
+
+#include "compiler/mir_build/analysis.h"
+#include "compiler/mir_build/loop.h"
+#include "util/log.h"
+#include "util/macro.h"
+
+VEC_DECLARE_STATIC_INLINE(vec_mir_stmt_ref, mir_stmt, container_cmp_false,
+                          container_new_move, container_delete_false);
+
+// MIR_VALUE_DEF
+typedef struct mir_value_def_struct {
+  const mir_value *value;
+  size_t           defs_cnt;
+  const mir_bb    *bb;
+  const mir_stmt  *stmt; // the only definition
+} mir_value_def;
+
+static mir_value_def *mir_value_def_new(const mir_value *value,
+                                        const mir_bb    *bb,
+                                        const mir_stmt  *stmt) {
+  mir_value_def *self = MALLOC(mir_value_def);
+  self->value         = value;
+  self->defs_cnt      = 1;
+  self->bb            = bb;
+  self->stmt          = stmt;
+  return self;
+}
+
+static inline int container_cmp_mir_value_def(const void *_lsv,
+                                              const void *_rsv) {
+  const mir_value_def *lsv = _lsv;
+  const mir_value_def *rsv = _rsv;
+  return container_cmp_ptr(lsv->value, rsv->value);
+}
+static inline void container_delete_mir_value_def(void *data) { free(data); }
+static inline uint64_t container_hash_mir_value_def(const void *data) {
+  const mir_value_def *self = data;
+  return container_hash_ptr(self->value);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_value_def, mir_value_def,
+                              container_cmp_mir_value_def, container_new_move,
+                              container_delete_mir_value_def,
+                              container_hash_mir_value_def);
+
+// CTX
+typedef struct mir_ctx_struct {
+  arena                 *arena; // of mir
+  mir_subroutine        *sub;
+  mir_dom               *dom;
+  hashset_mir_value_ref *plain;
+  hashset_mir_value_ref *based;
+  hashset_mir_value_ref *params;
+  hashset_mir_value_def *defs;
+} mir_ctx;
+
+static mir_value_def *mir_ctx_def_find(mir_ctx *ctx, const mir_value *value) {
+  hashset_mir_value_def_it it = hashset_mir_value_def_find(
+      ctx->defs, &(mir_value_def){.value = value});
+  return END(it) ? NULL : GET(it);
+}
+
+static void mir_ctx_def_add(mir_ctx *ctx, const mir_value *value,
+                            const mir_bb *bb, const mir_stmt *stmt) {
+  mir_value_def *def = mir_ctx_def_find(ctx, value);
+  if (def) {
+    def->defs_cnt += 1;
+  } else {
+    hashset_mir_value_def_insert(ctx->defs, mir_value_def_new(value, bb, stmt));
+  }
+}
+
+// inserts values written by stmt, moved source is left void
+static void mir_stmt_defs_insert(const mir_stmt *stmt,
+                                 hashset_mir_value_ref *defs) {
+  mir_value *ret = mir_stmt_get_ret(stmt);
+  if (ret) {
+    hashset_mir_value_ref_insert(defs, ret);
+  }
+  if (stmt->kind == MIR_STMT_ASSIGN &&
+      stmt->assign.kind == MIR_STMT_ASSIGN_MOVE) {
+    hashset_mir_value_ref_insert(defs, stmt->assign.from_value);
+  }
+}
+
+static void mir_ctx_defs_init(mir_ctx *ctx) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(ctx->sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb = GET(it);
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      hashset_mir_value_ref *defs = hashset_mir_value_ref_new();
+      mir_stmt_defs_insert(GET(it_stmt), defs);
+      for (hashset_mir_value_ref_it it_def = hashset_mir_value_ref_begin(defs);
+           !END(it_def); NEXT(it_def)) {
+        mir_ctx_def_add(ctx, GET(it_def), bb, GET(it_stmt));
+      }
+      hashset_mir_value_ref_free(defs);
+    }
+  }
+}
+
+// each read of value happens after its definition
+static int mir_ctx_def_dominates_uses(mir_ctx *ctx, const mir_value_def *def) {
+  for (vec_mir_bb_it it = vec_mir_bb_begin(ctx->sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb = GET(it);
+    int           dominated =
+        bb == def->bb ? 0 : mir_dom_dominates(ctx->dom, def->bb, bb);
+
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+      if (stmt == def->stmt) {
+        dominated = 1;
+      } else if (!dominated && mir_stmt_reads_value(stmt, def->value)) {
+        return 0;
+      }
+    }
+
+    if (!dominated && bb->jmp.cond_ref == def->value) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+// HOIST
+typedef struct mir_loop_ctx_struct {
+  const mir_loop        *loop;
+  mir_bb                *preheader;
+  hashset_mir_value_ref *defs; // values written inside the loop
+  int                    writes_memory;
+} mir_loop_ctx;
+
+static int mir_ctx_operand_is_invariant(mir_ctx *ctx, mir_loop_ctx *loop_ctx,
+                                        const mir_value *value,
+                                        mir_purity       purity) {
+  if (mir_value_set_contains(loop_ctx->defs, value)) {
+    return 0;
+  }
+  // params are bound by caller, but scalar can't be a reference
+  return mir_value_set_contains(ctx->plain, value) ||
+         (purity == MIR_PURITY_VALUE &&
+          mir_value_set_contains(ctx->params, value));
+}
+
+static int mir_ctx_stmt_is_invariant(mir_ctx *ctx, mir_loop_ctx *loop_ctx,
+                                     const mir_stmt *stmt) {
+  mir_purity purity;
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      // division by zero traps, it can't be executed speculatively
+      if (stmt->op.kind == MIR_STMT_OP_BINARY_DIV ||
+          stmt->op.kind == MIR_STMT_OP_BINARY_REM) {
+        return 0;
+      }
+      purity = mir_stmt_purity(stmt);
+      break;
+    case MIR_STMT_MEMBER:
+      purity = mir_stmt_purity(stmt);
+      break;
+    case MIR_STMT_ASSIGN:
+      if (stmt->assign.kind != MIR_STMT_ASSIGN_LIT) {
+        return 0;
+      }
+      purity = MIR_PURITY_VALUE;
+      break;
+    default:
+      return 0;
+  }
+
+  if (purity == MIR_PURITY_NONE ||
+      (purity == MIR_PURITY_MEMORY && loop_ctx->writes_memory)) {
+    return 0;
+  }
+
+  mir_value *ret = mir_stmt_get_ret(stmt);
+  if (!mir_value_set_contains(ctx->plain, ret) ||
+      mir_value_set_contains(ctx->based, ret)) {
+    return 0;
+  }
+
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(stmt->op.args);
+           !END(it); NEXT(it)) {
+        if (!mir_ctx_operand_is_invariant(ctx, loop_ctx, GET(it), purity)) {
+          return 0;
+        }
+      }
+      break;
+    case MIR_STMT_MEMBER:
+      if (!mir_ctx_operand_is_invariant(ctx, loop_ctx, stmt->member.obj,
+                                        purity)) {
+        return 0;
+      }
+      break;
+    default:
+      break;
+  }
+
+  // result keeps the value computed in preheader through the loop
+  const mir_value_def *def = mir_ctx_def_find(ctx, ret);
+  return def->defs_cnt == 1 && mir_ctx_def_dominates_uses(ctx, def);
+}
+
+static void mir_ctx_bb_hoist(mir_ctx *ctx, mir_loop_ctx *loop_ctx,
+                             mir_bb *bb, int *changed) {
+  vec_mir_stmt_ref *hoisted = vec_mir_stmt_ref_new();
+
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+       NEXT(it)) {
+    mir_stmt *stmt = GET(it);
+    if (mir_ctx_stmt_is_invariant(ctx, loop_ctx, stmt)) {
+      // operands defined by hoisted stmt are invariant for the rest
+      mir_value_set_erase(loop_ctx->defs, mir_stmt_get_ret(stmt));
+      vec_mir_stmt_ref_push_back(hoisted, stmt);
+    }
+  }
+
+  if (vec_mir_stmt_ref_empty(hoisted)) {
+    vec_mir_stmt_ref_free(hoisted);
+    return;
+  }
+  *changed = 1;
+
+  vec_mir_stmt *new_stmts = vec_mir_stmt_new_arena(ctx->arena);
+  while (!vec_mir_stmt_empty(bb->stmts)) {
+    mir_stmt *stmt = vec_mir_stmt_pop_front(bb->stmts);
+
+    if (!vec_mir_stmt_ref_empty(hoisted) &&
+        vec_mir_stmt_ref_front(hoisted) == stmt) {
+      vec_mir_stmt_ref_pop_front(hoisted);
+      vec_mir_stmt_push_back(loop_ctx->preheader->stmts, stmt);
+      mir_ctx_def_find(ctx, mir_stmt_get_ret(stmt))->bb = loop_ctx->preheader;
+    } else {
+      vec_mir_stmt_push_back(new_stmts, stmt);
+    }
+  }
+
+  bb->stmts = new_stmts;
+
+  vec_mir_stmt_ref_free(hoisted);
+}
+
+static void mir_ctx_loop_hoist(mir_ctx *ctx, const mir_loop *loop,
+                               mir_bb *preheader) {
+  mir_loop_ctx loop_ctx = {
+      .loop          = loop,
+      .preheader     = preheader,
+      .defs          = hashset_mir_value_ref_new(),
+      .writes_memory = 0,
+  };
+
+  for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(loop->bbs); !END(it);
+       NEXT(it)) {
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(GET(it)->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      const mir_stmt *stmt = GET(it_stmt);
+      mir_stmt_defs_insert(stmt, loop_ctx.defs);
+      loop_ctx.writes_memory |= mir_stmt_writes_memory(stmt, ctx->plain);
+    }
+  }
+
+  int changed = 1;
+  while (changed) {
+    changed = 0;
+    for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(loop->bbs); !END(it);
+         NEXT(it)) {
+      mir_ctx_bb_hoist(ctx, &loop_ctx, GET(it), &changed);
+    }
+  }
+
+  hashset_mir_value_ref_free(loop_ctx.defs);
+}
+
+// the only predecessor of header outside of loop
+static mir_bb *mir_ctx_loop_preheader(mir_ctx *ctx, const mir_loop *loop) {
+  const mir_dom_node *node = mir_dom_find(ctx->dom, loop->header);
+  for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(node->preds); !END(it);
+       NEXT(it)) {
+    if (!mir_loop_contains(loop, GET(it))) {
+      return GET(it);
+    }
+  }
+  error("loop header %zu has no preheader", loop->header->id);
+  return NULL;
+}
+
+static void mir_ctx_licm_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
+  if (vec_mir_bb_empty(sub->defined.bbs)) {
+    return;
+  }
+
+  ctx->sub = sub;
+  ctx->dom = mir_dom_new(sub);
+
+  list_mir_loop *loops = mir_loops_new(ctx->dom);
+  if (list_mir_loop_empty(loops)) {
+    list_mir_loop_free(loops);
+    mir_dom_free(ctx->dom);
+    ctx->dom = NULL;
+    ctx->sub = NULL;
+    return;
+  }
+
+  size_t id = mir_sub_bb_id_next(sub);
+  for (list_mir_loop_it it = list_mir_loop_begin(loops); !END(it); NEXT(it)) {
+    mir_loop_preheader_insert(GET(it), ctx->arena, sub, id++);
+  }
+  list_mir_loop_free(loops);
+  mir_dom_free(ctx->dom);
+
+  // preheaders of inner loops are part of outer loops
+  ctx->dom    = mir_dom_new(sub);
+  loops       = mir_loops_new(ctx->dom);
+  ctx->plain  = hashset_mir_value_ref_new();
+  ctx->based  = hashset_mir_value_ref_new();
+  ctx->params = hashset_mir_value_ref_new();
+  ctx->defs   = hashset_mir_value_def_new();
+
+  mir_sub_plain_insert(sub, ctx->plain);
+  mir_sub_based_insert(sub, ctx->based);
+  for (vec_mir_value_it it = vec_mir_value_begin(sub->defined.params);
+       !END(it); NEXT(it)) {
+    hashset_mir_value_ref_insert(ctx->params, GET(it));
+  }
+  mir_ctx_defs_init(ctx);
+
+  for (list_mir_loop_it it = list_mir_loop_begin(loops); !END(it); NEXT(it)) {
+    mir_bb *preheader = mir_ctx_loop_preheader(ctx, GET(it));
+    if (preheader) {
+      mir_ctx_loop_hoist(ctx, GET(it), preheader);
+    }
+  }
+
+  list_mir_loop_free(loops);
+  hashset_mir_value_def_free(ctx->defs);
+  hashset_mir_value_ref_free(ctx->params);
+  hashset_mir_value_ref_free(ctx->based);
+  hashset_mir_value_ref_free(ctx->plain);
+  mir_dom_free(ctx->dom);
+  ctx->defs   = NULL;
+  ctx->params = NULL;
+  ctx->based  = NULL;
+  ctx->plain  = NULL;
+  ctx->dom    = NULL;
+  ctx->sub    = NULL;
+}
+
+mir_licm_result mir_licm(mir *mir) {
+  mir_licm_result result = {
+      .exceptions = list_exception_new(),
+  };
+
+  mir_ctx ctx = {
+      .arena  = mir->arena,
+      .sub    = NULL,
+      .dom    = NULL,
+      .plain  = NULL,
+      .based  = NULL,
+      .params = NULL,
+      .defs   = NULL,
+  };
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_licm_subroutine(&ctx, sub);
+    }
+  }
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->methods);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_licm_subroutine(&ctx, sub);
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+
+typedef struct mir_licm_result_struct {
+  list_exception *exceptions;
+} mir_licm_result;
+
+// inserts preheaders before natural loops and moves there pure statements and
+// literal assignments whose operands are not written inside the loop
+mir_licm_result mir_licm(mir *mir);
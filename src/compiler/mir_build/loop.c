@@ -0,0 +1,152 @@
+#include "loop.h"
+
+#include "util/macro.h"
+
+static mir_loop *mir_loop_new(mir_bb *header) {
+  mir_loop *self = MALLOC(mir_loop);
+  self->header   = header;
+  self->body     = hashset_mir_bb_ref_new();
+  self->bbs      = vec_mir_bb_ref_new();
+  return self;
+}
+
+void mir_loop_free(mir_loop *self) {
+  if (self) {
+    hashset_mir_bb_ref_free(self->body);
+    vec_mir_bb_ref_free(self->bbs);
+    free(self);
+  }
+}
+
+int mir_loop_contains(const mir_loop *self, const mir_bb *bb) {
+  hashset_mir_bb_ref_it it =
+      hashset_mir_bb_ref_find(self->body, (mir_bb *)bb);
+  return !END(it);
+}
+
+// walks predecessors backwards from latch until header
+static void mir_loop_body_insert(mir_loop *self, const mir_dom *dom,
+                                 mir_bb *latch) {
+  vec_mir_bb_ref *worklist = vec_mir_bb_ref_new();
+  vec_mir_bb_ref_push_back(worklist, latch);
+
+  while (!vec_mir_bb_ref_empty(worklist)) {
+    mir_bb *bb = vec_mir_bb_ref_pop_front(worklist);
+    if (mir_loop_contains(self, bb)) {
+      continue;
+    }
+    hashset_mir_bb_ref_insert(self->body, bb);
+
+    const mir_dom_node *node = mir_dom_find(dom, bb);
+    for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(node->preds); !END(it);
+         NEXT(it)) {
+      vec_mir_bb_ref_push_back(worklist, GET(it));
+    }
+  }
+
+  vec_mir_bb_ref_free(worklist);
+}
+
+static mir_loop *mir_loops_find(list_mir_loop *loops, const mir_bb *header) {
+  for (list_mir_loop_it it = list_mir_loop_begin(loops); !END(it); NEXT(it)) {
+    if (GET(it)->header == header) {
+      return GET(it);
+    }
+  }
+  return NULL;
+}
+
+list_mir_loop *mir_loops_new(const mir_dom *dom) {
+  list_mir_loop *loops = list_mir_loop_new();
+
+  for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(dom->rpo); !END(it);
+       NEXT(it)) {
+    mir_bb *bb      = GET(it);
+    mir_bb *succs[] = {bb->jmp.je_ref, bb->jmp.jz_ref};
+
+    for (size_t i = 0; i < sizeof(succs) / sizeof(*succs); ++i) {
+      mir_bb *header = succs[i];
+      if (!header || !mir_dom_dominates(dom, header, bb)) {
+        continue;
+      }
+
+      mir_loop *loop = mir_loops_find(loops, header);
+      if (!loop) {
+        loop = mir_loop_new(header);
+        // header stops the walk
+        hashset_mir_bb_ref_insert(loop->body, header);
+        list_mir_loop_push_back(loops, loop);
+      }
+      mir_loop_body_insert(loop, dom, bb);
+    }
+  }
+
+  for (list_mir_loop_it it = list_mir_loop_begin(loops); !END(it); NEXT(it)) {
+    mir_loop *loop = GET(it);
+    for (vec_mir_bb_ref_it it_bb = vec_mir_bb_ref_begin(dom->rpo);
+         !END(it_bb); NEXT(it_bb)) {
+      if (mir_loop_contains(loop, GET(it_bb))) {
+        vec_mir_bb_ref_push_back(loop->bbs, GET(it_bb));
+      }
+    }
+  }
+
+  // inner loop has smaller body than the loop that contains it
+  list_mir_loop *sorted = list_mir_loop_new();
+  while (!list_mir_loop_empty(loops)) {
+    mir_loop *inner = NULL;
+    for (list_mir_loop_it it = list_mir_loop_begin(loops); !END(it);
+         NEXT(it)) {
+      if (!inner || vec_mir_bb_ref_size(GET(it)->bbs) <
+                        vec_mir_bb_ref_size(inner->bbs)) {
+        inner = GET(it);
+      }
+    }
+
+    list_mir_loop *rest = list_mir_loop_new();
+    while (!list_mir_loop_empty(loops)) {
+      mir_loop *loop = list_mir_loop_pop_front(loops);
+      if (loop == inner) {
+        list_mir_loop_push_back(sorted, loop);
+      } else {
+        list_mir_loop_push_back(rest, loop);
+      }
+    }
+    list_mir_loop_free(loops);
+    loops = rest;
+  }
+  list_mir_loop_free(loops);
+
+  return sorted;
+}
+
+mir_bb *mir_loop_preheader_insert(const mir_loop *self, arena *arena,
+                                  mir_subroutine *sub, size_t id) {
+  mir_bb *preheader =
+      mir_bb_new(arena, id, vec_mir_stmt_new_arena(arena), NULL, NULL,
+                 self->header, list_hir_expr_ref_new_arena(arena));
+
+  vec_mir_bb *new_bbs = vec_mir_bb_new_arena(arena);
+  while (!vec_mir_bb_empty(sub->defined.bbs)) {
+    mir_bb *bb = vec_mir_bb_pop_front(sub->defined.bbs);
+
+    if (!mir_loop_contains(self, bb)) {
+      if (bb->jmp.je_ref == self->header) {
+        bb->jmp.je_ref = preheader;
+      }
+      if (bb->jmp.jz_ref == self->header) {
+        bb->jmp.jz_ref = preheader;
+      }
+    }
+
+    // preheader of entry becomes the entry
+    if (bb == self->header) {
+      vec_mir_bb_push_back(new_bbs, preheader);
+    }
+    vec_mir_bb_push_back(new_bbs, bb);
+  }
+
+  sub->defined.bbs = new_bbs;
+
+  return preheader;
+}
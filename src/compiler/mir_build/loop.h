@@ -0,0 +1,28 @@
+#pragma once
+
+#include "compiler/mir_build/dominance.h"
+
+// natural loop, header dominates the source of every back edge into it
+typedef struct mir_loop_struct {
+  mir_bb             *header;
+  hashset_mir_bb_ref *body; // includes header
+  vec_mir_bb_ref     *bbs;  // body in reverse postorder
+} mir_loop;
+
+void mir_loop_free(mir_loop *self);
+
+static inline void container_delete_mir_loop(void *data) {
+  mir_loop_free(data);
+}
+LIST_DECLARE_STATIC_INLINE(list_mir_loop, mir_loop, container_cmp_false,
+                           container_new_move, container_delete_mir_loop);
+
+// loops with the same header are merged, inner loops go first
+list_mir_loop *mir_loops_new(const mir_dom *dom);
+
+int mir_loop_contains(const mir_loop *self, const mir_bb *bb);
+
+// inserts empty block before header, all edges into header from outside of
+// the loop are redirected to it. Returns the new block
+mir_bb *mir_loop_preheader_insert(const mir_loop *self, arena *arena,
+                                  mir_subroutine *sub, size_t id);
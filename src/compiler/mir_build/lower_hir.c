@@ -15,29 +15,15 @@
 // - map[hir_subroutine] -> mir_subroutine
 // - instantiate mir_subroutines that are actually used
 
-// TYPE_REF
-static inline int container_cmp_type_ref(const void *lsv, const void *rsv) {
-  const type_base *l = lsv;
-  const type_base *r = rsv;
-  return type_cmp(l, r);
-}
-static inline uint64_t container_hash_type_ref(const void *lsv) {
-  const type_base *l = lsv;
-  return type_hash(l);
-}
-HASHSET_DECLARE_STATIC_INLINE(hashset_type_ref, type_base,
-                              container_cmp_type_ref, container_new_move,
-                              container_delete_false, container_hash_type_ref);
-
-// SYMBOL_ENTRY (compares by symbol name)
+// SYMBOL_ENTRY (compares by symbol name, names are interned)
 static inline int container_cmp_symbol_entry(const void *lsv, const void *rsv) {
   const symbol_entry *l = lsv;
   const symbol_entry *r = rsv;
-  return container_cmp_chars(l->name, r->name);
+  return container_cmp_ptr(l->name, r->name);
 }
 static inline uint64_t container_hash_symbol_entry(const void *lsv) {
   const symbol_entry *l = lsv;
-  return container_hash_chars(l->name);
+  return container_hash_ptr(l->name);
 }
 HASHSET_DECLARE_STATIC_INLINE(hashset_symbol_entry, symbol_entry,
                               container_cmp_symbol_entry, container_new_move,
@@ -171,7 +157,6 @@ HASHSET_DECLARE_STATIC_INLINE(hashset_mir_name_entry, mir_name_entry,
 typedef struct mir_ctx_struct {
   hashset_mir_sym_entry  *map_sym_sub;
   size_t                  lit_cnt;
-  hashset_type_ref       *registered_types;
   hashset_mir_type_entry *map_type_hir_class;
   hashset_mir_type_entry *map_type_mir_class;
 
@@ -194,7 +179,6 @@ static void mir_ctx_init(mir_ctx *ctx, mir *mir, const type_table *type_table,
                          list_exception *exceptions) {
   ctx->map_sym_sub        = hashset_mir_sym_entry_new();
   ctx->lit_cnt            = 0;
-  ctx->registered_types   = hashset_type_ref_new();
   ctx->map_type_hir_class = hashset_mir_type_entry_new();
   ctx->map_type_mir_class = hashset_mir_type_entry_new();
 
@@ -215,7 +199,6 @@ static void mir_ctx_init(mir_ctx *ctx, mir *mir, const type_table *type_table,
 static void mir_ctx_deinit(mir_ctx *ctx) {
   hashset_mir_sym_entry_free(ctx->map_sym_sub);
   ctx->lit_cnt = 0;
-  hashset_type_ref_free(ctx->registered_types);
   hashset_mir_type_entry_free(ctx->map_type_hir_class);
   hashset_mir_type_entry_free(ctx->map_type_mir_class);
 
@@ -278,18 +261,6 @@ static mir_class *mir_ctx_type_mir_class_find(mir_ctx          *ctx,
   return NULL;
 }
 
-static mir_class *mir_ctx_type_mir_class_erase(mir_ctx *ctx,
-                                               const mir_class *class) {
-  hashset_mir_type_entry_it it = hashset_mir_type_entry_find(
-      ctx->map_type_mir_class, &(mir_type_entry){.type_ref = class->type_ref});
-  if (!END(it)) {
-    mir_class *class = GET(it)->entry_ref;
-    hashset_mir_type_entry_erase(ctx->map_type_mir_class, it);
-    return class;
-  }
-  return NULL;
-}
-
 static void mir_ctx_type_mir_class_emplace(mir_ctx          *ctx,
                                            const type_entry *type_ref,
                                            const mir_class *class) {
@@ -299,10 +270,6 @@ static void mir_ctx_type_mir_class_emplace(mir_ctx          *ctx,
 }
 
 static void mir_ctx_setup(mir_ctx *ctx, const hir *hir) {
-  for (list_type_entry_it it = list_type_entry_begin(ctx->type_table->entries);
-       !END(it); NEXT(it)) {
-    hashset_type_ref_insert(ctx->registered_types, GET(it)->type);
-  }
   // used for lazy instantiation of classes
   for (list_hir_class_it it = list_hir_class_begin(hir->classes); !END(it);
        NEXT(it)) {
@@ -310,16 +277,13 @@ static void mir_ctx_setup(mir_ctx *ctx, const hir *hir) {
     mir_ctx_type_hir_class_emplace(ctx, class->type_ref, class);
   }
 
-  // add any type to type table
+  // any type is interned in type table by bind
   type_base *type_any =
       (typeof(type_any))type_primitive_new(TYPE_PRIMITIVE_ANY);
 
-  hashset_type_ref_it it =
-      hashset_type_ref_find(ctx->registered_types, type_any);
-  if (END(it)) {
+  ctx->type_any = type_table_find(ctx->type_table, type_any);
+  if (!ctx->type_any) {
     error("type any is not present in type table");
-  } else {
-    ctx->type_any = GET(it)->type_entry_ref;
   }
 
   type_free(type_any);
@@ -351,9 +315,10 @@ static mir_value *mir_ctx_sym_value_find(mir_ctx            *ctx,
 }
 
 static mir_bb *mir_ctx_sub_emplace_back_bb(mir_ctx *ctx) {
-  mir_bb *bb = mir_bb_new(ctx->bb_cnt++, list_mir_stmt_new(), NULL, NULL, NULL,
-                          list_hir_expr_ref_new());
-  list_mir_bb_push_back(ctx->sub_ref->defined.bbs, bb);
+  mir_bb *bb = mir_bb_new(ctx->mir->arena, ctx->bb_cnt++,
+                          vec_mir_stmt_new_arena(ctx->mir->arena), NULL, NULL,
+                          NULL, list_hir_expr_ref_new_arena(ctx->mir->arena));
+  vec_mir_bb_push_back(ctx->sub_ref->defined.bbs, bb);
   return bb;
 }
 
@@ -404,8 +369,8 @@ static mir_subroutine *mir_declare_subroutine(mir_ctx              *ctx,
   mir_subroutine_spec spec = mir_declare_subroutine_spec(ctx, sub_hir->spec);
 
   if (!sub_hir->body) {
-    return mir_subroutine_new_declared(sub_hir->id_ref, sub_hir->type_ref,
-                                       spec);
+    return mir_subroutine_new_declared(ctx->mir->arena, sub_hir->id_ref,
+                                       sub_hir->type_ref, spec);
   }
 
   switch (sub_hir->body->kind) {
@@ -413,11 +378,14 @@ static mir_subroutine *mir_declare_subroutine(mir_ctx              *ctx,
       const hir_lit *lib_lit   = sub_hir->body->body.import.lib;
       const hir_lit *entry_lit = sub_hir->body->body.import.entry;
 
-      char *lib   = lib_lit ? strdup(lib_lit->value.v_str) : NULL;
-      char *entry = entry_lit ? strdup(entry_lit->value.v_str) : NULL;
+      char *lib =
+          lib_lit ? arena_strdup(ctx->mir->arena, lib_lit->value.v_str) : NULL;
+      char *entry = entry_lit
+                        ? arena_strdup(ctx->mir->arena, entry_lit->value.v_str)
+                        : NULL;
 
-      return mir_subroutine_new_imported(sub_hir->id_ref, sub_hir->type_ref,
-                                         spec, lib, entry);
+      return mir_subroutine_new_imported(ctx->mir->arena, sub_hir->id_ref,
+                                         sub_hir->type_ref, spec, lib, entry);
     }
     case HIR_SUBROUTINE_BODY_BLOCK: {
       union {
@@ -440,22 +408,23 @@ static mir_subroutine *mir_declare_subroutine(mir_ctx              *ctx,
 
       const type_base *type_ret = type.callable->ret_ref;
 
-      mir_value *ret_value =
-          mir_value_new(ctx->value_cnt++, NULL, type_ret->type_entry_ref);
+      mir_value *ret_value = mir_value_new(ctx->mir->arena, ctx->value_cnt++,
+                                           NULL, type_ret->type_entry_ref);
 
-      list_mir_value *params = list_mir_value_new();
+      vec_mir_value *params = vec_mir_value_new_arena(ctx->mir->arena);
       for (list_hir_param_it it = list_hir_param_begin(sub_hir->params);
            !END(it); NEXT(it)) {
         const hir_param *param_hir = GET(it);
 
-        mir_value *param = mir_value_new(ctx->value_cnt++, param_hir->id_ref,
+        mir_value *param = mir_value_new(ctx->mir->arena, ctx->value_cnt++,
+                                         param_hir->id_ref,
                                          param_hir->type_ref);
-        list_mir_value_push_back(params, param);
+        vec_mir_value_push_back(params, param);
       }
 
-      return mir_subroutine_new_defined(sub_hir->id_ref, sub_hir->type_ref,
-                                        spec, ret_value, params, NULL, NULL,
-                                        NULL);
+      return mir_subroutine_new_defined(ctx->mir->arena, sub_hir->id_ref,
+                                        sub_hir->type_ref, spec, ret_value,
+                                        params, NULL, NULL, NULL);
     }
   }
   error("unexpected subroutine body kind %d %p", sub_hir->body->kind, sub_hir);
@@ -466,14 +435,14 @@ static mir_subroutine *mir_declare_subroutine(mir_ctx              *ctx,
 static mir_expr_r mir_define_expr(mir_ctx *ctx, const hir_expr_base *expr,
                                   mir_expr_o opts);
 
-static list_mir_value_ref *mir_define_mir_value_args(mir_value *first_ref,
-                                                     ...) {
-  list_mir_value_ref *args = list_mir_value_ref_new();
+static vec_mir_value_ref *mir_define_mir_value_args(mir_ctx   *ctx,
+                                                    mir_value *first_ref, ...) {
+  vec_mir_value_ref *args = vec_mir_value_ref_new_arena(ctx->mir->arena);
 
   if (first_ref == NULL) {
     return args;
   }
-  list_mir_value_ref_push_back(args, first_ref);
+  vec_mir_value_ref_push_back(args, first_ref);
 
   va_list ap;
   va_start(ap, first_ref);
@@ -483,7 +452,7 @@ static list_mir_value_ref *mir_define_mir_value_args(mir_value *first_ref,
     if (arg == NULL) {
       break;
     }
-    list_mir_value_ref_push_back(args, arg);
+    vec_mir_value_ref_push_back(args, arg);
   }
 
   va_end(ap);
@@ -493,14 +462,15 @@ static list_mir_value_ref *mir_define_mir_value_args(mir_value *first_ref,
 // returns reference
 static mir_value *mir_define_mir_value_tmp(mir_ctx          *ctx,
                                            const type_entry *type_ref) {
-  mir_value *res = mir_value_new(ctx->value_cnt++, NULL, type_ref);
-  list_mir_value_push_back(ctx->sub_ref->defined.tmps, res);
+  mir_value *res = mir_value_new(ctx->mir->arena, ctx->value_cnt++, NULL,
+                                 type_ref);
+  vec_mir_value_push_back(ctx->sub_ref->defined.tmps, res);
   return res;
 }
 
 // returns reference
 static mir_stmt *mir_define_mir_stmt(mir_ctx *ctx, mir_stmt *stmt) {
-  list_mir_stmt_push_back(ctx->bb_ref->stmts, stmt);
+  vec_mir_stmt_push_back(ctx->bb_ref->stmts, stmt);
   return stmt;
 }
 
@@ -559,7 +529,7 @@ static mir_lit *mir_define_mir_lit(mir_ctx *ctx, const hir_expr_lit *expr) {
       value.v_char = (uint8_t)hir_value.v_char[0];
       break;
     case TYPE_PRIMITIVE_STRING:
-      value.v_str = (uint8_t *)strdup(hir_value.v_str);
+      value.v_str = (uint8_t *)arena_strdup(ctx->mir->arena, hir_value.v_str);
       break;
     case TYPE_PRIMITIVE_VOID:
       value.v_bool = 0;
@@ -569,7 +539,7 @@ static mir_lit *mir_define_mir_lit(mir_ctx *ctx, const hir_expr_lit *expr) {
       value.v_bool = 0;
   }
 
-  mir_lit *lit = mir_lit_new(ctx->lit_cnt++, entry_ref, value);
+  mir_lit *lit = mir_lit_new(ctx->mir->arena, ctx->lit_cnt++, entry_ref, value);
   list_mir_lit_push_back(ctx->mir->literals, lit);
   return lit;
 }
@@ -581,8 +551,8 @@ static mir_value *mir_define_expr_deref(mir_ctx *ctx, const mir_expr_r *mir_r,
 
   mir_value *rvalue     = mir_define_mir_value_tmp(ctx, ctx->type_any);
   mir_stmt  *stmt_deref = mir_define_mir_stmt(
-      ctx, mir_stmt_new_op(MIR_STMT_OP_DEREF, rvalue,
-                            mir_define_mir_value_args(mir_r->ret, NULL)));
+      ctx, mir_stmt_new_op(ctx->mir->arena, MIR_STMT_OP_DEREF, rvalue,
+                            mir_define_mir_value_args(ctx, mir_r->ret, NULL)));
 
   value = rvalue;
 
@@ -597,7 +567,9 @@ static mir_expr_r mir_define_expr_unary_generic(mir_ctx              *ctx,
   mir_value *first = mir_define_expr(ctx, expr->first, mir_expr_o_make(0)).ret;
   mir_value *ret   = mir_define_mir_value_tmp(ctx, ctx->type_any);
   mir_stmt  *stmt  = mir_define_mir_stmt(
-      ctx, mir_stmt_new_op(op, ret, mir_define_mir_value_args(first, NULL)));
+      ctx,
+      mir_stmt_new_op(ctx->mir->arena, op, ret,
+                      mir_define_mir_value_args(ctx, first, NULL)));
 
   mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -685,12 +657,15 @@ static mir_expr_r mir_define_expr_unary(mir_ctx              *ctx,
       mir_value *ret = mir_define_mir_value_tmp(ctx, ctx->type_any);
 
       mir_stmt *stmt_inc = mir_define_mir_stmt(
-          ctx, mir_stmt_new_op(MIR_STMT_OP_UNARY_INC, ret,
-                               mir_define_mir_value_args(first_deref, NULL)));
+          ctx,
+          mir_stmt_new_op(ctx->mir->arena, MIR_STMT_OP_UNARY_INC, ret,
+                          mir_define_mir_value_args(ctx, first_deref, NULL)));
 
       // save tmp result to actual value (preserve reference)
       mir_stmt *stmt_ass = mir_define_mir_stmt(
-          ctx, mir_stmt_new_assign(MIR_STMT_ASSIGN_VALUE, first_r.ret, ret));
+          ctx,
+          mir_stmt_new_assign(ctx->mir->arena, MIR_STMT_ASSIGN_VALUE,
+                              first_r.ret, ret));
 
       mir_stmt_debug_init_span(stmt_inc, expr->base.base.span);
       mir_stmt_debug_init_span(stmt_ass, expr->base.base.span);
@@ -712,12 +687,15 @@ static mir_expr_r mir_define_expr_unary(mir_ctx              *ctx,
       mir_value *ret = mir_define_mir_value_tmp(ctx, ctx->type_any);
 
       mir_stmt *stmt_inc = mir_define_mir_stmt(
-          ctx, mir_stmt_new_op(MIR_STMT_OP_UNARY_DEC, ret,
-                               mir_define_mir_value_args(first_deref, NULL)));
+          ctx,
+          mir_stmt_new_op(ctx->mir->arena, MIR_STMT_OP_UNARY_DEC, ret,
+                          mir_define_mir_value_args(ctx, first_deref, NULL)));
 
       // save tmp result to actual value (preserve reference)
       mir_stmt *stmt_ass = mir_define_mir_stmt(
-          ctx, mir_stmt_new_assign(MIR_STMT_ASSIGN_VALUE, first_r.ret, ret));
+          ctx,
+          mir_stmt_new_assign(ctx->mir->arena, MIR_STMT_ASSIGN_VALUE,
+                              first_r.ret, ret));
 
       mir_stmt_debug_init_span(stmt_inc, expr->base.base.span);
       mir_stmt_debug_init_span(stmt_ass, expr->base.base.span);
@@ -740,7 +718,8 @@ static mir_expr_r mir_define_expr_binary_generic(mir_ctx               *ctx,
   mir_value *ret  = mir_define_mir_value_tmp(ctx, ctx->type_any);
   mir_stmt  *stmt = mir_define_mir_stmt(
       ctx,
-      mir_stmt_new_op(op, ret, mir_define_mir_value_args(first, second, NULL)));
+      mir_stmt_new_op(ctx->mir->arena, op, ret,
+                      mir_define_mir_value_args(ctx, first, second, NULL)));
 
   mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -823,7 +802,9 @@ static mir_expr_r mir_define_expr_binary(mir_ctx               *ctx,
       mir_expr_r to_r = mir_define_expr(ctx, expr->first, mir_expr_o_make(1));
 
       mir_stmt *stmt = mir_define_mir_stmt(
-          ctx, mir_stmt_new_assign(MIR_STMT_ASSIGN_VALUE, to_r.ret, from));
+          ctx,
+          mir_stmt_new_assign(ctx->mir->arena, MIR_STMT_ASSIGN_VALUE, to_r.ret,
+                              from));
 
       mir_value *to_deref;
       if (!opts.lvalue && to_r.ref) {
@@ -911,10 +892,11 @@ static mir_expr_r mir_define_expr_binary(mir_ctx               *ctx,
 
       mir_stmt *stmt;
       if (opts.lvalue) {
-        stmt =
-            mir_define_mir_stmt(ctx, mir_stmt_new_member_ref(ret, obj, member));
+        stmt = mir_define_mir_stmt(
+            ctx, mir_stmt_new_member_ref(ctx->mir->arena, ret, obj, member));
       } else {
-        stmt = mir_define_mir_stmt(ctx, mir_stmt_new_member(ret, obj, member));
+        stmt = mir_define_mir_stmt(
+            ctx, mir_stmt_new_member(ctx->mir->arena, ret, obj, member));
       }
 
       mir_stmt_debug_init_span(stmt, expr->base.base.span);
@@ -932,7 +914,7 @@ static mir_expr_r mir_define_expr_lit(mir_ctx *ctx, const hir_expr_lit *expr) {
   mir_value *ret  = mir_define_mir_value_tmp(ctx, expr->lit->type_ref);
   mir_lit   *lit  = mir_define_mir_lit(ctx, expr);
   mir_stmt  *stmt = mir_define_mir_stmt(
-      ctx, mir_stmt_new_assign(MIR_STMT_ASSIGN_LIT, ret, lit));
+      ctx, mir_stmt_new_assign(ctx->mir->arena, MIR_STMT_ASSIGN_LIT, ret, lit));
 
   mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -953,7 +935,9 @@ static mir_expr_r mir_define_expr_id(mir_ctx *ctx, const hir_expr_id *expr) {
   if (subroutine) {
     mir_value *tmp  = mir_define_mir_value_tmp(ctx, ctx->type_any);
     mir_stmt  *stmt = mir_define_mir_stmt(
-        ctx, mir_stmt_new_assign(MIR_STMT_ASSIGN_SUB, tmp, subroutine));
+        ctx,
+        mir_stmt_new_assign(ctx->mir->arena, MIR_STMT_ASSIGN_SUB, tmp,
+                            subroutine));
 
     mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -970,11 +954,11 @@ static mir_expr_r mir_define_expr_id(mir_ctx *ctx, const hir_expr_id *expr) {
 static mir_expr_r mir_define_expr_call(mir_ctx             *ctx,
                                        const hir_expr_call *expr) {
 
-  list_mir_value_ref *args = list_mir_value_ref_new();
+  vec_mir_value_ref *args = vec_mir_value_ref_new_arena(ctx->mir->arena);
   for (list_hir_expr_it it = list_hir_expr_begin(expr->args); !END(it);
        NEXT(it)) {
     const hir_expr_base *arg = GET(it);
-    list_mir_value_ref_push_back(
+    vec_mir_value_ref_push_back(
         args, mir_define_expr(ctx, arg, mir_expr_o_make(0)).ret);
   }
 
@@ -986,8 +970,8 @@ static mir_expr_r mir_define_expr_call(mir_ctx             *ctx,
       mir_subroutine *subroutine = mir_ctx_sym_sub_find(ctx, callee->id_ref);
       if (subroutine) {
         mir_value *ret = mir_define_mir_value_tmp(ctx, ctx->type_any);
-        mir_stmt  *stmt =
-            mir_define_mir_stmt(ctx, mir_stmt_new_call(ret, subroutine, args));
+        mir_stmt  *stmt = mir_define_mir_stmt(
+            ctx, mir_stmt_new_call(ctx->mir->arena, ret, subroutine, args));
 
         mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -996,10 +980,10 @@ static mir_expr_r mir_define_expr_call(mir_ctx             *ctx,
 
       mir_value *indirect = mir_define_expr_id(ctx, callee).ret;
       if (indirect) {
-        list_mir_value_ref_push_front(args, indirect);
+        vec_mir_value_ref_push_front(args, indirect);
         mir_value *ret  = mir_define_mir_value_tmp(ctx, ctx->type_any);
         mir_stmt  *stmt = mir_define_mir_stmt(
-            ctx, mir_stmt_new_op(MIR_STMT_OP_CALL, ret, args));
+            ctx, mir_stmt_new_op(ctx->mir->arena, MIR_STMT_OP_CALL, ret, args));
 
         mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -1021,14 +1005,14 @@ static mir_expr_r mir_define_expr_call(mir_ctx             *ctx,
 
       // pass object if method call
       if (indirect_r.obj) {
-        list_mir_value_ref_push_front(args, indirect_r.obj);
+        vec_mir_value_ref_push_front(args, indirect_r.obj);
       }
 
-      list_mir_value_ref_push_front(args, indirect_r.ret);
+      vec_mir_value_ref_push_front(args, indirect_r.ret);
 
       mir_value *ret  = mir_define_mir_value_tmp(ctx, ctx->type_any);
       mir_stmt  *stmt = mir_define_mir_stmt(
-          ctx, mir_stmt_new_op(MIR_STMT_OP_CALL, ret, args));
+          ctx, mir_stmt_new_op(ctx->mir->arena, MIR_STMT_OP_CALL, ret, args));
 
       mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -1036,7 +1020,6 @@ static mir_expr_r mir_define_expr_call(mir_ctx             *ctx,
     }
   }
 
-  list_mir_value_ref_free(args);
   error("unexpected callee kind %d %p", expr->callee->kind, expr);
   return mir_expr_r_empty();
 }
@@ -1044,27 +1027,28 @@ static mir_expr_r mir_define_expr_call(mir_ctx             *ctx,
 static mir_expr_r mir_define_expr_index(mir_ctx              *ctx,
                                         const hir_expr_index *expr,
                                         mir_expr_o            opts) {
-  list_mir_value_ref *args = list_mir_value_ref_new();
+  vec_mir_value_ref *args = vec_mir_value_ref_new_arena(ctx->mir->arena);
   for (list_hir_expr_it it = list_hir_expr_begin(expr->args); !END(it);
        NEXT(it)) {
     const hir_expr_base *arg = GET(it);
-    list_mir_value_ref_push_back(
+    vec_mir_value_ref_push_back(
         args, mir_define_expr(ctx, arg, mir_expr_o_make(0)).ret);
   }
 
   mir_value *indirect = mir_define_expr(ctx, expr->indexed, opts).ret;
 
   if (indirect) {
-    list_mir_value_ref_push_front(args, indirect);
+    vec_mir_value_ref_push_front(args, indirect);
     mir_value *ret = mir_define_mir_value_tmp(ctx, ctx->type_any);
 
     mir_stmt *stmt;
     if (opts.lvalue) {
       stmt = mir_define_mir_stmt(
-          ctx, mir_stmt_new_op(MIR_STMT_OP_INDEX_REF, ret, args));
+          ctx,
+          mir_stmt_new_op(ctx->mir->arena, MIR_STMT_OP_INDEX_REF, ret, args));
     } else {
-      stmt = mir_define_mir_stmt(ctx,
-                                 mir_stmt_new_op(MIR_STMT_OP_INDEX, ret, args));
+      stmt = mir_define_mir_stmt(
+          ctx, mir_stmt_new_op(ctx->mir->arena, MIR_STMT_OP_INDEX, ret, args));
     }
 
     mir_stmt_debug_init_span(stmt, expr->base.base.span);
@@ -1072,24 +1056,25 @@ static mir_expr_r mir_define_expr_index(mir_ctx              *ctx,
     return mir_expr_r_make(ret, NULL, opts.lvalue);
   }
 
-  list_mir_value_ref_free(args);
   return mir_expr_r_empty();
 }
 
 static mir_expr_r mir_define_expr_builtin_generic(mir_ctx                *ctx,
                                                   const hir_expr_builtin *expr,
                                                   mir_stmt_builtin_enum kind) {
-  list_mir_value_ref *args = list_mir_value_ref_new();
+  vec_mir_value_ref *args = vec_mir_value_ref_new_arena(ctx->mir->arena);
   for (list_hir_expr_it it = list_hir_expr_begin(expr->args); !END(it);
        NEXT(it)) {
     const hir_expr_base *arg = GET(it);
-    list_mir_value_ref_push_back(
+    vec_mir_value_ref_push_back(
         args, mir_define_expr(ctx, arg, mir_expr_o_make(0)).ret);
   }
 
   mir_value *ret  = mir_define_mir_value_tmp(ctx, ctx->type_any);
   mir_stmt  *stmt = mir_define_mir_stmt(
-      ctx, mir_stmt_new_builtin(kind, ret, expr->base.type_ref, args));
+      ctx,
+      mir_stmt_new_builtin(ctx->mir->arena, kind, ret, expr->base.type_ref,
+                           args));
 
   mir_stmt_debug_init_span(stmt, expr->base.base.span);
 
@@ -1322,9 +1307,10 @@ static mir_bb_seq mir_define_stmt_return(mir_ctx               *ctx,
   mir_value *value = mir_define_expr_tree(ctx, root.first, stmt->expr);
   list_hir_expr_ref_push_back(root.first->hir_exprs, stmt->expr);
 
-  mir_stmt *stmt_ass = mir_stmt_new_assign(MIR_STMT_ASSIGN_VALUE,
+  mir_stmt *stmt_ass = mir_stmt_new_assign(ctx->mir->arena,
+                                           MIR_STMT_ASSIGN_VALUE,
                                            ctx->sub_ref->defined.ret, value);
-  list_mir_stmt_push_back(root.first->stmts, stmt_ass);
+  vec_mir_stmt_push_back(root.first->stmts, stmt_ass);
 
   mir_stmt_debug_init_span(stmt_ass, stmt->base.base.span);
 
@@ -1366,42 +1352,43 @@ static void mir_define_subroutine_defined(mir_ctx *ctx, mir_subroutine *sub_mir,
   const hir_stmt_block *hir_root = sub_hir->body->body.block.block;
 
   ctx->sub_ref   = sub_mir;
-  ctx->value_cnt = 1 + list_mir_value_size(sub_mir->defined.params);
+  ctx->value_cnt = 1 + vec_mir_value_size(sub_mir->defined.params);
   ctx->bb_cnt    = 0;
 
   // add vars
-  sub_mir->defined.vars = list_mir_value_new();
+  sub_mir->defined.vars = vec_mir_value_new_arena(ctx->mir->arena);
 
   for (list_hir_var_it it = list_hir_var_begin(hir_vars); !END(it); NEXT(it)) {
     const hir_var *var_hir = GET(it);
 
-    mir_value *value =
-        mir_value_new(ctx->value_cnt++, var_hir->id_ref, var_hir->type_ref);
-    list_mir_value_push_back(sub_mir->defined.vars, value);
+    mir_value *value = mir_value_new(ctx->mir->arena, ctx->value_cnt++,
+                                     var_hir->id_ref, var_hir->type_ref);
+    vec_mir_value_push_back(sub_mir->defined.vars, value);
   }
 
   // add values to symbol scope
   mir_ctx_sym_value_create(ctx);
 
-  for (list_mir_value_it it = list_mir_value_begin(sub_mir->defined.params);
+  for (vec_mir_value_it it = vec_mir_value_begin(sub_mir->defined.params);
        !END(it); NEXT(it)) {
     mir_value *param = GET(it);
     mir_ctx_sym_value_emplace(ctx, param->symbol_ref, param);
   }
-  for (list_mir_value_it it = list_mir_value_begin(sub_mir->defined.vars);
+  for (vec_mir_value_it it = vec_mir_value_begin(sub_mir->defined.vars);
        !END(it); NEXT(it)) {
     mir_value *param = GET(it);
     mir_ctx_sym_value_emplace(ctx, param->symbol_ref, param);
   }
 
   // handle body
-  sub_mir->defined.tmps = list_mir_value_new();
-  sub_mir->defined.bbs  = list_mir_bb_new();
+  sub_mir->defined.tmps = vec_mir_value_new_arena(ctx->mir->arena);
+  sub_mir->defined.bbs  = vec_mir_bb_new_arena(ctx->mir->arena);
   ctx->scope_stack      = list_mir_scope_ref_new();
 
   // add last block to handle returns
-  mir_bb *bb_last  = mir_bb_new(ctx->bb_cnt++, list_mir_stmt_new(), NULL, NULL,
-                                NULL, list_hir_expr_ref_new());
+  mir_bb *bb_last  = mir_bb_new(
+      ctx->mir->arena, ctx->bb_cnt++, vec_mir_stmt_new_arena(ctx->mir->arena),
+      NULL, NULL, NULL, list_hir_expr_ref_new_arena(ctx->mir->arena));
   ctx->bb_last_ref = bb_last;
 
   mir_bb_seq seq = mir_define_stmt_block(ctx, hir_root);
@@ -1410,7 +1397,7 @@ static void mir_define_subroutine_defined(mir_ctx *ctx, mir_subroutine *sub_mir,
   if (mir_bb_get_cond(seq.last) == MIR_BB_TERM) {
     seq.last->jmp.next_ref = ctx->bb_last_ref;
   }
-  list_mir_bb_push_back(ctx->sub_ref->defined.bbs, bb_last);
+  vec_mir_bb_push_back(ctx->sub_ref->defined.bbs, bb_last);
 
   list_mir_scope_ref_free(ctx->scope_stack);
   mir_ctx_sym_value_destroy(ctx);
@@ -1440,8 +1427,9 @@ static mir_class *mir_define_class(mir_ctx          *ctx,
     return NULL;
   }
 
-  class = mir_class_new(class_entry, list_mir_value_new(),
-                        list_mir_subroutine_ref_new());
+  class = mir_class_new(ctx->mir->arena, class_entry,
+                        vec_mir_value_new_arena(ctx->mir->arena),
+                        list_mir_subroutine_ref_new_arena(ctx->mir->arena));
 
   // get parents
   type_base     *class_type  = class->type_ref->type;
@@ -1474,7 +1462,6 @@ static mir_class *mir_define_class(mir_ctx          *ctx,
   }
   if (!parents_ref) {
     error("parent list is null, exiting");
-    mir_class_free(class);
     return NULL;
   }
 
@@ -1493,7 +1480,7 @@ static mir_class *mir_define_class(mir_ctx          *ctx,
       continue;
     }
 
-    for (list_mir_value_it v_it = list_mir_value_begin(parent->fields);
+    for (vec_mir_value_it v_it = vec_mir_value_begin(parent->fields);
          !END(v_it); NEXT(v_it)) {
       mir_value *field = GET(v_it);
 
@@ -1515,10 +1502,10 @@ static mir_class *mir_define_class(mir_ctx          *ctx,
         continue;
       }
 
-      mir_value *field_new =
-          mir_value_new(fields_cnt++, field->symbol_ref, field->type_ref);
+      mir_value *field_new = mir_value_new(ctx->mir->arena, fields_cnt++,
+                                           field->symbol_ref, field->type_ref);
 
-      list_mir_value_push_back(class->fields, field_new);
+      vec_mir_value_push_back(class->fields, field_new);
 
       hashset_symbol_entry_insert(class_symbols,
                                   (symbol_entry *)field_new->symbol_ref);
@@ -1545,10 +1532,10 @@ static mir_class *mir_define_class(mir_ctx          *ctx,
       continue;
     }
 
-    mir_value *var =
-        mir_value_new(fields_cnt++, var_hir->id_ref, var_hir->type_ref);
+    mir_value *var = mir_value_new(ctx->mir->arena, fields_cnt++,
+                                   var_hir->id_ref, var_hir->type_ref);
 
-    list_mir_value_push_back(class->fields, var);
+    vec_mir_value_push_back(class->fields, var);
     hashset_symbol_entry_insert(class_symbols, (symbol_entry *)var->symbol_ref);
   }
 
@@ -1718,22 +1705,8 @@ static void mir_lower_classes(mir_ctx *ctx, const hir *hir) {
     list_mir_class_push_back(ctx->mir->classes, class_mir);
   }
 
-  // remove classes that don't need to be instantiated from index
-  // (because they are stored as references and won't be removed automatically)
-  for (list_mir_class_it it = list_mir_class_begin(ctx->mir->classes); !END(it);
-       NEXT(it)) {
-    mir_ctx_type_mir_class_erase(ctx, GET(it));
-  }
-
-  for (hashset_mir_type_entry_it it =
-           hashset_mir_type_entry_begin(ctx->map_type_mir_class);
-       !END(it); NEXT(it)) {
-    mir_type_entry *entry = GET(it);
-    mir_class *class      = entry->entry_ref;
-    mir_class_free(class);
-  }
-
-  // WARN: map is freed, because iterator invalidates while erasing
+  // index is rebuilt of classes that are instantiated, others are left in
+  // arena of mir
   hashset_mir_type_entry_free(ctx->map_type_mir_class);
   ctx->map_type_mir_class = hashset_mir_type_entry_new();
 
@@ -1,27 +1,21 @@
 #include "merge_bb.h"
 
 #include "compiler/exception/list.h"
+#include "compiler/mir_build/analysis.h"
 #include "util/hashset.h"
 #include "util/log.h"
 #include "util/macro.h"
 
-LIST_DECLARE_STATIC_INLINE(list_mir_bb_ref, mir_bb, container_cmp_false,
-                           container_new_move, container_delete_false);
-
-HASHSET_DECLARE_STATIC_INLINE(hashset_mir_bb_ref, mir_bb, container_cmp_ptr,
-                              container_new_move, container_delete_false,
-                              container_hash_ptr);
-
 // MIR_BB_PREDS
 typedef struct mir_bb_preds_struct {
-  const mir_bb    *bb;
-  list_mir_bb_ref *preds;
+  const mir_bb   *bb;
+  vec_mir_bb_ref *preds;
 } mir_bb_preds;
 
 mir_bb_preds *mir_bb_preds_new(const mir_bb *bb) {
   mir_bb_preds *self = MALLOC(mir_bb_preds);
   self->bb           = bb;
-  self->preds        = list_mir_bb_ref_new();
+  self->preds        = vec_mir_bb_ref_new();
   return self;
 }
 
@@ -33,7 +27,7 @@ static inline int container_cmp_mir_bb_preds(const void *_lsv,
 }
 static inline void container_delete_mir_bb_preds(void *data) {
   mir_bb_preds *self = data;
-  list_mir_bb_ref_free(self->preds);
+  vec_mir_bb_ref_free(self->preds);
   free(self);
 }
 static inline size_t container_hash_mir_bb_preds(const void *data) {
@@ -48,6 +42,7 @@ HASHSET_DECLARE_STATIC_INLINE(hashset_mir_bb_preds, mir_bb_preds,
 
 // CTX
 typedef struct mir_ctx_struct {
+  arena                *arena; // of mir
   hashset_mir_bb_preds *preds;
   hashset_mir_bb_ref   *visited;
   hashset_mir_bb_ref   *deleted;
@@ -78,12 +73,12 @@ static mir_bb_preds *mir_ctx_get_preds(mir_ctx *ctx, const mir_bb *cur) {
   if (mir_bb_get_cond(cur) != MIR_BB_TERM) {
     mir_bb_preds *je_preds = mir_ctx_get_preds(ctx, cur->jmp.je_ref);
     if (je_preds) {
-      list_mir_bb_ref_push_back(je_preds->preds, (mir_bb *)cur);
+      vec_mir_bb_ref_push_back(je_preds->preds, (mir_bb *)cur);
     }
 
     mir_bb_preds *jz_preds = mir_ctx_get_preds(ctx, cur->jmp.jz_ref);
     if (jz_preds) {
-      list_mir_bb_ref_push_back(jz_preds->preds, (mir_bb *)cur);
+      vec_mir_bb_ref_push_back(jz_preds->preds, (mir_bb *)cur);
     }
   }
 
@@ -103,8 +98,12 @@ static mir_bb *mir_ctx_can_merge_with(mir_ctx *ctx, mir_bb *cur) {
     case MIR_BB_TERM:
       return NULL;
     case MIR_BB_NEXT: {
+      // infinite loop on itself
+      if (cur->jmp.next_ref == cur) {
+        return NULL;
+      }
 
-      if (list_mir_stmt_empty(cur->stmts) &&
+      if (vec_mir_stmt_empty(cur->stmts) &&
           list_hir_expr_ref_empty(cur->hir_exprs)) {
         return cur->jmp.next_ref;
       }
@@ -112,7 +111,7 @@ static mir_bb *mir_ctx_can_merge_with(mir_ctx *ctx, mir_bb *cur) {
       hashset_mir_bb_preds_it it = hashset_mir_bb_preds_find(
           ctx->preds, &(mir_bb_preds){.bb = cur->jmp.next_ref});
 
-      if (list_mir_bb_ref_size(GET(it)->preds) <= 1) {
+      if (vec_mir_bb_ref_size(GET(it)->preds) <= 1) {
         return cur->jmp.next_ref;
       }
 
@@ -142,7 +141,7 @@ static mir_bb *mir_ctx_bb_merge_block(mir_ctx *ctx, mir_bb *cur) {
   mir_bb_preds *cur_preds = GET(cur_preds_it);
 
   // update all predecessors
-  for (list_mir_bb_ref_it it = list_mir_bb_ref_begin(cur_preds->preds);
+  for (vec_mir_bb_ref_it it = vec_mir_bb_ref_begin(cur_preds->preds);
        !END(it); NEXT(it)) {
     mir_bb *pred = GET(it);
 
@@ -159,26 +158,20 @@ static mir_bb *mir_ctx_bb_merge_block(mir_ctx *ctx, mir_bb *cur) {
     if (pred->jmp.je_ref == cur) {
       pred->jmp.je_ref = next;
       // debug("upd.. %zu.je_ref -> %zu", pred_bb->id, next_bb->id);
-      list_mir_bb_ref_push_back(next_preds->preds, pred);
+      vec_mir_bb_ref_push_back(next_preds->preds, pred);
     }
     if (pred->jmp.jz_ref == cur) {
       pred->jmp.jz_ref = next;
       // debug("upd.. %zu.jz_ref -> %zu", pred_bb->id, next_bb->id);
-      list_mir_bb_ref_push_back(next_preds->preds, pred);
+      vec_mir_bb_ref_push_back(next_preds->preds, pred);
     }
   }
 
-  // merge stmts
-  list_mir_stmt *rev_stmt = list_mir_stmt_new();
-  while (!list_mir_stmt_empty(cur->stmts)) {
-    mir_stmt *stmt = list_mir_stmt_pop_front(cur->stmts);
-    list_mir_stmt_push_front(rev_stmt, stmt);
-  }
-  while (!list_mir_stmt_empty(rev_stmt)) {
-    mir_stmt *stmt = list_mir_stmt_pop_front(rev_stmt);
-    list_mir_stmt_push_front(next->stmts, stmt);
-  }
-  list_mir_stmt_free(rev_stmt);
+  // merge stmts, stmts of cur are placed before stmts of next
+  vec_mir_stmt *stmts = next->stmts;
+  vec_mir_stmt_splice_back(cur->stmts, stmts);
+  next->stmts = cur->stmts;
+  cur->stmts  = stmts;
 
   // merge hir_exprs
   list_hir_expr_ref *rev_exprs = list_hir_expr_ref_new();
@@ -196,7 +189,7 @@ static mir_bb *mir_ctx_bb_merge_block(mir_ctx *ctx, mir_bb *cur) {
 }
 
 static void mir_ctx_bb_merge_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
-  if (!list_mir_bb_size(sub->defined.bbs)) {
+  if (!vec_mir_bb_size(sub->defined.bbs)) {
     return;
   }
 
@@ -205,7 +198,7 @@ static void mir_ctx_bb_merge_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
   ctx->deleted = hashset_mir_bb_ref_new();
 
   // calculate predicates for all bbs
-  for (list_mir_bb_it it = list_mir_bb_begin(sub->defined.bbs); !END(it);
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
        NEXT(it)) {
     mir_ctx_get_preds(ctx, GET(it));
   }
@@ -216,27 +209,43 @@ static void mir_ctx_bb_merge_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
   //   mir_bb_preds *bb_preds = GET(it);
 
   //   debug("bb%zu", bb_preds->bb->id);
-  //   for (list_mir_bb_ref_it pred_it = list_mir_bb_ref_begin(bb_preds->preds);
+  //   for (vec_mir_bb_ref_it pred_it = vec_mir_bb_ref_begin(bb_preds->preds);
   //        !END(pred_it); NEXT(pred_it)) {
   //     debug("  bb%zu", GET(pred_it)->id);
   //   }
   // }
 
-  list_mir_bb *new_bbs = list_mir_bb_new();
+  vec_mir_bb *new_bbs = vec_mir_bb_new_arena(ctx->arena);
+  mir_bb     *entry   = vec_mir_bb_front(sub->defined.bbs);
 
   // bb_first may be redundant (need to check)
-  while (!list_mir_bb_empty(sub->defined.bbs)) {
-    mir_bb *cur      = list_mir_bb_pop_front(sub->defined.bbs);
+  while (!vec_mir_bb_empty(sub->defined.bbs)) {
+    mir_bb *cur      = vec_mir_bb_pop_front(sub->defined.bbs);
     mir_bb *cur_next = mir_ctx_bb_merge_block(ctx, cur);
     if (cur_next) {
+      if (cur == entry) {
+        entry = cur_next;
+      }
       hashset_mir_bb_ref_insert(ctx->deleted, cur);
-      mir_bb_free(cur);
     } else {
-      list_mir_bb_push_back(new_bbs, cur);
+      vec_mir_bb_push_back(new_bbs, cur);
+    }
+  }
+
+  // entry is merged into block that is not adjacent (after pruned branches),
+  // it should stay first
+  if (vec_mir_bb_front(new_bbs) != entry) {
+    vec_mir_bb *rest = new_bbs;
+    new_bbs          = vec_mir_bb_new_arena(ctx->arena);
+    vec_mir_bb_push_back(new_bbs, entry);
+    while (!vec_mir_bb_empty(rest)) {
+      mir_bb *bb = vec_mir_bb_pop_front(rest);
+      if (bb != entry) {
+        vec_mir_bb_push_back(new_bbs, bb);
+      }
     }
   }
 
-  list_mir_bb_free(sub->defined.bbs);
   sub->defined.bbs = new_bbs;
 
   hashset_mir_bb_ref_free(ctx->deleted);
@@ -250,6 +259,7 @@ mir_merge_bb_result mir_merge_bb(mir *mir) {
   };
 
   mir_ctx ctx = {
+      .arena      = mir->arena,
       .preds      = NULL,
       .visited    = NULL,
       .deleted    = NULL,
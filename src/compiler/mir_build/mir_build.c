@@ -1,6 +1,14 @@
 #include "mir_build.h"
+#include "compiler/mir_build/copy_prop.h"
+#include "compiler/mir_build/dead_subs.h"
+#include "compiler/mir_build/escape.h"
+#include "compiler/mir_build/gvn.h"
+#include "compiler/mir_build/inline.h"
+#include "compiler/mir_build/licm.h"
 #include "compiler/mir_build/lower_hir.h"
 #include "compiler/mir_build/merge_bb.h"
+#include "compiler/mir_build/sccp.h"
+#include "compiler/mir_build/tail_call.h"
 #include "util/macro.h"
 
 static inline int mir_ok(list_exception *exceptions, int ignore_errors) {
@@ -10,7 +18,8 @@ static inline int mir_ok(list_exception *exceptions, int ignore_errors) {
 }
 
 mir_build_result mir_build(const hir *hir, const symbol_table *symbol_table,
-                           const type_table *type_table, int ignore_errors) {
+                           const type_table *type_table, int opt_level,
+                           int ignore_errors) {
   UNUSED(symbol_table);
 
   mir_build_result result = {
@@ -29,5 +38,62 @@ mir_build_result mir_build(const hir *hir, const symbol_table *symbol_table,
     list_exception_extend(result.exceptions, r.exceptions);
   }
 
+  // self recursion that became a loop doesn't prevent inlining
+  if (opt_level >= 2 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_tail_call_result r = mir_tail_call(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  // inlined bodies are optimized together with the caller
+  if (opt_level >= 2 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_inline_result r = mir_inline(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  if (opt_level >= 1 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_sccp_result r = mir_sccp(result.mir, type_table);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  // pruned branches leave chains of blocks that can be merged
+  if (opt_level >= 1 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_merge_bb_result r = mir_merge_bb(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  // calls are inlined and pruned, rest of passes skip unreachable subs
+  if (opt_level >= 1 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_dead_subs_result r = mir_dead_subs(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  if (opt_level >= 1 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_gvn_result r = mir_gvn(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  if (opt_level >= 2 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_licm_result r = mir_licm(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  // preheaders with nothing hoisted are left empty
+  if (opt_level >= 2 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_merge_bb_result r = mir_merge_bb(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  // reused results are left as copies
+  if (opt_level >= 1 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_copy_prop_result r = mir_copy_prop(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
+  // after copies are removed, so fewer values alias made data
+  if (opt_level >= 2 && mir_ok(result.exceptions, ignore_errors)) {
+    mir_escape_result r = mir_escape(result.mir);
+    list_exception_extend(result.exceptions, r.exceptions);
+  }
+
   return result;
 }
@@ -10,4 +10,5 @@ typedef struct mir_build_result_struct {
 } mir_build_result;
 
 mir_build_result mir_build(const hir *hir, const symbol_table *symbol_table,
-                           const type_table *type_table, int ignore_errors);
+                           const type_table *type_table, int opt_level,
+                           int ignore_errors);
@@ -0,0 +1,776 @@
+#include "sccp.h"
+
+#include "compiler/mir_build/analysis.h"
+#include "util/log.h"
+#include "util/macro.h"
+#include <stdint.h>
+
+// MIR_CONST
+// primitive value widened to 64 bits, it is truncated after each operation
+// the same way runtime proxies do
+typedef struct mir_const_struct {
+  const mir_value    *value_ref;
+  const type_entry   *type_ref;
+  type_primitive_enum type;
+  uint64_t            data;
+} mir_const;
+
+static mir_const *mir_const_new(const mir_value *value_ref,
+                                const mir_const *from) {
+  mir_const *self = MALLOC(mir_const);
+  *self           = *from;
+  self->value_ref = value_ref;
+  return self;
+}
+
+static inline int container_cmp_mir_const(const void *_lsv, const void *_rsv) {
+  const mir_const *lsv = _lsv;
+  const mir_const *rsv = _rsv;
+  return container_cmp_ptr(lsv->value_ref, rsv->value_ref);
+}
+static inline void container_delete_mir_const(void *data) { free(data); }
+static inline uint64_t container_hash_mir_const(const void *data) {
+  const mir_const *self = data;
+  return container_hash_ptr(self->value_ref);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_const, mir_const,
+                              container_cmp_mir_const, container_new_move,
+                              container_delete_mir_const,
+                              container_hash_mir_const);
+
+// returns 0 if values of type are not folded
+static type_primitive_enum mir_const_type(const type_entry *entry) {
+  const type_base *type = entry ? entry->type : NULL;
+  if (!type || type->kind != TYPE_PRIMITIVE) {
+    return 0;
+  }
+
+  const type_primitive *primitive = (typeof(primitive))type;
+  switch (primitive->type) {
+    case TYPE_PRIMITIVE_BOOL:
+    case TYPE_PRIMITIVE_BYTE:
+    case TYPE_PRIMITIVE_INT:
+    case TYPE_PRIMITIVE_UINT:
+    case TYPE_PRIMITIVE_LONG:
+    case TYPE_PRIMITIVE_ULONG:
+    case TYPE_PRIMITIVE_CHAR:
+      return primitive->type;
+    case TYPE_PRIMITIVE_STRING:
+    case TYPE_PRIMITIVE_VOID:
+    case TYPE_PRIMITIVE_ANY:
+      return 0;
+  }
+  return 0;
+}
+
+static int mir_const_signed(type_primitive_enum type) {
+  return type == TYPE_PRIMITIVE_INT || type == TYPE_PRIMITIVE_LONG;
+}
+
+// byte and char are promoted to int before shift
+static uint64_t mir_const_width(type_primitive_enum type) {
+  return type == TYPE_PRIMITIVE_LONG || type == TYPE_PRIMITIVE_ULONG ? 64 : 32;
+}
+
+// signed values are kept sign extended
+static uint64_t mir_const_trunc(type_primitive_enum type, uint64_t data) {
+  switch (type) {
+    case TYPE_PRIMITIVE_BOOL:
+      return data != 0;
+    case TYPE_PRIMITIVE_BYTE:
+    case TYPE_PRIMITIVE_CHAR:
+      return (uint8_t)data;
+    case TYPE_PRIMITIVE_INT:
+      return (uint64_t)(int64_t)(int32_t)(uint32_t)data;
+    case TYPE_PRIMITIVE_UINT:
+      return (uint32_t)data;
+    default:
+      return data;
+  }
+}
+
+static uint64_t mir_const_from_lit(type_primitive_enum type,
+                                   const mir_lit      *lit) {
+  switch (type) {
+    case TYPE_PRIMITIVE_BOOL:
+      return lit->value.v_bool != 0;
+    case TYPE_PRIMITIVE_BYTE:
+      return lit->value.v_byte;
+    case TYPE_PRIMITIVE_CHAR:
+      return lit->value.v_char;
+    case TYPE_PRIMITIVE_INT:
+      return (uint64_t)(int64_t)lit->value.v_int;
+    case TYPE_PRIMITIVE_UINT:
+      return lit->value.v_uint;
+    case TYPE_PRIMITIVE_LONG:
+      return (uint64_t)lit->value.v_long;
+    case TYPE_PRIMITIVE_ULONG:
+      return lit->value.v_ulong;
+    default:
+      error("unsupported constant type %d", type);
+      return 0;
+  }
+}
+
+static mir_lit_value mir_const_to_lit(const mir_const *self) {
+  mir_lit_value value = {0};
+  switch (self->type) {
+    case TYPE_PRIMITIVE_BOOL:
+      value.v_bool = (uint8_t)self->data;
+      break;
+    case TYPE_PRIMITIVE_BYTE:
+      value.v_byte = (uint8_t)self->data;
+      break;
+    case TYPE_PRIMITIVE_CHAR:
+      value.v_char = (uint8_t)self->data;
+      break;
+    case TYPE_PRIMITIVE_INT:
+      value.v_int = (int32_t)self->data;
+      break;
+    case TYPE_PRIMITIVE_UINT:
+      value.v_uint = (uint32_t)self->data;
+      break;
+    case TYPE_PRIMITIVE_LONG:
+      value.v_long = (int64_t)self->data;
+      break;
+    case TYPE_PRIMITIVE_ULONG:
+      value.v_ulong = self->data;
+      break;
+    default:
+      error("unsupported constant type %d", self->type);
+      break;
+  }
+  return value;
+}
+
+static int mir_const_eq(const mir_const *lsv, const mir_const *rsv) {
+  return lsv->type == rsv->type && lsv->data == rsv->data;
+}
+
+// ENV
+// constants that are known for values at some point of subroutine
+static const mir_const *mir_env_find(hashset_mir_const *env,
+                                     const mir_value   *value) {
+  hashset_mir_const_it it =
+      hashset_mir_const_find(env, &(mir_const){.value_ref = value});
+  return END(it) ? NULL : GET(it);
+}
+
+static void mir_env_set(hashset_mir_const *env, const mir_value *value,
+                        const mir_const *from) {
+  hashset_mir_const_insert(env, mir_const_new(value, from));
+}
+
+static void mir_env_erase(hashset_mir_const *env, const mir_value *value) {
+  hashset_mir_const_it it =
+      hashset_mir_const_find(env, &(mir_const){.value_ref = value});
+  if (!END(it)) {
+    hashset_mir_const_erase(env, it);
+  }
+}
+
+static hashset_mir_const *mir_env_copy(const hashset_mir_const *from) {
+  hashset_mir_const *self = hashset_mir_const_new();
+  for (hashset_mir_const_it it = hashset_mir_const_begin(from); !END(it);
+       NEXT(it)) {
+    mir_env_set(self, GET(it)->value_ref, GET(it));
+  }
+  return self;
+}
+
+// keeps constants that are equal in both envs, returns 1 if self is changed
+static int mir_env_meet(hashset_mir_const *self, hashset_mir_const *other) {
+  vec_mir_value_ref *removed = vec_mir_value_ref_new();
+
+  for (hashset_mir_const_it it = hashset_mir_const_begin(self); !END(it);
+       NEXT(it)) {
+    const mir_const *other_const = mir_env_find(other, GET(it)->value_ref);
+    if (!other_const || !mir_const_eq(GET(it), other_const)) {
+      vec_mir_value_ref_push_back(removed, (mir_value *)GET(it)->value_ref);
+    }
+  }
+
+  int changed = !vec_mir_value_ref_empty(removed);
+  while (!vec_mir_value_ref_empty(removed)) {
+    mir_env_erase(self, vec_mir_value_ref_pop_front(removed));
+  }
+  vec_mir_value_ref_free(removed);
+
+  return changed;
+}
+
+// MIR_BB_STATE
+// bb is executable if it has state
+typedef struct mir_bb_state_struct {
+  const mir_bb      *bb;
+  hashset_mir_const *env; // on entry
+} mir_bb_state;
+
+static mir_bb_state *mir_bb_state_new(const mir_bb          *bb,
+                                      hashset_mir_const *env) {
+  mir_bb_state *self = MALLOC(mir_bb_state);
+  self->bb           = bb;
+  self->env          = env;
+  return self;
+}
+
+static inline int container_cmp_mir_bb_state(const void *_lsv,
+                                             const void *_rsv) {
+  const mir_bb_state *lsv = _lsv;
+  const mir_bb_state *rsv = _rsv;
+  return container_cmp_ptr(lsv->bb, rsv->bb);
+}
+static inline void container_delete_mir_bb_state(void *data) {
+  mir_bb_state *self = data;
+  hashset_mir_const_free(self->env);
+  free(self);
+}
+static inline uint64_t container_hash_mir_bb_state(const void *data) {
+  const mir_bb_state *self = data;
+  return container_hash_ptr(self->bb);
+}
+
+HASHSET_DECLARE_STATIC_INLINE(hashset_mir_bb_state, mir_bb_state,
+                              container_cmp_mir_bb_state, container_new_move,
+                              container_delete_mir_bb_state,
+                              container_hash_mir_bb_state);
+
+// CTX
+typedef struct mir_ctx_struct {
+  mir              *mir;
+  const type_entry *type_bool;
+  size_t            lit_cnt;
+
+  hashset_mir_value_ref *plain;
+  hashset_mir_bb_state  *states;
+  vec_mir_bb_ref        *worklist;
+
+  list_exception *exceptions;
+} mir_ctx;
+
+static mir_bb_state *mir_ctx_state_find(mir_ctx *ctx, const mir_bb *bb) {
+  hashset_mir_bb_state_it it =
+      hashset_mir_bb_state_find(ctx->states, &(mir_bb_state){.bb = bb});
+  return END(it) ? NULL : GET(it);
+}
+
+static int mir_ctx_is_plain(mir_ctx *ctx, const mir_value *value) {
+  return mir_value_set_contains(ctx->plain, value);
+}
+
+static mir_lit *mir_ctx_lit_new(mir_ctx *ctx, const mir_const *from) {
+  mir_lit *lit = mir_lit_new(ctx->mir->arena, ctx->lit_cnt++, from->type_ref,
+                             mir_const_to_lit(from));
+  list_mir_lit_push_back(ctx->mir->literals, lit);
+  return lit;
+}
+
+// FOLD
+static int mir_ctx_fold_bool(mir_ctx *ctx, int value, mir_const *out) {
+  if (!ctx->type_bool) {
+    return 0;
+  }
+  out->type_ref = ctx->type_bool;
+  out->type     = TYPE_PRIMITIVE_BOOL;
+  out->data     = value != 0;
+  return 1;
+}
+
+static int mir_ctx_fold_unary(mir_ctx *ctx, mir_stmt_op_enum kind,
+                              const mir_const *first, mir_const *out) {
+  UNUSED(ctx);
+
+  uint64_t x = first->data;
+  uint64_t data;
+
+  out->type_ref = first->type_ref;
+  out->type     = first->type;
+
+  if (first->type == TYPE_PRIMITIVE_BOOL) {
+    if (kind != MIR_STMT_OP_UNARY_LOGICAL_NOT) {
+      return 0;
+    }
+    out->data = !x;
+    return 1;
+  }
+
+  switch (kind) {
+    case MIR_STMT_OP_UNARY_PLUS:
+      data = x;
+      break;
+    case MIR_STMT_OP_UNARY_MINUS:
+      data = 0 - x;
+      break;
+    case MIR_STMT_OP_UNARY_BITWISE_NOT:
+      data = ~x;
+      break;
+    case MIR_STMT_OP_UNARY_INC:
+      data = x + 1;
+      break;
+    case MIR_STMT_OP_UNARY_DEC:
+      data = x - 1;
+      break;
+    default:
+      return 0;
+  }
+
+  out->data = mir_const_trunc(out->type, data);
+  return 1;
+}
+
+// shift by negative or too big count is undefined in runtime
+static int mir_const_shift_ok(const mir_const *count) {
+  if (mir_const_signed(count->type) && (int64_t)count->data < 0) {
+    return 0;
+  }
+  return count->data < mir_const_width(count->type);
+}
+
+// division by zero and overflow trap in runtime
+static int mir_const_div_ok(const mir_const *first, const mir_const *second) {
+  if (!second->data) {
+    return 0;
+  }
+  if (mir_const_signed(first->type) && (int64_t)second->data == -1) {
+    uint64_t min = first->type == TYPE_PRIMITIVE_INT
+                       ? (uint64_t)(int64_t)INT32_MIN
+                       : (uint64_t)INT64_MIN;
+    return first->data != min;
+  }
+  return 1;
+}
+
+static int mir_ctx_fold_binary(mir_ctx *ctx, mir_stmt_op_enum kind,
+                               const mir_const *first, const mir_const *second,
+                               mir_const *out) {
+  // runtime reports type mismatch
+  if (first->type != second->type) {
+    return 0;
+  }
+
+  type_primitive_enum type = first->type;
+  int                 sgn  = mir_const_signed(type);
+  uint64_t            x    = first->data;
+  uint64_t            y    = second->data;
+  uint64_t            data;
+
+  out->type_ref = first->type_ref;
+  out->type     = type;
+
+  switch (kind) {
+    case MIR_STMT_OP_BINARY_EQUALS:
+      return mir_ctx_fold_bool(ctx, x == y, out);
+    case MIR_STMT_OP_BINARY_NOT_EQUALS:
+      return mir_ctx_fold_bool(ctx, x != y, out);
+    default:
+      break;
+  }
+
+  if (type == TYPE_PRIMITIVE_BOOL) {
+    switch (kind) {
+      case MIR_STMT_OP_BINARY_LOGICAL_OR:
+        out->data = x || y;
+        return 1;
+      case MIR_STMT_OP_BINARY_LOGICAL_AND:
+        out->data = x && y;
+        return 1;
+      default:
+        return 0;
+    }
+  }
+
+  switch (kind) {
+    case MIR_STMT_OP_BINARY_LESS:
+      return mir_ctx_fold_bool(ctx, sgn ? (int64_t)x < (int64_t)y : x < y,
+                               out);
+    case MIR_STMT_OP_BINARY_LESS_EQUALS:
+      return mir_ctx_fold_bool(ctx, sgn ? (int64_t)x <= (int64_t)y : x <= y,
+                               out);
+    case MIR_STMT_OP_BINARY_GREATER:
+      return mir_ctx_fold_bool(ctx, sgn ? (int64_t)y < (int64_t)x : y < x,
+                               out);
+    case MIR_STMT_OP_BINARY_GREATER_EQUALS:
+      return mir_ctx_fold_bool(ctx, sgn ? (int64_t)y <= (int64_t)x : y <= x,
+                               out);
+    case MIR_STMT_OP_BINARY_BITWISE_OR:
+      data = x | y;
+      break;
+    case MIR_STMT_OP_BINARY_BITWISE_XOR:
+      data = x ^ y;
+      break;
+    case MIR_STMT_OP_BINARY_BITWISE_AND:
+      data = x & y;
+      break;
+    case MIR_STMT_OP_BINARY_BITWISE_SHIFT_LEFT:
+      if (!mir_const_shift_ok(second)) {
+        return 0;
+      }
+      data = x << y;
+      break;
+    case MIR_STMT_OP_BINARY_BITWISE_SHIFT_RIGHT:
+      if (!mir_const_shift_ok(second)) {
+        return 0;
+      }
+      data = sgn ? (uint64_t)((int64_t)x >> y) : x >> y;
+      break;
+    case MIR_STMT_OP_BINARY_ADD:
+      data = x + y;
+      break;
+    case MIR_STMT_OP_BINARY_SUB:
+      data = x - y;
+      break;
+    case MIR_STMT_OP_BINARY_MUL:
+      data = x * y;
+      break;
+    case MIR_STMT_OP_BINARY_DIV:
+      if (!mir_const_div_ok(first, second)) {
+        return 0;
+      }
+      data = sgn ? (uint64_t)((int64_t)x / (int64_t)y) : x / y;
+      break;
+    case MIR_STMT_OP_BINARY_REM:
+      if (!mir_const_div_ok(first, second)) {
+        return 0;
+      }
+      data = sgn ? (uint64_t)((int64_t)x % (int64_t)y) : x % y;
+      break;
+    default:
+      return 0;
+  }
+
+  out->data = mir_const_trunc(type, data);
+  return 1;
+}
+
+static int mir_ctx_fold_op(mir_ctx *ctx, hashset_mir_const *env,
+                           const mir_stmt *stmt, mir_const *out) {
+  const mir_const *args[2];
+  size_t           args_cnt = 0;
+
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(stmt->op.args);
+       !END(it); NEXT(it)) {
+    if (args_cnt == 2) {
+      return 0;
+    }
+    const mir_const *arg = mir_env_find(env, GET(it));
+    if (!arg) {
+      return 0;
+    }
+    args[args_cnt++] = arg;
+  }
+
+  switch (args_cnt) {
+    case 1:
+      return mir_ctx_fold_unary(ctx, stmt->op.kind, args[0], out);
+    case 2:
+      return mir_ctx_fold_binary(ctx, stmt->op.kind, args[0], args[1], out);
+    default:
+      return 0;
+  }
+}
+
+// returns 1 if constant written by stmt is known
+static int mir_ctx_stmt_eval(mir_ctx *ctx, hashset_mir_const *env,
+                             const mir_stmt *stmt, mir_const *out) {
+  switch (stmt->kind) {
+    case MIR_STMT_OP:
+      return mir_ctx_fold_op(ctx, env, stmt, out);
+    case MIR_STMT_ASSIGN:
+      switch (stmt->assign.kind) {
+        case MIR_STMT_ASSIGN_LIT: {
+          const mir_lit *lit = stmt->assign.from_lit;
+          out->type          = mir_const_type(lit->type_ref);
+          if (!out->type) {
+            return 0;
+          }
+          out->type_ref = lit->type_ref;
+          out->data     = mir_const_from_lit(out->type, lit);
+          return 1;
+        }
+        case MIR_STMT_ASSIGN_VALUE:
+        case MIR_STMT_ASSIGN_MOVE: {
+          const mir_const *from = mir_env_find(env, stmt->assign.from_value);
+          if (!from) {
+            return 0;
+          }
+          *out = *from;
+          return 1;
+        }
+        case MIR_STMT_ASSIGN_SUB:
+          return 0;
+      }
+      return 0;
+    default:
+      return 0;
+  }
+}
+
+static void mir_ctx_stmt_apply(mir_ctx *ctx, hashset_mir_const *env,
+                               const mir_stmt *stmt) {
+  const mir_value *ret = mir_stmt_get_ret(stmt);
+  if (!ret) {
+    return;
+  }
+
+  mir_const value;
+  if (mir_ctx_is_plain(ctx, ret) && mir_ctx_stmt_eval(ctx, env, stmt, &value)) {
+    mir_env_set(env, ret, &value);
+  } else {
+    mir_env_erase(env, ret);
+  }
+
+  // moved source is left void
+  if (stmt->kind == MIR_STMT_ASSIGN &&
+      stmt->assign.kind == MIR_STMT_ASSIGN_MOVE &&
+      stmt->assign.from_value != ret) {
+    mir_env_erase(env, stmt->assign.from_value);
+  }
+}
+
+// PROPAGATE
+static void mir_ctx_bb_visit(mir_ctx *ctx, mir_bb *bb,
+                             hashset_mir_const *env) {
+  if (!bb) {
+    return;
+  }
+
+  mir_bb_state *state = mir_ctx_state_find(ctx, bb);
+  if (!state) {
+    hashset_mir_bb_state_insert(ctx->states,
+                                mir_bb_state_new(bb, mir_env_copy(env)));
+    vec_mir_bb_ref_push_back(ctx->worklist, bb);
+  } else if (mir_env_meet(state->env, env)) {
+    vec_mir_bb_ref_push_back(ctx->worklist, bb);
+  }
+}
+
+// returns constant condition of bb or NULL
+static const mir_const *mir_ctx_bb_cond(hashset_mir_const *env,
+                                        const mir_bb      *bb) {
+  if (mir_bb_get_cond(bb) != MIR_BB_COND) {
+    return NULL;
+  }
+  const mir_const *cond = mir_env_find(env, bb->jmp.cond_ref);
+  if (!cond || cond->type != TYPE_PRIMITIVE_BOOL) {
+    return NULL;
+  }
+  return cond;
+}
+
+static void mir_ctx_bb_propagate(mir_ctx *ctx, mir_bb *bb) {
+  hashset_mir_const *env = mir_env_copy(mir_ctx_state_find(ctx, bb)->env);
+
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+       NEXT(it)) {
+    mir_ctx_stmt_apply(ctx, env, GET(it));
+  }
+
+  switch (mir_bb_get_cond(bb)) {
+    case MIR_BB_COND: {
+      const mir_const *cond = mir_ctx_bb_cond(env, bb);
+      if (cond) {
+        mir_ctx_bb_visit(ctx, cond->data ? bb->jmp.je_ref : bb->jmp.jz_ref,
+                         env);
+      } else {
+        mir_ctx_bb_visit(ctx, bb->jmp.je_ref, env);
+        mir_ctx_bb_visit(ctx, bb->jmp.jz_ref, env);
+      }
+      break;
+    }
+    case MIR_BB_NEXT:
+      mir_ctx_bb_visit(ctx, bb->jmp.next_ref, env);
+      break;
+    case MIR_BB_TERM:
+      break;
+    default:
+      error("unhandled mir bb kind %d", mir_bb_get_cond(bb));
+      break;
+  }
+
+  hashset_mir_const_free(env);
+}
+
+// REWRITE
+static void mir_stmt_to_assign_lit(mir_stmt *stmt, mir_lit *lit) {
+  mir_value *to = mir_stmt_get_ret(stmt);
+  stmt->kind            = MIR_STMT_ASSIGN;
+  stmt->assign.kind     = MIR_STMT_ASSIGN_LIT;
+  stmt->assign.to       = to;
+  stmt->assign.from_lit = lit;
+}
+
+static void mir_ctx_bb_rewrite(mir_ctx *ctx, mir_bb *bb) {
+  hashset_mir_const *env = mir_env_copy(mir_ctx_state_find(ctx, bb)->env);
+
+  for (vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts); !END(it);
+       NEXT(it)) {
+    mir_stmt *stmt = GET(it);
+    mir_const value;
+
+    switch (stmt->kind) {
+      case MIR_STMT_OP:
+        // operators initialize result without reading it
+        if (mir_ctx_fold_op(ctx, env, stmt, &value)) {
+          mir_stmt_to_assign_lit(stmt, mir_ctx_lit_new(ctx, &value));
+        }
+        break;
+      case MIR_STMT_ASSIGN:
+        // literal assignment doesn't drop previous value, so it is replaced
+        // only when previous value is primitive as well
+        if (stmt->assign.kind == MIR_STMT_ASSIGN_VALUE &&
+            mir_env_find(env, stmt->assign.to) &&
+            mir_ctx_stmt_eval(ctx, env, stmt, &value)) {
+          mir_stmt_to_assign_lit(stmt, mir_ctx_lit_new(ctx, &value));
+        }
+        break;
+      default:
+        break;
+    }
+
+    mir_ctx_stmt_apply(ctx, env, stmt);
+  }
+
+  const mir_const *cond = mir_ctx_bb_cond(env, bb);
+  if (cond) {
+    mir_bb *taken      = cond->data ? bb->jmp.je_ref : bb->jmp.jz_ref;
+    bb->jmp.cond_ref   = NULL;
+    bb->jmp.je_ref     = NULL;
+    bb->jmp.next_ref   = taken;
+  }
+
+  hashset_mir_const_free(env);
+}
+
+static void mir_ctx_sub_prune(mir_ctx *ctx, mir_subroutine *sub) {
+  vec_mir_bb *new_bbs = vec_mir_bb_new_arena(ctx->mir->arena);
+
+  while (!vec_mir_bb_empty(sub->defined.bbs)) {
+    mir_bb *bb = vec_mir_bb_pop_front(sub->defined.bbs);
+    if (mir_ctx_state_find(ctx, bb)) {
+      vec_mir_bb_push_back(new_bbs, bb);
+    }
+  }
+
+  sub->defined.bbs = new_bbs;
+}
+
+// removes literals assigned to temporaries that are never read after folding
+// and temporaries themselves
+static void mir_ctx_sub_clean(mir_ctx *ctx, mir_subroutine *sub) {
+  hashset_mir_value_ref *reads = hashset_mir_value_ref_new();
+  mir_sub_reads_insert(sub, reads);
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    mir_bb       *bb        = GET(it);
+    vec_mir_stmt *new_stmts = vec_mir_stmt_new_arena(ctx->mir->arena);
+
+    while (!vec_mir_stmt_empty(bb->stmts)) {
+      mir_stmt *stmt = vec_mir_stmt_pop_front(bb->stmts);
+
+      if (stmt->kind == MIR_STMT_ASSIGN &&
+          stmt->assign.kind == MIR_STMT_ASSIGN_LIT &&
+          mir_value_is_tmp(sub, stmt->assign.to) &&
+          !mir_value_set_contains(reads, stmt->assign.to)) {
+        continue;
+      }
+      vec_mir_stmt_push_back(new_stmts, stmt);
+    }
+
+    bb->stmts = new_stmts;
+  }
+
+  // temporaries that are not mentioned anymore don't need stack slots
+  mir_sub_tmps_prune(ctx->mir->arena, sub);
+
+  hashset_mir_value_ref_free(reads);
+}
+
+static void mir_ctx_sccp_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
+  if (vec_mir_bb_empty(sub->defined.bbs)) {
+    return;
+  }
+
+  ctx->plain    = hashset_mir_value_ref_new();
+  ctx->states   = hashset_mir_bb_state_new();
+  ctx->worklist = vec_mir_bb_ref_new();
+
+  mir_sub_plain_insert(sub, ctx->plain);
+
+  // first bb is the entry
+  mir_bb            *entry = vec_mir_bb_front(sub->defined.bbs);
+  hashset_mir_const *env   = hashset_mir_const_new();
+  mir_ctx_bb_visit(ctx, entry, env);
+  hashset_mir_const_free(env);
+
+  while (!vec_mir_bb_ref_empty(ctx->worklist)) {
+    mir_ctx_bb_propagate(ctx, vec_mir_bb_ref_pop_front(ctx->worklist));
+  }
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    if (mir_ctx_state_find(ctx, GET(it))) {
+      mir_ctx_bb_rewrite(ctx, GET(it));
+    }
+  }
+
+  mir_ctx_sub_prune(ctx, sub);
+  mir_ctx_sub_clean(ctx, sub);
+
+  vec_mir_bb_ref_free(ctx->worklist);
+  hashset_mir_bb_state_free(ctx->states);
+  hashset_mir_value_ref_free(ctx->plain);
+  ctx->worklist = NULL;
+  ctx->states   = NULL;
+  ctx->plain    = NULL;
+}
+
+static const type_entry *mir_type_table_find_bool(const type_table *table) {
+  type_primitive type_bool = {
+      .base = {.kind = TYPE_PRIMITIVE},
+      .type = TYPE_PRIMITIVE_BOOL,
+  };
+  return type_table_find(table, (type_base *)&type_bool);
+}
+
+mir_sccp_result mir_sccp(mir *mir, const type_table *type_table) {
+  mir_sccp_result result = {
+      .exceptions = list_exception_new(),
+  };
+
+  mir_ctx ctx = {
+      .mir        = mir,
+      .type_bool  = mir_type_table_find_bool(type_table),
+      .lit_cnt    = 0,
+      .plain      = NULL,
+      .states     = NULL,
+      .worklist   = NULL,
+      .exceptions = result.exceptions,
+  };
+
+  for (list_mir_lit_it it = list_mir_lit_begin(mir->literals); !END(it);
+       NEXT(it)) {
+    if (GET(it)->id >= ctx.lit_cnt) {
+      ctx.lit_cnt = GET(it)->id + 1;
+    }
+  }
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_sccp_subroutine(&ctx, sub);
+    }
+  }
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->methods);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_sccp_subroutine(&ctx, sub);
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+#include "compiler/type_table/type_table.h"
+
+typedef struct mir_sccp_result_struct {
+  list_exception *exceptions;
+} mir_sccp_result;
+
+// folds operations on primitive literals, resolves constant branches and
+// removes blocks that became unreachable
+mir_sccp_result mir_sccp(mir *mir, const type_table *type_table);
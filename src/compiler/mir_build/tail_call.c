@@ -0,0 +1,227 @@
+#include "tail_call.h"
+
+#include "compiler/mir_build/analysis.h"
+#include "util/macro.h"
+
+// CTX
+typedef struct mir_ctx_struct {
+  arena          *arena; // of mir
+  mir_subroutine *sub;
+  size_t          value_cnt;
+  mir_value      *sink; // receives vars to reset them before the next pass
+} mir_ctx;
+
+static mir_value *mir_ctx_tmp_new(mir_ctx *ctx, const type_entry *type_ref) {
+  mir_value *value = mir_value_new(ctx->arena, ctx->value_cnt++, NULL,
+                                   type_ref);
+  vec_mir_value_push_back(ctx->sub->defined.tmps, value);
+  return value;
+}
+
+// only empty blocks are left till the end of subroutine
+static int mir_ctx_bb_is_tail(mir_ctx *ctx, const mir_bb *bb) {
+  size_t steps = vec_mir_bb_size(ctx->sub->defined.bbs);
+
+  for (const mir_bb *cur = bb->jmp.next_ref; steps; cur = cur->jmp.next_ref) {
+    if (!vec_mir_stmt_empty(cur->stmts)) {
+      return 0;
+    }
+    switch (mir_bb_get_cond(cur)) {
+      case MIR_BB_TERM:
+        return 1;
+      case MIR_BB_NEXT:
+        break;
+      default:
+        return 0;
+    }
+    --steps;
+  }
+  // empty infinite loop
+  return 0;
+}
+
+static int mir_ctx_value_reads_cnt(mir_ctx *ctx, const mir_value *value) {
+  int cnt = 0;
+  for (vec_mir_bb_it it = vec_mir_bb_begin(ctx->sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    const mir_bb *bb = GET(it);
+    for (vec_mir_stmt_it it_stmt = vec_mir_stmt_begin(bb->stmts);
+         !END(it_stmt); NEXT(it_stmt)) {
+      cnt += mir_stmt_reads_value(GET(it_stmt), value);
+    }
+    cnt += bb->jmp.cond_ref == value;
+  }
+  return cnt;
+}
+
+// returns call if bb ends with 'ret = call(...)' through temporary
+static mir_stmt *mir_ctx_bb_tail_call(mir_ctx *ctx, const mir_bb *bb) {
+  if (vec_mir_stmt_size(bb->stmts) < 2 ||
+      mir_bb_get_cond(bb) == MIR_BB_COND) {
+    return NULL;
+  }
+  if (mir_bb_get_cond(bb) == MIR_BB_NEXT && !mir_ctx_bb_is_tail(ctx, bb)) {
+    return NULL;
+  }
+
+  vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts);
+  for (size_t i = vec_mir_stmt_size(bb->stmts) - 2; i; --i) {
+    NEXT(it);
+  }
+  mir_stmt *call = GET(it);
+  NEXT(it);
+  const mir_stmt *assign = GET(it);
+
+  if (call->kind != MIR_STMT_CALL || assign->kind != MIR_STMT_ASSIGN ||
+      (assign->assign.kind != MIR_STMT_ASSIGN_VALUE &&
+       assign->assign.kind != MIR_STMT_ASSIGN_MOVE) ||
+      assign->assign.to != ctx->sub->defined.ret ||
+      assign->assign.from_value != call->call.ret) {
+    return NULL;
+  }
+
+  // extern calls return through registers
+  const mir_subroutine *callee = call->call.sub;
+  if (!callee || callee->kind == MIR_SUBROUTINE_IMPORTED ||
+      (callee->spec & MIR_SUBROUTINE_SPEC_EXTERN)) {
+    return NULL;
+  }
+
+  if (!mir_value_is_tmp(ctx->sub, call->call.ret) ||
+      mir_ctx_value_reads_cnt(ctx, call->call.ret) != 1) {
+    return NULL;
+  }
+  return call;
+}
+
+static int mir_ctx_call_is_self(mir_ctx *ctx, const mir_stmt *call) {
+  size_t args_cnt =
+      call->call.args ? vec_mir_value_ref_size(call->call.args) : 0;
+  return call->call.sub == ctx->sub &&
+         args_cnt == vec_mir_value_size(ctx->sub->defined.params);
+}
+
+// args are copied before params are overwritten, because args may refer to
+// them. Vars start as void on each pass like in a new frame
+static void mir_ctx_self_call_loop(mir_ctx *ctx, mir_bb *bb,
+                                   const mir_stmt *call) {
+  vec_mir_value_ref *copies = vec_mir_value_ref_new();
+
+  for (vec_mir_value_ref_it it = vec_mir_value_ref_begin(call->call.args);
+       !END(it); NEXT(it)) {
+    mir_value *copy = mir_ctx_tmp_new(ctx, GET(it)->type_ref);
+    mir_stmt  *stmt =
+        mir_stmt_new_assign(ctx->arena, MIR_STMT_ASSIGN_VALUE, copy, GET(it));
+    stmt->debug = call->debug;
+    vec_mir_stmt_push_back(bb->stmts, stmt);
+    vec_mir_value_ref_push_back(copies, copy);
+  }
+
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.vars);
+       !END(it); NEXT(it)) {
+    if (!ctx->sink) {
+      ctx->sink = mir_ctx_tmp_new(ctx, NULL);
+    }
+    mir_stmt *stmt = mir_stmt_new_assign(ctx->arena, MIR_STMT_ASSIGN_MOVE,
+                                         ctx->sink, GET(it));
+    stmt->debug = call->debug;
+    vec_mir_stmt_push_back(bb->stmts, stmt);
+  }
+
+  vec_mir_value_ref_it it_copy = vec_mir_value_ref_begin(copies);
+  for (vec_mir_value_it it = vec_mir_value_begin(ctx->sub->defined.params);
+       !END(it); NEXT(it), NEXT(it_copy)) {
+    mir_stmt *stmt = mir_stmt_new_assign(ctx->arena, MIR_STMT_ASSIGN_MOVE,
+                                         GET(it), GET(it_copy));
+    stmt->debug = call->debug;
+    vec_mir_stmt_push_back(bb->stmts, stmt);
+  }
+
+  vec_mir_value_ref_free(copies);
+
+  bb->jmp.cond_ref = NULL;
+  bb->jmp.je_ref   = NULL;
+  bb->jmp.next_ref = vec_mir_bb_front(ctx->sub->defined.bbs);
+  bb->jmp.debug    = call->debug;
+}
+
+static void mir_ctx_bb_tail_call_apply(mir_ctx *ctx, mir_bb *bb,
+                                       mir_stmt *call) {
+  int self = mir_ctx_call_is_self(ctx, call);
+
+  // drop call (if self) and assignment of its result
+  vec_mir_stmt *new_stmts = vec_mir_stmt_new_arena(ctx->arena);
+  while (!vec_mir_stmt_empty(bb->stmts)) {
+    mir_stmt *stmt = vec_mir_stmt_pop_front(bb->stmts);
+    if (stmt == call) {
+      if (!self) {
+        vec_mir_stmt_push_back(new_stmts, stmt);
+      }
+      break;
+    }
+    vec_mir_stmt_push_back(new_stmts, stmt);
+  }
+  bb->stmts = new_stmts;
+
+  if (self) {
+    mir_ctx_self_call_loop(ctx, bb, call);
+  } else {
+    // callee assigns through pointer to the same value
+    call->call.ret = ctx->sub->defined.ret;
+  }
+}
+
+static void mir_ctx_tail_call_subroutine(mir_ctx *ctx, mir_subroutine *sub) {
+  if (vec_mir_bb_empty(sub->defined.bbs)) {
+    return;
+  }
+
+  ctx->sub       = sub;
+  ctx->value_cnt = mir_sub_value_id_next(sub);
+  ctx->sink      = NULL;
+
+  for (vec_mir_bb_it it = vec_mir_bb_begin(sub->defined.bbs); !END(it);
+       NEXT(it)) {
+    mir_bb   *bb   = GET(it);
+    mir_stmt *call = mir_ctx_bb_tail_call(ctx, bb);
+    if (call) {
+      mir_ctx_bb_tail_call_apply(ctx, bb, call);
+    }
+  }
+
+  mir_sub_tmps_prune(ctx->arena, sub);
+
+  ctx->sub  = NULL;
+  ctx->sink = NULL;
+}
+
+mir_tail_call_result mir_tail_call(mir *mir) {
+  mir_tail_call_result result = {
+      .exceptions = list_exception_new(),
+  };
+
+  mir_ctx ctx = {
+      .arena     = mir->arena,
+      .sub       = NULL,
+      .value_cnt = 0,
+      .sink      = NULL,
+  };
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->defined_subs);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_tail_call_subroutine(&ctx, sub);
+    }
+  }
+
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(mir->methods);
+       !END(it); NEXT(it)) {
+    mir_subroutine *sub = GET(it);
+    if (sub->kind == MIR_SUBROUTINE_DEFINED) {
+      mir_ctx_tail_call_subroutine(&ctx, sub);
+    }
+  }
+
+  return result;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "compiler/exception/list.h"
+#include "compiler/mir/mir.h"
+
+typedef struct mir_tail_call_result_struct {
+  list_exception *exceptions;
+} mir_tail_call_result;
+
+// finds calls whose result is returned right away. Self calls are replaced
+// with copies of args to params and jump to the entry block, other calls
+// write result directly to ret of subroutine
+mir_tail_call_result mir_tail_call(mir *mir);
@@ -33,3 +33,19 @@ span *span_copy(const span *self) {
   }
   return NULL;
 }
+
+span *span_new_arena(arena *arena, const char *source_ref, size_t line_start,
+                     size_t line_end, size_t pos_start, size_t pos_end) {
+  span *self = ARENA_MALLOC(arena, span);
+  *self      = span_make(source_ref, line_start, line_end, pos_start, pos_end);
+  return self;
+}
+
+span *span_copy_arena(arena *arena, const span *self) {
+  if (self) {
+    span *new_self = ARENA_MALLOC(arena, span);
+    *new_self      = *self;
+    return new_self;
+  }
+  return NULL;
+}
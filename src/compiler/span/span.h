@@ -1,5 +1,6 @@
 #pragma once
 
+#include "util/arena.h"
 #include <stddef.h>
 
 typedef struct span_struct {
@@ -16,3 +17,8 @@ span *span_new(const char *source, size_t line_start, size_t line_end,
                size_t pos_start, size_t pos_end);
 void  span_free(span *self);
 span *span_copy(const span *self);
+
+// spans of nodes in arena, they are not freed
+span *span_new_arena(arena *arena, const char *source, size_t line_start,
+                     size_t line_end, size_t pos_start, size_t pos_end);
+span *span_copy_arena(arena *arena, const span *self);
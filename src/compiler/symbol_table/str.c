@@ -40,7 +40,7 @@ char *symbol_table_str(const symbol_table *table, const char *title) {
     snprintf(buf, STRMAXLEN(buf), "%p", entry);
     list_chars_push_back(row, buf);
     // NAME
-    list_chars_push_back(row, entry->name);
+    list_chars_push_back(row, (char *)entry->name);
     // TYPE_ID
     if (entry->type_ref) {
       snprintf(buf, STRMAXLEN(buf), "%p", entry->type_ref);
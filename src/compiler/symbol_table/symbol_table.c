@@ -3,7 +3,8 @@
 #include "util/macro.h"
 #include <stdlib.h>
 
-symbol_entry *symbol_entry_new(char *id, type_entry *type_ref, span *span) {
+symbol_entry *symbol_entry_new(const char *id, type_entry *type_ref,
+                               span *span) {
   symbol_entry *self = MALLOC(symbol_entry);
   self->name         = id;
   self->type_ref     = type_ref;
@@ -13,7 +14,6 @@ symbol_entry *symbol_entry_new(char *id, type_entry *type_ref, span *span) {
 
 void symbol_entry_free(symbol_entry *self) {
   if (self) {
-    free(self->name);
     self->type_ref = NULL;
     span_free(self->span);
     free(self);
@@ -33,7 +33,7 @@ void symbol_table_free(symbol_table *self) {
   }
 }
 
-symbol_entry *symbol_table_emplace(symbol_table *self, char *id,
+symbol_entry *symbol_table_emplace(symbol_table *self, const char *id,
                                    type_entry *type_ref, span *span) {
   symbol_entry *entry = symbol_entry_new(id, type_ref, span);
   list_symbol_entry_push_back(self->entries, entry);
@@ -4,12 +4,14 @@
 #include "compiler/type_table/type_table.h"
 
 typedef struct symbol_entry_struct {
-  char       *name; // used inside scope resolution
+  const char *name; // interned, used inside scope resolution
   type_entry *type_ref;
   span       *span;
 } symbol_entry;
 
-symbol_entry *symbol_entry_new(char *id, type_entry *type_ref, span *span);
+// id is interned, so entries are found by pointer to their name
+symbol_entry *symbol_entry_new(const char *id, type_entry *type_ref,
+                               span *span);
 void          symbol_entry_free(symbol_entry *self);
 
 static inline void container_delete_symbol_entry(void *lsv) {
@@ -25,5 +27,5 @@ typedef struct symbol_table_struct {
 symbol_table *symbol_table_new();
 void          symbol_table_free(symbol_table *self);
 
-symbol_entry *symbol_table_emplace(symbol_table *self, char *id,
+symbol_entry *symbol_table_emplace(symbol_table *self, const char *id,
                                    type_entry *type_ref, span *span);
@@ -45,6 +45,9 @@ type_mono_enum type_fetch_mono(type_base *generic);
 
 int            type_cmp(const type_base *lsv, const type_base *rsv);
 uint64_t       type_hash(const type_base *lsv);
+// nested types are compared/hashed by pointer, valid for interned types only
+int            type_cmp_shallow(const type_base *lsv, const type_base *rsv);
+uint64_t       type_hash_shallow(const type_base *lsv);
 type_base     *type_copy(const type_base *generic);
 list_type_ref *type_copy_list_ref(const list_type_ref *from);
 
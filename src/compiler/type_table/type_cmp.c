@@ -213,3 +213,137 @@ uint64_t type_hash(const type_base *lsv) {
 
   return hash;
 }
+
+static int type_cmp_list_ref_shallow(const list_type_ref *lsv,
+                                     const list_type_ref *rsv) {
+  size_t lsz = list_type_ref_size(lsv);
+  size_t rsz = list_type_ref_size(rsv);
+  if (lsz > rsz) {
+    return 1;
+  } else if (lsz < rsz) {
+    return -1;
+  }
+  for (list_type_ref_it lit = list_type_ref_begin(lsv),
+                        rit = list_type_ref_begin(rsv);
+       !END(lit); NEXT(lit), NEXT(rit)) {
+    int cmp = container_cmp_ptr(GET(lit), GET(rit));
+    if (cmp) {
+      return cmp;
+    }
+  }
+  return 0;
+}
+
+static uint64_t type_hash_list_ref_shallow(uint64_t             hash,
+                                           const list_type_ref *lsv) {
+  for (list_type_ref_it it = list_type_ref_begin(lsv); !END(it); NEXT(it)) {
+    hash = hash_combine(hash, container_hash_ptr(GET(it)));
+  }
+  return hash;
+}
+
+// nested types are already unique, so only one level is compared
+int type_cmp_shallow(const type_base *lsv, const type_base *rsv) {
+  if (lsv == rsv) {
+    return 0;
+  }
+  if (lsv->kind > rsv->kind) {
+    return 1;
+  }
+  if (lsv->kind < rsv->kind) {
+    return -1;
+  }
+  switch (lsv->kind) {
+    case TYPE_PRIMITIVE:
+      return type_cmp(lsv, rsv);
+    case TYPE_ARRAY: {
+      const type_array *l = (const type_array *)lsv;
+      const type_array *r = (const type_array *)rsv;
+      return container_cmp_ptr(l->element_ref, r->element_ref);
+    }
+    case TYPE_CALLABLE: {
+      const type_callable *l = (const type_callable *)lsv;
+      const type_callable *r = (const type_callable *)rsv;
+
+      int cmp = type_cmp_list_ref_shallow(l->params, r->params);
+      if (cmp) {
+        return cmp;
+      }
+      return container_cmp_ptr(l->ret_ref, r->ret_ref);
+    }
+    case TYPE_CLASS_T: {
+      const type_class_t *l = (const type_class_t *)lsv;
+      const type_class_t *r = (const type_class_t *)rsv;
+
+      int cmp = strcmp(l->id, r->id);
+      if (cmp) {
+        return cmp;
+      }
+      cmp = type_cmp_list_ref_shallow(l->parents, r->parents);
+      if (cmp) {
+        return cmp;
+      }
+      return type_cmp_list_ref_shallow(l->typenames, r->typenames);
+    }
+    case TYPE_TYPENAME:
+      return type_cmp(lsv, rsv);
+    case TYPE_MONO: {
+      const type_mono *l = (const type_mono *)lsv;
+      const type_mono *r = (const type_mono *)rsv;
+
+      int cmp = container_cmp_ptr(l->type_ref, r->type_ref);
+      if (cmp) {
+        return cmp;
+      }
+      return type_cmp_list_ref_shallow(l->types, r->types);
+    }
+    default:
+      error("unexpected type kind %d", lsv->kind);
+      return -1;
+  }
+}
+
+uint64_t type_hash_shallow(const type_base *lsv) {
+  if (lsv == NULL) {
+    return 0;
+  }
+
+  uint64_t hash = 5381;
+
+  hash = hash_combine(hash, (uint64_t)lsv->kind);
+
+  switch (lsv->kind) {
+    case TYPE_PRIMITIVE:
+    case TYPE_TYPENAME:
+      return type_hash(lsv);
+    case TYPE_ARRAY: {
+      const type_array *l = (const type_array *)lsv;
+
+      hash = hash_combine(hash, container_hash_ptr(l->element_ref));
+    } break;
+    case TYPE_CALLABLE: {
+      const type_callable *l = (const type_callable *)lsv;
+
+      hash = type_hash_list_ref_shallow(hash, l->params);
+      hash = hash_combine(hash, container_hash_ptr(l->ret_ref));
+    } break;
+    case TYPE_CLASS_T: {
+      const type_class_t *l = (const type_class_t *)lsv;
+
+      hash = hash_combine(hash, container_hash_chars(l->id));
+      hash = type_hash_list_ref_shallow(hash, l->parents);
+      hash = type_hash_list_ref_shallow(hash, l->typenames);
+    } break;
+    case TYPE_MONO: {
+      const type_mono *l = (const type_mono *)lsv;
+
+      hash = hash_combine(hash, container_hash_ptr(l->type_ref));
+      hash = type_hash_list_ref_shallow(hash, l->types);
+    } break;
+    default:
+      error("unexpected type kind %d", lsv->kind);
+      return 0;
+  }
+
+  return hash;
+}
@@ -21,11 +21,13 @@ void type_entry_free(type_entry *self) {
 type_table *type_table_new() {
   type_table *self = MALLOC(type_table);
   self->entries    = list_type_entry_new();
+  self->index      = hashset_type_shallow_new();
   return self;
 }
 
 void type_table_free(type_table *self) {
   if (self) {
+    hashset_type_shallow_free(self->index);
     list_type_entry_free(self->entries);
     free(self);
   }
@@ -37,3 +39,36 @@ type_entry *type_table_emplace(type_table *self, type_base *type, span *span) {
   list_type_entry_push_back(self->entries, entry);
   return entry;
 }
+
+type_entry *type_table_intern(type_table *self, type_base *type, span *span) {
+  type_entry *found = type_table_find(self, type);
+  if (found) {
+    type_free(type);
+    span_free(span);
+    return found;
+  }
+
+  type_entry *entry = type_table_emplace(self, type, span);
+  hashset_type_shallow_insert(self->index, type);
+  return entry;
+}
+
+type_entry *type_table_find(const type_table *self, const type_base *type) {
+  hashset_type_shallow_it it =
+      hashset_type_shallow_find(self->index, (type_base *)type);
+  if (END(it)) {
+    return NULL;
+  }
+  return GET(it)->type_entry_ref;
+}
+
+void type_table_unindex(type_table *self, type_base *type) {
+  hashset_type_shallow_it it = hashset_type_shallow_find(self->index, type);
+  if (!END(it) && GET(it) == type) {
+    hashset_type_shallow_erase(self->index, it);
+  }
+}
+
+void type_table_reindex(type_table *self, type_base *type) {
+  hashset_type_shallow_insert(self->index, type);
+}
@@ -2,6 +2,7 @@
 
 #include "compiler/span/span.h"
 #include "compiler/type_table/type.h"
+#include "util/hashset.h"
 
 typedef struct type_entry_struct {
   type_base *type;
@@ -17,10 +18,26 @@ static inline void container_delete_type_entry(void *lsv) {
 LIST_DECLARE_STATIC_INLINE(list_type_entry, type_entry, container_cmp_false,
                            container_new_move, container_delete_type_entry);
 
-// TODO: use hashset instead of list
-// compare/hash is required in template expansion
+static inline int container_cmp_type_shallow(const void *lsv, const void *rsv) {
+  return type_cmp_shallow(lsv, rsv);
+}
+static inline uint64_t container_hash_type_shallow(const void *lsv) {
+  return type_hash_shallow(lsv);
+}
+HASHSET_DECLARE_STATIC_INLINE(hashset_type_shallow, type_base,
+                              container_cmp_type_shallow, container_new_move,
+                              container_delete_false,
+                              container_hash_type_shallow);
+
+// types are hash-consed: structural types are interned, each of them exists
+// in table once, so equal types have the same pointer. Nested types of
+// interned type are interned too, that's why index compares them by pointer.
+//
+// classes and typenames are declarations, they are emplaced (not interned)
+// and compared by pointer.
 typedef struct type_table_struct {
-  list_type_entry *entries;
+  list_type_entry      *entries; // in order of insertion
+  hashset_type_shallow *index;   // interned types
 } type_table;
 
 type_table *type_table_new();
@@ -28,3 +45,13 @@ void        type_table_free(type_table *self);
 
 // returns pointer of inserted entry
 type_entry *type_table_emplace(type_table *self, type_base *type, span *span);
+// returns entry of type equal to passed one, if it is present type and span
+// are freed, otherwise they are emplaced
+type_entry *type_table_intern(type_table *self, type_base *type, span *span);
+// returns entry of interned type equal to passed one or NULL
+type_entry *type_table_find(const type_table *self, const type_base *type);
+
+// interned type should be unindexed before it is changed in place and then
+// indexed again, so references to it stay valid
+void type_table_unindex(type_table *self, type_base *type);
+void type_table_reindex(type_table *self, type_base *type);
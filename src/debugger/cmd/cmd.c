@@ -103,7 +103,8 @@ void cmd_out_source_line(ctx *ctx, ctx_debug_line line) {
   snprintf(buf, STRMAXLEN(buf), "%zu│", line.line);
 
   ctx_out_append(ctx, buf);
-  ctx_out_append(ctx, file->lines[line.line]);
+  ctx_out_append_n(ctx, file->lines[line.line],
+                   file->lines[line.line + 1] - file->lines[line.line]);
 }
 
 void cmd_out_line(ctx *ctx, ctx_debug_line line) {
@@ -347,7 +347,8 @@ static void cmd_info_debug_files(ctx *ctx) {
       snprintf(buf, STRMAXLEN(buf), "%lu", j);
       ctx_out_append(ctx, buf);
       ctx_out_append(ctx, "│");
-      ctx_out_append(ctx, file->lines[j]);
+      ctx_out_append_n(ctx, file->lines[j],
+                       file->lines[j + 1] - file->lines[j]);
     }
   }
 }
@@ -56,6 +56,10 @@ void ctx_out_append(ctx *self, const char *data) {
   strbuf_append(self->buf_out, data);
 }
 
+void ctx_out_append_n(ctx *self, const char *data, size_t len) {
+  strbuf_append_n(self->buf_out, data, len);
+}
+
 void ctx_out_appendln(ctx *self, const char *data) {
   ctx_out_append(self, data);
   ctx_out_append(self, "\n");
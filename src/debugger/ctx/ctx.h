@@ -31,6 +31,7 @@ ctx *ctx_new();
 void ctx_free(ctx *self);
 
 void ctx_out_append(ctx *self, const char *data);
+void ctx_out_append_n(ctx *self, const char *data, size_t len);
 void ctx_out_appendln(ctx *self, const char *data);
 void ctx_err_append(ctx *self, const char *data);
 void ctx_err_appendln(ctx *self, const char *data);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "util/container_util.h"
+#include "util/file.h"
 #include "util/hashset.h"
 #include <stdbool.h>
 #include <stddef.h>
@@ -62,10 +63,13 @@ typedef struct ctx_debug_sub_struct {
   ctx_debug_var   *vars;
 } ctx_debug_sub;
 
+// source is mapped once and lines point into it, line i is chars from
+// lines[i] to lines[i + 1]. Lines start from 1
 typedef struct ctx_debug_file_struct {
-  uint64_t debug_str_id;
-  uint64_t lines_cnt;
-  char   **lines;
+  uint64_t     debug_str_id;
+  uint64_t     lines_cnt;
+  const char **lines;
+  file_map     source;
 } ctx_debug_file;
 
 typedef struct ctx_debug_line_struct {
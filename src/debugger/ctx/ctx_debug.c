@@ -2,7 +2,7 @@
 
 #include "util/macro.h"
 #include "x86_64_core/debug.h"
-#include <stdio.h>
+#include <string.h>
 
 void ctx_dbg_init(ctx *self) {
   if (!self->abfd) {
@@ -64,6 +64,7 @@ void ctx_dbg_init(ctx *self) {
         file->debug_str_id = ((x86_64_debug_info_file *)cur)->debug_str_id;
         file->lines_cnt    = 0;
         file->lines        = NULL;
+        file->source       = (file_map){.chars = NULL, .len = 0, .mapped = 0};
 
         cur += sizeof(x86_64_debug_info_file);
       }
@@ -111,39 +112,31 @@ void ctx_dbg_init(ctx *self) {
 
   // post init files lines
   for (uint64_t i = 0; i < self->debug.files_cnt; ++i) {
-    ctx_debug_file *file    = self->debug.files[i];
-    FILE           *file_fp = NULL;
-    file_fp                 = fopen(dbg->strs[file->debug_str_id], "r");
-    if (file_fp) {
-      char  *line = NULL;
-      size_t len  = 0;
-      while (getline(&line, &len, file_fp) != -1) {
-        file->lines_cnt++;
-        free(line);
-        line = NULL;
-      }
-      free(line);
-      fclose(file_fp);
+    ctx_debug_file *file = self->debug.files[i];
+    if (file_map_open(&file->source, dbg->strs[file->debug_str_id])) {
+      continue;
     }
-    file_fp = fopen(dbg->strs[file->debug_str_id], "r");
-    if (file_fp) {
-      // increase by one to set lines from 1
-      file->lines = MALLOCN(char *, ++file->lines_cnt);
-
-      char  *line = NULL;
-      size_t len  = 0;
-
-      uint64_t li       = 0;
-      file->lines[li++] = NULL;
-      while (li < file->lines_cnt && getline(&line, &len, file_fp) != -1) {
-        file->lines[li++] = line;
-        line              = NULL;
-      }
-      if (line) {
-        free(line);
-      }
-      fclose(file_fp);
+    const char *begin = file->source.chars;
+    const char *end   = begin + file->source.len;
+
+    // increase by one to set lines from 1
+    file->lines_cnt = 1;
+    for (const char *cur = begin; cur < end; ++file->lines_cnt) {
+      const char *next = memchr(cur, '\n', end - cur);
+      cur              = next ? next + 1 : end;
     }
+
+    // one more for end of last line
+    file->lines = MALLOCN(const char *, file->lines_cnt + 1);
+
+    uint64_t li       = 0;
+    file->lines[li++] = NULL;
+    for (const char *cur = begin; cur < end; ++li) {
+      const char *next = memchr(cur, '\n', end - cur);
+      file->lines[li]  = cur;
+      cur              = next ? next + 1 : end;
+    }
+    file->lines[li] = end;
   }
 }
 
@@ -162,14 +155,8 @@ void ctx_dbg_deinit(ctx *self) {
 
   for (uint64_t i = 0; i < dbg->files_cnt; ++i) {
     ctx_debug_file *file = dbg->files[i];
-    if (file->lines) {
-      for (uint64_t j = 0; j < file->lines_cnt; ++j) {
-        if (file->lines[j]) {
-          free(file->lines[j]);
-        }
-      }
-      free(file->lines);
-    }
+    free(file->lines);
+    file_map_close(&file->source);
     free(file);
   }
   free(dbg->files);
@@ -0,0 +1,128 @@
+#include "util/arena.h"
+
+#include "util/macro.h"
+#include <stdalign.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_ALIGN alignof(max_align_t)
+
+struct arena_chunk_struct {
+  arena_chunk *next;
+  size_t       size;
+  size_t       offset;
+  alignas(max_align_t) unsigned char data[];
+};
+
+static size_t arena_align_up(size_t size) {
+  return (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+static arena_chunk *arena_chunk_new(size_t size, arena_chunk *next) {
+  arena_chunk *self = malloc(sizeof(arena_chunk) + size);
+  self->next        = next;
+  self->size        = size;
+  self->offset      = 0;
+  return self;
+}
+
+arena *arena_new(size_t chunk_size) {
+  arena *self      = MALLOC(arena);
+  self->chunk_size = chunk_size ? arena_align_up(chunk_size) : ARENA_CHUNK_SIZE;
+  self->head       = arena_chunk_new(self->chunk_size, NULL);
+  self->used       = 0;
+  return self;
+}
+
+static void arena_chunks_free(arena_chunk *chunk) {
+  arena_chunk *next;
+  for (; chunk; chunk = next) {
+    next = chunk->next;
+    free(chunk);
+  }
+}
+
+void arena_free(arena *self) {
+  if (self) {
+    arena_chunks_free(self->head);
+    free(self);
+  }
+}
+
+void *arena_alloc(arena *self, size_t size) {
+  size = arena_align_up(size ? size : 1);
+  self->used += size;
+
+  arena_chunk *head = self->head;
+  if (head->size - head->offset >= size) {
+    void *data = head->data + head->offset;
+    head->offset += size;
+    return data;
+  }
+
+  // large allocation is placed after head, so rest of head is still used
+  if (size > self->chunk_size / 4) {
+    arena_chunk *chunk = arena_chunk_new(size, head->next);
+    chunk->offset      = size;
+    head->next         = chunk;
+    return chunk->data;
+  }
+
+  head         = arena_chunk_new(self->chunk_size, head);
+  head->offset = size;
+  self->head   = head;
+  return head->data;
+}
+
+char *arena_strdup(arena *self, const char *chars) {
+  size_t len  = strlen(chars) + 1;
+  char  *copy = arena_alloc(self, len);
+  memcpy(copy, chars, len);
+  return copy;
+}
+
+char *arena_strndup(arena *self, const char *chars, size_t len) {
+  len        = strnlen(chars, len);
+  char *copy = arena_alloc(self, len + 1);
+  memcpy(copy, chars, len);
+  copy[len] = '\0';
+  return copy;
+}
+
+// chunks of other are placed after head, so rest of head is still used
+void arena_merge(arena *self, arena *other) {
+  arena_chunk *tail = other->head;
+  while (tail->next) {
+    tail = tail->next;
+  }
+  tail->next       = self->head->next;
+  self->head->next = other->head;
+  self->used += other->used;
+  free(other);
+}
+
+void arena_reset(arena *self) {
+  arena_chunk *keep = NULL;
+  arena_chunk *next;
+
+  // one chunk of regular size is kept
+  for (arena_chunk *chunk = self->head; chunk; chunk = next) {
+    next = chunk->next;
+    if (!keep && chunk->size == self->chunk_size) {
+      keep = chunk;
+      continue;
+    }
+    free(chunk);
+  }
+  if (!keep) {
+    keep = arena_chunk_new(self->chunk_size, NULL);
+  }
+
+  keep->next   = NULL;
+  keep->offset = 0;
+  self->head   = keep;
+  self->used   = 0;
+}
+
+size_t arena_used(const arena *self) { return self->used; }
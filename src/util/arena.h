@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stddef.h>
+
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+#define ARENA_MALLOC(arena, x)                                                 \
+  ((typeof(x) *)arena_alloc(arena, sizeof(typeof(x))))
+#define ARENA_MALLOCN(arena, x, n)                                             \
+  ((typeof(x) *)arena_alloc(arena, sizeof(typeof(x)) * (n)))
+
+typedef struct arena_chunk_struct arena_chunk;
+
+// bump allocator: memory is taken from chunks and released all at once when
+// arena is reset or freed. Not thread safe
+typedef struct arena_struct {
+  arena_chunk *head; // chunk allocations are made from
+  size_t       chunk_size;
+  size_t       used;
+} arena;
+
+arena *arena_new(size_t chunk_size); // 0 for ARENA_CHUNK_SIZE
+void   arena_free(arena *self);
+
+// memory is aligned for any type, requests larger than chunk get own chunk
+void *arena_alloc(arena *self, size_t size);
+char *arena_strdup(arena *self, const char *chars);
+char *arena_strndup(arena *self, const char *chars, size_t len);
+
+// moves chunks of other to self and frees other, allocations of other are
+// released with self
+void arena_merge(arena *self, arena *other);
+
+// releases all allocations, keeps first chunk for reuse
+void   arena_reset(arena *self);
+// bytes allocated since creation or reset
+size_t arena_used(const arena *self);
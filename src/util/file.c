@@ -11,6 +11,8 @@
 #include <direct.h>
 #define mkdir(path, mode) _mkdir(path)
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -75,22 +77,86 @@ char *dirname(const char *file_path) {
   return dir_path;
 }
 
-char *read_file(const char *path) {
-  char *buffer = 0;
-  long  length;
+// reads until end of file, size of pipes isn't known beforehand
+static int file_map_read(file_map *self, FILE *f) {
+  size_t cap = 4096;
+  size_t len = 0;
+  char  *buf = malloc(cap);
+  size_t read;
+
+  while (buf && (read = fread(buf + len, 1, cap - len, f)) > 0) {
+    len += read;
+    if (len == cap) {
+      char *next = realloc(buf, cap *= 2);
+      if (!next) {
+        free(buf);
+      }
+      buf = next;
+    }
+  }
+
+  if (!buf || ferror(f)) {
+    free(buf);
+    return -1;
+  }
+
+  self->chars  = buf;
+  self->len    = len;
+  self->mapped = 0;
+  return 0;
+}
+
+int file_map_open(file_map *self, const char *path) {
+  *self = (file_map){.chars = NULL, .len = 0, .mapped = 0};
+
+#ifdef _WIN32
   FILE *f = fopen(path, "rb");
+  if (!f) {
+    return -1;
+  }
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return -1;
+  }
 
-  if (f) {
-    fseek(f, 0, SEEK_END);
-    length = ftell(f);
-    fseek(f, 0, SEEK_SET);
-    buffer = malloc(length + 1);
-    if (buffer) {
-      fread(buffer, 1, length, f);
-      buffer[length] = '\0';
+  struct stat st;
+  if (!fstat(fd, &st) && S_ISREG(st.st_mode) && st.st_size > 0) {
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      // sources are scanned once from start to end
+      madvise(data, st.st_size, MADV_SEQUENTIAL);
+      close(fd);
+      self->chars  = data;
+      self->len    = st.st_size;
+      self->mapped = 1;
+      return 0;
     }
-    fclose(f);
   }
 
-  return buffer;
+  FILE *f = fdopen(fd, "rb");
+  if (!f) {
+    int err = errno;
+    close(fd);
+    errno = err;
+    return -1;
+  }
+#endif
+
+  int res = file_map_read(self, f);
+  int err = errno;
+  fclose(f);
+  errno = err;
+  return res;
+}
+
+void file_map_close(file_map *self) {
+  if (self->mapped) {
+#ifndef _WIN32
+    munmap((void *)self->chars, self->len);
+#endif
+  } else {
+    free((void *)self->chars);
+  }
+  *self = (file_map){.chars = NULL, .len = 0, .mapped = 0};
 }
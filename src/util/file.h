@@ -1,9 +1,21 @@
 #pragma once
 
+#include <stddef.h>
+
 char *join_paths(const char *dir, const char *file);
 
 int   dir_create(const char *path);
 int   dir_create_p(const char *dir);
 char *dirname(const char *file_path);
 
-char *read_file(const char *path);
+// file contents mapped to memory read only, chars aren't terminated. Files
+// that can't be mapped (empty files, pipes) are read to buffer instead
+typedef struct file_map_struct {
+  const char *chars;
+  size_t      len;
+  int         mapped;
+} file_map;
+
+// returns 0 on success, -1 with errno set otherwise
+int  file_map_open(file_map *self, const char *path);
+void file_map_close(file_map *self);
@@ -0,0 +1,32 @@
+#include "util/hash.h"
+
+#include <string.h>
+
+#define HASH_PRIME 0x100000001b3ull
+
+uint64_t hash_bytes(uint64_t hash, const void *data, size_t size) {
+  const uint8_t *bytes = data;
+
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= bytes[i];
+    hash *= HASH_PRIME;
+  }
+  return hash;
+}
+
+uint64_t hash_chars(uint64_t hash, const char *chars) {
+  if (!chars) {
+    return hash_uint64(hash, 0);
+  }
+  return hash_bytes(hash, chars, strlen(chars) + 1);
+}
+
+uint64_t hash_uint64(uint64_t hash, uint64_t value) {
+  uint8_t bytes[sizeof(value)];
+
+  // independent of byte order
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    bytes[i] = (uint8_t)(value >> (i * 8));
+  }
+  return hash_bytes(hash, bytes, sizeof(bytes));
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// FNV-1a, hashes are combined by passing previous hash as seed
+#define HASH_SEED 0xcbf29ce484222325ull
+
+uint64_t hash_bytes(uint64_t hash, const void *data, size_t size);
+// terminator is hashed too, so concatenated strings don't collide
+uint64_t hash_chars(uint64_t hash, const char *chars);
+uint64_t hash_uint64(uint64_t hash, uint64_t value);
@@ -3,68 +3,99 @@
 #include "util/macro.h"
 #include <stdlib.h>
 
-static void hashset_bucket_free_in(hashset *self, hashset_bucket *bucket) {
-  hashset_list_node *next;
-  for (hashset_list_node *node = bucket->head; node; node = next) {
-    next = node->next;
-    self->f_delete(node->data);
-    free(node);
-  }
+// hashes of container functions are weak in low bits (pointers are aligned),
+// they are mixed before masking
+static uint32_t hashset_hash(const hashset *self, const void *data) {
+  uint64_t hash = self->f_hash(data);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdull;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ull;
+  hash ^= hash >> 33;
+  return (uint32_t)hash;
 }
 
-static hashset_it hashset_it_make(hashset *hashset, size_t bucket_i,
-                                  hashset_list_node *node,
-                                  hashset_list_node *prev) {
+static hashset_it hashset_it_make(hashset *hashset, size_t index) {
   hashset_it it = {
-      .hashset  = hashset,
-      .bucket_i = bucket_i,
-      .node     = node,
-      .prev     = prev,
+      .hashset = hashset,
+      .index   = index,
   };
   return it;
 }
 
-static void hashset_grow(hashset *self) {
-  size_t new_capacity = self->capacity * self->growth_factor;
+static hashset_slot *hashset_slots_new(size_t capacity) {
+  hashset_slot *slots = MALLOCN(hashset_slot, capacity);
+  for (size_t i = 0; i < capacity; ++i) {
+    slots[i].dist = 0;
+  }
+  return slots;
+}
 
-  hashset_bucket *new_buckets = MALLOCN(hashset_bucket, new_capacity);
-  for (size_t i = 0; i < new_capacity; ++i) {
-    new_buckets[i].head = NULL;
+// returns index where slot is placed, elements it displaces are moved further
+static size_t hashset_place(hashset *self, hashset_slot slot) {
+  size_t mask  = self->capacity - 1;
+  size_t index = self->capacity;
+
+  slot.dist = 1;
+  for (size_t i = slot.hash & mask;; i = (i + 1) & mask, ++slot.dist) {
+    hashset_slot *cur = self->slots + i;
+    if (!cur->dist) {
+      *cur = slot;
+      return index == self->capacity ? i : index;
+    }
+    if (cur->dist < slot.dist) {
+      hashset_slot tmp = *cur;
+      *cur             = slot;
+      slot             = tmp;
+      if (index == self->capacity) {
+        index = i;
+      }
+    }
   }
+}
 
-  for (size_t i = 0; i < self->capacity; ++i) {
-    hashset_bucket    *bucket = self->buckets + i;
-    hashset_list_node *next;
-    for (hashset_list_node *node = bucket->head; node; node = next) {
-      next                       = node->next;
-      size_t          new_i      = self->f_hash(node->data) % new_capacity;
-      hashset_bucket *new_bucket = new_buckets + new_i;
-      node->next                 = new_bucket->head;
-      new_bucket->head           = node;
+static void hashset_grow(hashset *self) {
+  hashset_slot *slots    = self->slots;
+  size_t        capacity = self->capacity;
+
+  self->capacity = capacity * 2;
+  self->slots    = hashset_slots_new(self->capacity);
+
+  for (size_t i = 0; i < capacity; ++i) {
+    if (slots[i].dist) {
+      hashset_place(self, slots[i]);
     }
   }
+  free(slots);
+}
+
+static size_t hashset_lookup(hashset *self, const void *data, uint32_t hash) {
+  size_t mask = self->capacity - 1;
 
-  free(self->buckets);
-  self->buckets  = new_buckets;
-  self->capacity = new_capacity;
+  uint32_t dist = 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask, ++dist) {
+    const hashset_slot *cur = self->slots + i;
+    if (cur->dist < dist) {
+      return self->capacity;
+    }
+    if (cur->hash == hash && !self->f_cmp(cur->data, data)) {
+      return i;
+    }
+  }
 }
 
 void hashset_init(hashset *self, container_f_cmp f_cmp, container_f_new f_new,
                   container_f_delete f_delete, container_f_hash f_hash) {
-  self->load_factor   = HASHTABLE_LOAD_FACTOR;
-  self->growth_factor = HASHTABLE_GROWTH_FACTOR;
-  self->capacity      = HASHTABLE_INITIAL_CAPACITY;
-  self->size          = 0;
+  self->load_factor = HASHTABLE_LOAD_FACTOR;
+  self->capacity    = HASHTABLE_INITIAL_CAPACITY;
+  self->size        = 0;
 
   self->f_cmp    = f_cmp;
   self->f_new    = f_new;
   self->f_delete = f_delete;
   self->f_hash   = f_hash;
 
-  self->buckets = MALLOCN(hashset_bucket, self->capacity);
-  for (size_t i = 0; i < self->capacity; ++i) {
-    self->buckets[i].head = NULL;
-  }
+  self->slots = hashset_slots_new(self->capacity);
 }
 
 hashset *hashset_new(container_f_cmp f_cmp, container_f_new f_new,
@@ -76,9 +107,11 @@ hashset *hashset_new(container_f_cmp f_cmp, container_f_new f_new,
 
 void hashset_deinit(hashset *self) {
   for (size_t i = 0; i < self->capacity; ++i) {
-    hashset_bucket_free_in(self, self->buckets + i);
+    if (self->slots[i].dist) {
+      self->f_delete(self->slots[i].data);
+    }
   }
-  free(self->buckets);
+  free(self->slots);
 }
 
 void hashset_free(hashset *self) {
@@ -88,91 +121,83 @@ void hashset_free(hashset *self) {
   }
 }
 
-int hashset_it_end(hashset_it *it) { return !it->node; }
+int hashset_it_end(hashset_it *it) {
+  return it->index >= it->hashset->capacity;
+}
 
-void *hashset_it_get(hashset_it *it) { return it->node->data; }
+void *hashset_it_get(hashset_it *it) {
+  return it->hashset->slots[it->index].data;
+}
 
 int hashset_it_next(hashset_it *it) {
-  if (it->node) {
-    it->prev = it->node;
-    it->node = it->node->next;
-    if (!it->node) {
-      it->prev = NULL;
-      while (++it->bucket_i < it->hashset->capacity &&
-             !it->hashset->buckets[it->bucket_i].head)
-        ;
-      if (it->bucket_i == it->hashset->capacity) {
-        return 0;
-      }
-      it->node = it->hashset->buckets[it->bucket_i].head;
-    }
-    return 1;
+  const hashset *hashset = it->hashset;
+  if (it->index < hashset->capacity) {
+    while (++it->index < hashset->capacity && !hashset->slots[it->index].dist)
+      ;
+    return it->index < hashset->capacity;
   }
   return 0;
 }
 
 hashset_it hashset_find(hashset *self, void *data) {
-  size_t          index  = self->f_hash(data) % self->capacity;
-  hashset_bucket *bucket = self->buckets + index;
-
-  hashset_list_node *prev = NULL;
-  for (hashset_list_node *node = bucket->head; node; node = node->next) {
-    if (!self->f_cmp(node->data, data)) {
-      return hashset_it_make(self, index, node, prev);
-    }
-    prev = node;
-  }
-  return hashset_it_make(self, 0, NULL, NULL);
+  return hashset_it_make(
+      self, hashset_lookup(self, data, hashset_hash(self, data)));
 }
 
 hashset_it hashset_insert(hashset *self, void *data) {
-  if ((float)self->size / self->capacity > self->load_factor) {
-    hashset_grow(self);
+  uint32_t hash  = hashset_hash(self, data);
+  size_t   index = hashset_lookup(self, data, hash);
+
+  if (index != self->capacity) {
+    hashset_slot *slot = self->slots + index;
+    self->f_delete(slot->data);
+    slot->data = self->f_new(data);
+    return hashset_it_make(self, index);
   }
 
-  size_t          index  = self->f_hash(data) % self->capacity;
-  hashset_bucket *bucket = self->buckets + index;
-
-  hashset_list_node *prev = NULL;
-  for (hashset_list_node *node = bucket->head; node; node = node->next) {
-    if (!self->f_cmp(node->data, data)) {
-      self->f_delete(node->data);
-      node->data = self->f_new(data);
-      return hashset_it_make(self, index, node, prev);
-    } else {
-      prev = node;
-    }
+  if ((double)(self->size + 1) / self->capacity > self->load_factor) {
+    hashset_grow(self);
   }
 
-  hashset_list_node *node = MALLOC(hashset_list_node);
-  node->data              = self->f_new(data);
-  node->next              = bucket->head;
-  bucket->head            = node;
+  hashset_slot slot = {
+      .data = self->f_new(data),
+      .hash = hash,
+  };
   self->size += 1;
-  return hashset_it_make(self, index, node, NULL);
+  return hashset_it_make(self, hashset_place(self, slot));
 }
 
 void hashset_replace(hashset *self, hashset_it it, void *data) {
-  self->f_delete(it.node->data);
-  it.node->data = self->f_new(data);
+  hashset_slot *slot = self->slots + it.index;
+  self->f_delete(slot->data);
+  slot->data = self->f_new(data);
 }
 
 hashset_it hashset_begin(hashset *self) {
   for (size_t i = 0; i < self->capacity; ++i) {
-    hashset_bucket *bucket = self->buckets + i;
-    if (bucket->head) {
-      return hashset_it_make(self, i, bucket->head, NULL);
+    if (self->slots[i].dist) {
+      return hashset_it_make(self, i);
     }
   }
-  return hashset_it_make(self, 0, NULL, NULL);
+  return hashset_it_make(self, self->capacity);
 }
 
+// following elements of probe sequence are shifted back, no tombstones
 void hashset_erase(hashset *self, hashset_it it) {
-  self->f_delete(it.node->data);
-  if (it.prev) {
-    it.prev->next = it.node->next;
-  } else {
-    self->buckets[it.bucket_i].head = it.node->next;
+  size_t mask  = self->capacity - 1;
+  size_t index = it.index;
+
+  self->f_delete(self->slots[index].data);
+  for (;;) {
+    size_t        next = (index + 1) & mask;
+    hashset_slot *slot = self->slots + next;
+    if (slot->dist <= 1) {
+      self->slots[index].dist = 0;
+      break;
+    }
+    self->slots[index] = *slot;
+    self->slots[index].dist -= 1;
+    index = next;
   }
-  free(it.node);
+  self->size -= 1;
 }
@@ -2,28 +2,27 @@
 
 #include "util/container.h"
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #define HASHTABLE_LOAD_FACTOR 0.75
-#define HASHTABLE_GROWTH_FACTOR 2
-#define HASHTABLE_INITIAL_CAPACITY 16
+#define HASHTABLE_INITIAL_CAPACITY 16 // power of two
 
-typedef struct hashset_list_node_struct {
-  void                            *data;
-  struct hashset_list_node_struct *next;
-} hashset_list_node;
-
-typedef struct hashset_bucket_struct {
-  hashset_list_node *head;
-} hashset_bucket;
+// open addressing with robin hood probing: element that is further from its
+// home slot takes place of element that is closer, so probe sequences are
+// short and lookup stops at first slot closer to home than probed distance
+typedef struct hashset_slot_struct {
+  void    *data;
+  uint32_t hash; // low 32 bits of mixed hash, compared before f_cmp
+  uint32_t dist; // 1 + distance from home slot, 0 if slot is empty
+} hashset_slot;
 
 typedef struct hashset_struct {
-  hashset_bucket *buckets;
+  hashset_slot *slots;
 
   double load_factor;
-  double growth_factor;
 
-  size_t capacity;
+  size_t capacity; // power of two, index is hash masked by capacity - 1
   size_t size;
 
   container_f_cmp    *f_cmp;
@@ -33,10 +32,8 @@ typedef struct hashset_struct {
 } hashset;
 
 typedef struct hashset_it_struct {
-  hashset           *hashset;
-  size_t             bucket_i;
-  hashset_list_node *node;
-  hashset_list_node *prev; // previous in the bucket
+  hashset *hashset;
+  size_t   index; // capacity if end
 } hashset_it;
 
 void       hashset_init(hashset *self, container_f_cmp, container_f_new,
@@ -0,0 +1,82 @@
+#include "intern.h"
+
+#include "util/arena.h"
+#include "util/container_util.h"
+#include "util/hash.h"
+#include "util/hashset.h"
+#include "util/macro.h"
+#include <pthread.h>
+#include <string.h>
+
+typedef struct intern_entry_struct {
+  const char *chars;
+  size_t      len;
+} intern_entry;
+
+static inline int container_cmp_intern_entry(const void *lsv, const void *rsv) {
+  const intern_entry *l = lsv;
+  const intern_entry *r = rsv;
+  return l->len != r->len || memcmp(l->chars, r->chars, l->len);
+}
+static inline uint64_t container_hash_intern_entry(const void *lsv) {
+  const intern_entry *l = lsv;
+  return hash_bytes(HASH_SEED, l->chars, l->len);
+}
+HASHSET_DECLARE_STATIC_INLINE(hashset_intern_entry, intern_entry,
+                              container_cmp_intern_entry, container_new_move,
+                              container_delete_false,
+                              container_hash_intern_entry);
+
+// entries and strings are placed in arena, they are never freed one by one
+static pthread_mutex_t       intern_mutex   = PTHREAD_MUTEX_INITIALIZER;
+static arena                *intern_arena   = NULL;
+static hashset_intern_entry *intern_entries = NULL;
+
+const char *intern(const char *chars) { return intern_n(chars, strlen(chars)); }
+
+const char *intern_n(const char *chars, size_t len) {
+  pthread_mutex_lock(&intern_mutex);
+
+  if (!intern_entries) {
+    intern_arena   = arena_new(0);
+    intern_entries = hashset_intern_entry_new();
+  }
+
+  const char *result;
+
+  hashset_intern_entry_it it = hashset_intern_entry_find(
+      intern_entries, &(intern_entry){.chars = chars, .len = len});
+
+  if (!END(it)) {
+    result = GET(it)->chars;
+  } else {
+    char *copy = arena_alloc(intern_arena, len + 1);
+    memcpy(copy, chars, len);
+    copy[len] = '\0';
+
+    intern_entry *entry = ARENA_MALLOC(intern_arena, intern_entry);
+    entry->chars        = copy;
+    entry->len          = len;
+    hashset_intern_entry_insert(intern_entries, entry);
+    result = copy;
+  }
+
+  pthread_mutex_unlock(&intern_mutex);
+  return result;
+}
+
+size_t intern_size(void) {
+  pthread_mutex_lock(&intern_mutex);
+  size_t size = intern_entries ? intern_entries->hashset.size : 0;
+  pthread_mutex_unlock(&intern_mutex);
+  return size;
+}
+
+void intern_free(void) {
+  pthread_mutex_lock(&intern_mutex);
+  hashset_intern_entry_free(intern_entries);
+  arena_free(intern_arena);
+  intern_entries = NULL;
+  intern_arena   = NULL;
+  pthread_mutex_unlock(&intern_mutex);
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stddef.h>
+
+// interned strings are unique by content and live until intern_free, so they
+// are compared and hashed by pointer. Thread safe
+const char *intern(const char *chars);
+// chars don't have to be terminated, interned string is
+const char *intern_n(const char *chars, size_t len);
+
+// number of distinct interned strings
+size_t intern_size(void);
+// releases all interned strings, handles taken before are invalid
+void   intern_free(void);
@@ -12,6 +12,14 @@ void list_init(list *self, container_f_cmp cmp, container_f_new new,
   self->f_cmp    = cmp;
   self->f_new    = new;
   self->f_delete = delete;
+
+  self->arena = NULL;
+}
+
+void list_init_arena(list *self, arena *arena, container_f_cmp cmp,
+                     container_f_new new, container_f_delete delete) {
+  list_init(self, cmp, new, delete);
+  self->arena = arena;
 }
 
 list *list_new(container_f_cmp cmp, container_f_new new,
@@ -23,11 +31,15 @@ list *list_new(container_f_cmp cmp, container_f_new new,
 
 void list_deinit(list *self) {
   list_node *next;
-  for (list_node *cur = self->head; cur; cur = next) {
-    next = cur->next;
-    self->f_delete(cur->data);
-    free(cur);
+  if (!self->arena) {
+    for (list_node *cur = self->head; cur; cur = next) {
+      next = cur->next;
+      self->f_delete(cur->data);
+      free(cur);
+    }
   }
+  self->head = NULL;
+  self->tail = NULL;
 }
 
 void list_free(list *self) {
@@ -46,8 +58,12 @@ list_it list_find(const list *self, const void *data) {
   return (list_it){.cur = NULL};
 }
 
+static list_node *list_node_new(list *self) {
+  return self->arena ? ARENA_MALLOC(self->arena, list_node) : MALLOC(list_node);
+}
+
 void list_push_back(list *self, void *data) {
-  list_node *node = MALLOC(list_node);
+  list_node *node = list_node_new(self);
   node->data      = self->f_new(data);
   node->next      = NULL;
 
@@ -60,7 +76,7 @@ void list_push_back(list *self, void *data) {
 }
 
 void list_push_front(list *self, void *data) {
-  list_node *node = MALLOC(list_node);
+  list_node *node = list_node_new(self);
   node->data      = self->f_new(data);
   node->next      = self->head;
   self->head      = node;
@@ -87,19 +103,39 @@ void *list_pop_front(list *self) {
     self->tail = NULL;
   }
   void *data = node->data;
-  free(node);
+  if (!self->arena) {
+    free(node);
+  }
   return data;
 }
 
 void list_insert(list *self, list_it it, void *data) {
   if (it.cur) {
-    self->f_delete(it.cur->data);
+    if (!self->arena) {
+      self->f_delete(it.cur->data);
+    }
     it.cur->data = self->f_new(data);
   } else {
     list_push_back(self, data);
   }
 }
 
+// moves all nodes of other to the end of self, other is left empty. Nodes are
+// moved as is, so both lists should be on heap or on the same arena
+void list_splice_back(list *self, list *other) {
+  if (!other->head) {
+    return;
+  }
+  if (self->tail) {
+    self->tail->next = other->head;
+  } else {
+    self->head = other->head;
+  }
+  self->tail  = other->tail;
+  other->head = NULL;
+  other->tail = NULL;
+}
+
 size_t list_size(const list *self) {
   size_t size = 0;
   for (list_node *cur = self->head; cur; cur = cur->next) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "util/arena.h"
 #include "util/container.h"
 #include <stddef.h>
 #include <stdlib.h>
@@ -16,6 +17,8 @@ typedef struct list_struct {
   container_f_cmp    *f_cmp;
   container_f_new    *f_new;
   container_f_delete *f_delete;
+
+  arena *arena; // owns nodes and elements if set, they are not freed
 } list;
 
 typedef struct list_it_struct {
@@ -24,6 +27,8 @@ typedef struct list_it_struct {
 
 void    list_init(list *self, container_f_cmp, container_f_new,
                   container_f_delete);
+void    list_init_arena(list *self, arena *arena, container_f_cmp,
+                        container_f_new, container_f_delete);
 list   *list_new(container_f_cmp, container_f_new, container_f_delete);
 void    list_deinit(list *self);
 void    list_free(list *self);
@@ -35,6 +40,7 @@ void   *list_back(const list *self);
 int     list_empty(const list *self);
 list_it list_find(const list *self, const void *data);
 void    list_insert(list *self, list_it it, void *data);
+void    list_splice_back(list *self, list *other);
 size_t  list_size(const list *self);
 list_it list_begin(list *self);
 
@@ -75,11 +81,20 @@ int   list_it_end(list_it *it);
     return self;                                                               \
   }                                                                            \
                                                                                \
+  __attribute__((__unused__)) static inline list_type *list_type##_new_arena(  \
+      arena *arena) {                                                          \
+    list_type *self = ARENA_MALLOC(arena, list_type);                          \
+    list_init_arena(&self->list, arena, cmp_func, new_func, del_func);         \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
   __attribute__((__unused__)) static inline void list_type##_free(             \
       list_type *self) {                                                       \
     if (self) {                                                                \
       list_deinit(&self->list);                                                \
-      free(self);                                                              \
+      if (!self->list.arena) {                                                 \
+        free(self);                                                            \
+      }                                                                        \
     }                                                                          \
   }                                                                            \
                                                                                \
@@ -128,6 +143,11 @@ int   list_it_end(list_it *it);
     list_insert(&self->list, it.it, (void *)data);                             \
   }                                                                            \
                                                                                \
+  __attribute__((__unused__)) static inline void list_type##_splice_back(      \
+      list_type *self, list_type *other) {                                     \
+    list_splice_back(&self->list, &other->list);                               \
+  }                                                                            \
+                                                                               \
   __attribute__((__unused__)) static inline size_t list_type##_size(           \
       const list_type *self) {                                                 \
     return list_size(&self->list);                                             \
@@ -0,0 +1,61 @@
+#include "parallel.h"
+
+#include "util/log.h"
+#include "util/macro.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct parallel_ctx_struct {
+  parallel_f_task *task;
+  void            *arg;
+  size_t           cnt;
+  atomic_size_t    next;
+} parallel_ctx;
+
+static void *parallel_worker(void *arg) {
+  parallel_ctx *ctx = arg;
+  size_t        idx;
+  while ((idx = atomic_fetch_add(&ctx->next, 1)) < ctx->cnt) {
+    ctx->task(ctx->arg, idx);
+  }
+  return NULL;
+}
+
+size_t parallel_jobs_default(void) {
+  long cnt = sysconf(_SC_NPROCESSORS_ONLN);
+  return cnt > 0 ? (size_t)cnt : 1;
+}
+
+void parallel_for(size_t cnt, size_t jobs, parallel_f_task *task, void *arg) {
+  parallel_ctx ctx = {
+      .task = task,
+      .arg  = arg,
+      .cnt  = cnt,
+      .next = 0,
+  };
+
+  if (jobs > cnt) {
+    jobs = cnt;
+  }
+
+  // calling thread is a worker too
+  size_t     threads_cnt = jobs > 1 ? jobs - 1 : 0;
+  pthread_t *threads     = MALLOCN(pthread_t, threads_cnt);
+  size_t     started     = 0;
+
+  for (; started < threads_cnt; ++started) {
+    if (pthread_create(&threads[started], NULL, parallel_worker, &ctx)) {
+      warn("can't start worker thread, continuing with %lu", started + 1);
+      break;
+    }
+  }
+
+  parallel_worker(&ctx);
+
+  for (size_t i = 0; i < started; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  free(threads);
+}
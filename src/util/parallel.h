@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stddef.h>
+
+typedef void parallel_f_task(void *arg, size_t idx);
+
+// number of online processors, at least 1
+size_t parallel_jobs_default(void);
+
+// calls task for each idx in [0, cnt) on up to jobs threads, returns when all
+// tasks are done. Tasks are taken in order of idx, but may complete in any
+// order. Runs on calling thread if jobs <= 1
+void parallel_for(size_t cnt, size_t jobs, parallel_f_task *task, void *arg);
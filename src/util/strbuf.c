@@ -57,6 +57,18 @@ void strbuf_append(strbuf *self, const char *data) {
   self->cur += (data_size / sizeof(char));
 }
 
+void strbuf_append_n(strbuf *self, const char *data, size_t len) {
+  size_t size = strbuf_size(self);
+
+  while (size + len >= self->capacity) {
+    strbuf_resize(self);
+  }
+
+  memcpy(self->cur, data, len);
+  self->cur += len;
+  *self->cur = '\0';
+}
+
 void strbuf_append_f(strbuf *self, char *buf, const char *format, ...) {
   va_list args;
   va_start(args, format);
@@ -15,6 +15,8 @@ typedef struct strbuf_struct {
 strbuf *strbuf_new(int capacity, double growth_factor);
 void    strbuf_free(strbuf *self);
 void    strbuf_append(strbuf *self, const char *data);
+// appends len chars of data, data isn't required to be terminated
+void    strbuf_append_n(strbuf *self, const char *data, size_t len);
 void    strbuf_append_f(strbuf *self, char *buf, const char *format, ...);
 char   *strbuf_data(strbuf *self);
 char   *strbuf_detach(strbuf *self);
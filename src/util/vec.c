@@ -0,0 +1,182 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "util/macro.h"
+#include "util/vec.h"
+
+#define VEC_CAPACITY_MIN 4
+
+void vec_init(vec *self, container_f_cmp cmp, container_f_new new,
+              container_f_delete delete) {
+  self->data     = NULL;
+  self->start    = 0;
+  self->end      = 0;
+  self->capacity = 0;
+
+  self->f_cmp    = cmp;
+  self->f_new    = new;
+  self->f_delete = delete;
+
+  self->arena = NULL;
+}
+
+void vec_init_arena(vec *self, arena *arena, container_f_cmp cmp,
+                    container_f_new new, container_f_delete delete) {
+  vec_init(self, cmp, new, delete);
+  self->arena = arena;
+}
+
+vec *vec_new(container_f_cmp cmp, container_f_new new,
+             container_f_delete delete) {
+  vec *self = MALLOC(vec);
+  vec_init(self, cmp, new, delete);
+  return self;
+}
+
+void vec_deinit(vec *self) {
+  if (!self->arena) {
+    for (size_t i = self->start; i < self->end; ++i) {
+      self->f_delete(self->data[i]);
+    }
+    free(self->data);
+  }
+  self->data = NULL;
+}
+
+void vec_free(vec *self) {
+  if (self) {
+    vec_deinit(self);
+    free(self);
+  }
+}
+
+// space skipped at front is reused only when vector is empty, so iterators
+// stay valid while elements are pushed back
+static void vec_grow(vec *self, size_t size) {
+  if (self->start == self->end) {
+    self->start = 0;
+    self->end   = 0;
+  }
+  if (self->end + size <= self->capacity) {
+    return;
+  }
+
+  size_t capacity = self->capacity * 2;
+  if (capacity < VEC_CAPACITY_MIN) {
+    capacity = VEC_CAPACITY_MIN;
+  }
+  if (capacity < self->end + size) {
+    capacity = self->end + size;
+  }
+  if (self->arena) {
+    // old data is left in arena
+    void **data = ARENA_MALLOCN(self->arena, void *, capacity);
+    memcpy(data, self->data, self->end * sizeof(void *));
+    self->data = data;
+  } else {
+    self->data = realloc(self->data, capacity * sizeof(void *));
+  }
+  self->capacity = capacity;
+}
+
+void vec_reserve(vec *self, size_t size) {
+  if (vec_size(self) < size) {
+    vec_grow(self, size - vec_size(self));
+  }
+}
+
+void vec_push_back(vec *self, void *data) {
+  vec_grow(self, 1);
+  self->data[self->end++] = self->f_new(data);
+}
+
+void vec_push_front(vec *self, void *data) {
+  if (!self->start) {
+    vec_grow(self, 1);
+    memmove(self->data + 1, self->data, self->end * sizeof(void *));
+    ++self->end;
+  } else {
+    --self->start;
+  }
+  self->data[self->start] = self->f_new(data);
+}
+
+// won't free data
+void *vec_pop_front(vec *self) { return self->data[self->start++]; }
+
+// won't free data
+void *vec_pop_back(vec *self) { return self->data[--self->end]; }
+
+void *vec_front(const vec *self) {
+  return vec_empty(self) ? NULL : self->data[self->start];
+}
+
+void *vec_back(const vec *self) {
+  return vec_empty(self) ? NULL : self->data[self->end - 1];
+}
+
+void *vec_at(const vec *self, size_t idx) {
+  return self->data[self->start + idx];
+}
+
+int vec_empty(const vec *self) { return self->start == self->end; }
+
+vec_it vec_find(const vec *self, const void *data) {
+  for (size_t i = self->start; i < self->end; ++i) {
+    if (!self->f_cmp(self->data[i], data)) {
+      return (vec_it){.vec = self, .idx = i};
+    }
+  }
+  return (vec_it){.vec = self, .idx = self->end};
+}
+
+void vec_insert(vec *self, vec_it it, void *data) {
+  if (it.idx < self->end) {
+    if (!self->arena) {
+      self->f_delete(self->data[it.idx]);
+    }
+    self->data[it.idx] = self->f_new(data);
+  } else {
+    vec_push_back(self, data);
+  }
+}
+
+// moves all elements of other to the end of self, other is left empty
+void vec_splice_back(vec *self, vec *other) {
+  size_t size = vec_size(other);
+  if (!size) {
+    return;
+  }
+  vec_grow(self, size);
+  memcpy(self->data + self->end, other->data + other->start,
+         size * sizeof(void *));
+  self->end    += size;
+  other->start  = 0;
+  other->end    = 0;
+}
+
+void vec_reverse(vec *self) {
+  for (size_t l = self->start, r = self->end; l + 1 < r; ++l, --r) {
+    void *data        = self->data[l];
+    self->data[l]     = self->data[r - 1];
+    self->data[r - 1] = data;
+  }
+}
+
+size_t vec_size(const vec *self) { return self->end - self->start; }
+
+vec_it vec_begin(const vec *self) {
+  return (vec_it){.vec = self, .idx = self->start};
+}
+
+void *vec_it_get(vec_it *it) { return it->vec->data[it->idx]; }
+
+int vec_it_next(vec_it *it) {
+  if (it->idx < it->vec->end) {
+    ++it->idx;
+    return it->idx < it->vec->end;
+  }
+  return 0;
+}
+
+int vec_it_end(vec_it *it) { return it->idx >= it->vec->end; }
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "util/arena.h"
+#include "util/container.h"
+#include <stddef.h>
+#include <stdlib.h>
+
+// contiguous array of pointers, elements removed from front are skipped by
+// start offset, so draining vector from front is linear
+typedef struct vec_struct {
+  void **data;
+  size_t start;
+  size_t end;
+  size_t capacity;
+
+  container_f_cmp    *f_cmp;
+  container_f_new    *f_new;
+  container_f_delete *f_delete;
+
+  arena *arena; // owns data and elements if set, they are not freed
+} vec;
+
+// index is stable when elements are pushed back
+typedef struct vec_it_struct {
+  const vec *vec;
+  size_t     idx;
+} vec_it;
+
+void   vec_init(vec *self, container_f_cmp, container_f_new,
+                container_f_delete);
+void   vec_init_arena(vec *self, arena *arena, container_f_cmp, container_f_new,
+                      container_f_delete);
+vec   *vec_new(container_f_cmp, container_f_new, container_f_delete);
+void   vec_deinit(vec *self);
+void   vec_free(vec *self);
+void   vec_reserve(vec *self, size_t size);
+void   vec_push_back(vec *self, void *data);
+void   vec_push_front(vec *self, void *data);
+void  *vec_pop_front(vec *self);
+void  *vec_pop_back(vec *self);
+void  *vec_front(const vec *self);
+void  *vec_back(const vec *self);
+void  *vec_at(const vec *self, size_t idx);
+int    vec_empty(const vec *self);
+vec_it vec_find(const vec *self, const void *data);
+void   vec_insert(vec *self, vec_it it, void *data);
+void   vec_splice_back(vec *self, vec *other);
+void   vec_reverse(vec *self);
+size_t vec_size(const vec *self);
+vec_it vec_begin(const vec *self);
+
+void *vec_it_get(vec_it *it);
+int   vec_it_next(vec_it *it);
+int   vec_it_end(vec_it *it);
+
+#define VEC_DECLARE_STATIC_INLINE(vec_type, type, cmp_func, new_func,          \
+                                  del_func)                                    \
+                                                                               \
+  typedef struct vec_type##_struct {                                           \
+    vec vec;                                                                   \
+  } vec_type;                                                                  \
+                                                                               \
+  typedef struct vec_type##_it_struct {                                        \
+    vec_it it;                                                                 \
+    type *(*get)(struct vec_type##_it_struct * it);                            \
+    int (*next)(struct vec_type##_it_struct * it);                             \
+    int (*end)(struct vec_type##_it_struct * it);                              \
+  } vec_type##_it;                                                             \
+                                                                               \
+  __attribute__((__unused__)) static inline type *vec_type##_it_get(           \
+      vec_type##_it *self) {                                                   \
+    return vec_it_get(&self->it);                                              \
+  }                                                                            \
+  __attribute__((__unused__)) static inline int vec_type##_it_next(            \
+      vec_type##_it *self) {                                                   \
+    return vec_it_next(&self->it);                                             \
+  }                                                                            \
+  __attribute__((__unused__)) static inline int vec_type##_it_end(             \
+      vec_type##_it *self) {                                                   \
+    return vec_it_end(&self->it);                                              \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline vec_type *vec_type##_new() {       \
+    vec_type *self = (vec_type *)malloc(sizeof(vec_type));                     \
+    vec_init(&self->vec, cmp_func, new_func, del_func);                        \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline vec_type *vec_type##_new_arena(    \
+      arena *arena) {                                                          \
+    vec_type *self = ARENA_MALLOC(arena, vec_type);                            \
+    vec_init_arena(&self->vec, arena, cmp_func, new_func, del_func);           \
+    return self;                                                               \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline void vec_type##_free(              \
+      vec_type *self) {                                                        \
+    if (self) {                                                                \
+      vec_deinit(&self->vec);                                                  \
+      if (!self->vec.arena) {                                                  \
+        free(self);                                                            \
+      }                                                                        \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline void vec_type##_reserve(           \
+      vec_type *self, size_t size) {                                           \
+    vec_reserve(&self->vec, size);                                             \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline void vec_type##_push_back(         \
+      vec_type *self, type *data) {                                            \
+    vec_push_back(&self->vec, (void *)data);                                   \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline void vec_type##_push_front(        \
+      vec_type *self, type *data) {                                            \
+    vec_push_front(&self->vec, (void *)data);                                  \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline type *vec_type##_pop_front(        \
+      vec_type *self) {                                                        \
+    return (type *)vec_pop_front(&self->vec);                                  \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline type *vec_type##_pop_back(         \
+      vec_type *self) {                                                        \
+    return (type *)vec_pop_back(&self->vec);                                   \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline type *vec_type##_front(            \
+      const vec_type *self) {                                                  \
+    return (type *)vec_front(&self->vec);                                      \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline type *vec_type##_back(             \
+      const vec_type *self) {                                                  \
+    return (type *)vec_back(&self->vec);                                       \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline type *vec_type##_at(               \
+      const vec_type *self, size_t idx) {                                      \
+    return (type *)vec_at(&self->vec, idx);                                    \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline int vec_type##_empty(              \
+      const vec_type *self) {                                                  \
+    return vec_empty(&self->vec);                                              \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline vec_type##_it vec_type##_find(     \
+      const vec_type *self, const type *data) {                                \
+    return (vec_type##_it){                                                    \
+        .it   = vec_find(&self->vec, (const void *)data),                      \
+        .get  = vec_type##_it_get,                                             \
+        .next = vec_type##_it_next,                                            \
+        .end  = vec_type##_it_end,                                             \
+    };                                                                         \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline void vec_type##_insert(            \
+      vec_type *self, vec_type##_it it, type *data) {                          \
+    vec_insert(&self->vec, it.it, (void *)data);                               \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline void vec_type##_splice_back(       \
+      vec_type *self, vec_type *other) {                                       \
+    vec_splice_back(&self->vec, &other->vec);                                  \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline void vec_type##_reverse(           \
+      vec_type *self) {                                                        \
+    vec_reverse(&self->vec);                                                   \
+  }                                                                            \
+                                                                               \
+  __attribute__((__unused__)) static inline size_t vec_type##_size(            \
+      const vec_type *self) {                                                  \
+    return vec_size(&self->vec);                                               \
+  }                                                                            \
+  __attribute__((__unused__)) static inline vec_type##_it vec_type##_begin(    \
+      const vec_type *self) {                                                  \
+    return (vec_type##_it){                                                    \
+        .it   = vec_begin(&self->vec),                                         \
+        .get  = vec_type##_it_get,                                             \
+        .next = vec_type##_it_next,                                            \
+        .end  = vec_type##_it_end,                                             \
+    };                                                                         \
+  }
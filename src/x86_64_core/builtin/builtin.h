@@ -1,6 +1,7 @@
 #pragma once
 
 #include "x86_64_core/value.h"
+#include "x86_64_core/value/array.h"
 #include "x86_64_core/value/object.h"
 
 // io
@@ -20,12 +21,21 @@ void __x86_64_make_string_move(x86_64_value *out, uint8_t *value);
 void __x86_64_make_callable(x86_64_value *out, x86_64_func *func);
 // args are of type x86_64_value *
 void __x86_64_make_array(x86_64_value *out, ...);
+// frame is reserved by caller for capacity elements, array is created on heap
+// if it doesn't fit or frame is still referenced
+void __x86_64_make_array_frame(x86_64_value *out, x86_64_value *length,
+                               x86_64_data_array *frame, uint64_t capacity);
 void __x86_64_make_object(x86_64_value                     *out,
                           const x86_64_data_object_symbols *symbols);
 // move defaults into object, for faster default setup
 void __x86_64_make_object_setup(x86_64_value                     *out,
                                 const x86_64_data_object_symbols *symbols,
                                 x86_64_value                     *defaults);
+// same as setup, but object is placed in frame if it is not referenced
+void __x86_64_make_object_setup_frame(x86_64_value                     *out,
+                                      const x86_64_data_object_symbols *symbols,
+                                      x86_64_value       *defaults,
+                                      x86_64_data_object *frame);
 void __x86_64_make_error(x86_64_value *out, x86_64_value *value);
 
 // print
@@ -122,6 +122,20 @@ cleanup:
   va_end(args);
 }
 
+void __x86_64_make_array_frame(x86_64_value *out, x86_64_value *length,
+                               x86_64_data_array *frame, uint64_t capacity) {
+  uint64_t len = __x86_64_proxy_value_as_index(length);
+
+  // previous array may still be alive if make is executed in loop
+  if (len == UINT64_MAX || !len || len > capacity ||
+      (frame->ref_cnt & ~X86_64_REF_CNT_FRAME)) {
+    __x86_64_make_array(out, length, NULL);
+    return;
+  }
+
+  __x86_64_proxy_array_init_frame(out, frame, len);
+}
+
 void __x86_64_make_object(x86_64_value                     *out,
                           const x86_64_data_object_symbols *symbols) {
   __x86_64_proxy_object_init(out, symbols);
@@ -138,6 +152,22 @@ void __x86_64_make_object_setup(x86_64_value                     *out,
   }
 }
 
+void __x86_64_make_object_setup_frame(x86_64_value                     *out,
+                                      const x86_64_data_object_symbols *symbols,
+                                      x86_64_value       *defaults,
+                                      x86_64_data_object *frame) {
+  if (!frame || (frame->ref_cnt & ~X86_64_REF_CNT_FRAME)) {
+    __x86_64_make_object_setup(out, symbols, defaults);
+    return;
+  }
+
+  __x86_64_proxy_object_init_frame(out, frame, symbols);
+
+  for (uint64_t i = 0; i < symbols->count; ++i) {
+    frame->members[i] = defaults[i];
+  }
+}
+
 void __x86_64_make_error(x86_64_value *out, x86_64_value *value) {
   __x86_64_proxy_error_init(out, value);
 }
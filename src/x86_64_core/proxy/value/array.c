@@ -28,6 +28,20 @@ void __x86_64_proxy_array_init(x86_64_value *out, uint64_t length) {
                           data);
 }
 
+void __x86_64_proxy_array_init_frame(x86_64_value *out, x86_64_data_array *data,
+                                     uint64_t length) {
+  data->ref_cnt = X86_64_REF_CNT_FRAME | 1;
+  data->length  = length;
+  for (uint64_t i = 0; i < length; ++i) {
+    __x86_64_proxy_void_init(data->elements + i);
+  }
+
+  const x86_64_op_tbl *op_tbl = X86_64_REGISTRY.op_tbl_arr[X86_64_TYPE_ARRAY];
+
+  __x86_64_value_init_ptr(out, X86_64_TYPE_ARRAY, (x86_64_op_tbl *)op_tbl,
+                          data);
+}
+
 x86_64_op_plus    __x86_64_proxy_array_op_plus;
 x86_64_op_minus   __x86_64_proxy_array_op_minus;
 x86_64_op_not     __x86_64_proxy_array_op_not;
@@ -157,12 +171,14 @@ void __x86_64_proxy_array_op_assign(x86_64_value *self, x86_64_value *other) {
 void __x86_64_proxy_array_op_drop(x86_64_value *self) {
   x86_64_data_array *data = (x86_64_data_array *)self->data_ptr;
 
-  if (!--data->ref_cnt) {
+  if (!(--data->ref_cnt & ~X86_64_REF_CNT_FRAME)) {
     for (uint64_t i = 0; i < data->length; ++i) {
       x86_64_value *value = data->elements + i;
       value->op_tbl->op_drop(value);
     }
-    free(data);
+    if (!data->ref_cnt) {
+      free(data);
+    }
   }
 
   __x86_64_proxy_void_init(self);
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "x86_64_core/value.h"
+#include "x86_64_core/value/array.h"
 
 void __x86_64_proxy_array_init(x86_64_value *out, uint64_t length);
+// data is placed in frame, it should be large enough to store length elements
+void __x86_64_proxy_array_init_frame(x86_64_value *out, x86_64_data_array *data,
+                                     uint64_t length);
 
 x86_64_op_plus        __x86_64_proxy_array_op_plus;
 x86_64_op_minus       __x86_64_proxy_array_op_minus;
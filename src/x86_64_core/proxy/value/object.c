@@ -28,6 +28,21 @@ void __x86_64_proxy_object_init(x86_64_value                     *out,
                           data);
 }
 
+void __x86_64_proxy_object_init_frame(
+    x86_64_value *out, x86_64_data_object *data,
+    const x86_64_data_object_symbols *symbols) {
+  data->ref_cnt     = X86_64_REF_CNT_FRAME | 1;
+  data->symbols_ref = symbols;
+  for (uint64_t i = 0; i < symbols->count; ++i) {
+    __x86_64_proxy_void_init(data->members + i);
+  }
+
+  const x86_64_op_tbl *op_tbl = X86_64_REGISTRY.op_tbl_arr[X86_64_TYPE_OBJECT];
+
+  __x86_64_value_init_ptr(out, X86_64_TYPE_OBJECT, (x86_64_op_tbl *)op_tbl,
+                          data);
+}
+
 x86_64_op_plus    __x86_64_proxy_object_op_plus;
 x86_64_op_minus   __x86_64_proxy_object_op_minus;
 x86_64_op_not     __x86_64_proxy_object_op_not;
@@ -165,12 +180,14 @@ void __x86_64_proxy_object_op_assign(x86_64_value *self, x86_64_value *other) {
 void __x86_64_proxy_object_op_drop(x86_64_value *self) {
   x86_64_data_object *data = (x86_64_data_object *)self->data_ptr;
 
-  if (!--data->ref_cnt) {
+  if (!(--data->ref_cnt & ~X86_64_REF_CNT_FRAME)) {
     for (uint64_t i = 0; i < data->symbols_ref->count; ++i) {
       x86_64_value *value = data->members + i;
       value->op_tbl->op_drop(value);
     }
-    free(data);
+    if (!data->ref_cnt) {
+      free(data);
+    }
   }
 
   __x86_64_proxy_void_init(self);
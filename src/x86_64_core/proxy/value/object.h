@@ -5,6 +5,10 @@
 
 void __x86_64_proxy_object_init(x86_64_value                     *out,
                                 const x86_64_data_object_symbols *symbols);
+// data is placed in frame, it should be large enough to store all members
+void __x86_64_proxy_object_init_frame(
+    x86_64_value *out, x86_64_data_object *data,
+    const x86_64_data_object_symbols *symbols);
 
 x86_64_op_plus        __x86_64_proxy_object_op_plus;
 x86_64_op_minus       __x86_64_proxy_object_op_minus;
@@ -143,6 +143,10 @@ typedef struct __attribute__((packed)) x86_64_value_struct {
   };
 } x86_64_value;
 
+// set in ref_cnt of array or object data placed in stack frame by compiler.
+// Such data is released when count drops to flag, but never freed
+#define X86_64_REF_CNT_FRAME (1ull << 63)
+
 static inline void __x86_64_value_init_ptr(x86_64_value    *value,
                                            x86_64_type_enum type,
                                            x86_64_op_tbl *op_tbl, void *data) {
@@ -0,0 +1,86 @@
+#include <criterion/criterion.h>
+
+#include "util/arena.h"
+#include <stdalign.h>
+#include <stdint.h>
+#include <string.h>
+
+Test(arena, alloc) {
+  arena *a = arena_new(256);
+
+  // allocations don't overlap and are aligned
+  uint64_t *values[100];
+  for (size_t i = 0; i < 100; ++i) {
+    values[i]  = ARENA_MALLOC(a, uint64_t);
+    *values[i] = i;
+    cr_expect_eq((uintptr_t)values[i] % alignof(max_align_t), 0);
+  }
+  for (size_t i = 0; i < 100; ++i) {
+    cr_expect_eq(*values[i], i);
+  }
+
+  arena_free(a);
+}
+
+Test(arena, alloc_large) {
+  arena *a = arena_new(256);
+
+  char *small = arena_strdup(a, "small");
+  char *large = ARENA_MALLOCN(a, char, 1000);
+  memset(large, 'x', 1000);
+  char *next = arena_strdup(a, "next");
+
+  cr_expect_str_eq(small, "small");
+  cr_expect_str_eq(next, "next");
+  cr_expect_eq(large[999], 'x');
+
+  arena_free(a);
+}
+
+Test(arena, reset) {
+  arena *a = arena_new(256);
+
+  for (size_t i = 0; i < 100; ++i) {
+    arena_strdup(a, "string to fill several chunks");
+  }
+  ARENA_MALLOCN(a, char, 1000);
+  cr_expect_gt(arena_used(a), 1000);
+
+  arena_reset(a);
+  cr_expect_eq(arena_used(a), 0);
+  cr_expect_str_eq(arena_strdup(a, "after reset"), "after reset");
+
+  arena_free(a);
+}
+
+Test(arena, strndup) {
+  arena *a = arena_new(256);
+
+  cr_expect_str_eq(arena_strndup(a, "\"quoted\"" + 1, 6), "quoted");
+  cr_expect_str_eq(arena_strndup(a, "short", 100), "short");
+
+  arena_free(a);
+}
+
+Test(arena, merge) {
+  arena *a = arena_new(256);
+  arena *b = arena_new(256);
+
+  char *in_a = arena_strdup(a, "a");
+  char *in_b[100];
+  for (size_t i = 0; i < 100; ++i) {
+    in_b[i] = arena_strdup(b, "string to fill several chunks");
+  }
+  size_t used = arena_used(a) + arena_used(b);
+
+  // allocations of b are alive until a is freed, a keeps allocating
+  arena_merge(a, b);
+  cr_expect_eq(arena_used(a), used);
+  char *next = arena_strdup(a, "next");
+
+  cr_expect_str_eq(in_a, "a");
+  cr_expect_str_eq(in_b[99], "string to fill several chunks");
+  cr_expect_str_eq(next, "next");
+
+  arena_free(a);
+}
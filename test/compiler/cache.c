@@ -0,0 +1,155 @@
+#include <criterion/criterion.h>
+
+#include "compiler/codegen/x86_64_build/cache.h"
+#include "compiler/codegen/x86_64_emit/x86_64_emit.h"
+#include "util/macro.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static char      dir[32];
+static cg_cache *cache;
+
+static void setup(void) {
+  strcpy(dir, "/tmp/natrix_cache_XXXXXX");
+  cr_assert(mkdtemp(dir));
+  cache = cg_cache_new(dir);
+  cr_assert(cache);
+}
+
+static void teardown(void) {
+  char cmd[128];
+  snprintf(cmd, STRMAXLEN(cmd), "rm -rf %s", dir);
+  cg_cache_free(cache);
+  cr_expect_eq(system(cmd), 0);
+}
+
+static void push_text(cg_x86_64 *code, cg_x86_64_mnem mnem, cg_x86_64_op *op1,
+                      cg_x86_64_op *op2) {
+  list_cg_x86_64_op *ops = list_cg_x86_64_op_new();
+  if (op1) {
+    list_cg_x86_64_op_push_back(ops, op1);
+  }
+  if (op2) {
+    list_cg_x86_64_op_push_back(ops, op2);
+  }
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_text_new(mnem, ops));
+}
+
+static cg_x86_64 *fragment(void) {
+  cg_x86_64 *code = cg_x86_64_new();
+
+  vec_cg_x86_64_unit_push_back(
+      code->data, (cg_x86_64_unit *)cg_x86_64_symbol_new_data(strdup("s")));
+  vec_cg_x86_64_unit_push_back(
+      code->data,
+      (cg_x86_64_unit *)cg_x86_64_data_new_ascii((uint8_t *)strdup("str")));
+  vec_cg_x86_64_unit_push_back(
+      code->data, (cg_x86_64_unit *)cg_x86_64_data_new_quad(UINT64_MAX));
+  vec_cg_x86_64_unit_push_back(
+      code->data, (cg_x86_64_unit *)cg_x86_64_data_new_symbol(strdup("s")));
+
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_symbol_new_text(strdup("f")));
+  push_text(code, CG_X86_64_MNEM_LEAQ,
+            cg_x86_64_op_new_base_sym(strdup("s"), CG_X86_64_REG_RIP),
+            cg_x86_64_op_new_register(CG_X86_64_REG_RDI));
+  push_text(code, CG_X86_64_MNEM_MOVQ,
+            cg_x86_64_op_new_base_imm(-8, CG_X86_64_REG_RBP),
+            cg_x86_64_op_new_register(CG_X86_64_REG_RAX));
+  push_text(code, CG_X86_64_MNEM_MOVQ,
+            cg_x86_64_op_new_indexed(strdup("s"), CG_X86_64_REG_RCX, 8),
+            cg_x86_64_op_new_register(CG_X86_64_REG_RAX));
+  push_text(code, CG_X86_64_MNEM_CALL, cg_x86_64_op_new_direct(strdup("g")),
+            NULL);
+  push_text(code, CG_X86_64_MNEM_RETQ, NULL, NULL);
+  return code;
+}
+
+static char *emit(const cg_x86_64 *code) {
+  char  *buf;
+  size_t size;
+  FILE  *stream = open_memstream(&buf, &size);
+
+  cg_x86_64_emit_result result =
+      cg_x86_64_emit(code, CG_X86_64_EMIT_FORMAT_GAS, stream, NULL);
+  list_exception_free(result.exceptions);
+  fclose(stream);
+  return buf;
+}
+
+Test(cache, load_stored, .init = setup, .fini = teardown) {
+  cg_x86_64 *code  = fragment();
+  cg_debug  *debug = cg_debug_new(CG_CTX_DEBUG_LEVEL_ENABLED);
+
+  cg_debug_sub *sub = cg_debug_sub_new("f", ".L_f_end", "f");
+  list_cg_debug_var_push_back(sub->vars, cg_debug_var_new(8, "x"));
+  list_cg_debug_sub_push_back(debug->subroutines, sub);
+  list_cg_debug_line_push_back(debug->lines,
+                               cg_debug_line_new("f", "f.txt", 3));
+
+  cg_cache_store(cache, 1, code, debug);
+
+  cg_x86_64 *loaded       = cg_x86_64_new();
+  cg_debug  *loaded_debug = cg_debug_new(CG_CTX_DEBUG_LEVEL_ENABLED);
+  cr_assert(cg_cache_load(cache, 1, loaded, loaded_debug));
+
+  char *expected = emit(code);
+  char *actual   = emit(loaded);
+  cr_expect_str_eq(actual, expected);
+
+  cr_assert_eq(list_cg_debug_sub_size(loaded_debug->subroutines), 1);
+  list_cg_debug_sub_it it_s =
+      list_cg_debug_sub_begin(loaded_debug->subroutines);
+  cr_expect_str_eq(GET(it_s)->sym_end_ref, ".L_f_end");
+  cr_expect_eq(list_cg_debug_var_size(GET(it_s)->vars), 1);
+
+  cr_assert_eq(list_cg_debug_line_size(loaded_debug->lines), 1);
+  list_cg_debug_line_it it_l = list_cg_debug_line_begin(loaded_debug->lines);
+  cr_expect_str_eq(GET(it_l)->file_ref, "f.txt");
+  cr_expect_eq(GET(it_l)->line, 3);
+
+  free(expected);
+  free(actual);
+  cg_debug_free(loaded_debug);
+  cg_x86_64_free(loaded);
+  cg_debug_free(debug);
+  cg_x86_64_free(code);
+}
+
+Test(cache, load_missing, .init = setup, .fini = teardown) {
+  cg_x86_64 *code  = cg_x86_64_new();
+  cg_debug  *debug = cg_debug_new(CG_CTX_DEBUG_LEVEL_ENABLED);
+
+  cr_expect_not(cg_cache_load(cache, 2, code, debug));
+  cr_expect(vec_cg_x86_64_unit_empty(code->text));
+
+  cg_debug_free(debug);
+  cg_x86_64_free(code);
+}
+
+Test(cache, load_damaged, .init = setup, .fini = teardown) {
+  cg_x86_64 *code  = fragment();
+  cg_debug  *debug = cg_debug_new(CG_CTX_DEBUG_LEVEL_ENABLED);
+  cg_cache_store(cache, 3, code, debug);
+
+  // cut entry in half
+  char path[128];
+  snprintf(path, STRMAXLEN(path), "%s/%016x.cg", dir, 3);
+  FILE *file = fopen(path, "r+b");
+  cr_assert(file);
+  fseek(file, 0, SEEK_END);
+  cr_assert_eq(ftruncate(fileno(file), ftell(file) / 2), 0);
+  fclose(file);
+
+  cg_x86_64 *loaded = cg_x86_64_new();
+  cr_expect_not(cg_cache_load(cache, 3, loaded, debug));
+  cr_expect(vec_cg_x86_64_unit_empty(loaded->data));
+  cr_expect(vec_cg_x86_64_unit_empty(loaded->text));
+
+  cg_x86_64_free(loaded);
+  cg_debug_free(debug);
+  cg_x86_64_free(code);
+}
@@ -0,0 +1,114 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/copy_prop.h"
+#include "mir_fixture.h"
+#include "util/macro.h"
+
+Test(copy_prop, propagate, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+  mir_value *t2 = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  vec_mir_stmt_push_back(
+      entry->stmts, mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, t1, t0));
+  vec_mir_stmt_push_back(entry->stmts,
+                         op(MIR_STMT_OP_BINARY_ADD, t2, t1, t1));
+  vec_mir_stmt_push_back(
+      entry->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret, t2));
+
+  mir_copy_prop_result result = mir_copy_prop(mir);
+  list_exception_free(result.exceptions);
+
+  // copy to t1 is dropped together with temporary
+  cr_assert_eq(vec_mir_stmt_size(entry->stmts), 3);
+  cr_expect_eq(vec_mir_value_size(sub->defined.tmps), 2);
+
+  vec_mir_stmt_it it = vec_mir_stmt_begin(entry->stmts);
+  NEXT(it);
+  const mir_stmt *add = GET(it);
+  cr_expect_eq(vec_mir_value_ref_front(add->op.args), t0);
+  cr_expect_eq(vec_mir_value_ref_back(add->op.args), t0);
+
+  // t2 is not read after return value is assigned
+  NEXT(it);
+  const mir_stmt *ret = GET(it);
+  cr_expect_eq(ret->assign.kind, MIR_STMT_ASSIGN_MOVE);
+  cr_expect_eq(ret->assign.from_value, t2);
+
+  mir_free(mir);
+}
+
+Test(copy_prop, redefinition, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+  mir_bb *loop  = bb(sub, 1);
+  mir_bb *term  = bb(sub, 2);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  entry->jmp.next_ref = loop;
+
+  // t0 is read again on the next iteration, so it can't be moved from
+  vec_mir_stmt_push_back(
+      loop->stmts, mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, t1, t0));
+  vec_mir_stmt_push_back(loop->stmts,
+                         op(MIR_STMT_OP_BINARY_LESS, t0, t1, t1));
+  vec_mir_stmt_push_back(
+      loop->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret, t1));
+  loop->jmp.cond_ref = t0;
+  loop->jmp.je_ref   = loop;
+  loop->jmp.jz_ref   = term;
+
+  mir_copy_prop_result result = mir_copy_prop(mir);
+  list_exception_free(result.exceptions);
+
+  cr_assert_eq(vec_mir_stmt_size(loop->stmts), 3);
+
+  vec_mir_stmt_it it = vec_mir_stmt_begin(loop->stmts);
+  cr_expect_eq(GET(it)->assign.kind, MIR_STMT_ASSIGN_VALUE);
+  NEXT(it);
+  cr_expect_eq(vec_mir_value_ref_front(GET(it)->op.args), t0);
+  NEXT(it);
+  // t0 was redefined, so copy is not propagated past it
+  cr_expect_eq(GET(it)->assign.from_value, t1);
+  cr_expect_eq(GET(it)->assign.kind, MIR_STMT_ASSIGN_MOVE);
+
+  mir_free(mir);
+}
+
+Test(copy_prop, method, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->methods);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  vec_mir_stmt_push_back(
+      entry->stmts, mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, t1, t0));
+  vec_mir_stmt_push_back(
+      entry->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret, t1));
+
+  mir_copy_prop_result result = mir_copy_prop(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(vec_mir_stmt_size(entry->stmts), 2);
+  cr_expect_eq(vec_mir_value_size(sub->defined.tmps), 1);
+
+  mir_free(mir);
+}
@@ -0,0 +1,175 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/dead_subs.h"
+#include "compiler/symbol_table/symbol_table.h"
+#include "util/intern.h"
+#include "util/macro.h"
+#include <string.h>
+
+static type_table        *types;
+static list_symbol_entry *symbols;
+static const type_entry  *type_int;
+static arena             *nodes; // mir doesn't own nodes made by tests
+
+static void setup(void) {
+  types    = type_table_new();
+  nodes    = arena_new(0);
+  symbols  = list_symbol_entry_new();
+  type_int = type_table_intern(
+      types, (type_base *)type_primitive_new(TYPE_PRIMITIVE_INT), NULL);
+}
+
+static void teardown(void) {
+  arena_free(nodes);
+  list_symbol_entry_free(symbols);
+  type_table_free(types);
+}
+
+static const symbol_entry *symbol(const char *name) {
+  symbol_entry *self = symbol_entry_new(intern(name), NULL, NULL);
+  list_symbol_entry_push_back(symbols, self);
+  return self;
+}
+
+static mir_subroutine *sub_new(list_mir_subroutine *subs, const char *name) {
+  mir_subroutine *sub = mir_subroutine_new_defined(
+      nodes, symbol(name), NULL, MIR_SUBROUTINE_SPEC_EMPTY,
+      mir_value_new(nodes, 0, NULL, type_int), vec_mir_value_new_arena(nodes),
+      vec_mir_value_new_arena(nodes), vec_mir_value_new_arena(nodes),
+      vec_mir_bb_new_arena(nodes));
+  list_mir_subroutine_push_back(subs, sub);
+  return sub;
+}
+
+static mir_bb *bb(mir_subroutine *sub) {
+  mir_bb *self = mir_bb_new(nodes, vec_mir_bb_size(sub->defined.bbs),
+                            vec_mir_stmt_new_arena(nodes), NULL, NULL, NULL,
+                            list_hir_expr_ref_new_arena(nodes));
+  vec_mir_bb_push_back(sub->defined.bbs, self);
+  return self;
+}
+
+static mir_value *tmp(mir_subroutine *sub) {
+  size_t     id    = vec_mir_value_size(sub->defined.tmps) + 1;
+  mir_value *value = mir_value_new(nodes, id, NULL, type_int);
+  vec_mir_value_push_back(sub->defined.tmps, value);
+  return value;
+}
+
+static mir_stmt *call(mir_subroutine *sub, mir_subroutine *callee) {
+  return mir_stmt_new_call(nodes, tmp(sub), callee,
+                           vec_mir_value_ref_new_arena(nodes));
+}
+
+static const type_entry *class_type(const char *name) {
+  type_entry *class_t = type_table_emplace(
+      types,
+      (type_base *)type_class_t_new(strdup(name), list_type_ref_new(),
+                                    list_type_ref_new()),
+      NULL);
+  return type_table_intern(
+      types, (type_base *)type_mono_new(class_t->type, list_type_ref_new()),
+      NULL);
+}
+
+static mir_class *class_new(mir *mir, const type_entry *type_ref,
+                            mir_subroutine *method) {
+  list_mir_subroutine_ref *methods = list_mir_subroutine_ref_new_arena(nodes);
+  list_mir_subroutine_ref_push_back(methods, method);
+
+  mir_class *class =
+      mir_class_new(nodes, type_ref, vec_mir_value_new_arena(nodes), methods);
+  list_mir_class_push_back(mir->classes, class);
+  return class;
+}
+
+static int has_sub(list_mir_subroutine *subs, const mir_subroutine *sub) {
+  for (list_mir_subroutine_it it = list_mir_subroutine_begin(subs); !END(it);
+       NEXT(it)) {
+    if (GET(it) == sub) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+Test(dead_subs, subs, .init = setup, .fini = teardown) {
+  mir            *mir  = mir_new();
+  mir_subroutine *g    = sub_new(mir->defined_subs, "g");
+  mir_subroutine *f    = sub_new(mir->defined_subs, "f");
+  mir_subroutine *h    = sub_new(mir->defined_subs, "h");
+  mir_subroutine *main = sub_new(mir->defined_subs, "main");
+
+  mir_subroutine *used = mir_subroutine_new_declared(
+      nodes, symbol("used"), NULL, MIR_SUBROUTINE_SPEC_EMPTY);
+  mir_subroutine *unused = mir_subroutine_new_declared(
+      nodes, symbol("unused"), NULL, MIR_SUBROUTINE_SPEC_EMPTY);
+  list_mir_subroutine_push_back(mir->declared_subs, used);
+  list_mir_subroutine_push_back(mir->declared_subs, unused);
+
+  // main -> f -> used, f is also stored as value in main, g calls h
+  vec_mir_stmt_push_back(bb(main)->stmts, call(main, f));
+  vec_mir_stmt_push_back(
+      bb(main)->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_SUB, tmp(main), f));
+  vec_mir_stmt_push_back(bb(f)->stmts, call(f, used));
+  vec_mir_stmt_push_back(bb(g)->stmts, call(g, h));
+
+  mir_dead_subs_result result = mir_dead_subs(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(result.subs, 3);
+  cr_expect_eq(list_mir_subroutine_size(mir->defined_subs), 2);
+  cr_expect(has_sub(mir->defined_subs, main));
+  cr_expect(has_sub(mir->defined_subs, f));
+  cr_expect_eq(list_mir_subroutine_size(mir->declared_subs), 1);
+  cr_expect(has_sub(mir->declared_subs, used));
+
+  mir_free(mir);
+}
+
+Test(dead_subs, classes, .init = setup, .fini = teardown) {
+  mir            *mir  = mir_new();
+  mir_subroutine *main = sub_new(mir->defined_subs, "main");
+  mir_subroutine *f    = sub_new(mir->defined_subs, "f");
+  mir_subroutine *made = sub_new(mir->methods, "made");
+  mir_subroutine *left = sub_new(mir->methods, "left");
+
+  const type_entry *type_made = class_type("A");
+  const type_entry *type_left = class_type("B");
+  class_new(mir, type_made, made);
+  class_new(mir, type_left, left);
+
+  // method of made class reaches f
+  vec_mir_stmt_push_back(
+      bb(main)->stmts,
+      mir_stmt_new_builtin(nodes, MIR_STMT_BUILTIN_MAKE, tmp(main),
+                           (type_entry *)type_made,
+                           vec_mir_value_ref_new_arena(nodes)));
+  vec_mir_stmt_push_back(bb(made)->stmts, call(made, f));
+
+  mir_dead_subs_result result = mir_dead_subs(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(result.subs, 0);
+  cr_expect_eq(result.methods, 1);
+  cr_expect_eq(result.classes, 1);
+  cr_assert_eq(list_mir_class_size(mir->classes), 1);
+  cr_expect_eq(list_mir_class_front(mir->classes)->type_ref, type_made);
+  cr_expect(has_sub(mir->methods, made));
+
+  mir_free(mir);
+}
+
+Test(dead_subs, no_main, .init = setup, .fini = teardown) {
+  mir *mir = mir_new();
+  sub_new(mir->defined_subs, "f");
+
+  mir_dead_subs_result result = mir_dead_subs(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(result.subs, 0);
+  cr_expect_eq(list_mir_subroutine_size(mir->defined_subs), 1);
+
+  mir_free(mir);
+}
@@ -0,0 +1,186 @@
+#include <criterion/criterion.h>
+
+#include "compiler/codegen/x86_64_emit/object.h"
+#include "util/macro.h"
+#include <string.h>
+
+static cg_x86_64_bytes       bytes;
+static list_cg_x86_64_reloc *relocs;
+
+static void setup(void) {
+  cg_x86_64_bytes_init(&bytes);
+  relocs = list_cg_x86_64_reloc_new();
+}
+
+static void teardown(void) {
+  list_cg_x86_64_reloc_free(relocs);
+  cg_x86_64_bytes_deinit(&bytes);
+}
+
+static int encode(cg_x86_64_mnem mnem, cg_x86_64_op *op1, cg_x86_64_op *op2) {
+  list_cg_x86_64_op *ops = list_cg_x86_64_op_new();
+  if (op1) {
+    list_cg_x86_64_op_push_back(ops, op1);
+  }
+  if (op2) {
+    list_cg_x86_64_op_push_back(ops, op2);
+  }
+  cg_x86_64_text *text = cg_x86_64_text_new(mnem, ops);
+  int             ok   = cg_x86_64_encode_text(&bytes, relocs, text);
+  cg_x86_64_unit_free((cg_x86_64_unit *)text);
+  return ok;
+}
+
+static void expect_bytes(const uint8_t *expected, size_t size) {
+  cr_assert_eq(bytes.size, size);
+  cr_expect_arr_eq(bytes.data, expected, size);
+}
+
+Test(encode, mov_reg, .init = setup, .fini = teardown) {
+  cr_assert(encode(CG_X86_64_MNEM_MOVQ,
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RSP),
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RBP)));
+  cr_assert(encode(CG_X86_64_MNEM_MOVB,
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RSI),
+                   cg_x86_64_op_new_register(CG_X86_64_REG_R9)));
+
+  // rex is required to access sil
+  const uint8_t expected[] = {0x48, 0x89, 0xE5, 0x41, 0x88, 0xF1};
+  expect_bytes(expected, sizeof(expected));
+}
+
+Test(encode, mem_base, .init = setup, .fini = teardown) {
+  cr_assert(encode(CG_X86_64_MNEM_MOVQ,
+                   cg_x86_64_op_new_base_imm(-8, CG_X86_64_REG_RBP),
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RAX)));
+  cr_assert(encode(CG_X86_64_MNEM_MOVQ,
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RDI),
+                   cg_x86_64_op_new_indirect(CG_X86_64_REG_R12)));
+
+  // rsp and r12 need sib
+  const uint8_t expected[] = {0x48, 0x8B, 0x45, 0xF8, 0x49, 0x89, 0x3C, 0x24};
+  expect_bytes(expected, sizeof(expected));
+}
+
+Test(encode, imm, .init = setup, .fini = teardown) {
+  cr_assert(encode(CG_X86_64_MNEM_SUBQ, cg_x86_64_op_new_immediate(16),
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RSP)));
+  cr_assert(encode(CG_X86_64_MNEM_MOVQ,
+                   cg_x86_64_op_new_immediate(0x100000000),
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RCX)));
+
+  const uint8_t expected[] = {0x48, 0x83, 0xEC, 0x10, 0x48, 0xB9, 0x00,
+                              0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00};
+  expect_bytes(expected, sizeof(expected));
+}
+
+Test(encode, reloc, .init = setup, .fini = teardown) {
+  cr_assert(encode(CG_X86_64_MNEM_LEAQ,
+                   cg_x86_64_op_new_base_sym(strdup("data"), CG_X86_64_REG_RIP),
+                   cg_x86_64_op_new_register(CG_X86_64_REG_RDI)));
+  cr_assert(encode(CG_X86_64_MNEM_CALL, cg_x86_64_op_new_direct(strdup("f")),
+                   NULL));
+
+  const uint8_t expected[] = {0x48, 0x8D, 0x3D, 0x00, 0x00, 0x00,
+                              0x00, 0xE8, 0x00, 0x00, 0x00, 0x00};
+  expect_bytes(expected, sizeof(expected));
+
+  cr_assert_eq(list_cg_x86_64_reloc_size(relocs), 2);
+  const cg_x86_64_reloc *lea = list_cg_x86_64_reloc_front(relocs);
+  cr_expect_eq(lea->kind, CG_X86_64_RELOC_PC32);
+  cr_expect_eq(lea->offset, 3);
+  cr_expect_eq(lea->addend, -4);
+  const cg_x86_64_reloc *call = list_cg_x86_64_reloc_back(relocs);
+  cr_expect_eq(call->kind, CG_X86_64_RELOC_PLT32);
+  cr_expect_eq(call->offset, 8);
+  cr_expect_eq(call->addend, -4);
+}
+
+Test(encode, unsupported, .init = setup, .fini = teardown) {
+  cr_expect_not(encode(CG_X86_64_MNEM_LEAQ,
+                       cg_x86_64_op_new_register(CG_X86_64_REG_RAX),
+                       cg_x86_64_op_new_register(CG_X86_64_REG_RBX)));
+  cr_expect_eq(bytes.size, 0);
+}
+
+Test(encode, ascii, .init = setup, .fini = teardown) {
+  cg_x86_64_data *data =
+      cg_x86_64_data_new_ascii((uint8_t *)strdup("a\\n\\101\\x42"));
+  cg_x86_64_encode_data(&bytes, relocs, data);
+  cg_x86_64_unit_free((cg_x86_64_unit *)data);
+
+  const uint8_t expected[] = {'a', '\n', 'A', 'B', '\0'};
+  expect_bytes(expected, sizeof(expected));
+}
+
+Test(encode, branch_rel8, .init = setup, .fini = teardown) {
+  list_cg_x86_64_op *ops = list_cg_x86_64_op_new();
+  list_cg_x86_64_op_push_back(ops, cg_x86_64_op_new_direct(strdup(".L0")));
+  cg_x86_64_text *jl = cg_x86_64_text_new(CG_X86_64_MNEM_JL, ops);
+
+  ops = list_cg_x86_64_op_new();
+  list_cg_x86_64_op_push_back(ops, cg_x86_64_op_new_direct(strdup("f")));
+  cg_x86_64_text *call = cg_x86_64_text_new(CG_X86_64_MNEM_CALL, ops);
+
+  cr_expect_str_eq(cg_x86_64_encode_branch_target(jl), ".L0");
+  cr_expect_null(cg_x86_64_encode_branch_target(call));
+  cr_assert(cg_x86_64_encode_branch_rel8(&bytes, jl, -2));
+  cr_expect_not(cg_x86_64_encode_branch_rel8(&bytes, call, 0));
+
+  const uint8_t expected[] = {0x7C, 0xFE};
+  expect_bytes(expected, sizeof(expected));
+  cr_expect_eq(list_cg_x86_64_reloc_size(relocs), 0);
+
+  cg_x86_64_unit_free((cg_x86_64_unit *)call);
+  cg_x86_64_unit_free((cg_x86_64_unit *)jl);
+}
+
+static void push_jmp(cg_x86_64 *code, cg_x86_64_mnem mnem, const char *sym) {
+  list_cg_x86_64_op *ops = list_cg_x86_64_op_new();
+  list_cg_x86_64_op_push_back(ops, cg_x86_64_op_new_direct(strdup(sym)));
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_text_new(mnem, ops));
+}
+
+Test(encode, relax, .init = setup, .fini = teardown) {
+  cg_x86_64 *code = cg_x86_64_new();
+
+  // backward branch fits rel8, forward one is pushed out of reach by the
+  // code it jumps over, global symbol is left to linker
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_symbol_new_text(strdup(".L0")));
+  push_jmp(code, CG_X86_64_MNEM_JZ, ".L0");
+  push_jmp(code, CG_X86_64_MNEM_JMP, ".L1");
+  for (size_t i = 0; i < 126; ++i) {
+    push_jmp(code, CG_X86_64_MNEM_JMP, ".L0");
+  }
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_symbol_new_text(strdup(".L1")));
+  push_jmp(code, CG_X86_64_MNEM_JMP, "f");
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_symbol_new_global(strdup("f")));
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_symbol_new_text(strdup("f")));
+
+  list_exception  *exceptions = list_exception_new();
+  cg_x86_64_object obj;
+  cg_x86_64_object_init(&obj, exceptions);
+  cg_x86_64_object_build(&obj, code);
+
+  // 60 jmp to .L0 fit rel8, the rest are near
+  const cg_x86_64_object_section *text =
+      &obj.sections[CG_X86_64_OBJECT_SECTION_TEXT];
+  cr_assert_eq(text->bytes.size, 2 + 5 + 60 * 2 + 66 * 5 + 5);
+  const uint8_t head[] = {0x74, 0xFE, 0xE9};
+  cr_expect_arr_eq(text->bytes.data, head, sizeof(head));
+  cr_expect_eq(text->bytes.data[7], 0xEB);
+  cr_expect_eq(text->bytes.data[7 + 60 * 2], 0xE9);
+
+  cr_assert_eq(list_cg_x86_64_reloc_size(text->relocs), 1);
+  cr_expect_str_eq(list_cg_x86_64_reloc_front(text->relocs)->sym_ref, "f");
+  cr_expect_eq(list_exception_size(exceptions), 0);
+
+  cg_x86_64_object_deinit(&obj);
+  list_exception_free(exceptions);
+  cg_x86_64_free(code);
+}
@@ -0,0 +1,82 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/escape.h"
+#include "mir_fixture.h"
+#include "util/macro.h"
+
+static const type_entry *type_arr;
+
+static void setup_arr(void) {
+  setup();
+  type_arr = type_table_intern(
+      types, (type_base *)type_array_new(type_int->type), NULL);
+}
+
+static mir_stmt *make(mir_value *ret, mir_value *length) {
+  vec_mir_value_ref *args = vec_mir_value_ref_new_arena(nodes);
+  vec_mir_value_ref_push_back(args, length);
+  return mir_stmt_new_builtin(nodes, MIR_STMT_BUILTIN_MAKE, ret, type_arr,
+                              args);
+}
+
+// returns array
+static mir_subroutine *sub_arr_new(mir *mir) {
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+  sub->defined.ret    = mir_value_new(nodes, 0, NULL, type_arr);
+  return sub;
+}
+
+Test(escape, local, .init = setup_arr, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_arr_new(mir);
+
+  mir_value *len  = tmp(sub, type_int);
+  mir_value *arr  = tmp(sub, type_arr);
+  mir_value *copy = tmp(sub, type_arr);
+
+  mir_bb   *entry = bb(sub, 0);
+  mir_stmt *stmt  = make(arr, len);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, len, 4));
+  vec_mir_stmt_push_back(entry->stmts, stmt);
+  vec_mir_stmt_push_back(
+      entry->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, copy, arr));
+
+  mir_escape_result result = mir_escape(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(stmt->builtin.frame_capacity, 4);
+
+  mir_free(mir);
+}
+
+Test(escape, returned, .init = setup_arr, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *f   = sub_arr_new(mir);
+  mir_subroutine *sub = sub_arr_new(mir);
+
+  mir_value *len  = tmp(sub, type_int);
+  mir_value *arr  = tmp(sub, type_arr);
+  mir_value *copy = tmp(sub, type_arr);
+  mir_value *r    = tmp(sub, type_arr);
+
+  mir_bb   *entry  = bb(sub, 0);
+  mir_stmt *passed = make(arr, len);
+  mir_stmt *ret    = make(copy, len);
+
+  vec_mir_stmt_push_back(entry->stmts, passed);
+  vec_mir_stmt_push_back(entry->stmts, call(r, f, arr, NULL));
+  vec_mir_stmt_push_back(entry->stmts, ret);
+  vec_mir_stmt_push_back(entry->stmts,
+                         mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE,
+                                              sub->defined.ret, copy));
+
+  mir_escape_result result = mir_escape(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(passed->builtin.frame_capacity, 0);
+  cr_expect_eq(ret->builtin.frame_capacity, 0);
+
+  mir_free(mir);
+}
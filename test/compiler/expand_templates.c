@@ -0,0 +1,227 @@
+#include <criterion/criterion.h>
+
+#include "compiler/hir_build/bind_symbols.h"
+#include "compiler/hir_build/bind_types.h"
+#include "compiler/hir_build/expand_templates.h"
+#include "compiler/symbol_table/symbol_table.h"
+#include "compiler/type_table/str.h"
+#include "util/arena.h"
+#include "util/intern.h"
+#include "util/macro.h"
+#include <string.h>
+
+// builds hir of:
+//   class C<T> { c: T }
+//   class B<T> { x: T; get(): T; put() { var y: C<T> }; unused(): B<string> }
+//   main(): int { var b: B<int>; <calls> }
+// get() calls this.unused() if chain is set
+
+static hir   *sample;
+static arena *nodes; // of sample, nodes made by tests are allocated there
+
+static void setup(void) {
+  sample = hir_new();
+  nodes  = sample->arena;
+}
+
+static hir_id *id_new(const char *name) {
+  return hir_id_new(nodes, NULL, intern(name));
+}
+
+static hir_type_base *type_new(const char *name, hir_type_base *arg) {
+  list_hir_type *args = NULL;
+  if (arg) {
+    args = list_hir_type_new_arena(nodes);
+    list_hir_type_push_back(args, arg);
+  }
+  return (hir_type_base *)hir_type_custom_new(nodes, NULL,
+                                              arena_strdup(nodes, name), args);
+}
+
+static hir_stmt_base *call_member_new(const char *obj, const char *member) {
+  hir_lit *lit =
+      hir_lit_new(nodes, NULL, hir_type_base_new(nodes, NULL, HIR_TYPE_STRING),
+                  (hir_lit_u){.v_str = arena_strdup(nodes, member)});
+
+  hir_expr_base *callee = (hir_expr_base *)hir_expr_binary_new(
+      nodes, NULL, NULL, HIR_EXPR_BINARY_MEMBER,
+      (hir_expr_base *)hir_expr_id_new(nodes, NULL, NULL, id_new(obj)),
+      (hir_expr_base *)hir_expr_lit_new(nodes, NULL, NULL, lit));
+
+  return (hir_stmt_base *)hir_stmt_expr_new(
+      nodes, NULL,
+      (hir_expr_base *)hir_expr_call_new(nodes, NULL, NULL, callee,
+                                         list_hir_expr_new_arena(nodes)));
+}
+
+static hir_subroutine *subroutine_new(const char *name, hir_type_base *ret,
+                                      list_hir_var *vars,
+                                      list_hir_stmt *stmts) {
+  return hir_subroutine_new(
+      nodes, NULL, id_new(name), list_hir_param_new_arena(nodes), ret,
+      HIR_SUBROUTINE_SPEC_EMPTY,
+      hir_subroutine_body_new_block(nodes, vars,
+                                    hir_stmt_block_new(nodes, NULL, stmts)));
+}
+
+static hir_method *method_new(const char *class, hir_subroutine *func) {
+  list_hir_param_push_front(
+      func->params, hir_param_new(nodes, NULL, id_new("this"),
+                                  type_new(class, type_new("T", NULL))));
+  return hir_method_new(nodes, NULL, HIR_METHOD_MODIFIER_ENUM_PUBLIC, func);
+}
+
+static hir_class *class_new(const char *name, list_hir_var *fields,
+                            list_hir_method *methods) {
+  list_hir_id *typenames = list_hir_id_new_arena(nodes);
+  list_hir_id_push_back(typenames, id_new("T"));
+  return hir_class_new(nodes, NULL, id_new(name), typenames,
+                       list_hir_type_new_arena(nodes), fields, methods);
+}
+
+static hir *hir_sample_build(list_hir_stmt *calls, int chain) {
+  list_hir_var *fields_c = list_hir_var_new_arena(nodes);
+  list_hir_var_push_back(
+      fields_c, hir_var_new(nodes, NULL, id_new("c"), type_new("T", NULL)));
+  list_hir_class_push_back(
+      sample->classes,
+      class_new("C", fields_c, list_hir_method_new_arena(nodes)));
+
+  list_hir_var *fields_b = list_hir_var_new_arena(nodes);
+  list_hir_var_push_back(
+      fields_b, hir_var_new(nodes, NULL, id_new("x"), type_new("T", NULL)));
+
+  list_hir_stmt *stmts_get = list_hir_stmt_new_arena(nodes);
+  if (chain) {
+    list_hir_stmt_push_back(stmts_get, call_member_new("this", "unused"));
+  }
+
+  list_hir_var *vars_put = list_hir_var_new_arena(nodes);
+  list_hir_var_push_back(vars_put,
+                         hir_var_new(nodes, NULL, id_new("y"),
+                                     type_new("C", type_new("T", NULL))));
+
+  list_hir_method *methods_b = list_hir_method_new_arena(nodes);
+  list_hir_method_push_back(
+      methods_b, method_new("B", subroutine_new("get", type_new("T", NULL),
+                                                list_hir_var_new_arena(nodes),
+                                                stmts_get)));
+  list_hir_method_push_back(
+      methods_b,
+      method_new("B", subroutine_new("put", NULL, vars_put,
+                                     list_hir_stmt_new_arena(nodes))));
+  list_hir_method_push_back(
+      methods_b,
+      method_new("B", subroutine_new(
+                          "unused",
+                          type_new("B", hir_type_base_new(nodes, NULL,
+                                                          HIR_TYPE_STRING)),
+                          list_hir_var_new_arena(nodes),
+                          list_hir_stmt_new_arena(nodes))));
+  list_hir_class_push_back(sample->classes,
+                           class_new("B", fields_b, methods_b));
+
+  list_hir_var *vars_main = list_hir_var_new_arena(nodes);
+  list_hir_var_push_back(
+      vars_main,
+      hir_var_new(nodes, NULL, id_new("b"),
+                  type_new("B", hir_type_base_new(nodes, NULL, HIR_TYPE_INT))));
+  list_hir_subroutine_push_back(
+      sample->subroutines,
+      subroutine_new("main", hir_type_base_new(nodes, NULL, HIR_TYPE_INT),
+                     vars_main, calls));
+  return sample;
+}
+
+// returns expanded class by its type name, NULL if not instantiated
+static hir_class *hir_sample_find(hir *hir, const char *name) {
+  for (list_hir_class_it it = list_hir_class_begin(hir->classes); !END(it);
+       NEXT(it)) {
+    hir_class *class = GET(it);
+    char      *str   = type_str(class->type_ref->type);
+    int        found = !strcmp(str, name);
+    free(str);
+    if (found) {
+      return class;
+    }
+  }
+  return NULL;
+}
+
+static int hir_class_has_method(hir_class *class, const char *name) {
+  for (list_hir_method_it it = list_hir_method_begin(class->methods); !END(it);
+       NEXT(it)) {
+    if (!strcmp(GET(it)->subroutine->id_hir->name, name)) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void hir_sample_expand(hir *hir, type_table **types) {
+  hir_bind_types_result types_res = hir_bind_types(hir);
+  cr_assert_eq(list_exception_size(types_res.exceptions), 0);
+  list_exception_free(types_res.exceptions);
+
+  hir_expand_templates_result expand_res =
+      hir_expand_templates(hir, types_res.type_table);
+  cr_assert_eq(list_exception_size(expand_res.exceptions), 0);
+  list_exception_free(expand_res.exceptions);
+
+  *types = types_res.type_table;
+}
+
+static void hir_sample_free(hir *hir, type_table *types) {
+  hir_bind_symbols_result symbols_res = hir_bind_symbols(hir);
+  cr_expect_eq(list_exception_size(symbols_res.exceptions), 0);
+  list_exception_free(symbols_res.exceptions);
+  symbol_table_free(symbols_res.symbol_table);
+
+  hir_free(hir);
+  type_table_free(types);
+}
+
+Test(expand_templates, unused_methods, .init = setup) {
+  list_hir_stmt *calls = list_hir_stmt_new_arena(nodes);
+  list_hir_stmt_push_back(calls, call_member_new("b", "get"));
+
+  type_table *types;
+  hir        *hir = hir_sample_build(calls, 0);
+  hir_sample_expand(hir, &types);
+
+  hir_class *class_b = hir_sample_find(hir, "class B<int>");
+  cr_assert_not_null(class_b);
+  cr_expect(hir_class_has_method(class_b, "get"));
+  cr_expect_not(hir_class_has_method(class_b, "put"));
+  cr_expect_not(hir_class_has_method(class_b, "unused"));
+
+  // only reachable through put and unused
+  cr_expect_null(hir_sample_find(hir, "class C<int>"));
+  cr_expect_null(hir_sample_find(hir, "class B<string>"));
+
+  hir_sample_free(hir, types);
+}
+
+Test(expand_templates, required_transitively, .init = setup) {
+  list_hir_stmt *calls = list_hir_stmt_new_arena(nodes);
+  list_hir_stmt_push_back(calls, call_member_new("b", "get"));
+  list_hir_stmt_push_back(calls, call_member_new("b", "put"));
+
+  type_table *types;
+  hir        *hir = hir_sample_build(calls, 1);
+  hir_sample_expand(hir, &types);
+
+  hir_class *class_b = hir_sample_find(hir, "class B<int>");
+  cr_assert_not_null(class_b);
+  cr_expect(hir_class_has_method(class_b, "unused"));
+
+  // B<string> is instantiated once, though it is required by itself
+  hir_class *class_bs = hir_sample_find(hir, "class B<string>");
+  cr_assert_not_null(class_bs);
+  cr_expect(hir_class_has_method(class_bs, "unused"));
+  cr_expect_not_null(hir_sample_find(hir, "class C<int>"));
+  cr_expect_not_null(hir_sample_find(hir, "class C<string>"));
+  cr_expect_eq(list_hir_class_size(hir->classes), 4);
+
+  hir_sample_free(hir, types);
+}
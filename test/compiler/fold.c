@@ -0,0 +1,152 @@
+#include <criterion/criterion.h>
+
+#include "compiler/codegen/x86_64_build/inst/inst.h"
+#include "util/macro.h"
+#include <string.h>
+
+static cg_x86_64_unit *text(cg_x86_64_mnem mnem, cg_x86_64_op *op1,
+                            cg_x86_64_op *op2) {
+  list_cg_x86_64_op *ops = list_cg_x86_64_op_new();
+  if (op1) {
+    list_cg_x86_64_op_push_back(ops, op1);
+  }
+  if (op2) {
+    list_cg_x86_64_op_push_back(ops, op2);
+  }
+  return (cg_x86_64_unit *)cg_x86_64_text_new(mnem, ops);
+}
+
+static void lit(cg_x86_64 *lits, const char *sym, const char *value) {
+  vec_cg_x86_64_unit_push_back(
+      lits->data, (cg_x86_64_unit *)cg_x86_64_symbol_new_data(strdup(sym)));
+  vec_cg_x86_64_unit_push_back(
+      lits->data,
+      (cg_x86_64_unit *)cg_x86_64_data_new_ascii((uint8_t *)strdup(value)));
+}
+
+// sym:
+//   leaq lit_sym(%rip), %rdi
+// .L<sym>_bb1:
+//   call callee
+//   jnz .L<sym>_bb1
+//   retq
+static cg_x86_64 *body(const char *sym, const char *lit_sym,
+                       const char *callee) {
+  cg_x86_64 *code = cg_x86_64_new();
+  char      *bb   = cg_sym_local_suf(sym, "bb1");
+
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_symbol_new_text(strdup(sym)));
+  vec_cg_x86_64_unit_push_back(
+      code->text,
+      text(CG_X86_64_MNEM_LEAQ,
+           cg_x86_64_op_new_base_sym(strdup(lit_sym), CG_X86_64_REG_RIP),
+           cg_x86_64_op_new_register(CG_X86_64_REG_RDI)));
+  vec_cg_x86_64_unit_push_back(
+      code->text, (cg_x86_64_unit *)cg_x86_64_symbol_new_text(strdup(bb)));
+  vec_cg_x86_64_unit_push_back(
+      code->text, text(CG_X86_64_MNEM_CALL,
+                       cg_x86_64_op_new_direct(strdup(callee)), NULL));
+  vec_cg_x86_64_unit_push_back(
+      code->text,
+      text(CG_X86_64_MNEM_JNZ, cg_x86_64_op_new_direct(bb), NULL));
+  vec_cg_x86_64_unit_push_back(code->text,
+                               text(CG_X86_64_MNEM_RETQ, NULL, NULL));
+  return code;
+}
+
+static void bodies_free(cg_fold_body *bodies, size_t cnt) {
+  for (size_t i = 0; i < cnt; ++i) {
+    cg_x86_64_free((cg_x86_64 *)bodies[i].code_ref);
+  }
+}
+
+Test(fold, locals_and_lits) {
+  cg_x86_64 *lits = cg_x86_64_new();
+  lit(lits, ".L_lit_0", "x");
+  lit(lits, ".L_lit_1", "x");
+  lit(lits, ".L_lit_2", "y");
+
+  cg_fold_body bodies[] = {
+      {body("a", ".L_lit_0", "puts"), lits, 1},
+      {body("b", ".L_lit_1", "puts"), NULL, 1},
+      {body("c", ".L_lit_2", "puts"), NULL, 1},
+      {body("d", ".L_lit_0", "exit"), NULL, 1},
+  };
+
+  size_t *folded = cg_fold(bodies, 4);
+  cr_expect_eq(folded[0], 0);
+  cr_expect_eq(folded[1], 0);
+  cr_expect_eq(folded[2], 2);
+  cr_expect_eq(folded[3], 3);
+
+  free(folded);
+  bodies_free(bodies, 4);
+  cg_x86_64_free(lits);
+}
+
+Test(fold, recursive) {
+  cg_x86_64 *lits = cg_x86_64_new();
+  lit(lits, ".L_lit_0", "x");
+  lit(lits, ".L_lit_1", "y");
+
+  // a and b call themselves, c and d call a and b, e isn't foldable
+  cg_fold_body bodies[] = {
+      {body("a", ".L_lit_0", "a"), lits, 1},
+      {body("b", ".L_lit_0", "b"), NULL, 1},
+      {body("c", ".L_lit_1", "a"), NULL, 1},
+      {body("d", ".L_lit_1", "b"), NULL, 1},
+      {body("e", ".L_lit_0", "e"), NULL, 0},
+  };
+
+  size_t *folded = cg_fold(bodies, 5);
+  cr_expect_eq(folded[0], 0);
+  cr_expect_eq(folded[1], 0);
+  cr_expect_eq(folded[2], 2);
+  cr_expect_eq(folded[3], 2);
+  cr_expect_eq(folded[4], 4);
+
+  free(folded);
+  bodies_free(bodies, 5);
+  cg_x86_64_free(lits);
+}
+
+Test(fold, rewrite) {
+  cg_x86_64 *lits = cg_x86_64_new();
+  lit(lits, ".L_lit_0", "x");
+
+  cg_fold_body bodies[] = {
+      {body("a", ".L_lit_0", "puts"), lits, 1},
+      {body("b", ".L_lit_0", "puts"), NULL, 1},
+  };
+
+  size_t              *folded = cg_fold(bodies, 2);
+  hashset_cg_fold_sym *syms   = cg_fold_syms(bodies, folded, 2);
+
+  vec_cg_x86_64_unit *units = vec_cg_x86_64_unit_new();
+  vec_cg_x86_64_unit_push_back(
+      units,
+      text(CG_X86_64_MNEM_CALL, cg_x86_64_op_new_direct(strdup("b")), NULL));
+  vec_cg_x86_64_unit_push_back(
+      units, (cg_x86_64_unit *)cg_x86_64_data_new_symbol(strdup("b")));
+  vec_cg_x86_64_unit_push_back(
+      units,
+      text(CG_X86_64_MNEM_CALL, cg_x86_64_op_new_direct(strdup("c")), NULL));
+
+  cg_fold_rewrite(units, syms);
+
+  cg_x86_64_text *call = (cg_x86_64_text *)vec_cg_x86_64_unit_at(units, 0);
+  cr_expect_str_eq(list_cg_x86_64_op_front(call->operands)->direct.sym_addr,
+                   "a");
+  cg_x86_64_data *data = (cg_x86_64_data *)vec_cg_x86_64_unit_at(units, 1);
+  cr_expect_str_eq(data->data_symbol, "a");
+  call = (cg_x86_64_text *)vec_cg_x86_64_unit_at(units, 2);
+  cr_expect_str_eq(list_cg_x86_64_op_front(call->operands)->direct.sym_addr,
+                   "c");
+
+  vec_cg_x86_64_unit_free(units);
+  hashset_cg_fold_sym_free(syms);
+  free(folded);
+  bodies_free(bodies, 2);
+  cg_x86_64_free(lits);
+}
@@ -0,0 +1,146 @@
+#include <criterion/criterion.h>
+
+#include "compiler/hir/str.h"
+#include "compiler/hir_build/front.h"
+#include "util/file.h"
+#include "util/macro.h"
+#include "util/strbuf.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FILES_CNT 8
+#define GOLDEN_DIR "test/compiler/golden/"
+
+static char  dir[32];
+static char  paths[FILES_CNT][64];
+static char *paths_ref[FILES_CNT];
+
+// files 3 and 6 have syntax errors
+static void setup(void) {
+  strcpy(dir, "/tmp/natrix_front_XXXXXX");
+  cr_assert(mkdtemp(dir));
+
+  for (size_t i = 0; i < FILES_CNT; ++i) {
+    snprintf(paths[i], STRMAXLEN(paths[i]), "%s/%zu.txt", dir, i);
+    paths_ref[i] = paths[i];
+
+    FILE *file = fopen(paths[i], "wb");
+    cr_assert(file);
+    if (i % 3 == 0 && i) {
+      fprintf(file, "method f%zu(): int begin x = ; end;\n", i);
+    } else {
+      fprintf(file, "method f%zu(): int;\n", i);
+    }
+    fclose(file);
+  }
+}
+
+static void teardown(void) {
+  char cmd[128];
+  snprintf(cmd, STRMAXLEN(cmd), "rm -rf %s", dir);
+  cr_expect_eq(system(cmd), 0);
+}
+
+Test(front, merged_in_order, .init = setup, .fini = teardown) {
+  for (size_t jobs = 1; jobs <= FILES_CNT; jobs *= 2) {
+    hir_front_result result =
+        hir_front((const char *const *)paths_ref, FILES_CNT, 1, 0, jobs);
+
+    cr_expect_eq(list_ast_size(result.asts), 0);
+    cr_assert_eq(list_exception_size(result.exceptions), 2);
+    list_exception_it exc_it = list_exception_begin(result.exceptions);
+    cr_expect_str_eq(GET(exc_it)->stream, paths[3]);
+    NEXT(exc_it);
+    cr_expect_str_eq(GET(exc_it)->stream, paths[6]);
+
+    cr_assert_eq(list_hir_subroutine_size(result.hir->subroutines),
+                 FILES_CNT - 2);
+    list_hir_subroutine_it sub_it =
+        list_hir_subroutine_begin(result.hir->subroutines);
+    for (size_t i = 0; i < FILES_CNT; ++i) {
+      if (i % 3 == 0 && i) {
+        continue;
+      }
+      char name[8];
+      snprintf(name, STRMAXLEN(name), "f%zu", i);
+      cr_expect_str_eq(GET(sub_it)->id_hir->name, name);
+      NEXT(sub_it);
+    }
+
+    list_exception_free(result.exceptions);
+    list_ast_free(result.asts);
+    hir_free(result.hir);
+  }
+}
+
+// golden files hold output of antlr front end, hand-written parser has to
+// produce the same spans and report syntax errors at the same places. Messages
+// of syntax errors differ, so only kind and location are compared
+static const char *front_names[] = {"antlr", "hand-written"};
+
+static char *golden_read(const char *path) {
+  file_map map;
+  cr_assert_eq(file_map_open(&map, path), 0, "can't read %s", path);
+  size_t len = map.len;
+  if (len && map.chars[len - 1] == '\n') {
+    --len;
+  }
+  char *chars = strndup(map.chars, len);
+  file_map_close(&map);
+  return chars;
+}
+
+static char *front_exceptions_str(const list_exception *exceptions) {
+  static const char types[] = "ULPTHMC";
+
+  char    buf[128];
+  strbuf *buffer = strbuf_new(sizeof(buf), 0);
+  for (list_exception_it it = list_exception_begin(exceptions); !END(it);
+       NEXT(it)) {
+    const exception *exc = GET(it);
+    strbuf_append_f(buffer, buf, "%s%c%d %s:%u:%u",
+                    strbuf_size(buffer) ? "\n" : "", types[exc->type],
+                    exc->subtype, exc->stream, exc->line, exc->offset);
+  }
+  return strbuf_detach(buffer);
+}
+
+static void front_result_free(hir_front_result *result) {
+  list_exception_free(result->exceptions);
+  list_ast_free(result->asts);
+  hir_free(result->hir);
+}
+
+Test(front, golden_spans) {
+  const char *path   = GOLDEN_DIR "spans.txt";
+  char       *golden = golden_read(GOLDEN_DIR "spans.hir");
+
+  for (int hand_parser = 0; hand_parser <= 1; ++hand_parser) {
+    hir_front_result result = hir_front(&path, 1, hand_parser, 0, 1);
+    cr_expect_eq(list_exception_size(result.exceptions), 0, "%s",
+                 front_names[hand_parser]);
+
+    char *tree = hir_tree_str(result.hir);
+    cr_expect_str_eq(tree, golden, "%s", front_names[hand_parser]);
+    free(tree);
+    front_result_free(&result);
+  }
+  free(golden);
+}
+
+Test(front, golden_errors) {
+  const char *path   = GOLDEN_DIR "errors.txt";
+  char       *golden = golden_read(GOLDEN_DIR "errors.exc");
+
+  for (int hand_parser = 0; hand_parser <= 1; ++hand_parser) {
+    hir_front_result result = hir_front(&path, 1, hand_parser, 0, 1);
+
+    char *exceptions = front_exceptions_str(result.exceptions);
+    cr_expect_str_eq(exceptions, golden, "%s", front_names[hand_parser]);
+    free(exceptions);
+    front_result_free(&result);
+  }
+  free(golden);
+}
@@ -0,0 +1,121 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/gvn.h"
+#include "mir_fixture.h"
+#include "util/macro.h"
+
+static mir_stmt *member(mir *mir, mir_value *ret, mir_value *obj,
+                        const char *name) {
+  // untyped literal is not freed
+  mir_lit *lit = mir_lit_new(nodes, list_mir_lit_size(mir->literals), NULL,
+                             (mir_lit_value){.v_str = (uint8_t *)name});
+  list_mir_lit_push_back(mir->literals, lit);
+  return mir_stmt_new_member(nodes, ret, obj, lit);
+}
+
+Test(gvn, dominated, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+  mir_value *t2 = tmp(sub, type_int);
+  mir_value *t3 = tmp(sub, type_int);
+  mir_value *t4 = tmp(sub, type_int);
+  mir_value *t5 = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+  mir_bb *je    = bb(sub, 1);
+  mir_bb *jz    = bb(sub, 2);
+  mir_bb *term  = bb(sub, 3);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t1, 2));
+  vec_mir_stmt_push_back(entry->stmts, op(MIR_STMT_OP_BINARY_ADD, t2, t0, t1));
+  vec_mir_stmt_push_back(entry->stmts,
+                         op(MIR_STMT_OP_BINARY_LESS, t3, t0, t1));
+  entry->jmp.cond_ref = t3;
+  entry->jmp.je_ref   = je;
+  entry->jmp.jz_ref   = jz;
+
+  // operands are swapped
+  vec_mir_stmt_push_back(je->stmts, op(MIR_STMT_OP_BINARY_ADD, t4, t1, t0));
+  je->jmp.next_ref = term;
+
+  vec_mir_stmt_push_back(jz->stmts, op(MIR_STMT_OP_BINARY_MUL, t5, t0, t1));
+  jz->jmp.next_ref = term;
+
+  // join is dominated by entry, but not by branches
+  vec_mir_stmt_push_back(term->stmts, op(MIR_STMT_OP_BINARY_MUL, t4, t0, t1));
+
+  mir_gvn_result result = mir_gvn(mir);
+  list_exception_free(result.exceptions);
+
+  const mir_stmt *add = stmt_at(je, 0);
+  cr_assert_eq(add->kind, MIR_STMT_ASSIGN);
+  cr_expect_eq(add->assign.kind, MIR_STMT_ASSIGN_VALUE);
+  cr_expect_eq(add->assign.from_value, t2);
+
+  cr_expect_eq(stmt_at(jz, 0)->kind, MIR_STMT_OP);
+  cr_expect_eq(stmt_at(term, 0)->kind, MIR_STMT_OP);
+
+  mir_free(mir);
+}
+
+Test(gvn, memory, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *obj = tmp(sub, NULL);
+  mir_value *t0  = tmp(sub, NULL);
+  mir_value *t1  = tmp(sub, NULL);
+  mir_value *ref = tmp(sub, NULL);
+  mir_value *t2  = tmp(sub, NULL);
+
+  mir_bb *entry = bb(sub, 0);
+
+  vec_mir_stmt_push_back(entry->stmts, member(mir, t0, obj, "x"));
+  vec_mir_stmt_push_back(entry->stmts, member(mir, t1, obj, "x"));
+  // write through reference invalidates loads
+  vec_mir_stmt_push_back(
+      entry->stmts, mir_stmt_new_member_ref(nodes, ref, obj, (mir_lit *)NULL));
+  vec_mir_stmt_push_back(
+      entry->stmts, mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, ref, t0));
+  vec_mir_stmt_push_back(entry->stmts, member(mir, t2, obj, "x"));
+
+  mir_gvn_result result = mir_gvn(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(stmt_at(entry, 0)->kind, MIR_STMT_MEMBER);
+  cr_expect_eq(stmt_at(entry, 1)->kind, MIR_STMT_ASSIGN);
+  cr_expect_eq(stmt_at(entry, 1)->assign.from_value, t0);
+  cr_expect_eq(stmt_at(entry, 4)->kind, MIR_STMT_MEMBER);
+
+  mir_free(mir);
+}
+
+Test(gvn, method, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->methods);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+  mir_value *t2 = tmp(sub, type_int);
+  mir_value *t3 = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t1, 2));
+  vec_mir_stmt_push_back(entry->stmts, op(MIR_STMT_OP_BINARY_ADD, t2, t0, t1));
+  vec_mir_stmt_push_back(entry->stmts, op(MIR_STMT_OP_BINARY_ADD, t3, t0, t1));
+
+  mir_gvn_result result = mir_gvn(mir);
+  list_exception_free(result.exceptions);
+
+  const mir_stmt *add = stmt_at(entry, 3);
+  cr_assert_eq(add->kind, MIR_STMT_ASSIGN);
+  cr_expect_eq(add->assign.from_value, t2);
+
+  mir_free(mir);
+}
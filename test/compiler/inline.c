@@ -0,0 +1,103 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/inline.h"
+#include "mir_fixture.h"
+#include "util/macro.h"
+
+// add(a, b) { return a + b; }
+static mir_subroutine *add_new(mir *mir) {
+  mir_subroutine *add = sub_new(mir->defined_subs);
+  mir_value      *a   = param(add);
+  mir_value      *b   = param(add);
+  mir_value      *t0  = tmp(add, type_int);
+  mir_bb         *c0  = bb(add, 0);
+  mir_bb         *c1  = bb(add, 1);
+
+  vec_mir_stmt_push_back(c0->stmts, op(MIR_STMT_OP_BINARY_ADD, t0, a, b));
+  vec_mir_stmt_push_back(c0->stmts,
+                         mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE,
+                                              add->defined.ret, t0));
+  c0->jmp.next_ref = c1;
+  return add;
+}
+
+Test(inline, splice, .init = setup, .fini = teardown) {
+  mir            *mir  = mir_new();
+  mir_subroutine *add  = add_new(mir);
+  mir_subroutine *main = sub_new(mir->defined_subs);
+
+  mir_value *x = tmp(main, type_int);
+  mir_value *y = tmp(main, type_int);
+  mir_value *r = tmp(main, NULL);
+  mir_value *z = tmp(main, NULL);
+
+  mir_bb *entry = bb(main, 0);
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, x, 1));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, y, 2));
+  vec_mir_stmt_push_back(entry->stmts, call(r, add, x, y));
+  vec_mir_stmt_push_back(entry->stmts, op(MIR_STMT_OP_BINARY_ADD, z, r, x));
+
+  mir_inline_result result = mir_inline(mir);
+  list_exception_free(result.exceptions);
+
+  // entry, copies of both callee blocks and continuation
+  cr_assert_eq(vec_mir_bb_size(main->defined.bbs), 4);
+  cr_expect_eq(vec_mir_bb_size(add->defined.bbs), 2);
+
+  vec_mir_bb_it it    = vec_mir_bb_begin(main->defined.bbs);
+  mir_bb       *first = GET(it);
+  NEXT(it);
+  mir_bb *body = GET(it);
+  NEXT(it);
+  mir_bb *ret = GET(it);
+  NEXT(it);
+  mir_bb *cont = GET(it);
+
+  cr_assert_eq(first, entry);
+  cr_expect_eq(entry->jmp.next_ref, body);
+  cr_expect_eq(body->jmp.next_ref, ret);
+  cr_expect_eq(ret->jmp.next_ref, cont);
+  cr_expect_eq(mir_bb_get_cond(cont), MIR_BB_TERM);
+
+  // params are copied from args
+  cr_assert_eq(vec_mir_stmt_size(entry->stmts), 4);
+  const mir_stmt *copy = stmt_at(entry, 2);
+  cr_expect_eq(copy->kind, MIR_STMT_ASSIGN);
+  cr_expect_eq(copy->assign.from_value, x);
+
+  // result is assigned to value of the call
+  cr_assert_eq(vec_mir_stmt_size(body->stmts), 2);
+  cr_expect_eq(stmt_at(body, 0)->op.kind, MIR_STMT_OP_BINARY_ADD);
+  cr_expect_eq(stmt_at(body, 1)->assign.to, r);
+
+  cr_assert_eq(vec_mir_stmt_size(cont->stmts), 1);
+  cr_expect_eq(stmt_at(cont, 0)->op.ret, z);
+
+  mir_free(mir);
+}
+
+Test(inline, recursive, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *a = param(sub);
+  mir_value *b = param(sub);
+  mir_value *r = tmp(sub, NULL);
+
+  mir_bb *entry = bb(sub, 0);
+  vec_mir_stmt_push_back(entry->stmts, call(r, sub, a, b));
+
+  mir_subroutine *main = sub_new(mir->defined_subs);
+  mir_value      *t0   = tmp(main, NULL);
+  mir_bb         *c0   = bb(main, 0);
+  vec_mir_stmt_push_back(c0->stmts, call(t0, sub, t0, t0));
+
+  mir_inline_result result = mir_inline(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(vec_mir_bb_size(sub->defined.bbs), 1);
+  cr_expect_eq(vec_mir_bb_size(main->defined.bbs), 1);
+  cr_expect_eq(stmt_at(c0, 0)->kind, MIR_STMT_CALL);
+
+  mir_free(mir);
+}
@@ -0,0 +1,175 @@
+#include <criterion/criterion.h>
+
+#include "compiler/codegen/x86_64_build/inst/inst.h"
+#include "compiler/symbol_table/symbol_table.h"
+#include "mir_fixture.h"
+#include "util/intern.h"
+#include "util/macro.h"
+#include "x86_64_core/value.h"
+#include <string.h>
+
+static list_symbol_entry *symbols;
+static const type_entry  *type_uint;
+
+static void setup_cg(void) {
+  setup();
+  symbols   = list_symbol_entry_new();
+  type_uint = type_table_intern(
+      types, (type_base *)type_primitive_new(TYPE_PRIMITIVE_UINT), NULL);
+}
+
+static void teardown_cg(void) {
+  list_symbol_entry_free(symbols);
+  teardown();
+}
+
+static const symbol_entry *symbol(const char *name) {
+  symbol_entry *self = symbol_entry_new(intern(name), NULL, NULL);
+  list_symbol_entry_push_back(symbols, self);
+  return self;
+}
+
+// f:
+//   bb0: t3 = t1 <kind> t2, cond t3, je bb2, jz bb1
+//   bb1: ret = t1
+//   bb2: ret = t2
+static mir *cmp_mir(mir_stmt_op_enum kind, const type_entry *type,
+                    int cond_read) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+  sub->symbol_ref     = symbol("f");
+
+  mir_value *t1 = tmp(sub, type);
+  mir_value *t2 = tmp(sub, type);
+  mir_value *t3 = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+  mir_bb *jz    = bb(sub, 1);
+  mir_bb *je    = bb(sub, 2);
+
+  vec_mir_stmt_push_back(entry->stmts, op(kind, t3, t1, t2));
+  entry->jmp.cond_ref = t3;
+  entry->jmp.je_ref   = je;
+  entry->jmp.jz_ref   = jz;
+
+  vec_mir_stmt_push_back(
+      jz->stmts, mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE,
+                                     sub->defined.ret, cond_read ? t3 : t1));
+  vec_mir_stmt_push_back(
+      je->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret, t2));
+
+  return mir;
+}
+
+static cg_x86_64 *inst(const mir *mir) {
+  cg_x86_64      *code       = cg_x86_64_new();
+  cg_debug       *debug      = cg_debug_new(CG_CTX_DEBUG_LEVEL_DISABLED);
+  list_exception *exceptions = list_exception_new();
+
+  cg_ctx ctx;
+  cg_ctx_init(&ctx, code, debug, exceptions);
+  cg_inst_sub_def(&ctx, list_mir_subroutine_front(mir->defined_subs),
+                  strdup("f"));
+  cg_ctx_deinit(&ctx);
+
+  cr_expect(list_exception_empty(exceptions));
+  list_exception_free(exceptions);
+  cg_debug_free(debug);
+  return code;
+}
+
+static const cg_x86_64_text *text_at(const cg_x86_64 *code, size_t i) {
+  const cg_x86_64_unit *unit = vec_cg_x86_64_unit_at(code->text, i);
+  return unit->kind == CG_X86_64_UNIT_TEXT ? (const cg_x86_64_text *)unit
+                                           : NULL;
+}
+
+static const cg_x86_64_op *op_at(const cg_x86_64_text *text, size_t i) {
+  list_cg_x86_64_op_it it = list_cg_x86_64_op_begin(text->operands);
+  while (i--) {
+    NEXT(it);
+  }
+  return GET(it);
+}
+
+static int is_jmp(const cg_x86_64_text *text, cg_x86_64_mnem mnem,
+                  const char *sym) {
+  return text && text->mnem == mnem &&
+         op_at(text, 0)->kind == CG_X86_64_MODE_DIRECT &&
+         !strcmp(op_at(text, 0)->direct.sym_addr, sym);
+}
+
+// index of symbol unit, size of text if it is not found
+static size_t sym_idx(const cg_x86_64 *code, const char *sym) {
+  size_t i = 0;
+  for (; i < vec_cg_x86_64_unit_size(code->text); ++i) {
+    const cg_x86_64_unit *unit = vec_cg_x86_64_unit_at(code->text, i);
+    if (unit->kind == CG_X86_64_UNIT_SYMBOL &&
+        !strcmp(((const cg_x86_64_symbol *)unit)->name, sym)) {
+      break;
+    }
+  }
+  return i;
+}
+
+// guards of both operands jump to slow path, then compare of raw data jumps
+// to je with jcc and to jz explicitly right before slow path
+static void expect_fast(const cg_x86_64 *code, x86_64_type_enum type,
+                        cg_x86_64_mnem jcc) {
+  size_t slow = sym_idx(code, ".Lf_slow_0");
+  cr_assert(slow < vec_cg_x86_64_unit_size(code->text));
+
+  size_t guards = 0;
+  for (size_t i = 0; i + 1 < slow; ++i) {
+    const cg_x86_64_text *text = text_at(code, i);
+    if (!text || text->mnem != CG_X86_64_MNEM_CMPL ||
+        op_at(text, 0)->kind != CG_X86_64_MODE_IMMEDIATE) {
+      continue;
+    }
+    cr_expect_eq(op_at(text, 0)->imm.imm_const, type);
+    cr_expect(
+        is_jmp(text_at(code, i + 1), CG_X86_64_MNEM_JNZ, ".Lf_slow_0"));
+    ++guards;
+  }
+  cr_expect_eq(guards, 2);
+
+  const cg_x86_64_text *cmp = text_at(code, slow - 3);
+  cr_expect(cmp && cmp->mnem == CG_X86_64_MNEM_CMPL &&
+            op_at(cmp, 0)->kind == CG_X86_64_MODE_BASE_IMM);
+
+  cr_expect(is_jmp(text_at(code, slow - 2), jcc, ".Lf_bb2"));
+  cr_expect(is_jmp(text_at(code, slow - 1), CG_X86_64_MNEM_JMP, ".Lf_bb1"));
+}
+
+Test(inst_bb, cmp_signed, .init = setup_cg, .fini = teardown_cg) {
+  mir       *mir  = cmp_mir(MIR_STMT_OP_BINARY_LESS, type_int, 0);
+  cg_x86_64 *code = inst(mir);
+
+  expect_fast(code, X86_64_TYPE_INT, CG_X86_64_MNEM_JL);
+
+  cg_x86_64_free(code);
+  mir_free(mir);
+}
+
+Test(inst_bb, cmp_unsigned, .init = setup_cg, .fini = teardown_cg) {
+  mir       *mir  = cmp_mir(MIR_STMT_OP_BINARY_LESS, type_uint, 0);
+  cg_x86_64 *code = inst(mir);
+
+  expect_fast(code, X86_64_TYPE_UINT, CG_X86_64_MNEM_JB);
+
+  cg_x86_64_free(code);
+  mir_free(mir);
+}
+
+Test(inst_bb, cmp_cond_read, .init = setup_cg, .fini = teardown_cg) {
+  mir       *mir  = cmp_mir(MIR_STMT_OP_BINARY_LESS, type_int, 1);
+  cg_x86_64 *code = inst(mir);
+
+  // cond is read by other bb, so fast path doesn't skip its computation
+  cr_expect_eq(sym_idx(code, ".Lf_slow_0"),
+               vec_cg_x86_64_unit_size(code->text));
+
+  cg_x86_64_free(code);
+  mir_free(mir);
+}
@@ -0,0 +1,136 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/licm.h"
+#include "mir_fixture.h"
+#include "util/macro.h"
+
+Test(licm, invariant, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+  mir_value *t2 = tmp(sub, type_int);
+  mir_value *t3 = tmp(sub, type_int);
+  mir_value *t4 = tmp(sub, type_int);
+  mir_value *t5 = tmp(sub, type_int);
+  mir_value *t6 = tmp(sub, type_int);
+
+  mir_bb *entry  = bb(sub, 0);
+  mir_bb *header = bb(sub, 1);
+  mir_bb *body   = bb(sub, 2);
+  mir_bb *exit   = bb(sub, 3);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t1, 2));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t5, 0));
+  entry->jmp.next_ref = header;
+
+  vec_mir_stmt_push_back(header->stmts,
+                         op(MIR_STMT_OP_BINARY_LESS, t6, t5, t1));
+  header->jmp.cond_ref = t6;
+  header->jmp.je_ref   = body;
+  header->jmp.jz_ref   = exit;
+
+  vec_mir_stmt_push_back(body->stmts, op(MIR_STMT_OP_BINARY_ADD, t2, t0, t1));
+  // operand is hoisted first
+  vec_mir_stmt_push_back(body->stmts, op(MIR_STMT_OP_BINARY_MUL, t3, t2, t0));
+  // may trap, so it is not executed speculatively
+  vec_mir_stmt_push_back(body->stmts, op(MIR_STMT_OP_BINARY_DIV, t4, t0, t1));
+  // induction variable is written in the loop
+  vec_mir_stmt_push_back(body->stmts, op(MIR_STMT_OP_BINARY_ADD, t5, t5, t3));
+  body->jmp.next_ref = header;
+
+  mir_licm_result result = mir_licm(mir);
+  list_exception_free(result.exceptions);
+
+  mir_bb *preheader = entry->jmp.next_ref;
+  cr_assert_neq(preheader, header);
+  cr_expect_eq(preheader->jmp.next_ref, header);
+  cr_expect_eq(body->jmp.next_ref, header);
+
+  cr_assert_eq(vec_mir_stmt_size(preheader->stmts), 2);
+  cr_expect_eq(stmt_at(preheader, 0)->op.ret, t2);
+  cr_expect_eq(stmt_at(preheader, 1)->op.ret, t3);
+
+  cr_assert_eq(vec_mir_stmt_size(body->stmts), 2);
+  cr_expect_eq(stmt_at(body, 0)->op.ret, t4);
+  cr_expect_eq(stmt_at(body, 1)->op.ret, t5);
+  cr_expect_eq(vec_mir_stmt_size(header->stmts), 1);
+
+  mir_free(mir);
+}
+
+Test(licm, use_before_loop, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+  mir_value *t2 = tmp(sub, type_int);
+
+  mir_bb *entry  = bb(sub, 0);
+  mir_bb *header = bb(sub, 1);
+  mir_bb *exit   = bb(sub, 2);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  entry->jmp.next_ref = header;
+
+  // condition reads result of previous iteration
+  vec_mir_stmt_push_back(header->stmts,
+                         op(MIR_STMT_OP_BINARY_LESS, t1, t2, t0));
+  vec_mir_stmt_push_back(header->stmts,
+                         op(MIR_STMT_OP_BINARY_ADD, t2, t0, t0));
+  header->jmp.cond_ref = t1;
+  header->jmp.je_ref   = header;
+  header->jmp.jz_ref   = exit;
+
+  mir_licm_result result = mir_licm(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(vec_mir_stmt_size(header->stmts), 2);
+  cr_expect_eq(vec_mir_stmt_size(entry->jmp.next_ref->stmts), 0);
+
+  mir_free(mir);
+}
+
+Test(licm, method, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->methods);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+  mir_value *t2 = tmp(sub, type_int);
+  mir_value *t3 = tmp(sub, type_int);
+  mir_value *t4 = tmp(sub, type_int);
+
+  mir_bb *entry  = bb(sub, 0);
+  mir_bb *header = bb(sub, 1);
+  mir_bb *body   = bb(sub, 2);
+  mir_bb *exit   = bb(sub, 3);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 1));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t1, 2));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t4, 0));
+  entry->jmp.next_ref = header;
+
+  vec_mir_stmt_push_back(header->stmts,
+                         op(MIR_STMT_OP_BINARY_LESS, t3, t4, t1));
+  header->jmp.cond_ref = t3;
+  header->jmp.je_ref   = body;
+  header->jmp.jz_ref   = exit;
+
+  vec_mir_stmt_push_back(body->stmts, op(MIR_STMT_OP_BINARY_ADD, t2, t0, t1));
+  vec_mir_stmt_push_back(body->stmts, op(MIR_STMT_OP_BINARY_ADD, t4, t4, t2));
+  body->jmp.next_ref = header;
+
+  mir_licm_result result = mir_licm(mir);
+  list_exception_free(result.exceptions);
+
+  mir_bb *preheader = entry->jmp.next_ref;
+  cr_assert_neq(preheader, header);
+  cr_expect_eq(vec_mir_stmt_size(preheader->stmts), 1);
+  cr_expect_eq(vec_mir_stmt_size(body->stmts), 1);
+
+  mir_free(mir);
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "compiler/mir/mir.h"
+#include "compiler/type_table/type_table.h"
+#include "util/arena.h"
+#include "util/macro.h"
+#include <stdint.h>
+
+// fixture of mir pass tests, nodes are made with int type unless it is passed.
+// Containers of nodes are on the same arena as nodes, like the ones of mir
+
+static type_table       *types;
+static const type_entry *type_int;
+static arena            *nodes; // mir doesn't own nodes made by tests
+
+static inline void setup(void) {
+  types    = type_table_new();
+  nodes    = arena_new(0);
+  type_int = type_table_intern(
+      types, (type_base *)type_primitive_new(TYPE_PRIMITIVE_INT), NULL);
+  type_table_intern(types,
+                    (type_base *)type_primitive_new(TYPE_PRIMITIVE_BOOL), NULL);
+}
+
+static inline void teardown(void) {
+  arena_free(nodes);
+  type_table_free(types);
+}
+
+static inline mir_value *tmp(mir_subroutine *sub, const type_entry *type) {
+  size_t     id    = vec_mir_value_size(sub->defined.tmps) + 1;
+  mir_value *value = mir_value_new(nodes, id, NULL, type);
+  vec_mir_value_push_back(sub->defined.tmps, value);
+  return value;
+}
+
+static inline mir_value *param(mir_subroutine *sub) {
+  size_t     id    = vec_mir_value_size(sub->defined.params) + 1;
+  mir_value *value = mir_value_new(nodes, id, NULL, type_int);
+  vec_mir_value_push_back(sub->defined.params, value);
+  return value;
+}
+
+static inline mir_stmt *assign_int(mir *mir, mir_value *to, int32_t value) {
+  mir_lit *lit = mir_lit_new(nodes, list_mir_lit_size(mir->literals), type_int,
+                             (mir_lit_value){.v_int = value});
+  list_mir_lit_push_back(mir->literals, lit);
+  return mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_LIT, to, lit);
+}
+
+static inline mir_stmt *op(mir_stmt_op_enum kind, mir_value *ret,
+                           mir_value *lsv, mir_value *rsv) {
+  vec_mir_value_ref *args = vec_mir_value_ref_new_arena(nodes);
+  vec_mir_value_ref_push_back(args, lsv);
+  vec_mir_value_ref_push_back(args, rsv);
+  return mir_stmt_new_op(nodes, kind, ret, args);
+}
+
+// rsv is optional
+static inline mir_stmt *call(mir_value *ret, mir_subroutine *sub,
+                             mir_value *lsv, mir_value *rsv) {
+  vec_mir_value_ref *args = vec_mir_value_ref_new_arena(nodes);
+  vec_mir_value_ref_push_back(args, lsv);
+  if (rsv) {
+    vec_mir_value_ref_push_back(args, rsv);
+  }
+  return mir_stmt_new_call(nodes, ret, sub, args);
+}
+
+static inline mir_bb *bb(mir_subroutine *sub, size_t id) {
+  mir_bb *self = mir_bb_new(nodes, id, vec_mir_stmt_new_arena(nodes), NULL,
+                            NULL, NULL, list_hir_expr_ref_new_arena(nodes));
+  vec_mir_bb_push_back(sub->defined.bbs, self);
+  return self;
+}
+
+static inline mir_subroutine *sub_new(list_mir_subroutine *subs) {
+  mir_subroutine *sub = mir_subroutine_new_defined(
+      nodes, NULL, NULL, MIR_SUBROUTINE_SPEC_EMPTY,
+      mir_value_new(nodes, 0, NULL, type_int), vec_mir_value_new_arena(nodes),
+      vec_mir_value_new_arena(nodes), vec_mir_value_new_arena(nodes),
+      vec_mir_bb_new_arena(nodes));
+  list_mir_subroutine_push_back(subs, sub);
+  return sub;
+}
+
+static inline const mir_stmt *stmt_at(const mir_bb *bb, size_t i) {
+  vec_mir_stmt_it it = vec_mir_stmt_begin(bb->stmts);
+  while (i--) {
+    NEXT(it);
+  }
+  return GET(it);
+}
@@ -0,0 +1,221 @@
+#include <criterion/criterion.h>
+
+#include "compiler/hir_build/parse.h"
+#include "util/macro.h"
+#include <string.h>
+
+static hir_parse_result result;
+
+static void parse(const char *source) {
+  result = hir_parse("test", source, strlen(source));
+}
+
+static void teardown(void) {
+  list_exception_free(result.exceptions);
+  hir_free(result.hir);
+}
+
+static void expect_span(const span *span, size_t line_start, size_t pos_start,
+                        size_t line_end, size_t pos_end) {
+  cr_assert_not_null(span);
+  cr_expect_eq(span->line_start, line_start);
+  cr_expect_eq(span->pos_start, pos_start);
+  cr_expect_eq(span->line_end, line_end);
+  cr_expect_eq(span->pos_end, pos_end);
+}
+
+static hir_subroutine *sub_front(void) {
+  cr_assert_eq(list_exception_size(result.exceptions), 0);
+  cr_assert_eq(list_hir_subroutine_size(result.hir->subroutines), 1);
+  return list_hir_subroutine_front(result.hir->subroutines);
+}
+
+static hir_stmt_base *stmt_at(const hir_subroutine *sub, size_t index) {
+  list_hir_stmt_it it =
+      list_hir_stmt_begin(sub->body->body.block.block->stmts);
+  for (size_t i = 0; i < index; ++i) {
+    NEXT(it);
+  }
+  return GET(it);
+}
+
+static hir_expr_base *expr_at(const hir_subroutine *sub, size_t index) {
+  hir_stmt_base *stmt = stmt_at(sub, index);
+  cr_assert_eq(stmt->kind, HIR_STMT_EXPR);
+  return ((hir_stmt_expr *)stmt)->expr;
+}
+
+static hir_expr_base *binary(hir_expr_base *expr, hir_expr_binary_enum op) {
+  cr_assert_eq(expr->kind, HIR_EXPR_BINARY);
+  cr_assert_eq(((hir_expr_binary *)expr)->op, op);
+  return ((hir_expr_binary *)expr)->second;
+}
+
+Test(parse, func, .fini = teardown) {
+  parse("method f(a: int, b): long\n"
+        "var\n"
+        "  x, y: long;\n"
+        "begin\n"
+        "  x = a + b * 2;\n"
+        "  return x;\n"
+        "end;\n");
+
+  hir_subroutine *sub = sub_front();
+  cr_expect_str_eq(sub->id_hir->name, "f");
+  expect_span(sub->base.span, 1, 0, 1, 25);
+  cr_expect_eq(list_hir_param_size(sub->params), 2);
+  expect_span(list_hir_param_front(sub->params)->base.span, 1, 9, 1, 15);
+  cr_expect_eq(sub->type_ret->type, HIR_TYPE_LONG);
+
+  cr_assert_eq(sub->body->kind, HIR_SUBROUTINE_BODY_BLOCK);
+  cr_expect_eq(list_hir_var_size(sub->body->body.block.vars), 2);
+  expect_span(sub->body->body.block.block->base.base.span, 4, 0, 6, 10);
+
+  hir_expr_base *assign = expr_at(sub, 0);
+  expect_span(assign->base.span, 5, 2, 5, 15);
+  hir_expr_base *second = binary(assign, HIR_EXPR_BINARY_ASSIGN);
+  second                = binary(second, HIR_EXPR_BINARY_ADD);
+  binary(second, HIR_EXPR_BINARY_MUL);
+
+  hir_stmt_base *ret = stmt_at(sub, 1);
+  cr_expect_eq(ret->kind, HIR_STMT_RETURN);
+  expect_span(ret->base.span, 6, 2, 6, 10);
+}
+
+Test(parse, precedence, .fini = teardown) {
+  parse("method f(): int begin\n"
+        "  a = b = c || d && e | f ^ g & h == i < j >> 1 + k * -l;\n"
+        "  a - b - c;\n"
+        "end;\n");
+
+  hir_subroutine *sub  = sub_front();
+  hir_expr_base  *expr = expr_at(sub, 0);
+
+  hir_expr_binary_enum ops[] = {
+      HIR_EXPR_BINARY_ASSIGN,      HIR_EXPR_BINARY_ASSIGN,
+      HIR_EXPR_BINARY_LOGICAL_OR,  HIR_EXPR_BINARY_LOGICAL_AND,
+      HIR_EXPR_BINARY_BITWISE_OR,  HIR_EXPR_BINARY_BITWISE_XOR,
+      HIR_EXPR_BINARY_BITWISE_AND, HIR_EXPR_BINARY_EQUALS,
+      HIR_EXPR_BINARY_LESS,        HIR_EXPR_BINARY_BITWISE_SHIFT_RIGHT,
+      HIR_EXPR_BINARY_ADD,         HIR_EXPR_BINARY_MUL,
+  };
+  for (size_t i = 0; i < sizeof(ops) / sizeof(*ops); ++i) {
+    expr = binary(expr, ops[i]);
+  }
+  cr_assert_eq(expr->kind, HIR_EXPR_UNARY);
+  cr_expect_eq(((hir_expr_unary *)expr)->op, HIR_EXPR_UNARY_MINUS);
+
+  // left associative
+  hir_expr_binary *sub_expr = (hir_expr_binary *)expr_at(sub, 1);
+  cr_expect_eq(sub_expr->op, HIR_EXPR_BINARY_SUB);
+  cr_assert_eq(sub_expr->first->kind, HIR_EXPR_BINARY);
+  cr_expect_eq(sub_expr->second->kind, HIR_EXPR_IDENTIFIER);
+}
+
+Test(parse, postfix_and_builtins, .fini = teardown) {
+  parse("method f(): int begin\n"
+        "  cast!<A<B<int>>>(o.g(1)[2]);\n"
+        "end;\n");
+
+  hir_subroutine   *sub     = sub_front();
+  hir_expr_builtin *builtin = (hir_expr_builtin *)expr_at(sub, 0);
+  cr_assert_eq(builtin->base.kind, HIR_EXPR_BUILTIN);
+  cr_expect_eq(builtin->kind, HIR_EXPR_BUILTIN_CAST);
+  expect_span(builtin->base.base.span, 2, 2, 2, 27);
+
+  hir_type_custom *type = (hir_type_custom *)builtin->base.type_hir;
+  cr_assert_eq(type->base.type, HIR_TYPE_CUSTOM);
+  cr_expect_str_eq(type->name, "A");
+  cr_expect_eq(list_hir_type_size(type->templates), 1);
+
+  cr_assert_eq(list_hir_expr_size(builtin->args), 1);
+  hir_expr_index *index =
+      (hir_expr_index *)list_hir_expr_front(builtin->args);
+  cr_assert_eq(index->base.kind, HIR_EXPR_INDEX);
+  hir_expr_call *call = (hir_expr_call *)index->indexed;
+  cr_assert_eq(call->base.kind, HIR_EXPR_CALL);
+  hir_expr_binary *member = (hir_expr_binary *)call->callee;
+  cr_assert_eq(member->base.kind, HIR_EXPR_BINARY);
+  cr_expect_eq(member->op, HIR_EXPR_BINARY_MEMBER);
+  cr_expect_str_eq(((hir_expr_lit *)member->second)->lit->value.v_str, "g");
+}
+
+Test(parse, class, .fini = teardown) {
+  parse("class A<T> : B<T>\n"
+        "var\n"
+        "  v: T;\n"
+        "begin\n"
+        "  public method get(): T;\n"
+        "  private method set(t: T): void begin end\n"
+        "end;\n");
+
+  cr_assert_eq(list_exception_size(result.exceptions), 0);
+  cr_assert_eq(list_hir_class_size(result.hir->classes), 1);
+  hir_class *class = list_hir_class_front(result.hir->classes);
+  expect_span(class->base.span, 1, 0, 1, 14);
+  cr_expect_eq(list_hir_id_size(class->typenames), 1);
+  cr_expect_eq(list_hir_type_size(class->parents), 1);
+  cr_expect_eq(list_hir_var_size(class->fields), 1);
+  cr_assert_eq(list_hir_method_size(class->methods), 2);
+
+  hir_method *get = list_hir_method_front(class->methods);
+  cr_expect_eq(get->modifier, HIR_METHOD_MODIFIER_ENUM_PUBLIC);
+  expect_span(get->base.span, 5, 2, 5, 24);
+  cr_expect_str_eq(list_hir_param_front(get->subroutine->params)->id_hir->name,
+                   "this");
+
+  hir_method *set = list_hir_method_back(class->methods);
+  cr_expect_eq(set->modifier, HIR_METHOD_MODIFIER_ENUM_PRIVATE);
+  cr_expect_eq(list_hir_param_size(set->subroutine->params), 2);
+}
+
+Test(parse, literals, .fini = teardown) {
+  parse("method f(): int begin\n"
+        "  0xff; 0b101; 18446744073709551615; 'c'; \"s\"; true;\n"
+        "end;\n");
+
+  hir_subroutine *sub = sub_front();
+  hir_lit        *lit = ((hir_expr_lit *)expr_at(sub, 0))->lit;
+  cr_expect_eq(lit->value.v_long, 0xff);
+  lit = ((hir_expr_lit *)expr_at(sub, 1))->lit;
+  cr_expect_eq(lit->value.v_long, 5);
+  lit = ((hir_expr_lit *)expr_at(sub, 2))->lit;
+  cr_expect_eq(lit->type_hir->type, HIR_TYPE_ULONG);
+  lit = ((hir_expr_lit *)expr_at(sub, 3))->lit;
+  cr_expect_str_eq(lit->value.v_char, "c");
+  lit = ((hir_expr_lit *)expr_at(sub, 4))->lit;
+  cr_expect_str_eq(lit->value.v_str, "s");
+  lit = ((hir_expr_lit *)expr_at(sub, 5))->lit;
+  cr_expect_eq(lit->value.v_bool, 1);
+}
+
+Test(parse, errors, .fini = teardown) {
+  parse("method f(): int begin x = ; end;\n"
+        "method g(): int begin\n"
+        "  $ 99999999999999999999;\n"
+        "end;\n"
+        "method h(): int;\n");
+
+  cr_assert_eq(list_exception_size(result.exceptions), 3);
+  list_exception_it it  = list_exception_begin(result.exceptions);
+  exception        *exc = GET(it);
+  cr_expect_eq(exc->type, EXCEPTION_PARSER);
+  cr_expect_eq(exc->line, 1);
+  cr_expect_eq(exc->offset, 26);
+
+  NEXT(it);
+  exc = GET(it);
+  cr_expect_eq(exc->type, EXCEPTION_LEXER);
+  cr_expect_eq(exc->line, 3);
+
+  NEXT(it);
+  exc = GET(it);
+  cr_expect_eq(exc->type, EXCEPTION_HIR);
+  cr_expect_eq(exc->subtype, EXCEPTION_HIR_DEC_VALIDATION);
+  cr_expect_eq(exc->offset, 4);
+
+  // parser skips to the next method at line start
+  cr_assert_eq(list_hir_subroutine_size(result.hir->subroutines), 1);
+  cr_expect_str_eq(
+      list_hir_subroutine_front(result.hir->subroutines)->id_hir->name, "h");
+}
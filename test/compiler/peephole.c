@@ -0,0 +1,141 @@
+#include <criterion/criterion.h>
+
+#include "compiler/codegen/x86_64_opt/peephole.h"
+#include "util/macro.h"
+#include <string.h>
+
+static cg_x86_64_unit *text(cg_x86_64_mnem mnem, cg_x86_64_op *op1,
+                            cg_x86_64_op *op2) {
+  list_cg_x86_64_op *ops = list_cg_x86_64_op_new();
+  if (op1) {
+    list_cg_x86_64_op_push_back(ops, op1);
+  }
+  if (op2) {
+    list_cg_x86_64_op_push_back(ops, op2);
+  }
+  return (cg_x86_64_unit *)cg_x86_64_text_new(mnem, ops);
+}
+
+static cg_x86_64_unit *label(const char *name) {
+  return (cg_x86_64_unit *)cg_x86_64_symbol_new_text(strdup(name));
+}
+
+static uint64_t hits(list_cg_x86_64_opt_stat *stats, const char *rule) {
+  for (list_cg_x86_64_opt_stat_it it = list_cg_x86_64_opt_stat_begin(stats);
+       !END(it); NEXT(it)) {
+    if (!strcmp(GET(it)->rule_ref, rule)) {
+      return GET(it)->hits;
+    }
+  }
+  return 0;
+}
+
+Test(peephole, jmp_next) {
+  vec_cg_x86_64_unit      *units = vec_cg_x86_64_unit_new();
+  list_cg_x86_64_opt_stat *stats = list_cg_x86_64_opt_stat_new();
+
+  vec_cg_x86_64_unit_push_back(
+      units, text(CG_X86_64_MNEM_JMP, cg_x86_64_op_new_direct(strdup(".L1")),
+                  NULL));
+  vec_cg_x86_64_unit_push_back(units, label(".L0"));
+  vec_cg_x86_64_unit_push_back(units, label(".L1"));
+
+  cg_peephole(units, stats);
+
+  cr_expect_eq(vec_cg_x86_64_unit_size(units), 2);
+  cr_expect_eq(hits(stats, "jmp_next"), 1);
+
+  list_cg_x86_64_opt_stat_free(stats);
+  vec_cg_x86_64_unit_free(units);
+}
+
+Test(peephole, mov_dead) {
+  vec_cg_x86_64_unit      *units = vec_cg_x86_64_unit_new();
+  list_cg_x86_64_opt_stat *stats = list_cg_x86_64_opt_stat_new();
+
+  vec_cg_x86_64_unit_push_back(
+      units, text(CG_X86_64_MNEM_MOVQ, cg_x86_64_op_new_immediate(0),
+                  cg_x86_64_op_new_register(CG_X86_64_REG_RDI)));
+  vec_cg_x86_64_unit_push_back(
+      units,
+      text(CG_X86_64_MNEM_LEAQ,
+           cg_x86_64_op_new_base_imm(-24, CG_X86_64_REG_RBP),
+           cg_x86_64_op_new_register(CG_X86_64_REG_RDI)));
+  // reads overwritten register, must stay
+  vec_cg_x86_64_unit_push_back(
+      units,
+      text(CG_X86_64_MNEM_MOVQ,
+           cg_x86_64_op_new_base_imm(8, CG_X86_64_REG_RDI),
+           cg_x86_64_op_new_register(CG_X86_64_REG_RDI)));
+
+  cg_peephole(units, stats);
+
+  cr_expect_eq(vec_cg_x86_64_unit_size(units), 2);
+  cr_expect_eq(hits(stats, "mov_dead"), 1);
+
+  list_cg_x86_64_opt_stat_free(stats);
+  vec_cg_x86_64_unit_free(units);
+}
+
+Test(peephole, lea_repeat) {
+  vec_cg_x86_64_unit      *units = vec_cg_x86_64_unit_new();
+  list_cg_x86_64_opt_stat *stats = list_cg_x86_64_opt_stat_new();
+
+  for (int i = 0; i < 2; ++i) {
+    vec_cg_x86_64_unit_push_back(
+        units,
+        text(CG_X86_64_MNEM_LEAQ,
+             cg_x86_64_op_new_base_imm(-24, CG_X86_64_REG_RBP),
+             cg_x86_64_op_new_register(CG_X86_64_REG_RSI)));
+    vec_cg_x86_64_unit_push_back(
+        units, text(CG_X86_64_MNEM_CMPL, cg_x86_64_op_new_immediate(6),
+                    cg_x86_64_op_new_indirect(CG_X86_64_REG_RSI)));
+  }
+  vec_cg_x86_64_unit_push_back(
+      units, text(CG_X86_64_MNEM_CALL,
+                  cg_x86_64_op_new_direct(strdup("__x86_64_flush")), NULL));
+  // clobbered by call, must stay
+  vec_cg_x86_64_unit_push_back(
+      units,
+      text(CG_X86_64_MNEM_LEAQ,
+           cg_x86_64_op_new_base_imm(-24, CG_X86_64_REG_RBP),
+           cg_x86_64_op_new_register(CG_X86_64_REG_RSI)));
+
+  cg_peephole(units, stats);
+
+  cr_expect_eq(vec_cg_x86_64_unit_size(units), 5);
+  cr_expect_eq(hits(stats, "lea_repeat"), 1);
+
+  list_cg_x86_64_opt_stat_free(stats);
+  vec_cg_x86_64_unit_free(units);
+}
+
+Test(peephole, rsp_cancel) {
+  vec_cg_x86_64_unit      *units = vec_cg_x86_64_unit_new();
+  list_cg_x86_64_opt_stat *stats = list_cg_x86_64_opt_stat_new();
+
+  vec_cg_x86_64_unit_push_back(
+      units, text(CG_X86_64_MNEM_ADDQ, cg_x86_64_op_new_immediate(8),
+                  cg_x86_64_op_new_register(CG_X86_64_REG_RSP)));
+  vec_cg_x86_64_unit_push_back(
+      units, text(CG_X86_64_MNEM_SUBQ, cg_x86_64_op_new_immediate(8),
+                  cg_x86_64_op_new_register(CG_X86_64_REG_RSP)));
+  vec_cg_x86_64_unit_push_back(
+      units, text(CG_X86_64_MNEM_SUBQ, cg_x86_64_op_new_immediate(16),
+                  cg_x86_64_op_new_register(CG_X86_64_REG_RSP)));
+  vec_cg_x86_64_unit_push_back(
+      units, text(CG_X86_64_MNEM_SUBQ, cg_x86_64_op_new_immediate(8),
+                  cg_x86_64_op_new_register(CG_X86_64_REG_RSP)));
+
+  cg_peephole(units, stats);
+
+  cr_assert_eq(vec_cg_x86_64_unit_size(units), 1);
+  cr_expect_eq(hits(stats, "rsp_cancel"), 2);
+
+  const cg_x86_64_text *text = (typeof(text))vec_cg_x86_64_unit_front(units);
+  cr_expect_eq(text->mnem, CG_X86_64_MNEM_SUBQ);
+  cr_expect_eq(list_cg_x86_64_op_front(text->operands)->imm.imm_const, 24);
+
+  list_cg_x86_64_opt_stat_free(stats);
+  vec_cg_x86_64_unit_free(units);
+}
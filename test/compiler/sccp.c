@@ -0,0 +1,109 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/merge_bb.h"
+#include "compiler/mir_build/sccp.h"
+#include "mir_fixture.h"
+#include "util/macro.h"
+#include <stdint.h>
+
+Test(sccp, fold_branch, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *t0 = tmp(sub, type_int);
+  mir_value *t1 = tmp(sub, type_int);
+  mir_value *t2 = tmp(sub, type_int);
+  mir_value *t3 = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+  mir_bb *je    = bb(sub, 1);
+  mir_bb *jz    = bb(sub, 2);
+  mir_bb *term  = bb(sub, 3);
+
+  // 2 * 3 < 2
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t0, 2));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, t1, 3));
+  vec_mir_stmt_push_back(entry->stmts,
+                         op(MIR_STMT_OP_BINARY_MUL, t2, t0, t1));
+  vec_mir_stmt_push_back(entry->stmts,
+                         op(MIR_STMT_OP_BINARY_LESS, t3, t2, t0));
+  entry->jmp.cond_ref = t3;
+  entry->jmp.je_ref   = je;
+  entry->jmp.jz_ref   = jz;
+
+  vec_mir_stmt_push_back(
+      je->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret, t0));
+  je->jmp.next_ref = term;
+
+  vec_mir_stmt_push_back(
+      jz->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret, t2));
+  jz->jmp.next_ref = term;
+
+  mir_sccp_result result = mir_sccp(mir, types);
+  list_exception_free(result.exceptions);
+
+  cr_assert_eq(vec_mir_bb_size(sub->defined.bbs), 3);
+  cr_expect_eq(mir_bb_get_cond(entry), MIR_BB_NEXT);
+  cr_expect_eq(entry->jmp.next_ref, jz);
+
+  // only folded multiplication is left
+  cr_assert_eq(vec_mir_stmt_size(entry->stmts), 1);
+  const mir_stmt *stmt = vec_mir_stmt_front(entry->stmts);
+  cr_expect_eq(stmt->kind, MIR_STMT_ASSIGN);
+  cr_expect_eq(stmt->assign.kind, MIR_STMT_ASSIGN_LIT);
+  cr_expect_eq(stmt->assign.to, t2);
+  cr_expect_eq(stmt->assign.from_lit->value.v_int, 6);
+  cr_expect_eq(vec_mir_value_size(sub->defined.tmps), 1);
+
+  mir_merge_bb_result merged = mir_merge_bb(mir);
+  list_exception_free(merged.exceptions);
+
+  cr_assert_eq(vec_mir_bb_size(sub->defined.bbs), 1);
+  cr_expect_eq(vec_mir_stmt_size(vec_mir_bb_front(sub->defined.bbs)->stmts),
+               2);
+
+  mir_free(mir);
+}
+
+Test(sccp, runtime_semantics, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *max  = tmp(sub, type_int);
+  mir_value *one  = tmp(sub, type_int);
+  mir_value *zero = tmp(sub, type_int);
+  mir_value *sum  = tmp(sub, type_int);
+  mir_value *div  = tmp(sub, type_int);
+
+  mir_bb *entry = bb(sub, 0);
+
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, max, INT32_MAX));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, one, 1));
+  vec_mir_stmt_push_back(entry->stmts, assign_int(mir, zero, 0));
+  vec_mir_stmt_push_back(entry->stmts,
+                         op(MIR_STMT_OP_BINARY_ADD, sum, max, one));
+  vec_mir_stmt_push_back(entry->stmts,
+                         op(MIR_STMT_OP_BINARY_DIV, div, one, zero));
+  vec_mir_stmt_push_back(
+      entry->stmts,
+      mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret, sum));
+
+  mir_sccp_result result = mir_sccp(mir, types);
+  list_exception_free(result.exceptions);
+
+  // division by zero is left to runtime, so its operands are kept
+  cr_assert_eq(vec_mir_stmt_size(entry->stmts), 5);
+
+  vec_mir_stmt_it it = vec_mir_stmt_begin(entry->stmts);
+  NEXT(it);
+  NEXT(it);
+  const mir_stmt *add = GET(it);
+  cr_expect_eq(add->kind, MIR_STMT_ASSIGN);
+  cr_expect_eq(add->assign.from_lit->value.v_int, INT32_MIN);
+  NEXT(it);
+  cr_expect_eq(GET(it)->kind, MIR_STMT_OP);
+
+  mir_free(mir);
+}
@@ -0,0 +1,110 @@
+#include <criterion/criterion.h>
+
+#include "compiler/mir_build/tail_call.h"
+#include "mir_fixture.h"
+#include "util/macro.h"
+
+static mir_stmt *ret_assign(mir_subroutine *sub, mir_value *from) {
+  return mir_stmt_new_assign(nodes, MIR_STMT_ASSIGN_VALUE, sub->defined.ret,
+                             from);
+}
+
+Test(tail_call, self, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *sub = sub_new(mir->defined_subs);
+
+  mir_value *a = param(sub);
+  mir_value *b = param(sub);
+  mir_value *c = tmp(sub, type_int);
+  mir_value *r = tmp(sub, NULL);
+
+  mir_bb *entry = bb(sub, 0);
+  mir_bb *rec   = bb(sub, 1);
+  mir_bb *last  = bb(sub, 2);
+
+  vec_mir_stmt_push_back(entry->stmts, op(MIR_STMT_OP_BINARY_LESS, c, a, b));
+  entry->jmp.cond_ref = c;
+  entry->jmp.je_ref   = rec;
+  entry->jmp.jz_ref   = last;
+
+  // params are swapped
+  vec_mir_stmt_push_back(rec->stmts, call(r, sub, b, a));
+  vec_mir_stmt_push_back(rec->stmts, ret_assign(sub, r));
+  rec->jmp.next_ref = last;
+
+  mir_tail_call_result result = mir_tail_call(mir);
+  list_exception_free(result.exceptions);
+
+  cr_expect_eq(rec->jmp.next_ref, entry);
+
+  // args are copied before params are overwritten
+  cr_assert_eq(vec_mir_stmt_size(rec->stmts), 4);
+  cr_expect_eq(stmt_at(rec, 0)->assign.kind, MIR_STMT_ASSIGN_VALUE);
+  cr_expect_eq(stmt_at(rec, 0)->assign.from_value, b);
+  cr_expect_eq(stmt_at(rec, 1)->assign.from_value, a);
+  cr_expect_eq(stmt_at(rec, 2)->assign.kind, MIR_STMT_ASSIGN_MOVE);
+  cr_expect_eq(stmt_at(rec, 2)->assign.to, a);
+  cr_expect_eq(stmt_at(rec, 3)->assign.to, b);
+
+  // result of call is not used anymore
+  cr_expect_eq(vec_mir_value_size(sub->defined.tmps), 3);
+
+  mir_free(mir);
+}
+
+Test(tail_call, sibling, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *g   = sub_new(mir->defined_subs);
+  mir_subroutine *f   = sub_new(mir->defined_subs);
+
+  mir_value *a = param(f);
+  mir_value *r = tmp(f, NULL);
+  mir_value *u = tmp(f, NULL);
+
+  mir_bb *entry = bb(f, 0);
+  mir_bb *last  = bb(f, 1);
+  mir_bb *other = bb(f, 2);
+
+  vec_mir_stmt_push_back(entry->stmts, call(r, g, a, a));
+  vec_mir_stmt_push_back(entry->stmts, ret_assign(f, r));
+  entry->jmp.next_ref = last;
+
+  // result is used after the call returns
+  vec_mir_stmt_push_back(other->stmts, call(u, g, a, a));
+  vec_mir_stmt_push_back(other->stmts, ret_assign(f, u));
+  vec_mir_stmt_push_back(other->stmts, ret_assign(f, u));
+
+  mir_tail_call_result result = mir_tail_call(mir);
+  list_exception_free(result.exceptions);
+
+  cr_assert_eq(vec_mir_stmt_size(entry->stmts), 1);
+  cr_expect_eq(stmt_at(entry, 0)->kind, MIR_STMT_CALL);
+  cr_expect_eq(stmt_at(entry, 0)->call.ret, f->defined.ret);
+
+  cr_expect_eq(vec_mir_stmt_size(other->stmts), 3);
+  cr_expect_eq(stmt_at(other, 0)->call.ret, u);
+
+  mir_free(mir);
+}
+
+Test(tail_call, method, .init = setup, .fini = teardown) {
+  mir            *mir = mir_new();
+  mir_subroutine *g   = sub_new(mir->defined_subs);
+  mir_subroutine *f   = sub_new(mir->methods);
+
+  mir_value *a = param(f);
+  mir_value *r = tmp(f, NULL);
+
+  mir_bb *entry = bb(f, 0);
+
+  vec_mir_stmt_push_back(entry->stmts, call(r, g, a, a));
+  vec_mir_stmt_push_back(entry->stmts, ret_assign(f, r));
+
+  mir_tail_call_result result = mir_tail_call(mir);
+  list_exception_free(result.exceptions);
+
+  cr_assert_eq(vec_mir_stmt_size(entry->stmts), 1);
+  cr_expect_eq(stmt_at(entry, 0)->call.ret, f->defined.ret);
+
+  mir_free(mir);
+}
@@ -0,0 +1,95 @@
+#include <criterion/criterion.h>
+
+#include "compiler/type_table/type_table.h"
+#include <string.h>
+
+static type_table *types;
+
+static void setup(void) { types = type_table_new(); }
+
+static void teardown(void) { type_table_free(types); }
+
+static type_entry *intern_int(void) {
+  return type_table_intern(
+      types, (type_base *)type_primitive_new(TYPE_PRIMITIVE_INT), NULL);
+}
+
+Test(type_table, intern_structural, .init = setup, .fini = teardown) {
+  type_entry *int_l = intern_int();
+  type_entry *int_r = intern_int();
+  cr_expect_eq(int_l, int_r);
+
+  type_entry *arr_l = type_table_intern(
+      types, (type_base *)type_array_new(int_l->type), NULL);
+  type_entry *arr_r = type_table_intern(
+      types, (type_base *)type_array_new(int_r->type), NULL);
+  cr_expect_eq(arr_l, arr_r);
+  cr_expect_neq(arr_l, int_l);
+
+  list_type_ref *params = list_type_ref_new();
+  list_type_ref_push_back(params, arr_l->type);
+  type_entry *callable =
+      type_table_intern(types, (type_base *)type_callable_new(NULL, params),
+                        NULL);
+  cr_expect_eq(type_table_find(types, callable->type), callable);
+
+  cr_expect_eq(list_type_entry_size(types->entries), 3);
+}
+
+Test(type_table, emplace_declarations, .init = setup, .fini = teardown) {
+  // class C and class C<T> share id, but are different declarations
+  type_entry *class_l = type_table_emplace(
+      types,
+      (type_base *)type_class_t_new(strdup("C"), list_type_ref_new(),
+                                    list_type_ref_new()),
+      NULL);
+  type_entry *class_r = type_table_emplace(
+      types,
+      (type_base *)type_class_t_new(strdup("C"), list_type_ref_new(),
+                                    list_type_ref_new()),
+      NULL);
+  cr_expect_neq(class_l, class_r);
+  cr_expect_null(type_table_find(types, class_l->type));
+
+  list_type_ref *types_l = list_type_ref_new();
+  list_type_ref_push_back(types_l, intern_int()->type);
+  list_type_ref *types_r = list_type_ref_new();
+  list_type_ref_push_back(types_r, intern_int()->type);
+
+  type_entry *mono_l = type_table_intern(
+      types, (type_base *)type_mono_new(class_l->type, types_l), NULL);
+  type_entry *mono_r = type_table_intern(
+      types, (type_base *)type_mono_new(class_r->type, types_r), NULL);
+  cr_expect_neq(mono_l, mono_r);
+}
+
+Test(type_table, reindex, .init = setup, .fini = teardown) {
+  type_entry *class_l = type_table_emplace(
+      types,
+      (type_base *)type_class_t_new(strdup("C"), list_type_ref_new(),
+                                    list_type_ref_new()),
+      NULL);
+  type_entry *class_r = type_table_emplace(
+      types,
+      (type_base *)type_class_t_new(strdup("C"), list_type_ref_new(),
+                                    list_type_ref_new()),
+      NULL);
+
+  type_entry *mono = type_table_intern(
+      types, (type_base *)type_mono_new(class_l->type, list_type_ref_new()),
+      NULL);
+
+  type_table_unindex(types, mono->type);
+  ((type_mono *)mono->type)->type_ref = class_r->type;
+  type_table_reindex(types, mono->type);
+
+  // mono changed in place is found by its new structure
+  type_entry *found = type_table_intern(
+      types, (type_base *)type_mono_new(class_r->type, list_type_ref_new()),
+      NULL);
+  cr_expect_eq(found, mono);
+
+  type_mono *probe = type_mono_new(class_l->type, list_type_ref_new());
+  cr_expect_null(type_table_find(types, (type_base *)probe));
+  type_free((type_base *)probe);
+}
@@ -1,6 +1,9 @@
 #include <criterion/criterion.h>
 
 #include "util/file.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 
 Test(file, dirname) {
   char *filename, *dir;
@@ -48,3 +51,31 @@ Test(file, join) {
   free(dir);
   free(path);
 }
+
+Test(file, map) {
+  char  path[] = "/tmp/natrix_file_XXXXXX";
+  int   fd     = mkstemp(path);
+  FILE *f      = fdopen(fd, "wb");
+  cr_assert(f);
+  fputs("line 1\nline 2", f);
+  fclose(f);
+
+  file_map map;
+  cr_assert_eq(file_map_open(&map, path), 0);
+  cr_expect(map.mapped);
+  cr_expect_eq(map.len, 13);
+  cr_expect_eq(memcmp(map.chars, "line 1\nline 2", 13), 0);
+  file_map_close(&map);
+  cr_expect_null(map.chars);
+
+  // empty file can't be mapped
+  f = fopen(path, "wb");
+  fclose(f);
+  cr_assert_eq(file_map_open(&map, path), 0);
+  cr_expect_not(map.mapped);
+  cr_expect_eq(map.len, 0);
+  file_map_close(&map);
+
+  unlink(path);
+  cr_expect_eq(file_map_open(&map, path), -1);
+}
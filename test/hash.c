@@ -0,0 +1,24 @@
+#include <criterion/criterion.h>
+
+#include "util/hash.h"
+
+Test(hash, bytes) {
+  // reference values of 64-bit FNV-1a
+  cr_expect_eq(hash_bytes(HASH_SEED, "", 0), 0xcbf29ce484222325ull);
+  cr_expect_eq(hash_bytes(HASH_SEED, "a", 1), 0xaf63dc4c8601ec8cull);
+  cr_expect_eq(hash_bytes(HASH_SEED, "foobar", 6), 0x85944171f73967e8ull);
+}
+
+Test(hash, chars) {
+  uint64_t ab_c = hash_chars(hash_chars(HASH_SEED, "ab"), "c");
+  uint64_t a_bc = hash_chars(hash_chars(HASH_SEED, "a"), "bc");
+
+  cr_expect_neq(ab_c, a_bc);
+  cr_expect_neq(hash_chars(HASH_SEED, NULL), hash_chars(HASH_SEED, ""));
+}
+
+Test(hash, uint64) {
+  cr_expect_eq(hash_uint64(HASH_SEED, 1),
+               hash_bytes(HASH_SEED, "\1\0\0\0\0\0\0\0", 8));
+  cr_expect_neq(hash_uint64(HASH_SEED, 1), hash_uint64(HASH_SEED, 2));
+}
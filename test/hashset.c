@@ -4,6 +4,7 @@
 
 #include "util/container_util.h"
 #include "util/hashset.h"
+#include "util/macro.h"
 
 HASHSET_DECLARE_STATIC_INLINE(hashset_char_char, chars_chars,
                               container_cmp_chars_chars,
@@ -148,3 +149,41 @@ Test(hashset, char_char_erase) {
 
   hashset_char_char_free(hashset);
 }
+
+Test(hashset, erase_find) {
+  hashset_char_char *hashset = hashset_char_char_new();
+
+  char key[10];
+  char value[10];
+
+  chars_chars data = {.key = key, .value = value};
+
+  for (int i = 0; i < 1000; ++i) {
+    sprintf(key, "%d", i);
+    sprintf(value, "%d", i + 1000);
+    hashset_char_char_insert(hashset, &data);
+  }
+
+  for (int i = 0; i < 1000; i += 2) {
+    sprintf(key, "%d", i);
+    hashset_char_char_it it = hashset_char_char_find(hashset, &data);
+    cr_assert_not(END(it));
+    hashset_char_char_erase(hashset, it);
+  }
+  cr_expect_eq(hashset->hashset.size, 500);
+
+  // elements after erased ones are still reachable
+  for (int i = 0; i < 1000; ++i) {
+    sprintf(key, "%d", i);
+    hashset_char_char_it it = hashset_char_char_find(hashset, &data);
+    if (i % 2) {
+      cr_expect_not(END(it));
+      sprintf(value, "%d", i + 1000);
+      cr_expect_str_eq(GET(it)->value, value);
+    } else {
+      cr_expect(END(it));
+    }
+  }
+
+  hashset_char_char_free(hashset);
+}
@@ -0,0 +1,183 @@
+#include <criterion/criterion.h>
+
+#include <time.h>
+
+#include "util/container_util.h"
+#include "util/hashset.h"
+#include "util/macro.h"
+
+// micro-benchmark of util/hashset against separate chaining it replaced,
+// timings are logged, results of both tables are compared
+
+#define BENCH_CNT 200000
+#define BENCH_ROUNDS 5
+
+// CHAINED
+typedef struct chained_node_struct {
+  void                       *data;
+  struct chained_node_struct *next;
+} chained_node;
+
+typedef struct chained_struct {
+  chained_node **buckets;
+  size_t         capacity;
+  size_t         size;
+
+  container_f_cmp  *f_cmp;
+  container_f_hash *f_hash;
+} chained;
+
+static chained *chained_new(container_f_cmp f_cmp, container_f_hash f_hash) {
+  chained *self  = MALLOC(chained);
+  self->capacity = HASHTABLE_INITIAL_CAPACITY;
+  self->size     = 0;
+  self->buckets  = calloc(self->capacity, sizeof(chained_node *));
+  self->f_cmp    = f_cmp;
+  self->f_hash   = f_hash;
+  return self;
+}
+
+static void chained_free(chained *self) {
+  chained_node *next;
+  for (size_t i = 0; i < self->capacity; ++i) {
+    for (chained_node *node = self->buckets[i]; node; node = next) {
+      next = node->next;
+      free(node);
+    }
+  }
+  free(self->buckets);
+  free(self);
+}
+
+static void chained_grow(chained *self) {
+  size_t         capacity = self->capacity * 2;
+  chained_node **buckets  = calloc(capacity, sizeof(chained_node *));
+
+  chained_node *next;
+  for (size_t i = 0; i < self->capacity; ++i) {
+    for (chained_node *node = self->buckets[i]; node; node = next) {
+      next         = node->next;
+      size_t idx   = self->f_hash(node->data) % capacity;
+      node->next   = buckets[idx];
+      buckets[idx] = node;
+    }
+  }
+  free(self->buckets);
+  self->buckets  = buckets;
+  self->capacity = capacity;
+}
+
+static chained_node *chained_find(chained *self, void *data) {
+  size_t idx = self->f_hash(data) % self->capacity;
+  for (chained_node *node = self->buckets[idx]; node; node = node->next) {
+    if (!self->f_cmp(node->data, data)) {
+      return node;
+    }
+  }
+  return NULL;
+}
+
+static void chained_insert(chained *self, void *data) {
+  if ((double)self->size / self->capacity > HASHTABLE_LOAD_FACTOR) {
+    chained_grow(self);
+  }
+  if (chained_find(self, data)) {
+    return;
+  }
+  size_t        idx  = self->f_hash(data) % self->capacity;
+  chained_node *node = MALLOC(chained_node);
+  node->data         = data;
+  node->next         = self->buckets[idx];
+  self->buckets[idx] = node;
+  self->size += 1;
+}
+
+// BENCH
+static uint64_t keys[BENCH_CNT];
+static size_t   order[BENCH_CNT]; // lookups are made in shuffled order
+
+static void setup(void) {
+  uint64_t state = 1;
+  for (size_t i = 0; i < BENCH_CNT; ++i) {
+    order[i] = i;
+  }
+  for (size_t i = BENCH_CNT - 1; i > 0; --i) {
+    state    = state * 6364136223846793005ull + 1442695040888963407ull;
+    size_t j = (state >> 33) % (i + 1);
+    size_t t = order[i];
+    order[i] = order[j];
+    order[j] = t;
+  }
+}
+
+static double bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static size_t bench_hashset(double *elapsed) {
+  double   start   = bench_now();
+  hashset *hashset = hashset_new(container_cmp_ptr, container_new_move,
+                                 container_delete_false, container_hash_ptr);
+
+  for (size_t i = 0; i < BENCH_CNT; ++i) {
+    hashset_insert(hashset, &keys[i]);
+  }
+
+  size_t found = 0;
+  for (size_t r = 0; r < BENCH_ROUNDS; ++r) {
+    for (size_t i = 0; i < BENCH_CNT; ++i) {
+      hashset_it it = hashset_find(hashset, &keys[order[i]]);
+      found += !hashset_it_end(&it);
+    }
+    // misses
+    for (size_t i = 0; i < BENCH_CNT; ++i) {
+      hashset_it it = hashset_find(hashset, (char *)&keys[order[i]] + 1);
+      found += !hashset_it_end(&it);
+    }
+  }
+
+  hashset_free(hashset);
+  *elapsed = bench_now() - start;
+  return found;
+}
+
+static size_t bench_chained(double *elapsed) {
+  double   start   = bench_now();
+  chained *chained = chained_new(container_cmp_ptr, container_hash_ptr);
+
+  for (size_t i = 0; i < BENCH_CNT; ++i) {
+    chained_insert(chained, &keys[i]);
+  }
+
+  size_t found = 0;
+  for (size_t r = 0; r < BENCH_ROUNDS; ++r) {
+    for (size_t i = 0; i < BENCH_CNT; ++i) {
+      found += chained_find(chained, &keys[order[i]]) != NULL;
+    }
+    for (size_t i = 0; i < BENCH_CNT; ++i) {
+      found += chained_find(chained, (char *)&keys[order[i]] + 1) != NULL;
+    }
+  }
+
+  chained_free(chained);
+  *elapsed = bench_now() - start;
+  return found;
+}
+
+Test(hashset_bench, ptr_insert_find, .init = setup) {
+  double elapsed_hashset;
+  double elapsed_chained;
+
+  size_t found_chained = bench_chained(&elapsed_chained);
+  size_t found_hashset = bench_hashset(&elapsed_hashset);
+
+  cr_expect_eq(found_hashset, (size_t)BENCH_CNT * BENCH_ROUNDS);
+  cr_expect_eq(found_hashset, found_chained);
+
+  cr_log_info("%d pointers, %d rounds of hits and misses", BENCH_CNT,
+              BENCH_ROUNDS);
+  cr_log_info("chained:         %.3fs", elapsed_chained);
+  cr_log_info("open addressing: %.3fs", elapsed_hashset);
+}
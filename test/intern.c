@@ -0,0 +1,56 @@
+#include <criterion/criterion.h>
+
+#include "util/intern.h"
+#include "util/parallel.h"
+#include <stdio.h>
+#include <string.h>
+
+Test(intern, unique) {
+  char buf[] = "name";
+
+  const char *a = intern("name");
+  const char *b = intern(buf);
+  const char *c = intern("other");
+
+  cr_expect_eq(a, b);
+  cr_expect_neq(a, c);
+  cr_expect_neq((const char *)buf, a);
+  cr_expect_str_eq(a, "name");
+  cr_expect_eq(intern_size(), 2);
+
+  intern_free();
+}
+
+Test(intern, not_terminated) {
+  const char *text = "first second";
+
+  const char *first  = intern_n(text, 5);
+  const char *second = intern_n(text + 6, 6);
+
+  cr_expect_str_eq(first, "first");
+  cr_expect_str_eq(second, "second");
+  cr_expect_eq(first, intern("first"));
+  cr_expect_eq(intern_n(text, 0), intern(""));
+
+  intern_free();
+}
+
+static const char *interned[64];
+
+static void intern_task(void *arg, size_t idx) {
+  (void)arg;
+  char buf[32];
+  snprintf(buf, sizeof(buf), "name_%zu", idx % 8);
+  interned[idx] = intern(buf);
+}
+
+Test(intern, parallel) {
+  parallel_for(64, 8, intern_task, NULL);
+
+  for (size_t i = 0; i < 64; ++i) {
+    cr_expect_eq(interned[i], interned[i % 8]);
+  }
+  cr_expect_eq(intern_size(), 8);
+
+  intern_free();
+}
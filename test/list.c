@@ -158,3 +158,53 @@ Test(list, push_front) {
 
   list_free(list);
 }
+
+Test(list, splice_back) {
+  list *head = list_new(container_cmp_chars_chars, container_new_chars_chars,
+                        container_delete_chars_chars);
+  list *tail = list_new(container_cmp_chars_chars, container_new_chars_chars,
+                        container_delete_chars_chars);
+
+  chars_chars data = {.key = "key1", .value = "value1"};
+  list_push_back(head, &data);
+  data.key = "key2";
+  list_push_back(tail, &data);
+  data.key = "key3";
+  list_push_back(tail, &data);
+
+  list_splice_back(head, tail);
+
+  cr_expect(list_empty(tail));
+  cr_expect_eq(3, list_size(head));
+  cr_expect_str_eq("key1", ((chars_chars *)list_front(head))->key);
+  cr_expect_str_eq("key3", ((chars_chars *)list_back(head))->key);
+
+  // spliced back and forth through empty list
+  list_splice_back(tail, head);
+  list_splice_back(head, tail);
+  cr_expect_eq(3, list_size(head));
+  cr_expect_str_eq("key3", ((chars_chars *)list_back(head))->key);
+
+  list_free(tail);
+  list_free(head);
+}
+
+Test(list, arena) {
+  arena *arena = arena_new(0);
+  list  *list  = ARENA_MALLOC(arena, typeof(*list));
+  list_init_arena(list, arena, container_cmp_false, container_new_move,
+                  container_delete_false);
+
+  chars_chars data1 = {.key = "key1", .value = "value1"};
+  chars_chars data2 = {.key = "key2", .value = "value2"};
+  list_push_back(list, &data1);
+  list_push_front(list, &data2);
+
+  cr_expect_eq(2, list_size(list));
+  cr_expect_str_eq("key2", ((chars_chars *)list_pop_front(list))->key);
+  cr_expect_str_eq("key1", ((chars_chars *)list_front(list))->key);
+
+  list_deinit(list);
+  cr_expect(list_empty(list));
+  arena_free(arena);
+}
@@ -28,3 +28,15 @@ Test(string_buffer, test2) {
   char *data = strbuf_detach(buffer);
   free(data);
 }
+
+Test(string_buffer, append_n) {
+  strbuf *buffer = strbuf_new(4, 0);
+
+  strbuf_append_n(buffer, "hello, world!", 5);
+  strbuf_append(buffer, ", ");
+  strbuf_append_n(buffer, "world!\nhello", 6);
+  cr_expect_str_eq(strbuf_data(buffer), "hello, world!");
+  cr_expect_eq(strbuf_size(buffer), 13);
+
+  strbuf_free(buffer);
+}
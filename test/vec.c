@@ -0,0 +1,144 @@
+#include <criterion/criterion.h>
+
+#include "util/container_util.h"
+#include "util/macro.h"
+#include "util/vec.h"
+
+VEC_DECLARE_STATIC_INLINE(vec_uint64, uint64_t, container_cmp_uint64,
+                          container_new_move, container_delete_false);
+
+static uint64_t values[100];
+
+static void setup(void) {
+  for (size_t i = 0; i < 100; ++i) {
+    values[i] = i;
+  }
+}
+
+Test(vec, push_back_at, .init = setup) {
+  vec_uint64 *vec = vec_uint64_new();
+
+  for (size_t i = 0; i < 100; ++i) {
+    vec_uint64_push_back(vec, &values[i]);
+  }
+
+  cr_expect_eq(vec_uint64_size(vec), 100);
+  for (size_t i = 0; i < 100; ++i) {
+    cr_expect_eq(*vec_uint64_at(vec, i), i);
+  }
+  cr_expect_eq(*vec_uint64_front(vec), 0);
+  cr_expect_eq(*vec_uint64_back(vec), 99);
+
+  vec_uint64_free(vec);
+}
+
+Test(vec, pop_push_front, .init = setup) {
+  vec_uint64 *vec = vec_uint64_new();
+
+  for (size_t i = 0; i < 10; ++i) {
+    vec_uint64_push_back(vec, &values[i]);
+  }
+  cr_expect_eq(*vec_uint64_pop_front(vec), 0);
+  cr_expect_eq(*vec_uint64_pop_front(vec), 1);
+  cr_expect_eq(*vec_uint64_pop_back(vec), 9);
+  cr_expect_eq(vec_uint64_size(vec), 7);
+
+  // front space left by pop is reused
+  vec_uint64_push_front(vec, &values[50]);
+  vec_uint64_push_front(vec, &values[51]);
+  vec_uint64_push_front(vec, &values[52]);
+  cr_expect_eq(vec_uint64_size(vec), 10);
+  cr_expect_eq(*vec_uint64_at(vec, 0), 52);
+  cr_expect_eq(*vec_uint64_at(vec, 3), 2);
+
+  while (!vec_uint64_empty(vec)) {
+    vec_uint64_pop_front(vec);
+  }
+  cr_expect_null(vec_uint64_front(vec));
+
+  vec_uint64_free(vec);
+}
+
+Test(vec, iterate_push_back, .init = setup) {
+  vec_uint64 *vec = vec_uint64_new();
+
+  vec_uint64_push_back(vec, &values[0]);
+
+  // iterator is valid after elements are pushed during iteration
+  size_t cnt = 0;
+  for (vec_uint64_it it = vec_uint64_begin(vec); !END(it); NEXT(it), ++cnt) {
+    uint64_t value = *GET(it);
+    cr_expect_eq(value, cnt);
+    if (value + 1 < 100) {
+      vec_uint64_push_back(vec, &values[value + 1]);
+    }
+  }
+  cr_expect_eq(cnt, 100);
+
+  vec_uint64_free(vec);
+}
+
+Test(vec, find_insert, .init = setup) {
+  vec_uint64 *vec = vec_uint64_new();
+
+  for (size_t i = 0; i < 10; ++i) {
+    vec_uint64_push_back(vec, &values[i]);
+  }
+
+  vec_uint64_it it = vec_uint64_find(vec, &values[5]);
+  cr_expect_not(END(it));
+  vec_uint64_insert(vec, it, &values[50]);
+  cr_expect_eq(*vec_uint64_at(vec, 5), 50);
+
+  it = vec_uint64_find(vec, &values[5]);
+  cr_expect(END(it));
+  vec_uint64_insert(vec, it, &values[5]);
+  cr_expect_eq(*vec_uint64_back(vec), 5);
+  cr_expect_eq(vec_uint64_size(vec), 11);
+
+  vec_uint64_free(vec);
+}
+
+Test(vec, splice_back, .init = setup) {
+  vec_uint64 *vec   = vec_uint64_new();
+  vec_uint64 *other = vec_uint64_new();
+
+  for (size_t i = 0; i < 5; ++i) {
+    vec_uint64_push_back(vec, &values[i]);
+  }
+  for (size_t i = 5; i < 100; ++i) {
+    vec_uint64_push_back(other, &values[i]);
+  }
+  vec_uint64_pop_front(other);
+
+  vec_uint64_splice_back(vec, other);
+  cr_expect(vec_uint64_empty(other));
+  cr_expect_eq(vec_uint64_size(vec), 99);
+  cr_expect_eq(*vec_uint64_at(vec, 5), 6);
+  cr_expect_eq(*vec_uint64_back(vec), 99);
+
+  vec_uint64_free(other);
+  vec_uint64_free(vec);
+}
+
+Test(vec, arena, .init = setup) {
+  arena      *arena = arena_new(0);
+  vec_uint64 *vec   = vec_uint64_new_arena(arena);
+
+  // grows by copying data to new place of arena
+  for (size_t i = 0; i < 100; ++i) {
+    vec_uint64_push_back(vec, &values[i]);
+  }
+  cr_expect_eq(vec_uint64_size(vec), 100);
+  for (size_t i = 0; i < 100; ++i) {
+    cr_expect_eq(*vec_uint64_at(vec, i), i);
+  }
+
+  vec_uint64_push_front(vec, &values[50]);
+  cr_expect_eq(*vec_uint64_front(vec), 50);
+  cr_expect_eq(*vec_uint64_at(vec, 100), 99);
+
+  // no-op, memory is released with arena
+  vec_uint64_free(vec);
+  arena_free(arena);
+}
@@ -0,0 +1,56 @@
+.section .data
+.section .text
+.extern __x86_64_flush
+.extern __x86_64_make_void
+.extern __x86_64_make_bool
+.extern __x86_64_make_byte
+.extern __x86_64_make_int
+.extern __x86_64_make_uint
+.extern __x86_64_make_long
+.extern __x86_64_make_ulong
+.extern __x86_64_make_char
+.extern __x86_64_make_string
+.extern __x86_64_make_callable
+.extern __x86_64_make_array
+.extern __x86_64_make_array_frame
+.extern __x86_64_make_object
+.extern __x86_64_make_object_setup
+.extern __x86_64_make_object_setup_frame
+.extern __x86_64_make_error
+.extern __x86_64_print
+.extern __x86_64_unwrap_void
+.extern __x86_64_unwrap_bool
+.extern __x86_64_unwrap_byte
+.extern __x86_64_unwrap_int
+.extern __x86_64_unwrap_uint
+.extern __x86_64_unwrap_long
+.extern __x86_64_unwrap_ulong
+.extern __x86_64_unwrap_char
+.extern __x86_64_unwrap_string
+.extern std_write
+.extern std_read_bool
+.extern std_read_byte
+.extern std_read_char
+.extern std_read_int
+.extern std_read_uint
+.extern std_read_long
+.extern std_read_ulong
+.extern std_read_string
+.extern std_write_bool
+.extern std_write_byte
+.extern std_write_char
+.extern std_write_int
+.extern std_write_uint
+.extern std_write_long
+.extern std_write_ulong
+.extern std_write_string
+.extern std_test_first
+.extern std_test_args
+.extern std_abs
+.section .u_debug_info
+.quad 0
+.quad 0
+.section .u_debug_line
+.quad 0
+.section .u_debug_str
+.quad 0
@@ -0,0 +1,262 @@
+.section .data
+.L_class_init_0_name_0: .ascii "e\0"
+.L_class_init_0_name_1: .ascii "n\0"
+.L_class_init_0_name_2: .ascii "f\0"
+.L_class_init_0_name_3: .ascii "a\0"
+.L_class_init_0_name_4: .ascii "b\0"
+.L_class_init_0_name_5: .ascii "c\0"
+.L_class_init_0_symbols: 
+.quad 0x6
+.quad .L_class_init_0_name_0
+.quad .L_class_init_0_name_1
+.quad .L_class_init_0_name_2
+.quad .L_class_init_0_name_3
+.quad .L_class_init_0_name_4
+.quad .L_class_init_0_name_5
+.L_class_init_1_name_0: .ascii "e\0"
+.L_class_init_1_name_1: .ascii "n\0"
+.L_class_init_1_symbols: 
+.quad 0x2
+.quad .L_class_init_1_name_0
+.quad .L_class_init_1_name_1
+.L_class_init_2_name_0: .ascii "f\0"
+.L_class_init_2_symbols: 
+.quad 0x1
+.quad .L_class_init_2_name_0
+.L_class_init_3_name_0: .ascii "e\0"
+.L_class_init_3_name_1: .ascii "n\0"
+.L_class_init_3_symbols: 
+.quad 0x2
+.quad .L_class_init_3_name_0
+.quad .L_class_init_3_name_1
+.L_class_init_4_name_0: .ascii "f\0"
+.L_class_init_4_symbols: 
+.quad 0x1
+.quad .L_class_init_4_name_0
+.L_class_init_5_symbols: 
+.quad 0
+.section .text
+.extern __x86_64_flush
+.extern __x86_64_make_void
+.extern __x86_64_make_bool
+.extern __x86_64_make_byte
+.extern __x86_64_make_int
+.extern __x86_64_make_uint
+.extern __x86_64_make_long
+.extern __x86_64_make_ulong
+.extern __x86_64_make_char
+.extern __x86_64_make_string
+.extern __x86_64_make_callable
+.extern __x86_64_make_array
+.extern __x86_64_make_array_frame
+.extern __x86_64_make_object
+.extern __x86_64_make_object_setup
+.extern __x86_64_make_object_setup_frame
+.extern __x86_64_make_error
+.extern __x86_64_print
+.extern __x86_64_unwrap_void
+.extern __x86_64_unwrap_bool
+.extern __x86_64_unwrap_byte
+.extern __x86_64_unwrap_int
+.extern __x86_64_unwrap_uint
+.extern __x86_64_unwrap_long
+.extern __x86_64_unwrap_ulong
+.extern __x86_64_unwrap_char
+.extern __x86_64_unwrap_string
+.extern read
+.extern write
+.extern std_write
+.extern std_read_bool
+.extern std_read_byte
+.extern std_read_char
+.extern std_read_int
+.extern std_read_uint
+.extern std_read_long
+.extern std_read_ulong
+.extern std_read_string
+.extern std_write_bool
+.extern std_write_byte
+.extern std_write_char
+.extern std_write_int
+.extern std_write_uint
+.extern std_write_long
+.extern std_write_ulong
+.extern std_write_string
+.extern std_test_first
+.extern std_test_args
+.extern std_abs
+.globl main
+main:
+.Lmain_S:
+  pushq %rbp
+  movq %rsp, %rbp
+.Lmain_init:
+  subq $0x60, %rsp
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x30(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_make_void
+.Lmain_bb0:
+.Lmain_L_0:
+  leaq -0x30(%rbp), %rdi
+  xorq %rsi, %rsi
+  call .L_class_init_0
+.Lmain_L_1:
+  leaq -0x48(%rbp), %rdi
+  movq $0, %rsi
+  call __x86_64_make_long
+.Lmain_L_2:
+  leaq -0x60(%rbp), %rdi
+  leaq -0x48(%rbp), %rsi
+  movl $0x6, %edx
+  movq -0x40(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_3:
+  leaq -0x60(%rbp), %rsi
+  leaq -0x18(%rbp), %rdi
+  movq -0x10(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_deinit:
+  movq -0x28(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x30(%rbp), %rdi
+  call *%rax
+  movq -0x40(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x48(%rbp), %rdi
+  call *%rax
+  movq -0x58(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x60(%rbp), %rdi
+  call *%rax
+.Lmain_epilogue:
+  call __x86_64_flush
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movl %eax, %edi
+  movq $0x3c, %rax
+  syscall
+.Lmain_E:
+.L_class_init_0:
+  pushq %rdi
+  pushq %rsi
+  subq $0x98, %rsp
+  leaq 0(%rsp), %rdi
+  call __x86_64_make_void
+  leaq 0x18(%rsp), %rdi
+  call __x86_64_make_void
+  leaq 0x30(%rsp), %rdi
+  call __x86_64_make_void
+  leaq 0x48(%rsp), %rdi
+  call __x86_64_make_void
+  leaq 0x60(%rsp), %rdi
+  call __x86_64_make_void
+  leaq 0x78(%rsp), %rdi
+  call __x86_64_make_void
+  movq 0xa0(%rsp), %rdi
+  movq 0x98(%rsp), %rcx
+  leaq .L_class_init_0_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0xa8, %rsp
+  retq
+.L_class_init_1:
+  pushq %rdi
+  pushq %rsi
+  subq $0x38, %rsp
+  leaq 0(%rsp), %rdi
+  call __x86_64_make_void
+  leaq 0x18(%rsp), %rdi
+  call __x86_64_make_void
+  movq 0x40(%rsp), %rdi
+  movq 0x38(%rsp), %rcx
+  leaq .L_class_init_1_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x48, %rsp
+  retq
+.L_class_init_2:
+  pushq %rdi
+  pushq %rsi
+  subq $0x18, %rsp
+  leaq 0(%rsp), %rdi
+  call __x86_64_make_void
+  movq 0x20(%rsp), %rdi
+  movq 0x18(%rsp), %rcx
+  leaq .L_class_init_2_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x28, %rsp
+  retq
+.L_class_init_3:
+  pushq %rdi
+  pushq %rsi
+  subq $0x38, %rsp
+  leaq 0(%rsp), %rdi
+  call __x86_64_make_void
+  leaq 0x18(%rsp), %rdi
+  call __x86_64_make_void
+  movq 0x40(%rsp), %rdi
+  movq 0x38(%rsp), %rcx
+  leaq .L_class_init_3_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x48, %rsp
+  retq
+.L_class_init_4:
+  pushq %rdi
+  pushq %rsi
+  subq $0x18, %rsp
+  leaq 0(%rsp), %rdi
+  call __x86_64_make_void
+  movq 0x20(%rsp), %rdi
+  movq 0x18(%rsp), %rcx
+  leaq .L_class_init_4_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x28, %rsp
+  retq
+.L_class_init_5:
+  pushq %rdi
+  pushq %rsi
+  subq $0x8, %rsp
+  movq 0x10(%rsp), %rdi
+  movq 0x8(%rsp), %rcx
+  leaq .L_class_init_5_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x18, %rsp
+  retq
+.section .u_debug_info
+.quad 0x1
+.quad 0x1
+.quad .Lmain_S
+.quad .Lmain_E
+.quad 0x1
+.quad 0
+.quad 0
+.quad 0
+.section .u_debug_line
+.quad 0x4
+.quad .Lmain_L_0
+.quad 0
+.quad 0x36
+.quad .Lmain_L_1
+.quad 0
+.quad 0x37
+.quad .Lmain_L_2
+.quad 0
+.quad 0x37
+.quad .Lmain_L_3
+.quad 0
+.quad 0x37
+.section .u_debug_str
+.quad 0x2
+.ascii "/root/repo/io/suite20.txt\0"
+.ascii "main\0"
@@ -0,0 +1,642 @@
+.section .data
+.L_lit_0: .ascii "Recursion!\0"
+.L_lit_1: .ascii "fun2!\0"
+.L_lit_2: .ascii "rec_2_1\0"
+.L_lit_3: .ascii "rec_2_2\0"
+.L_lit_4: .ascii "fun1 call\0"
+.L_lit_5: .ascii "arg2\0"
+.L_lit_6: .ascii "fun1 call\0"
+.L_lit_7: .ascii "arg2\0"
+.section .text
+.extern __x86_64_flush
+.extern __x86_64_make_void
+.extern __x86_64_make_bool
+.extern __x86_64_make_byte
+.extern __x86_64_make_int
+.extern __x86_64_make_uint
+.extern __x86_64_make_long
+.extern __x86_64_make_ulong
+.extern __x86_64_make_char
+.extern __x86_64_make_string
+.extern __x86_64_make_callable
+.extern __x86_64_make_array
+.extern __x86_64_make_array_frame
+.extern __x86_64_make_object
+.extern __x86_64_make_object_setup
+.extern __x86_64_make_object_setup_frame
+.extern __x86_64_make_error
+.extern __x86_64_print
+.extern __x86_64_unwrap_void
+.extern __x86_64_unwrap_bool
+.extern __x86_64_unwrap_byte
+.extern __x86_64_unwrap_int
+.extern __x86_64_unwrap_uint
+.extern __x86_64_unwrap_long
+.extern __x86_64_unwrap_ulong
+.extern __x86_64_unwrap_char
+.extern __x86_64_unwrap_string
+.extern std_write
+.extern std_read_bool
+.extern std_read_byte
+.extern std_read_char
+.extern std_read_int
+.extern std_read_uint
+.extern std_read_long
+.extern std_read_ulong
+.extern std_read_string
+.extern std_write_bool
+.extern std_write_byte
+.extern std_write_char
+.extern std_write_int
+.extern std_write_uint
+.extern std_write_long
+.extern std_write_ulong
+.extern std_write_string
+.extern std_test_first
+.extern std_test_args
+.extern std_abs
+.globl fun1
+.globl fun2
+.globl main
+fun1:
+.Lfun1_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+  pushq %rdx
+.Lfun1_copy:
+  subq $0x28, %rsp
+  leaq -0x38(%rbp), %rdi
+  movq -0x18(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.Lfun1_init:
+  subq $0x60, %rsp
+  leaq -0x58(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x70(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x88(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xa0(%rbp), %rdi
+  call __x86_64_make_void
+.Lfun1_bb0:
+.Lfun1_L_0:
+  leaq -0x70(%rbp), %rdi
+  leaq .L_lit_0(%rip), %rsi
+  call __x86_64_make_string
+.Lfun1_L_1:
+  leaq -0x70(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x20(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_print
+.Lfun1_L_2:
+  leaq -0xa0(%rbp), %rdi
+  leaq fun1(%rip), %rsi
+  call __x86_64_make_callable
+.Lfun1_L_3:
+  leaq -0xa0(%rbp), %rsi
+  leaq -0x58(%rbp), %rdi
+  movq -0x50(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lfun1_L_4:
+  leaq -0x58(%rbp), %rsi
+  movq -0x8(%rbp), %rdi
+  movq -0x8(%rbp), %rax
+  movq 0x8(%rax), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lfun1_deinit:
+  movq -0x50(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x58(%rbp), %rdi
+  call *%rax
+  movq -0x68(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x70(%rbp), %rdi
+  call *%rax
+  movq -0x80(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x88(%rbp), %rdi
+  call *%rax
+  movq -0x98(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xa0(%rbp), %rdi
+  call *%rax
+.Lfun1_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.Lfun1_E:
+fun2:
+.Lfun2_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+  pushq %rdx
+  pushq %rcx
+  pushq %r8
+  pushq %r9
+  pushq 0x10(%rbp)
+  pushq 0x18(%rbp)
+.Lfun2_copy:
+  subq $0x70, %rsp
+  leaq -0xb0(%rbp), %rdi
+  movq -0x40(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x98(%rbp), %rdi
+  movq -0x38(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x80(%rbp), %rdi
+  movq -0x30(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x68(%rbp), %rdi
+  movq -0x28(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x50(%rbp), %rdi
+  movq -0x20(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x38(%rbp), %rdi
+  movq -0x18(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.Lfun2_init:
+  subq $0x50, %rsp
+  leaq -0xc8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xe0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xf8(%rbp), %rdi
+  call __x86_64_make_void
+.Lfun2_bb0:
+.Lfun2_L_0:
+  leaq -0xe0(%rbp), %rdi
+  leaq .L_lit_1(%rip), %rsi
+  call __x86_64_make_string
+.Lfun2_L_1:
+  leaq -0xe0(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x20(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x50(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x68(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x80(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x98(%rbp), %rdi
+  call __x86_64_print
+  leaq -0xb0(%rbp), %rdi
+  call __x86_64_print
+.Lfun2_L_2:
+  leaq -0xc8(%rbp), %rsi
+  movq -0x8(%rbp), %rdi
+  movq -0x8(%rbp), %rax
+  movq 0x8(%rax), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lfun2_deinit:
+  movq -0xc0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xc8(%rbp), %rdi
+  call *%rax
+  movq -0xd8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xe0(%rbp), %rdi
+  call *%rax
+  movq -0xf0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xf8(%rbp), %rdi
+  call *%rax
+.Lfun2_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.Lfun2_E:
+main:
+.Lmain_S:
+  pushq %rbp
+  movq %rsp, %rbp
+.Lmain_init:
+  subq $0x210, %rsp
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x30(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x90(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xa8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xc0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xd8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xf0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x108(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x120(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x138(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x150(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x168(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x180(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x198(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1b0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1c8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1e0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1f8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x210(%rbp), %rdi
+  call __x86_64_make_void
+.Lmain_bb0:
+.Lmain_L_0:
+  leaq -0x78(%rbp), %rdi
+  leaq .L_lit_2(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_1:
+  leaq -0x90(%rbp), %rdi
+  leaq .L_lit_3(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_2:
+  leaq -0xa8(%rbp), %rdi
+  leaq .L_lit_4(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_3:
+  leaq -0xc0(%rbp), %rdi
+  leaq .L_lit_5(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_4:
+  leaq -0xc0(%rbp), %rdx
+  leaq -0xa8(%rbp), %rsi
+  leaq -0xd8(%rbp), %rdi
+  call fun1
+.Lmain_L_5:
+  leaq -0xd8(%rbp), %rdi
+  movq -0xd0(%rbp), %rax
+  movq 0xe8(%rax), %rax
+  call *%rax
+  pushq %rax
+  subq $0x8, %rsp
+  leaq -0x90(%rbp), %rdx
+  leaq -0x78(%rbp), %rsi
+  leaq -0xf0(%rbp), %rdi
+  movq 0x8(%rsp), %rax
+  call *%rax
+  addq $0x10, %rsp
+.Lmain_L_6:
+  leaq -0x108(%rbp), %rdi
+  leaq fun1(%rip), %rsi
+  call __x86_64_make_callable
+.Lmain_L_7:
+  leaq -0x108(%rbp), %rsi
+  leaq -0x30(%rbp), %rdi
+  movq -0x28(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_8:
+  leaq -0x30(%rbp), %rdi
+  call __x86_64_print
+.Lmain_L_9:
+  leaq -0x138(%rbp), %rdi
+  leaq .L_lit_6(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_10:
+  leaq -0x150(%rbp), %rdi
+  leaq .L_lit_7(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_11:
+  leaq -0x168(%rbp), %rdi
+  movq $0x3, %rsi
+  call __x86_64_make_long
+.Lmain_L_12:
+  leaq -0x180(%rbp), %rdi
+  movq $0x4, %rsi
+  call __x86_64_make_long
+.Lmain_L_13:
+  leaq -0x198(%rbp), %rdi
+  movq $0x5, %rsi
+  call __x86_64_make_long
+.Lmain_L_14:
+  leaq -0x1b0(%rbp), %rdi
+  movq $0x6, %rsi
+  call __x86_64_make_long
+.Lmain_L_15:
+  leaq -0x1c8(%rbp), %rdi
+  movq $0x7, %rsi
+  call __x86_64_make_long
+.Lmain_L_16:
+  leaq -0x1c8(%rbp), %rax
+  pushq %rax
+  leaq -0x1b0(%rbp), %rax
+  pushq %rax
+  leaq -0x198(%rbp), %r9
+  leaq -0x180(%rbp), %r8
+  leaq -0x168(%rbp), %rcx
+  leaq -0x150(%rbp), %rdx
+  leaq -0x138(%rbp), %rsi
+  leaq -0x1e0(%rbp), %rdi
+  call fun2
+  addq $0x10, %rsp
+.Lmain_L_17:
+  leaq -0x1f8(%rbp), %rdi
+  movq $0, %rsi
+  call __x86_64_make_long
+.Lmain_L_18:
+  leaq -0x210(%rbp), %rdi
+  leaq -0x1f8(%rbp), %rsi
+  movl $0x6, %edx
+  movq -0x1f0(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_19:
+  leaq -0x210(%rbp), %rsi
+  leaq -0x18(%rbp), %rdi
+  movq -0x10(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_deinit:
+  movq -0x28(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x30(%rbp), %rdi
+  call *%rax
+  movq -0x40(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x48(%rbp), %rdi
+  call *%rax
+  movq -0x58(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x60(%rbp), %rdi
+  call *%rax
+  movq -0x70(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x78(%rbp), %rdi
+  call *%rax
+  movq -0x88(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x90(%rbp), %rdi
+  call *%rax
+  movq -0xa0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xa8(%rbp), %rdi
+  call *%rax
+  movq -0xb8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xc0(%rbp), %rdi
+  call *%rax
+  movq -0xd0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xd8(%rbp), %rdi
+  call *%rax
+  movq -0xe8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xf0(%rbp), %rdi
+  call *%rax
+  movq -0x100(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x108(%rbp), %rdi
+  call *%rax
+  movq -0x118(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x120(%rbp), %rdi
+  call *%rax
+  movq -0x130(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x138(%rbp), %rdi
+  call *%rax
+  movq -0x148(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x150(%rbp), %rdi
+  call *%rax
+  movq -0x160(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x168(%rbp), %rdi
+  call *%rax
+  movq -0x178(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x180(%rbp), %rdi
+  call *%rax
+  movq -0x190(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x198(%rbp), %rdi
+  call *%rax
+  movq -0x1a8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1b0(%rbp), %rdi
+  call *%rax
+  movq -0x1c0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1c8(%rbp), %rdi
+  call *%rax
+  movq -0x1d8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1e0(%rbp), %rdi
+  call *%rax
+  movq -0x1f0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1f8(%rbp), %rdi
+  call *%rax
+  movq -0x208(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x210(%rbp), %rdi
+  call *%rax
+.Lmain_epilogue:
+  call __x86_64_flush
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movl %eax, %edi
+  movq $0x3c, %rax
+  syscall
+.Lmain_E:
+.section .u_debug_info
+.quad 0x3
+.quad 0x1
+.quad .Lfun1_S
+.quad .Lfun1_E
+.quad 0x1
+.quad 0x2
+.quad 0x1
+.quad 0xffffffffffffffe0
+.quad 0x2
+.quad 0xffffffffffffffc8
+.quad 0x3
+.quad 0xffffffffffffffa8
+.quad 0x4
+.quad .Lfun2_S
+.quad .Lfun2_E
+.quad 0x5
+.quad 0x7
+.quad 0x1
+.quad 0xffffffffffffffe0
+.quad 0x2
+.quad 0xffffffffffffffc8
+.quad 0x3
+.quad 0xffffffffffffffb0
+.quad 0x6
+.quad 0xffffffffffffff98
+.quad 0x7
+.quad 0xffffffffffffff80
+.quad 0x8
+.quad 0xffffffffffffff68
+.quad 0x9
+.quad 0xffffffffffffff50
+.quad 0xa
+.quad 0xffffffffffffff38
+.quad 0x4
+.quad .Lmain_S
+.quad .Lmain_E
+.quad 0xb
+.quad 0
+.quad 0x3
+.quad 0xffffffffffffffd0
+.quad 0x4
+.quad 0xffffffffffffffb8
+.quad 0xc
+.quad 0xffffffffffffffa0
+.quad 0xd
+.quad 0
+.section .u_debug_line
+.quad 0x1c
+.quad .Lfun1_L_0
+.quad 0
+.quad 0x5
+.quad .Lfun1_L_1
+.quad 0
+.quad 0x5
+.quad .Lfun1_L_2
+.quad 0
+.quad 0x6
+.quad .Lfun1_L_3
+.quad 0
+.quad 0x6
+.quad .Lfun1_L_4
+.quad 0
+.quad 0x7
+.quad .Lfun2_L_0
+.quad 0
+.quad 0xe
+.quad .Lfun2_L_1
+.quad 0
+.quad 0xe
+.quad .Lfun2_L_2
+.quad 0
+.quad 0xf
+.quad .Lmain_L_0
+.quad 0
+.quad 0x16
+.quad .Lmain_L_1
+.quad 0
+.quad 0x16
+.quad .Lmain_L_2
+.quad 0
+.quad 0x16
+.quad .Lmain_L_3
+.quad 0
+.quad 0x16
+.quad .Lmain_L_4
+.quad 0
+.quad 0x16
+.quad .Lmain_L_5
+.quad 0
+.quad 0x16
+.quad .Lmain_L_6
+.quad 0
+.quad 0x17
+.quad .Lmain_L_7
+.quad 0
+.quad 0x17
+.quad .Lmain_L_8
+.quad 0
+.quad 0x18
+.quad .Lmain_L_9
+.quad 0
+.quad 0x19
+.quad .Lmain_L_10
+.quad 0
+.quad 0x19
+.quad .Lmain_L_11
+.quad 0
+.quad 0x19
+.quad .Lmain_L_12
+.quad 0
+.quad 0x19
+.quad .Lmain_L_13
+.quad 0
+.quad 0x19
+.quad .Lmain_L_14
+.quad 0
+.quad 0x19
+.quad .Lmain_L_15
+.quad 0
+.quad 0x19
+.quad .Lmain_L_16
+.quad 0
+.quad 0x19
+.quad .Lmain_L_17
+.quad 0
+.quad 0x1a
+.quad .Lmain_L_18
+.quad 0
+.quad 0x1a
+.quad .Lmain_L_19
+.quad 0
+.quad 0x1a
+.section .u_debug_str
+.quad 0xe
+.ascii "/root/repo/io/suite21.txt\0"
+.ascii "fun1\0"
+.ascii "a1\0"
+.ascii "a2\0"
+.ascii "a\0"
+.ascii "fun2\0"
+.ascii "a3\0"
+.ascii "a4\0"
+.ascii "a5\0"
+.ascii "a6\0"
+.ascii "a7\0"
+.ascii "main\0"
+.ascii "b\0"
+.ascii "c\0"
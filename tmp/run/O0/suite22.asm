@@ -0,0 +1,245 @@
+.section .data
+.section .text
+.extern __x86_64_flush
+.extern __x86_64_make_void
+.extern __x86_64_make_bool
+.extern __x86_64_make_byte
+.extern __x86_64_make_int
+.extern __x86_64_make_uint
+.extern __x86_64_make_long
+.extern __x86_64_make_ulong
+.extern __x86_64_make_char
+.extern __x86_64_make_string
+.extern __x86_64_make_callable
+.extern __x86_64_make_array
+.extern __x86_64_make_array_frame
+.extern __x86_64_make_object
+.extern __x86_64_make_object_setup
+.extern __x86_64_make_object_setup_frame
+.extern __x86_64_make_error
+.extern __x86_64_print
+.extern __x86_64_unwrap_void
+.extern __x86_64_unwrap_bool
+.extern __x86_64_unwrap_byte
+.extern __x86_64_unwrap_int
+.extern __x86_64_unwrap_uint
+.extern __x86_64_unwrap_long
+.extern __x86_64_unwrap_ulong
+.extern __x86_64_unwrap_char
+.extern __x86_64_unwrap_string
+.extern std_write
+.extern std_read_bool
+.extern std_read_byte
+.extern std_read_char
+.extern std_read_int
+.extern std_read_uint
+.extern std_read_long
+.extern std_read_ulong
+.extern std_read_string
+.extern std_write_bool
+.extern std_write_byte
+.extern std_write_char
+.extern std_write_int
+.extern std_write_uint
+.extern std_write_long
+.extern std_write_ulong
+.extern std_write_string
+.extern std_test_first
+.extern std_test_args
+.extern std_abs
+.globl main
+main:
+.Lmain_S:
+  pushq %rbp
+  movq %rsp, %rbp
+.Lmain_init:
+  subq $0xe0, %rsp
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x30(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x90(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xa8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xc0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xd8(%rbp), %rdi
+  call __x86_64_make_void
+.Lmain_bb2:
+.Lmain_L_0:
+  leaq -0x48(%rbp), %rdi
+  movq $0x3e8, %rsi
+  call __x86_64_make_long
+.Lmain_L_1:
+  leaq -0x48(%rbp), %rsi
+  leaq -0x30(%rbp), %rdi
+  movq -0x28(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_bb3:
+.Lmain_L_2:
+  leaq -0x60(%rbp), %rdi
+  movq $0, %rsi
+  call __x86_64_make_long
+.Lmain_L_3:
+  leaq -0x30(%rbp), %rsi
+  leaq -0x60(%rbp), %rdx
+  cmpl $0x7, 0(%rsi)
+  jnz .Lmain_slow_3
+  cmpl $0x7, 0(%rdx)
+  jnz .Lmain_slow_3
+  movq 0x10(%rsi), %rax
+  cmpq 0x10(%rdx), %rax
+  jle .Lmain_bb0
+.Lmain_slow_3:
+.Lmain_L_4:
+  leaq -0x30(%rbp), %rdx
+  leaq -0x60(%rbp), %rsi
+  leaq -0x78(%rbp), %rdi
+  movq -0x28(%rbp), %rax
+  movq 0x68(%rax), %rax
+  call *%rax
+.Lmain_L_5:
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_unwrap_bool
+  testb %al, %al
+  jz .Lmain_bb0
+.Lmain_bb6:
+.Lmain_L_6:
+  leaq -0x30(%rbp), %rsi
+  leaq -0x90(%rbp), %rdi
+  movq -0x28(%rbp), %rax
+  movq 0x28(%rax), %rax
+  call *%rax
+.Lmain_L_7:
+  leaq -0x90(%rbp), %rsi
+  leaq -0x30(%rbp), %rdi
+  movq -0x28(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+  jmp .Lmain_bb3
+.Lmain_bb0:
+.Lmain_L_8:
+  leaq -0xa8(%rbp), %rdi
+  leaq -0x30(%rbp), %rsi
+  movq -0x28(%rbp), %rax
+  movq 0x118(%rax), %rax
+  call *%rax
+.Lmain_L_9:
+  leaq -0xa8(%rbp), %rdi
+  call __x86_64_print
+.Lmain_L_10:
+  leaq -0xd8(%rbp), %rdi
+  leaq -0x30(%rbp), %rsi
+  movl $0x6, %edx
+  movq -0x28(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_11:
+  leaq -0xd8(%rbp), %rsi
+  leaq -0x18(%rbp), %rdi
+  movq -0x10(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_deinit:
+  movq -0x28(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x30(%rbp), %rdi
+  call *%rax
+  movq -0x40(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x48(%rbp), %rdi
+  call *%rax
+  movq -0x58(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x60(%rbp), %rdi
+  call *%rax
+  movq -0x70(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x78(%rbp), %rdi
+  call *%rax
+  movq -0x88(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x90(%rbp), %rdi
+  call *%rax
+  movq -0xa0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xa8(%rbp), %rdi
+  call *%rax
+  movq -0xb8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xc0(%rbp), %rdi
+  call *%rax
+  movq -0xd0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xd8(%rbp), %rdi
+  call *%rax
+.Lmain_epilogue:
+  call __x86_64_flush
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movl %eax, %edi
+  movq $0x3c, %rax
+  syscall
+.Lmain_E:
+.section .u_debug_info
+.quad 0x1
+.quad 0x1
+.quad .Lmain_S
+.quad .Lmain_E
+.quad 0x1
+.quad 0
+.quad 0x1
+.quad 0xffffffffffffffd0
+.quad 0x2
+.quad 0
+.section .u_debug_line
+.quad 0xc
+.quad .Lmain_L_0
+.quad 0
+.quad 0x5
+.quad .Lmain_L_1
+.quad 0
+.quad 0x5
+.quad .Lmain_L_2
+.quad 0
+.quad 0x6
+.quad .Lmain_L_3
+.quad 0
+.quad 0x6
+.quad .Lmain_L_4
+.quad 0
+.quad 0x6
+.quad .Lmain_L_5
+.quad 0
+.quad 0x6
+.quad .Lmain_L_6
+.quad 0
+.quad 0x7
+.quad .Lmain_L_7
+.quad 0
+.quad 0x7
+.quad .Lmain_L_8
+.quad 0
+.quad 0x9
+.quad .Lmain_L_9
+.quad 0
+.quad 0x9
+.quad .Lmain_L_10
+.quad 0
+.quad 0xa
+.quad .Lmain_L_11
+.quad 0
+.quad 0xa
+.section .u_debug_str
+.quad 0x3
+.ascii "/root/repo/io/suite22.txt\0"
+.ascii "main\0"
+.ascii "n\0"
@@ -0,0 +1,1490 @@
+.section .data
+.L_lit_0: .ascii "hello\0"
+.L_lit_1: .ascii "\n\0"
+.L_lit_2: .ascii "\n\0"
+.L_lit_3: .ascii "\n\0"
+.L_lit_4: .ascii "\n\0"
+.L_lit_5: .ascii "\n\0"
+.L_lit_6: .ascii "\n\0"
+.L_lit_7: .ascii "\n\0"
+.L_lit_8: .ascii "\n\0"
+.L_lit_9: .ascii "absolute value of \0"
+.L_lit_10: .ascii "=\0"
+.L_lit_11: .ascii "\n\0"
+.L_lit_12: .ascii "factorial of \0"
+.L_lit_13: .ascii " is \0"
+.L_lit_14: .ascii "\n\0"
+.section .text
+.extern __x86_64_flush
+.extern __x86_64_make_void
+.extern __x86_64_make_bool
+.extern __x86_64_make_byte
+.extern __x86_64_make_int
+.extern __x86_64_make_uint
+.extern __x86_64_make_long
+.extern __x86_64_make_ulong
+.extern __x86_64_make_char
+.extern __x86_64_make_string
+.extern __x86_64_make_callable
+.extern __x86_64_make_array
+.extern __x86_64_make_array_frame
+.extern __x86_64_make_object
+.extern __x86_64_make_object_setup
+.extern __x86_64_make_object_setup_frame
+.extern __x86_64_make_error
+.extern __x86_64_print
+.extern __x86_64_unwrap_void
+.extern __x86_64_unwrap_bool
+.extern __x86_64_unwrap_byte
+.extern __x86_64_unwrap_int
+.extern __x86_64_unwrap_uint
+.extern __x86_64_unwrap_long
+.extern __x86_64_unwrap_ulong
+.extern __x86_64_unwrap_char
+.extern __x86_64_unwrap_string
+.extern std_write
+.extern std_read_bool
+.extern std_read_byte
+.extern std_read_char
+.extern std_read_int
+.extern std_read_uint
+.extern std_read_long
+.extern std_read_ulong
+.extern std_read_string
+.extern std_write_bool
+.extern std_write_byte
+.extern std_write_char
+.extern std_write_int
+.extern std_write_uint
+.extern std_write_long
+.extern std_write_ulong
+.extern std_write_string
+.extern std_test_first
+.extern std_test_args
+.extern std_abs
+.globl factorial
+.globl main
+factorial:
+.Lfactorial_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+.Lfactorial_copy:
+  subq $0x10, %rsp
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.Lfactorial_init:
+  subq $0xf0, %rsp
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x50(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x68(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x80(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x98(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xb0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xc8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xe0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xf8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x110(%rbp), %rdi
+  call __x86_64_make_void
+.Lfactorial_bb2:
+.Lfactorial_L_0:
+  leaq -0x38(%rbp), %rdi
+  movq $0, %rsi
+  call __x86_64_make_long
+.Lfactorial_L_1:
+  leaq -0x20(%rbp), %rsi
+  leaq -0x38(%rbp), %rdx
+  cmpl $0x7, 0(%rsi)
+  jnz .Lfactorial_slow_2
+  cmpl $0x7, 0(%rdx)
+  jnz .Lfactorial_slow_2
+  movq 0x10(%rsi), %rax
+  cmpq 0x10(%rdx), %rax
+  jnz .Lfactorial_bb5
+.Lfactorial_slow_2:
+.Lfactorial_L_2:
+  leaq -0x38(%rbp), %rdx
+  leaq -0x20(%rbp), %rsi
+  leaq -0x50(%rbp), %rdi
+  movq -0x18(%rbp), %rax
+  movq 0x58(%rax), %rax
+  call *%rax
+.Lfactorial_L_3:
+  leaq -0x50(%rbp), %rdi
+  call __x86_64_unwrap_bool
+  testb %al, %al
+  jz .Lfactorial_bb5
+.Lfactorial_bb4:
+.Lfactorial_L_4:
+  leaq -0x68(%rbp), %rdi
+  movq $0x1, %rsi
+  call __x86_64_make_long
+.Lfactorial_L_5:
+  leaq -0x68(%rbp), %rsi
+  movq -0x8(%rbp), %rdi
+  movq -0x8(%rbp), %rax
+  movq 0x8(%rax), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lfactorial_L_6:
+  jmp .Lfactorial_bb0
+.Lfactorial_bb5:
+.Lfactorial_L_7:
+  leaq -0x80(%rbp), %rdi
+  movq $0x1, %rsi
+  call __x86_64_make_long
+.Lfactorial_L_8:
+  leaq -0x20(%rbp), %rsi
+  leaq -0x80(%rbp), %rdx
+  cmpl $0x7, 0(%rsi)
+  jnz .Lfactorial_slow_5
+  cmpl $0x7, 0(%rdx)
+  jnz .Lfactorial_slow_5
+  movq 0x10(%rsi), %rax
+  cmpq 0x10(%rdx), %rax
+  jnz .Lfactorial_bb9
+.Lfactorial_slow_5:
+.Lfactorial_L_9:
+  leaq -0x80(%rbp), %rdx
+  leaq -0x20(%rbp), %rsi
+  leaq -0x98(%rbp), %rdi
+  movq -0x18(%rbp), %rax
+  movq 0x58(%rax), %rax
+  call *%rax
+.Lfactorial_L_10:
+  leaq -0x98(%rbp), %rdi
+  call __x86_64_unwrap_bool
+  testb %al, %al
+  jz .Lfactorial_bb9
+.Lfactorial_bb7:
+.Lfactorial_L_11:
+  leaq -0xb0(%rbp), %rdi
+  movq $0x1, %rsi
+  call __x86_64_make_long
+.Lfactorial_L_12:
+  leaq -0xb0(%rbp), %rsi
+  movq -0x8(%rbp), %rdi
+  movq -0x8(%rbp), %rax
+  movq 0x8(%rax), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lfactorial_L_13:
+  jmp .Lfactorial_bb0
+.Lfactorial_bb9:
+.Lfactorial_L_14:
+  leaq -0xc8(%rbp), %rdi
+  movq $0x1, %rsi
+  call __x86_64_make_long
+.Lfactorial_L_15:
+  leaq -0xc8(%rbp), %rdx
+  leaq -0x20(%rbp), %rsi
+  leaq -0xe0(%rbp), %rdi
+  movq -0x18(%rbp), %rax
+  movq 0x90(%rax), %rax
+  call *%rax
+.Lfactorial_L_16:
+  leaq -0xe0(%rbp), %rsi
+  leaq -0xf8(%rbp), %rdi
+  call factorial
+.Lfactorial_L_17:
+  leaq -0xf8(%rbp), %rdx
+  leaq -0x20(%rbp), %rsi
+  leaq -0x110(%rbp), %rdi
+  movq -0x18(%rbp), %rax
+  movq 0x98(%rax), %rax
+  call *%rax
+.Lfactorial_L_18:
+  leaq -0x110(%rbp), %rsi
+  movq -0x8(%rbp), %rdi
+  movq -0x8(%rbp), %rax
+  movq 0x8(%rax), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lfactorial_L_19:
+.Lfactorial_bb0:
+.Lfactorial_deinit:
+  movq -0x30(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x38(%rbp), %rdi
+  call *%rax
+  movq -0x48(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x50(%rbp), %rdi
+  call *%rax
+  movq -0x60(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x68(%rbp), %rdi
+  call *%rax
+  movq -0x78(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x80(%rbp), %rdi
+  call *%rax
+  movq -0x90(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x98(%rbp), %rdi
+  call *%rax
+  movq -0xa8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xb0(%rbp), %rdi
+  call *%rax
+  movq -0xc0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xc8(%rbp), %rdi
+  call *%rax
+  movq -0xd8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xe0(%rbp), %rdi
+  call *%rax
+  movq -0xf0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xf8(%rbp), %rdi
+  call *%rax
+  movq -0x108(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x110(%rbp), %rdi
+  call *%rax
+.Lfactorial_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.Lfactorial_E:
+main:
+.Lmain_S:
+  pushq %rbp
+  movq %rsp, %rbp
+.Lmain_init:
+  subq $0x6c0, %rsp
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x30(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x90(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xa8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xc0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xd8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xf0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x108(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x120(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x138(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x150(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x168(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x180(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x198(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1b0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1c8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1e0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x1f8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x210(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x228(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x240(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x258(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x270(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x288(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x2a0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x2b8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x2d0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x2e8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x300(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x318(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x330(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x348(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x360(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x378(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x390(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x3a8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x3c0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x3d8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x3f0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x408(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x420(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x438(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x450(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x468(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x480(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x498(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x4b0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x4c8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x4e0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x4f8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x510(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x528(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x540(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x558(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x570(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x588(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x5a0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x5b8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x5d0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x5e8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x600(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x618(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x630(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x648(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x660(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x678(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x690(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x6a8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x6c0(%rbp), %rdi
+  call __x86_64_make_void
+.Lmain_bb0:
+.Lmain_L_0:
+  leaq -0x108(%rbp), %rdi
+  movb $0x1, %sil
+  call __x86_64_make_bool
+.Lmain_L_1:
+  leaq -0x108(%rbp), %rsi
+  leaq -0x48(%rbp), %rdi
+  movq -0x40(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_2:
+  leaq -0x120(%rbp), %rdi
+  movq $0x2a, %rsi
+  call __x86_64_make_long
+.Lmain_L_3:
+  leaq -0x138(%rbp), %rdi
+  leaq -0x120(%rbp), %rsi
+  movl $0x2, %edx
+  movq -0x118(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_4:
+  leaq -0x138(%rbp), %rsi
+  leaq -0x60(%rbp), %rdi
+  movq -0x58(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_5:
+  leaq -0x150(%rbp), %rdi
+  movq $0x2a, %rsi
+  call __x86_64_make_long
+.Lmain_L_6:
+  leaq -0x150(%rbp), %rsi
+  leaq -0x168(%rbp), %rdi
+  movq -0x148(%rbp), %rax
+  movq 0x8(%rax), %rax
+  call *%rax
+.Lmain_L_7:
+  leaq -0x180(%rbp), %rdi
+  leaq -0x168(%rbp), %rsi
+  movl $0x6, %edx
+  movq -0x160(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_8:
+  leaq -0x180(%rbp), %rsi
+  leaq -0x78(%rbp), %rdi
+  movq -0x70(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_9:
+  leaq -0x198(%rbp), %rdi
+  movq $0x35, %rsi
+  call __x86_64_make_long
+.Lmain_L_10:
+  leaq -0x1b0(%rbp), %rdi
+  leaq -0x198(%rbp), %rsi
+  movl $0xb, %edx
+  movq -0x190(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_11:
+  leaq -0x1b0(%rbp), %rsi
+  leaq -0x90(%rbp), %rdi
+  movq -0x88(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_12:
+  leaq -0x1c8(%rbp), %rdi
+  movq $0xd055, %rsi
+  call __x86_64_make_long
+.Lmain_L_13:
+  leaq -0x1c8(%rbp), %rsi
+  leaq -0x1e0(%rbp), %rdi
+  movq -0x1c0(%rbp), %rax
+  movq 0x8(%rax), %rax
+  call *%rax
+.Lmain_L_14:
+  leaq -0x1f8(%rbp), %rdi
+  leaq -0x1e0(%rbp), %rsi
+  movl $0x7, %edx
+  movq -0x1d8(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_15:
+  leaq -0x1f8(%rbp), %rsi
+  leaq -0xa8(%rbp), %rdi
+  movq -0xa0(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_16:
+  leaq -0x210(%rbp), %rdi
+  movq $0xd055, %rsi
+  call __x86_64_make_long
+.Lmain_L_17:
+  leaq -0x228(%rbp), %rdi
+  leaq -0x210(%rbp), %rsi
+  movl $0xc, %edx
+  movq -0x208(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_18:
+  leaq -0x228(%rbp), %rsi
+  leaq -0xc0(%rbp), %rdi
+  movq -0xb8(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_19:
+  leaq -0xc0(%rbp), %rdi
+  call __x86_64_print
+.Lmain_L_20:
+  leaq -0x258(%rbp), %rdi
+  movb $0x61, %sil
+  call __x86_64_make_char
+.Lmain_L_21:
+  leaq -0x258(%rbp), %rsi
+  leaq -0xd8(%rbp), %rdi
+  movq -0xd0(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_22:
+  leaq -0x270(%rbp), %rdi
+  leaq .L_lit_0(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_23:
+  leaq -0x270(%rbp), %rsi
+  leaq -0xf0(%rbp), %rdi
+  movq -0xe8(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_24:
+  subq $0x40, %rsp
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_unwrap_bool
+  movq %rax, 0(%rsp)
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_unwrap_byte
+  movq %rax, 0x8(%rsp)
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movq %rax, 0x10(%rsp)
+  leaq -0x90(%rbp), %rdi
+  call __x86_64_unwrap_uint
+  movq %rax, 0x18(%rsp)
+  leaq -0xa8(%rbp), %rdi
+  call __x86_64_unwrap_long
+  movq %rax, 0x20(%rsp)
+  leaq -0xc0(%rbp), %rdi
+  call __x86_64_unwrap_ulong
+  movq %rax, 0x28(%rsp)
+  leaq -0xd8(%rbp), %rdi
+  call __x86_64_unwrap_char
+  movq %rax, 0x30(%rsp)
+  leaq -0xf0(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0x38(%rsp)
+  popq %rdi
+  popq %rsi
+  popq %rdx
+  popq %rcx
+  popq %r8
+  popq %r9
+  call std_test_args
+  leaq -0x288(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x10, %rsp
+.Lmain_L_25:
+  subq $0x10, %rsp
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_unwrap_bool
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_bool
+  leaq -0x2a0(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_26:
+  leaq -0x2b8(%rbp), %rdi
+  leaq .L_lit_1(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_27:
+  subq $0x10, %rsp
+  leaq -0x2b8(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x2d0(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_28:
+  subq $0x10, %rsp
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_unwrap_byte
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_byte
+  leaq -0x2e8(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_29:
+  leaq -0x300(%rbp), %rdi
+  leaq .L_lit_2(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_30:
+  subq $0x10, %rsp
+  leaq -0x300(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x318(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_31:
+  subq $0x10, %rsp
+  leaq -0xd8(%rbp), %rdi
+  call __x86_64_unwrap_char
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_char
+  leaq -0x330(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_32:
+  leaq -0x348(%rbp), %rdi
+  leaq .L_lit_3(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_33:
+  subq $0x10, %rsp
+  leaq -0x348(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x360(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_34:
+  subq $0x10, %rsp
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_int
+  leaq -0x378(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_35:
+  leaq -0x390(%rbp), %rdi
+  leaq .L_lit_4(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_36:
+  subq $0x10, %rsp
+  leaq -0x390(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x3a8(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_37:
+  subq $0x10, %rsp
+  leaq -0x90(%rbp), %rdi
+  call __x86_64_unwrap_uint
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_uint
+  leaq -0x3c0(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_38:
+  leaq -0x3d8(%rbp), %rdi
+  leaq .L_lit_5(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_39:
+  subq $0x10, %rsp
+  leaq -0x3d8(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x3f0(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_40:
+  subq $0x10, %rsp
+  leaq -0xa8(%rbp), %rdi
+  call __x86_64_unwrap_long
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_long
+  leaq -0x408(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_41:
+  leaq -0x420(%rbp), %rdi
+  leaq .L_lit_6(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_42:
+  subq $0x10, %rsp
+  leaq -0x420(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x438(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_43:
+  subq $0x10, %rsp
+  leaq -0xc0(%rbp), %rdi
+  call __x86_64_unwrap_ulong
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_ulong
+  leaq -0x450(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_44:
+  leaq -0x468(%rbp), %rdi
+  leaq .L_lit_7(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_45:
+  subq $0x10, %rsp
+  leaq -0x468(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x480(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_46:
+  subq $0x10, %rsp
+  leaq -0xf0(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x498(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_47:
+  leaq -0x4b0(%rbp), %rdi
+  leaq .L_lit_8(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_48:
+  subq $0x10, %rsp
+  leaq -0x4b0(%rbp), %rdi
+  call __x86_64_unwrap_string
+  movq %rax, 0(%rsp)
+  popq %rdi
+  call std_write_string
+  leaq -0x4c8(%rbp), %rdi
+  call __x86_64_make_void
+  addq $0x8, %rsp
+.Lmain_L_49:
+  leaq -0x4e0(%rbp), %rdi
+  leaq .L_lit_9(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_50:
+  leaq -0x4e0(%rbp), %rsi
+  leaq -0x4f8(%rbp), %rdi
+  call std_write
+.Lmain_L_51:
+  leaq -0xa8(%rbp), %rsi
+  leaq -0x510(%rbp), %rdi
+  call std_write
+.Lmain_L_52:
+  leaq -0x528(%rbp), %rdi
+  leaq .L_lit_10(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_53:
+  leaq -0x528(%rbp), %rsi
+  leaq -0x540(%rbp), %rdi
+  call std_write
+.Lmain_L_54:
+  leaq -0xa8(%rbp), %rsi
+  leaq -0x558(%rbp), %rdi
+  call std_abs
+.Lmain_L_55:
+  leaq -0x558(%rbp), %rsi
+  leaq -0x570(%rbp), %rdi
+  call std_write
+.Lmain_L_56:
+  leaq -0x588(%rbp), %rdi
+  leaq .L_lit_11(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_57:
+  leaq -0x588(%rbp), %rsi
+  leaq -0x5a0(%rbp), %rdi
+  call std_write
+.Lmain_L_58:
+  leaq -0x5b8(%rbp), %rdi
+  movq $0xa, %rsi
+  call __x86_64_make_long
+.Lmain_L_59:
+  leaq -0x5b8(%rbp), %rsi
+  leaq -0x30(%rbp), %rdi
+  movq -0x28(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_60:
+  leaq -0x5d0(%rbp), %rdi
+  leaq .L_lit_12(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_61:
+  leaq -0x5d0(%rbp), %rsi
+  leaq -0x5e8(%rbp), %rdi
+  call std_write
+.Lmain_L_62:
+  leaq -0x30(%rbp), %rsi
+  leaq -0x600(%rbp), %rdi
+  call std_write
+.Lmain_L_63:
+  leaq -0x618(%rbp), %rdi
+  leaq .L_lit_13(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_64:
+  leaq -0x618(%rbp), %rsi
+  leaq -0x630(%rbp), %rdi
+  call std_write
+.Lmain_L_65:
+  leaq -0x30(%rbp), %rsi
+  leaq -0x648(%rbp), %rdi
+  call factorial
+.Lmain_L_66:
+  leaq -0x648(%rbp), %rsi
+  leaq -0x660(%rbp), %rdi
+  call std_write
+.Lmain_L_67:
+  leaq -0x678(%rbp), %rdi
+  leaq .L_lit_14(%rip), %rsi
+  call __x86_64_make_string
+.Lmain_L_68:
+  leaq -0x678(%rbp), %rsi
+  leaq -0x690(%rbp), %rdi
+  call std_write
+.Lmain_L_69:
+  leaq -0x6a8(%rbp), %rdi
+  movq $0, %rsi
+  call __x86_64_make_long
+.Lmain_L_70:
+  leaq -0x6c0(%rbp), %rdi
+  leaq -0x6a8(%rbp), %rsi
+  movl $0x6, %edx
+  movq -0x6a0(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_71:
+  leaq -0x6c0(%rbp), %rsi
+  leaq -0x18(%rbp), %rdi
+  movq -0x10(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_deinit:
+  movq -0x28(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x30(%rbp), %rdi
+  call *%rax
+  movq -0x40(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x48(%rbp), %rdi
+  call *%rax
+  movq -0x58(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x60(%rbp), %rdi
+  call *%rax
+  movq -0x70(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x78(%rbp), %rdi
+  call *%rax
+  movq -0x88(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x90(%rbp), %rdi
+  call *%rax
+  movq -0xa0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xa8(%rbp), %rdi
+  call *%rax
+  movq -0xb8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xc0(%rbp), %rdi
+  call *%rax
+  movq -0xd0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xd8(%rbp), %rdi
+  call *%rax
+  movq -0xe8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xf0(%rbp), %rdi
+  call *%rax
+  movq -0x100(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x108(%rbp), %rdi
+  call *%rax
+  movq -0x118(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x120(%rbp), %rdi
+  call *%rax
+  movq -0x130(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x138(%rbp), %rdi
+  call *%rax
+  movq -0x148(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x150(%rbp), %rdi
+  call *%rax
+  movq -0x160(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x168(%rbp), %rdi
+  call *%rax
+  movq -0x178(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x180(%rbp), %rdi
+  call *%rax
+  movq -0x190(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x198(%rbp), %rdi
+  call *%rax
+  movq -0x1a8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1b0(%rbp), %rdi
+  call *%rax
+  movq -0x1c0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1c8(%rbp), %rdi
+  call *%rax
+  movq -0x1d8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1e0(%rbp), %rdi
+  call *%rax
+  movq -0x1f0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x1f8(%rbp), %rdi
+  call *%rax
+  movq -0x208(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x210(%rbp), %rdi
+  call *%rax
+  movq -0x220(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x228(%rbp), %rdi
+  call *%rax
+  movq -0x238(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x240(%rbp), %rdi
+  call *%rax
+  movq -0x250(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x258(%rbp), %rdi
+  call *%rax
+  movq -0x268(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x270(%rbp), %rdi
+  call *%rax
+  movq -0x280(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x288(%rbp), %rdi
+  call *%rax
+  movq -0x298(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x2a0(%rbp), %rdi
+  call *%rax
+  movq -0x2b0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x2b8(%rbp), %rdi
+  call *%rax
+  movq -0x2c8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x2d0(%rbp), %rdi
+  call *%rax
+  movq -0x2e0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x2e8(%rbp), %rdi
+  call *%rax
+  movq -0x2f8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x300(%rbp), %rdi
+  call *%rax
+  movq -0x310(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x318(%rbp), %rdi
+  call *%rax
+  movq -0x328(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x330(%rbp), %rdi
+  call *%rax
+  movq -0x340(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x348(%rbp), %rdi
+  call *%rax
+  movq -0x358(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x360(%rbp), %rdi
+  call *%rax
+  movq -0x370(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x378(%rbp), %rdi
+  call *%rax
+  movq -0x388(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x390(%rbp), %rdi
+  call *%rax
+  movq -0x3a0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x3a8(%rbp), %rdi
+  call *%rax
+  movq -0x3b8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x3c0(%rbp), %rdi
+  call *%rax
+  movq -0x3d0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x3d8(%rbp), %rdi
+  call *%rax
+  movq -0x3e8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x3f0(%rbp), %rdi
+  call *%rax
+  movq -0x400(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x408(%rbp), %rdi
+  call *%rax
+  movq -0x418(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x420(%rbp), %rdi
+  call *%rax
+  movq -0x430(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x438(%rbp), %rdi
+  call *%rax
+  movq -0x448(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x450(%rbp), %rdi
+  call *%rax
+  movq -0x460(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x468(%rbp), %rdi
+  call *%rax
+  movq -0x478(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x480(%rbp), %rdi
+  call *%rax
+  movq -0x490(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x498(%rbp), %rdi
+  call *%rax
+  movq -0x4a8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x4b0(%rbp), %rdi
+  call *%rax
+  movq -0x4c0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x4c8(%rbp), %rdi
+  call *%rax
+  movq -0x4d8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x4e0(%rbp), %rdi
+  call *%rax
+  movq -0x4f0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x4f8(%rbp), %rdi
+  call *%rax
+  movq -0x508(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x510(%rbp), %rdi
+  call *%rax
+  movq -0x520(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x528(%rbp), %rdi
+  call *%rax
+  movq -0x538(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x540(%rbp), %rdi
+  call *%rax
+  movq -0x550(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x558(%rbp), %rdi
+  call *%rax
+  movq -0x568(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x570(%rbp), %rdi
+  call *%rax
+  movq -0x580(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x588(%rbp), %rdi
+  call *%rax
+  movq -0x598(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x5a0(%rbp), %rdi
+  call *%rax
+  movq -0x5b0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x5b8(%rbp), %rdi
+  call *%rax
+  movq -0x5c8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x5d0(%rbp), %rdi
+  call *%rax
+  movq -0x5e0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x5e8(%rbp), %rdi
+  call *%rax
+  movq -0x5f8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x600(%rbp), %rdi
+  call *%rax
+  movq -0x610(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x618(%rbp), %rdi
+  call *%rax
+  movq -0x628(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x630(%rbp), %rdi
+  call *%rax
+  movq -0x640(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x648(%rbp), %rdi
+  call *%rax
+  movq -0x658(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x660(%rbp), %rdi
+  call *%rax
+  movq -0x670(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x678(%rbp), %rdi
+  call *%rax
+  movq -0x688(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x690(%rbp), %rdi
+  call *%rax
+  movq -0x6a0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x6a8(%rbp), %rdi
+  call *%rax
+  movq -0x6b8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x6c0(%rbp), %rdi
+  call *%rax
+.Lmain_epilogue:
+  call __x86_64_flush
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movl %eax, %edi
+  movq $0x3c, %rax
+  syscall
+.Lmain_E:
+.section .u_debug_info
+.quad 0x2
+.quad 0x1
+.quad .Lfactorial_S
+.quad .Lfactorial_E
+.quad 0x1
+.quad 0x1
+.quad 0
+.quad 0xffffffffffffffe0
+.quad 0x2
+.quad .Lmain_S
+.quad .Lmain_E
+.quad 0x3
+.quad 0
+.quad 0x9
+.quad 0xffffffffffffffd0
+.quad 0x2
+.quad 0xffffffffffffffb8
+.quad 0x4
+.quad 0xffffffffffffffa0
+.quad 0x5
+.quad 0xffffffffffffff88
+.quad 0x6
+.quad 0xffffffffffffff70
+.quad 0x7
+.quad 0xffffffffffffff58
+.quad 0x8
+.quad 0xffffffffffffff40
+.quad 0x9
+.quad 0xffffffffffffff28
+.quad 0xa
+.quad 0xffffffffffffff10
+.quad 0xb
+.quad 0
+.section .u_debug_line
+.quad 0x5c
+.quad .Lfactorial_L_0
+.quad 0
+.quad 0x3
+.quad .Lfactorial_L_1
+.quad 0
+.quad 0x3
+.quad .Lfactorial_L_2
+.quad 0
+.quad 0x3
+.quad .Lfactorial_L_3
+.quad 0
+.quad 0x3
+.quad .Lfactorial_L_4
+.quad 0
+.quad 0x4
+.quad .Lfactorial_L_5
+.quad 0
+.quad 0x4
+.quad .Lfactorial_L_6
+.quad 0
+.quad 0x4
+.quad .Lfactorial_L_7
+.quad 0
+.quad 0x5
+.quad .Lfactorial_L_8
+.quad 0
+.quad 0x5
+.quad .Lfactorial_L_9
+.quad 0
+.quad 0x5
+.quad .Lfactorial_L_10
+.quad 0
+.quad 0x5
+.quad .Lfactorial_L_11
+.quad 0
+.quad 0x6
+.quad .Lfactorial_L_12
+.quad 0
+.quad 0x6
+.quad .Lfactorial_L_13
+.quad 0
+.quad 0x6
+.quad .Lfactorial_L_14
+.quad 0
+.quad 0x8
+.quad .Lfactorial_L_15
+.quad 0
+.quad 0x8
+.quad .Lfactorial_L_16
+.quad 0
+.quad 0x8
+.quad .Lfactorial_L_17
+.quad 0
+.quad 0x8
+.quad .Lfactorial_L_18
+.quad 0
+.quad 0x8
+.quad .Lfactorial_L_19
+.quad 0
+.quad 0x8
+.quad .Lmain_L_0
+.quad 0
+.quad 0x11
+.quad .Lmain_L_1
+.quad 0
+.quad 0x11
+.quad .Lmain_L_2
+.quad 0
+.quad 0x12
+.quad .Lmain_L_3
+.quad 0
+.quad 0x12
+.quad .Lmain_L_4
+.quad 0
+.quad 0x12
+.quad .Lmain_L_5
+.quad 0
+.quad 0x13
+.quad .Lmain_L_6
+.quad 0
+.quad 0x13
+.quad .Lmain_L_7
+.quad 0
+.quad 0x13
+.quad .Lmain_L_8
+.quad 0
+.quad 0x13
+.quad .Lmain_L_9
+.quad 0
+.quad 0x14
+.quad .Lmain_L_10
+.quad 0
+.quad 0x14
+.quad .Lmain_L_11
+.quad 0
+.quad 0x14
+.quad .Lmain_L_12
+.quad 0
+.quad 0x15
+.quad .Lmain_L_13
+.quad 0
+.quad 0x15
+.quad .Lmain_L_14
+.quad 0
+.quad 0x15
+.quad .Lmain_L_15
+.quad 0
+.quad 0x15
+.quad .Lmain_L_16
+.quad 0
+.quad 0x16
+.quad .Lmain_L_17
+.quad 0
+.quad 0x16
+.quad .Lmain_L_18
+.quad 0
+.quad 0x16
+.quad .Lmain_L_19
+.quad 0
+.quad 0x17
+.quad .Lmain_L_20
+.quad 0
+.quad 0x18
+.quad .Lmain_L_21
+.quad 0
+.quad 0x18
+.quad .Lmain_L_22
+.quad 0
+.quad 0x19
+.quad .Lmain_L_23
+.quad 0
+.quad 0x19
+.quad .Lmain_L_24
+.quad 0
+.quad 0x1a
+.quad .Lmain_L_25
+.quad 0
+.quad 0x1c
+.quad .Lmain_L_26
+.quad 0
+.quad 0x1d
+.quad .Lmain_L_27
+.quad 0
+.quad 0x1d
+.quad .Lmain_L_28
+.quad 0
+.quad 0x1e
+.quad .Lmain_L_29
+.quad 0
+.quad 0x1f
+.quad .Lmain_L_30
+.quad 0
+.quad 0x1f
+.quad .Lmain_L_31
+.quad 0
+.quad 0x20
+.quad .Lmain_L_32
+.quad 0
+.quad 0x21
+.quad .Lmain_L_33
+.quad 0
+.quad 0x21
+.quad .Lmain_L_34
+.quad 0
+.quad 0x22
+.quad .Lmain_L_35
+.quad 0
+.quad 0x23
+.quad .Lmain_L_36
+.quad 0
+.quad 0x23
+.quad .Lmain_L_37
+.quad 0
+.quad 0x24
+.quad .Lmain_L_38
+.quad 0
+.quad 0x25
+.quad .Lmain_L_39
+.quad 0
+.quad 0x25
+.quad .Lmain_L_40
+.quad 0
+.quad 0x26
+.quad .Lmain_L_41
+.quad 0
+.quad 0x27
+.quad .Lmain_L_42
+.quad 0
+.quad 0x27
+.quad .Lmain_L_43
+.quad 0
+.quad 0x28
+.quad .Lmain_L_44
+.quad 0
+.quad 0x29
+.quad .Lmain_L_45
+.quad 0
+.quad 0x29
+.quad .Lmain_L_46
+.quad 0
+.quad 0x2a
+.quad .Lmain_L_47
+.quad 0
+.quad 0x2b
+.quad .Lmain_L_48
+.quad 0
+.quad 0x2b
+.quad .Lmain_L_49
+.quad 0
+.quad 0x2d
+.quad .Lmain_L_50
+.quad 0
+.quad 0x2d
+.quad .Lmain_L_51
+.quad 0
+.quad 0x2e
+.quad .Lmain_L_52
+.quad 0
+.quad 0x2f
+.quad .Lmain_L_53
+.quad 0
+.quad 0x2f
+.quad .Lmain_L_54
+.quad 0
+.quad 0x30
+.quad .Lmain_L_55
+.quad 0
+.quad 0x30
+.quad .Lmain_L_56
+.quad 0
+.quad 0x31
+.quad .Lmain_L_57
+.quad 0
+.quad 0x31
+.quad .Lmain_L_58
+.quad 0
+.quad 0x33
+.quad .Lmain_L_59
+.quad 0
+.quad 0x33
+.quad .Lmain_L_60
+.quad 0
+.quad 0x34
+.quad .Lmain_L_61
+.quad 0
+.quad 0x34
+.quad .Lmain_L_62
+.quad 0
+.quad 0x35
+.quad .Lmain_L_63
+.quad 0
+.quad 0x36
+.quad .Lmain_L_64
+.quad 0
+.quad 0x36
+.quad .Lmain_L_65
+.quad 0
+.quad 0x37
+.quad .Lmain_L_66
+.quad 0
+.quad 0x37
+.quad .Lmain_L_67
+.quad 0
+.quad 0x38
+.quad .Lmain_L_68
+.quad 0
+.quad 0x38
+.quad .Lmain_L_69
+.quad 0
+.quad 0x3a
+.quad .Lmain_L_70
+.quad 0
+.quad 0x3a
+.quad .Lmain_L_71
+.quad 0
+.quad 0x3a
+.section .u_debug_str
+.quad 0xc
+.ascii "/root/repo/io/suite23.txt\0"
+.ascii "factorial\0"
+.ascii "n\0"
+.ascii "main\0"
+.ascii "a\0"
+.ascii "b\0"
+.ascii "c\0"
+.ascii "d\0"
+.ascii "e\0"
+.ascii "f\0"
+.ascii "g\0"
+.ascii "h\0"
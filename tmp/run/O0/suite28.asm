@@ -0,0 +1,637 @@
+.section .data
+.L_lit_0: .ascii "build\0"
+.L_lit_1: .ascii "fun\0"
+.L_class_init_0_name_0: .ascii "build\0"
+.L_class_init_0_name_1: .ascii "fun\0"
+.L_class_init_0_symbols: 
+.quad 0x2
+.quad .L_class_init_0_name_0
+.quad .L_class_init_0_name_1
+.L_class_init_1_name_0: .ascii "fun\0"
+.L_class_init_1_symbols: 
+.quad 0x1
+.quad .L_class_init_1_name_0
+.L_class_init_2_name_0: .ascii "fun\0"
+.L_class_init_2_symbols: 
+.quad 0x1
+.quad .L_class_init_2_name_0
+.L_class_init_3_name_0: .ascii "fun\0"
+.L_class_init_3_symbols: 
+.quad 0x1
+.quad .L_class_init_3_name_0
+.L_class_init_4_symbols: 
+.quad 0
+.L_lit_2: .ascii "a<T>, fun\0"
+.L_lit_3: .ascii "a<T>, fun\0"
+.L_lit_4: .ascii "a, fun\0"
+.section .text
+.extern __x86_64_flush
+.extern __x86_64_make_void
+.extern __x86_64_make_bool
+.extern __x86_64_make_byte
+.extern __x86_64_make_int
+.extern __x86_64_make_uint
+.extern __x86_64_make_long
+.extern __x86_64_make_ulong
+.extern __x86_64_make_char
+.extern __x86_64_make_string
+.extern __x86_64_make_callable
+.extern __x86_64_make_array
+.extern __x86_64_make_array_frame
+.extern __x86_64_make_object
+.extern __x86_64_make_object_setup
+.extern __x86_64_make_object_setup_frame
+.extern __x86_64_make_error
+.extern __x86_64_print
+.extern __x86_64_unwrap_void
+.extern __x86_64_unwrap_bool
+.extern __x86_64_unwrap_byte
+.extern __x86_64_unwrap_int
+.extern __x86_64_unwrap_uint
+.extern __x86_64_unwrap_long
+.extern __x86_64_unwrap_ulong
+.extern __x86_64_unwrap_char
+.extern __x86_64_unwrap_string
+.extern std_write
+.extern std_read_bool
+.extern std_read_byte
+.extern std_read_char
+.extern std_read_int
+.extern std_read_uint
+.extern std_read_long
+.extern std_read_ulong
+.extern std_read_string
+.extern std_write_bool
+.extern std_write_byte
+.extern std_write_char
+.extern std_write_int
+.extern std_write_uint
+.extern std_write_long
+.extern std_write_ulong
+.extern std_write_string
+.extern std_test_first
+.extern std_test_args
+.extern std_abs
+.globl main
+main:
+.Lmain_S:
+  pushq %rbp
+  movq %rsp, %rbp
+.Lmain_init:
+  subq $0x150, %rsp
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x30(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x90(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xa8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xc0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xd8(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0xf0(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x108(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x120(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x138(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x150(%rbp), %rdi
+  call __x86_64_make_void
+.Lmain_bb0:
+.Lmain_L_0:
+  leaq -0x90(%rbp), %rdi
+  xorq %rsi, %rsi
+  call .L_class_init_0
+.Lmain_L_1:
+  leaq -0x90(%rbp), %rsi
+  leaq -0x48(%rbp), %rdi
+  movq -0x40(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_2:
+  leaq -0xa8(%rbp), %rdi
+  leaq -0x48(%rbp), %rsi
+  leaq .L_lit_0(%rip), %rdx
+  movq -0x40(%rbp), %rax
+  movq 0xd0(%rax), %rax
+  call *%rax
+.Lmain_L_3:
+  leaq -0xa8(%rbp), %rdi
+  movq -0xa0(%rbp), %rax
+  movq 0xe8(%rax), %rax
+  call *%rax
+  pushq %rax
+  subq $0x8, %rsp
+  leaq -0x48(%rbp), %rsi
+  leaq -0xc0(%rbp), %rdi
+  movq 0x8(%rsp), %rax
+  call *%rax
+  addq $0x10, %rsp
+.Lmain_L_4:
+  leaq -0xc0(%rbp), %rsi
+  leaq -0x30(%rbp), %rdi
+  movq -0x28(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_L_5:
+  leaq -0xd8(%rbp), %rdi
+  leaq -0x30(%rbp), %rsi
+  movq -0x28(%rbp), %rax
+  movq 0x118(%rax), %rax
+  call *%rax
+.Lmain_L_6:
+  leaq -0xd8(%rbp), %rdi
+  call __x86_64_print
+.Lmain_L_7:
+  leaq -0x108(%rbp), %rdi
+  leaq -0x30(%rbp), %rsi
+  leaq .L_lit_1(%rip), %rdx
+  movq -0x28(%rbp), %rax
+  movq 0xd0(%rax), %rax
+  call *%rax
+.Lmain_L_8:
+  leaq -0x108(%rbp), %rdi
+  movq -0x100(%rbp), %rax
+  movq 0xe8(%rax), %rax
+  call *%rax
+  pushq %rax
+  subq $0x8, %rsp
+  leaq -0x30(%rbp), %rsi
+  leaq -0x120(%rbp), %rdi
+  movq 0x8(%rsp), %rax
+  call *%rax
+  addq $0x10, %rsp
+.Lmain_L_9:
+  leaq -0x138(%rbp), %rdi
+  movq $0, %rsi
+  call __x86_64_make_long
+.Lmain_L_10:
+  leaq -0x150(%rbp), %rdi
+  leaq -0x138(%rbp), %rsi
+  movl $0x6, %edx
+  movq -0x130(%rbp), %rax
+  movq 0x108(%rax), %rax
+  call *%rax
+.Lmain_L_11:
+  leaq -0x150(%rbp), %rsi
+  leaq -0x18(%rbp), %rdi
+  movq -0x10(%rbp), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.Lmain_deinit:
+  movq -0x28(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x30(%rbp), %rdi
+  call *%rax
+  movq -0x40(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x48(%rbp), %rdi
+  call *%rax
+  movq -0x58(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x60(%rbp), %rdi
+  call *%rax
+  movq -0x70(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x78(%rbp), %rdi
+  call *%rax
+  movq -0x88(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x90(%rbp), %rdi
+  call *%rax
+  movq -0xa0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xa8(%rbp), %rdi
+  call *%rax
+  movq -0xb8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xc0(%rbp), %rdi
+  call *%rax
+  movq -0xd0(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xd8(%rbp), %rdi
+  call *%rax
+  movq -0xe8(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0xf0(%rbp), %rdi
+  call *%rax
+  movq -0x100(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x108(%rbp), %rdi
+  call *%rax
+  movq -0x118(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x120(%rbp), %rdi
+  call *%rax
+  movq -0x130(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x138(%rbp), %rdi
+  call *%rax
+  movq -0x148(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x150(%rbp), %rdi
+  call *%rax
+.Lmain_epilogue:
+  call __x86_64_flush
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movl %eax, %edi
+  movq $0x3c, %rax
+  syscall
+.Lmain_E:
+.L_class_init_0:
+  pushq %rdi
+  pushq %rsi
+  subq $0x38, %rsp
+  leaq 0(%rsp), %rdi
+  leaq .L_method_0(%rip), %rsi
+  call __x86_64_make_callable
+  leaq 0x18(%rsp), %rdi
+  leaq .L_method_1(%rip), %rsi
+  call __x86_64_make_callable
+  movq 0x40(%rsp), %rdi
+  movq 0x38(%rsp), %rcx
+  leaq .L_class_init_0_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x48, %rsp
+  retq
+.L_class_init_1:
+  pushq %rdi
+  pushq %rsi
+  subq $0x18, %rsp
+  leaq 0(%rsp), %rdi
+  leaq .L_method_2(%rip), %rsi
+  call __x86_64_make_callable
+  movq 0x20(%rsp), %rdi
+  movq 0x18(%rsp), %rcx
+  leaq .L_class_init_1_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x28, %rsp
+  retq
+.L_class_init_2:
+  pushq %rdi
+  pushq %rsi
+  subq $0x18, %rsp
+  leaq 0(%rsp), %rdi
+  leaq .L_method_1(%rip), %rsi
+  call __x86_64_make_callable
+  movq 0x20(%rsp), %rdi
+  movq 0x18(%rsp), %rcx
+  leaq .L_class_init_2_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x28, %rsp
+  retq
+.L_class_init_3:
+  pushq %rdi
+  pushq %rsi
+  subq $0x18, %rsp
+  leaq 0(%rsp), %rdi
+  leaq .L_method_3(%rip), %rsi
+  call __x86_64_make_callable
+  movq 0x20(%rsp), %rdi
+  movq 0x18(%rsp), %rcx
+  leaq .L_class_init_3_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x28, %rsp
+  retq
+.L_class_init_4:
+  pushq %rdi
+  pushq %rsi
+  subq $0x8, %rsp
+  movq 0x10(%rsp), %rdi
+  movq 0x8(%rsp), %rcx
+  leaq .L_class_init_4_symbols(%rip), %rsi
+  leaq 0(%rsp), %rdx
+  call __x86_64_make_object_setup_frame
+  addq $0x18, %rsp
+  retq
+.L_method_0:
+.L_method_0_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+.L_method_0_copy:
+  subq $0x10, %rsp
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.L_method_0_init:
+  subq $0x20, %rsp
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_make_void
+.L_method_0_bb0:
+.L_method_0_L_0:
+  leaq -0x38(%rbp), %rdi
+  xorq %rsi, %rsi
+  call .L_class_init_1
+.L_method_0_L_1:
+  leaq -0x38(%rbp), %rsi
+  movq -0x8(%rbp), %rdi
+  movq -0x8(%rbp), %rax
+  movq 0x8(%rax), %rax
+  movq 0xf0(%rax), %rax
+  call *%rax
+.L_method_0_deinit:
+  movq -0x30(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x38(%rbp), %rdi
+  call *%rax
+.L_method_0_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.L_method_0_E:
+.L_method_1:
+.L_method_1_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+.L_method_1_copy:
+  subq $0x10, %rsp
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.L_method_1_init:
+  subq $0x50, %rsp
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x50(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x68(%rbp), %rdi
+  call __x86_64_make_void
+.L_method_1_bb0:
+.L_method_1_L_0:
+  leaq -0x38(%rbp), %rdi
+  leaq .L_lit_2(%rip), %rsi
+  call __x86_64_make_string
+.L_method_1_L_1:
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_print
+.L_method_1_L_2:
+  leaq -0x20(%rbp), %rdi
+  call __x86_64_print
+.L_method_1_deinit:
+  movq -0x30(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x38(%rbp), %rdi
+  call *%rax
+  movq -0x48(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x50(%rbp), %rdi
+  call *%rax
+  movq -0x60(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x68(%rbp), %rdi
+  call *%rax
+.L_method_1_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.L_method_1_E:
+.L_method_2:
+.L_method_2_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+.L_method_2_copy:
+  subq $0x10, %rsp
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.L_method_2_init:
+  subq $0x50, %rsp
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x50(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x68(%rbp), %rdi
+  call __x86_64_make_void
+.L_method_2_bb0:
+.L_method_2_L_0:
+  leaq -0x38(%rbp), %rdi
+  leaq .L_lit_3(%rip), %rsi
+  call __x86_64_make_string
+.L_method_2_L_1:
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_print
+.L_method_2_L_2:
+  leaq -0x20(%rbp), %rdi
+  call __x86_64_print
+.L_method_2_deinit:
+  movq -0x30(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x38(%rbp), %rdi
+  call *%rax
+  movq -0x48(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x50(%rbp), %rdi
+  call *%rax
+  movq -0x60(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x68(%rbp), %rdi
+  call *%rax
+.L_method_2_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.L_method_2_E:
+.L_method_3:
+.L_method_3_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+.L_method_3_copy:
+  subq $0x10, %rsp
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.L_method_3_init:
+  subq $0x50, %rsp
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x50(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x68(%rbp), %rdi
+  call __x86_64_make_void
+.L_method_3_bb0:
+.L_method_3_L_0:
+  leaq -0x38(%rbp), %rdi
+  leaq .L_lit_4(%rip), %rsi
+  call __x86_64_make_string
+.L_method_3_L_1:
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_print
+.L_method_3_L_2:
+  leaq -0x20(%rbp), %rdi
+  call __x86_64_print
+.L_method_3_deinit:
+  movq -0x30(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x38(%rbp), %rdi
+  call *%rax
+  movq -0x48(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x50(%rbp), %rdi
+  call *%rax
+  movq -0x60(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x68(%rbp), %rdi
+  call *%rax
+.L_method_3_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.L_method_3_E:
+.section .u_debug_info
+.quad 0x5
+.quad 0x1
+.quad .Lmain_S
+.quad .Lmain_E
+.quad 0x1
+.quad 0
+.quad 0x4
+.quad 0xffffffffffffffd0
+.quad 0x2
+.quad 0xffffffffffffffb8
+.quad 0x3
+.quad 0xffffffffffffffa0
+.quad 0x4
+.quad 0xffffffffffffff88
+.quad 0x5
+.quad .L_method_0_S
+.quad .L_method_0_E
+.quad 0x6
+.quad 0x1
+.quad 0
+.quad 0xffffffffffffffe0
+.quad 0x7
+.quad .L_method_1_S
+.quad .L_method_1_E
+.quad 0x8
+.quad 0x1
+.quad 0
+.quad 0xffffffffffffffe0
+.quad 0x7
+.quad .L_method_2_S
+.quad .L_method_2_E
+.quad 0x8
+.quad 0x1
+.quad 0
+.quad 0xffffffffffffffe0
+.quad 0x7
+.quad .L_method_3_S
+.quad .L_method_3_E
+.quad 0x8
+.quad 0x1
+.quad 0
+.quad 0xffffffffffffffe0
+.quad 0x7
+.quad 0
+.section .u_debug_line
+.quad 0x17
+.quad .Lmain_L_0
+.quad 0
+.quad 0x2a
+.quad .Lmain_L_1
+.quad 0
+.quad 0x2a
+.quad .Lmain_L_2
+.quad 0
+.quad 0x2b
+.quad .Lmain_L_3
+.quad 0
+.quad 0x2b
+.quad .Lmain_L_4
+.quad 0
+.quad 0x2b
+.quad .Lmain_L_5
+.quad 0
+.quad 0x2d
+.quad .Lmain_L_6
+.quad 0
+.quad 0x2d
+.quad .Lmain_L_7
+.quad 0
+.quad 0x2e
+.quad .Lmain_L_8
+.quad 0
+.quad 0x2e
+.quad .Lmain_L_9
+.quad 0
+.quad 0x30
+.quad .Lmain_L_10
+.quad 0
+.quad 0x30
+.quad .Lmain_L_11
+.quad 0
+.quad 0x30
+.quad .L_method_0_L_0
+.quad 0
+.quad 0x22
+.quad .L_method_0_L_1
+.quad 0
+.quad 0x22
+.quad .L_method_1_L_0
+.quad 0
+.quad 0x17
+.quad .L_method_1_L_1
+.quad 0
+.quad 0x17
+.quad .L_method_1_L_2
+.quad 0
+.quad 0x18
+.quad .L_method_2_L_0
+.quad 0
+.quad 0x17
+.quad .L_method_2_L_1
+.quad 0
+.quad 0x17
+.quad .L_method_2_L_2
+.quad 0
+.quad 0x18
+.quad .L_method_3_L_0
+.quad 0
+.quad 0x7
+.quad .L_method_3_L_1
+.quad 0
+.quad 0x7
+.quad .L_method_3_L_2
+.quad 0
+.quad 0x8
+.section .u_debug_str
+.quad 0x9
+.ascii "/root/repo/io/suite28.txt\0"
+.ascii "main\0"
+.ascii "a\0"
+.ascii "b\0"
+.ascii "c\0"
+.ascii "d\0"
+.ascii "build\0"
+.ascii "this\0"
+.ascii "fun\0"
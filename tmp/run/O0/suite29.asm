@@ -0,0 +1,186 @@
+.section .data
+.section .text
+.extern __x86_64_flush
+.extern __x86_64_make_void
+.extern __x86_64_make_bool
+.extern __x86_64_make_byte
+.extern __x86_64_make_int
+.extern __x86_64_make_uint
+.extern __x86_64_make_long
+.extern __x86_64_make_ulong
+.extern __x86_64_make_char
+.extern __x86_64_make_string
+.extern __x86_64_make_callable
+.extern __x86_64_make_array
+.extern __x86_64_make_array_frame
+.extern __x86_64_make_object
+.extern __x86_64_make_object_setup
+.extern __x86_64_make_object_setup_frame
+.extern __x86_64_make_error
+.extern __x86_64_print
+.extern __x86_64_unwrap_void
+.extern __x86_64_unwrap_bool
+.extern __x86_64_unwrap_byte
+.extern __x86_64_unwrap_int
+.extern __x86_64_unwrap_uint
+.extern __x86_64_unwrap_long
+.extern __x86_64_unwrap_ulong
+.extern __x86_64_unwrap_char
+.extern __x86_64_unwrap_string
+.extern std_write
+.extern std_read_bool
+.extern std_read_byte
+.extern std_read_char
+.extern std_read_int
+.extern std_read_uint
+.extern std_read_long
+.extern std_read_ulong
+.extern std_read_string
+.extern std_write_bool
+.extern std_write_byte
+.extern std_write_char
+.extern std_write_int
+.extern std_write_uint
+.extern std_write_long
+.extern std_write_ulong
+.extern std_write_string
+.extern std_test_first
+.extern std_test_args
+.extern std_abs
+.globl fun
+.globl main
+fun:
+.Lfun_S:
+  pushq %rbp
+  movq %rsp, %rbp
+  pushq %rdi
+  pushq %rsi
+  pushq %rdx
+.Lfun_copy:
+  subq $0x28, %rsp
+  leaq -0x38(%rbp), %rdi
+  movq -0x18(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+  leaq -0x20(%rbp), %rdi
+  movq -0x10(%rbp), %rsi
+  movq 0x8(%rsi), %rax
+  movq 0x100(%rax), %rax
+  call *%rax
+.Lfun_init:
+  subq $0x20, %rsp
+  leaq -0x58(%rbp), %rdi
+  call __x86_64_make_void
+.Lfun_bb0:
+.Lfun_L_0:
+  leaq -0x20(%rbp), %rdi
+  call __x86_64_print
+  leaq -0x38(%rbp), %rdi
+  call __x86_64_print
+.Lfun_deinit:
+  movq -0x50(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x58(%rbp), %rdi
+  call *%rax
+.Lfun_epilogue:
+  movq %rbp, %rsp
+  popq %rbp
+  retq
+.Lfun_E:
+main:
+.Lmain_S:
+  pushq %rbp
+  movq %rsp, %rbp
+.Lmain_init:
+  subq $0x90, %rsp
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x30(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x48(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x60(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x78(%rbp), %rdi
+  call __x86_64_make_void
+  leaq -0x90(%rbp), %rdi
+  call __x86_64_make_void
+.Lmain_bb0:
+.Lmain_L_0:
+  leaq -0x48(%rbp), %rdx
+  leaq -0x30(%rbp), %rsi
+  leaq -0x90(%rbp), %rdi
+  call fun
+.Lmain_deinit:
+  movq -0x28(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x30(%rbp), %rdi
+  call *%rax
+  movq -0x40(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x48(%rbp), %rdi
+  call *%rax
+  movq -0x58(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x60(%rbp), %rdi
+  call *%rax
+  movq -0x70(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x78(%rbp), %rdi
+  call *%rax
+  movq -0x88(%rbp), %rax
+  movq 0xf8(%rax), %rax
+  leaq -0x90(%rbp), %rdi
+  call *%rax
+.Lmain_epilogue:
+  call __x86_64_flush
+  leaq -0x18(%rbp), %rdi
+  call __x86_64_unwrap_int
+  movl %eax, %edi
+  movq $0x3c, %rax
+  syscall
+.Lmain_E:
+.section .u_debug_info
+.quad 0x2
+.quad 0x1
+.quad .Lfun_S
+.quad .Lfun_E
+.quad 0x1
+.quad 0x2
+.quad 0
+.quad 0xffffffffffffffe0
+.quad 0x2
+.quad 0xffffffffffffffc8
+.quad 0x3
+.quad .Lmain_S
+.quad .Lmain_E
+.quad 0x4
+.quad 0
+.quad 0x4
+.quad 0xffffffffffffffd0
+.quad 0x2
+.quad 0xffffffffffffffb8
+.quad 0x3
+.quad 0xffffffffffffffa0
+.quad 0x5
+.quad 0xffffffffffffff88
+.quad 0x6
+.quad 0
+.section .u_debug_line
+.quad 0x2
+.quad .Lfun_L_0
+.quad 0
+.quad 0x4
+.quad .Lmain_L_0
+.quad 0
+.quad 0xb
+.section .u_debug_str
+.quad 0x7
+.ascii "/root/repo/io/suite29.txt\0"
+.ascii "fun\0"
+.ascii "a\0"
+.ascii "b\0"
+.ascii "main\0"
+.ascii "c\0"
+.ascii "d\0"